@@ -56,6 +56,7 @@
 
 #include <boost/numeric/conversion/cast.hpp>
 
+#include <algorithm>
 #include <iostream>
 #include <limits>
 #include <vector>
@@ -78,6 +79,7 @@ using namespace openstudio;
 using namespace openstudio::model;
 
 const char* InspectorGadget::s_indexSlotName = "indexSlot";
+const size_t InspectorGadget::s_maxPooledForms = 16;
 //const char* FIELDS_MATCH = "fields match";
 
 struct ModelEditorLibResourceInitializer
@@ -88,6 +90,29 @@ struct ModelEditorLibResourceInitializer
 };
 static ModelEditorLibResourceInitializer modelEditorLibResourceInitializer_;
 
+namespace {
+
+// Strip off prefix of `! `
+std::string cleanUpComment(std::string comment) {
+  if (!comment.empty()) {
+    if (auto i = comment.find('!'); i != std::string::npos) {
+      comment.erase(0, i + 1);
+    }
+  }
+  return comment;
+}
+
+// the children that layoutItems gives an InspectorGadget of their own
+std::vector<ModelObject> childrenToLayout(const WorkspaceObject& workspaceObj, bool hideChildren) {
+  OptionalParentObject p = workspaceObj.optionalCast<ParentObject>();
+  if (p && (!hideChildren)) {
+    return p->children();
+  }
+  return {};
+}
+
+}  // namespace
+
 IGWidget::IGWidget(QWidget* parent) : QWidget(parent) {
   setSizePolicy(QSizePolicy::Minimum, QSizePolicy::Preferred);
 }
@@ -197,22 +222,19 @@ void InspectorGadget::layoutModelObj(openstudio::WorkspaceObject& workspaceObj,
         clear(recursive);
       }
     } else {
-      //we have a NEW object, the recursive flag is stupid because its a new object, nuke everything
-      clear(true);
+      //we have a NEW object, the recursive flag is stupid because its a new object, its children are new too.
+      //Keep the form though, the next object of this shape can be bound to it rather than building all the widgets again
+      stashForm();
     }
   }
 
   m_workspaceObj = workspaceObj;
+  updateNameIndex();
+  m_locked = locked;
 
-  m_objectHasName = workspaceObj.name().has_value();
-  if (m_objectHasName) {
-    IddField iddField = workspaceObj.iddObject().getField(0).get();
-    std::string fieldName = iddField.name();
-    if (istringEqual(fieldName, "Name")) {
-      m_nameIndex = 0;
-    } else {
-      m_nameIndex = 1;
-    }
+  if (!force && takePooledForm(hideChildren)) {
+    connectWorkspaceObjectSignals();
+    return;
   }
 
   m_deleteHandle = new IGWidget(this);
@@ -223,7 +245,17 @@ void InspectorGadget::layoutModelObj(openstudio::WorkspaceObject& workspaceObj,
   layout->setSpacing(0);
   layout->setContentsMargins(0, 0, 0, 0);
   m_deleteHandle->setLayout(layout);
-  m_locked = locked;
+
+  m_form = Form();
+  m_form.widget = m_deleteHandle;
+  m_form.type = workspaceObj.iddObject().type();
+  m_form.numFields = workspaceObj.numFields();
+  m_form.numNonextensibleFields = workspaceObj.numNonextensibleFields();
+  m_form.locked = m_locked;
+  m_form.hideChildren = hideChildren;
+  m_form.showComments = m_showComments;
+  m_form.showAllFields = m_showAllFields;
+  m_form.unitSystem = m_unitSystem;
   layoutItems(layout, m_deleteHandle, hideChildren);
 
   if (m_scroll) {
@@ -236,6 +268,19 @@ void InspectorGadget::layoutModelObj(openstudio::WorkspaceObject& workspaceObj,
   connectWorkspaceObjectSignals();
 }
 
+void InspectorGadget::updateNameIndex() {
+  m_objectHasName = m_workspaceObj->name().has_value();
+  if (m_objectHasName) {
+    IddField iddField = m_workspaceObj->iddObject().getField(0).get();
+    std::string fieldName = iddField.name();
+    if (istringEqual(fieldName, "Name")) {
+      m_nameIndex = 0;
+    } else {
+      m_nameIndex = 1;
+    }
+  }
+}
+
 void InspectorGadget::clear(bool recursive) {
   disconnectWorkspaceObjectSignals();
 
@@ -255,6 +300,7 @@ void InspectorGadget::clear(bool recursive) {
     // delete widgets before resetting m_workspaceObj so can handle editingFinished signals from any text boxes
     delete m_deleteHandle;
     m_deleteHandle = nullptr;
+    m_form = Form();
   }
 
   // This line is commented out to prevent a crash when displaying the Inspector Gadget
@@ -265,16 +311,6 @@ void InspectorGadget::clear(bool recursive) {
 void InspectorGadget::layoutItems(QVBoxLayout* masterLayout, QWidget* parent, bool hideChildren) {
   IddObject iddObj = m_workspaceObj->iddObject();
 
-  // Strip off prefix of `! `
-  auto cleanUpComment = [](std::string comment) -> std::string {
-    if (!comment.empty()) {
-      if (auto i = comment.find('!'); i != std::string::npos) {
-        comment.erase(0, i + 1);
-      }
-    }
-    return comment;
-  };
-
   std::string comment = cleanUpComment(m_workspaceObj->comment());
 
   auto* layout = new QVBoxLayout();
@@ -351,6 +387,7 @@ void InspectorGadget::layoutItems(QVBoxLayout* masterLayout, QWidget* parent, bo
       if (igChildItr != m_childMap.end()) {
         InspectorGadget* igchild = igChildItr->second;
         layout->addWidget(igchild);
+        m_form.childGadgets.push_back(igchild);
       } else {
         bool showComment = false;
         bool showFields = true;
@@ -363,6 +400,7 @@ void InspectorGadget::layoutItems(QVBoxLayout* masterLayout, QWidget* parent, bo
         igChild->setUnitSystem(m_unitSystem);
         layout->addWidget(igChild);
         m_childMap[elem] = igChild;
+        m_form.childGadgets.push_back(igChild);
       }
     }
   }  // if(p)
@@ -387,17 +425,7 @@ void InspectorGadget::parseItem(QVBoxLayout* layout, QWidget* parent, openstudio
     }
 
     case IddFieldType::RealType: {
-      // curVal is in SI and will be set to the default value if no value is set
-      std::string realVal = curVal;
-      if (!field.unitsBasedOnOtherField()) {
-        if (m_unitSystem == IP) {
-          OSOptionalQuantity q = m_workspaceObj->getQuantity(index, true, true);
-          if (q.isSet()) {
-            realVal = boost::lexical_cast<std::string>(q.get().value());
-          }
-        }
-      }
-      layoutText(layout, parent, field, level, name, realVal, index, comment, exists, true, true);
+      layoutText(layout, parent, field, level, name, displayedRealValue(field, curVal, index), index, comment, exists, true, true);
       break;
     }
 
@@ -430,6 +458,20 @@ void InspectorGadget::parseItem(QVBoxLayout* layout, QWidget* parent, openstudio
   }
 }
 
+std::string InspectorGadget::displayedRealValue(const openstudio::IddField& field, const std::string& curVal, int index) {
+  // curVal is in SI and will be set to the default value if no value is set
+  std::string realVal = curVal;
+  if (!field.unitsBasedOnOtherField()) {
+    if (m_unitSystem == IP) {
+      OSOptionalQuantity q = m_workspaceObj->getQuantity(index, true, true);
+      if (q.isSet()) {
+        realVal = boost::lexical_cast<std::string>(q.get().value());
+      }
+    }
+  }
+  return realVal;
+}
+
 void InspectorGadget::layoutText(QVBoxLayout* layout, QWidget* parent, openstudio::model::AccessPolicy::ACCESS_LEVEL level, const std::string& val,
                                  int index, const std::string& comment) {
   auto* frame = new QFrame(parent);
@@ -470,6 +512,9 @@ void InspectorGadget::layoutText(QVBoxLayout* layout, QWidget* parent, openstudi
   }
   hbox->addWidget(commentText);
   commentText->setObjectName("IDFHeaderComment");
+  if (index < 0) {
+    m_form.objectComment = commentText;
+  }
 
   layout->addWidget(frame);
 }
@@ -493,6 +538,13 @@ void InspectorGadget::layoutText(QVBoxLayout* layout, QWidget* parent, openstudi
   text->setProperty(s_indexSlotName, index);
   auto* commentText = new QLineEdit(QString(comment.c_str()), parent);
   commentText->setProperty(s_indexSlotName, index);
+
+  FieldWidgets fieldWidgets;
+  fieldWidgets.index = index;
+  fieldWidgets.exists = exists;
+  fieldWidgets.text = text;
+  fieldWidgets.comment = commentText;
+
   if (level == AccessPolicy::LOCKED) {
     text->setEnabled(false);
     commentText->setEnabled(false);
@@ -608,6 +660,8 @@ void InspectorGadget::layoutText(QVBoxLayout* layout, QWidget* parent, openstudi
       auto* hardSizedRadio = new QRadioButton(tr("Hard Sized"), parent);
       auto* autosizedRadio = new QRadioButton(tr("Autosized"), parent);
       autosizedRadio->setProperty(s_indexSlotName, index);
+      fieldWidgets.hardSizedRadio = hardSizedRadio;
+      fieldWidgets.autoRadio = autosizedRadio;
 
       if (level == AccessPolicy::LOCKED) {
         hardSizedRadio->setEnabled(false);
@@ -653,6 +707,8 @@ void InspectorGadget::layoutText(QVBoxLayout* layout, QWidget* parent, openstudi
       auto* hardSizedRadio = new QRadioButton(tr("Hard Sized"), parent);
       auto* autocalculatedRadio = new QRadioButton(tr("Autocalculate"), parent);
       autocalculatedRadio->setProperty(s_indexSlotName, index);
+      fieldWidgets.hardSizedRadio = hardSizedRadio;
+      fieldWidgets.autoRadio = autocalculatedRadio;
 
       if (level == AccessPolicy::LOCKED) {
         hardSizedRadio->setEnabled(false);
@@ -720,6 +776,7 @@ void InspectorGadget::layoutText(QVBoxLayout* layout, QWidget* parent, openstudi
     frame->setObjectName("IGRowDisabled");
   }
   layout->addWidget(frame);
+  m_form.fields.push_back(fieldWidgets);
 }
 
 void InspectorGadget::layoutComboBox(QVBoxLayout* layout, QWidget* parent, openstudio::IddField& field, openstudio::IddFieldProperties& prop,
@@ -732,35 +789,7 @@ void InspectorGadget::layoutComboBox(QVBoxLayout* layout, QWidget* parent, opens
 
   QComboBox* combo = new IGComboBox(parent);
   combo->setSizeAdjustPolicy(QComboBox::AdjustToContentsOnFirstShow);
-
-  if (!prop.objectLists.empty() && m_workspaceObj && !m_workspaceObj->handle().isNull()) {
-    Workspace workspace = m_workspaceObj->workspace();
-    std::vector<std::string> names;
-
-    for (const std::string& objectList : prop.objectLists) {
-      for (const WorkspaceObject& workspaceObject : workspace.getObjectsByReference(objectList)) {
-        names.push_back(workspaceObject.nameString());
-      }
-    }
-
-    std::sort(names.begin(), names.end(), IstringCompare());
-
-    if (!prop.required) {
-      combo->addItem("");
-    }
-
-    for (const std::string& thisName : names) {
-      combo->addItem(thisName.c_str());
-    }
-  } else {
-    if (!prop.required) {
-      combo->addItem("");
-    }
-
-    for (const IddKey& key : field.keys()) {
-      combo->addItem(key.name().c_str());
-    }
-  }
+  populateComboBox(combo, field, prop);
 
   int idx = combo->findText(curVal.c_str(), Qt::MatchFixedString);
 
@@ -805,6 +834,44 @@ void InspectorGadget::layoutComboBox(QVBoxLayout* layout, QWidget* parent, opens
     frame->setObjectName("IGRowDisabled");
   }
   layout->addWidget(frame);
+
+  FieldWidgets fieldWidgets;
+  fieldWidgets.index = index;
+  fieldWidgets.exists = exists;
+  fieldWidgets.combo = combo;
+  fieldWidgets.comment = commentText;
+  m_form.fields.push_back(fieldWidgets);
+}
+
+void InspectorGadget::populateComboBox(QComboBox* combo, const openstudio::IddField& field, const openstudio::IddFieldProperties& prop) {
+  if (!prop.objectLists.empty() && m_workspaceObj && !m_workspaceObj->handle().isNull()) {
+    Workspace workspace = m_workspaceObj->workspace();
+    std::vector<std::string> names;
+
+    for (const std::string& objectList : prop.objectLists) {
+      for (const WorkspaceObject& workspaceObject : workspace.getObjectsByReference(objectList)) {
+        names.push_back(workspaceObject.nameString());
+      }
+    }
+
+    std::sort(names.begin(), names.end(), IstringCompare());
+
+    if (!prop.required) {
+      combo->addItem("");
+    }
+
+    for (const std::string& thisName : names) {
+      combo->addItem(thisName.c_str());
+    }
+  } else {
+    if (!prop.required) {
+      combo->addItem("");
+    }
+
+    for (const IddKey& key : field.keys()) {
+      combo->addItem(key.name().c_str());
+    }
+  }
 }
 
 void InspectorGadget::createExtensibleToolBar(QVBoxLayout* layout,
@@ -1148,3 +1215,182 @@ void InspectorGadget::setUnitSystem(const InspectorGadget::UNIT_SYSTEM unitSyste
   m_unitSystem = unitSystem;
   rebuild(true);
 }
+
+void InspectorGadget::stashForm() {
+  m_childMap.clear();
+
+  if (!m_deleteHandle) {
+    return;
+  }
+
+  // taking the form out of view moves the focus out of it, so a pending edit still goes to the object it was made on
+  if (m_scroll) {
+    m_scroll->takeWidget();
+  } else {
+    m_layout->removeWidget(m_deleteHandle);
+  }
+  m_deleteHandle->setParent(this);
+  m_deleteHandle->hide();
+  disconnectChildSignals();
+
+  auto sameShape = [this](const Form& form) {
+    return form.type == m_form.type && form.numFields == m_form.numFields && form.numNonextensibleFields == m_form.numNonextensibleFields;
+  };
+  for (auto it = m_formPool.begin(); it != m_formPool.end();) {
+    if (sameShape(*it)) {
+      delete it->widget;
+      it = m_formPool.erase(it);
+    } else {
+      ++it;
+    }
+  }
+
+  m_formPool.push_back(m_form);
+  if (m_formPool.size() > s_maxPooledForms) {
+    delete m_formPool.front().widget;
+    m_formPool.erase(m_formPool.begin());
+  }
+
+  m_deleteHandle = nullptr;
+  m_form = Form();
+}
+
+bool InspectorGadget::takePooledForm(bool hideChildren) {
+  auto it = std::find_if(m_formPool.begin(), m_formPool.end(),
+                         [this, hideChildren](const Form& form) { return formMatches(form, *m_workspaceObj, hideChildren); });
+  if (it == m_formPool.end()) {
+    return false;
+  }
+
+  m_form = *it;
+  m_formPool.erase(it);
+  m_deleteHandle = m_form.widget;
+
+  bindForm(*m_workspaceObj, hideChildren);
+
+  if (m_scroll) {
+    m_scroll->setWidget(m_deleteHandle);
+  } else {
+    m_layout->addWidget(m_deleteHandle);
+  }
+  m_deleteHandle->show();
+
+  return true;
+}
+
+bool InspectorGadget::formMatches(const Form& form, const openstudio::WorkspaceObject& workspaceObj, bool hideChildren) const {
+  if (!form.widget || form.type != workspaceObj.iddObject().type() || form.numFields != workspaceObj.numFields()
+      || form.numNonextensibleFields != workspaceObj.numNonextensibleFields() || form.locked != m_locked || form.hideChildren != hideChildren
+      || form.showComments != m_showComments || form.showAllFields != m_showAllFields || form.unitSystem != m_unitSystem) {
+    return false;
+  }
+
+  std::vector<ModelObject> children = childrenToLayout(workspaceObj, hideChildren);
+  if (children.size() != form.childGadgets.size()) {
+    return false;
+  }
+  for (size_t i = 0; i < children.size(); ++i) {
+    InspectorGadget* igChild = form.childGadgets[i];
+    if (!igChild->formMatches(igChild->m_form, children[i], false)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+void InspectorGadget::bindForm(const openstudio::WorkspaceObject& workspaceObj, bool hideChildren) {
+  m_workspaceObj = workspaceObj;
+  updateNameIndex();
+
+  if (m_form.objectComment) {
+    m_form.objectComment->setText(QString::fromStdString(cleanUpComment(m_workspaceObj->comment())));
+  }
+
+  for (const FieldWidgets& fieldWidgets : m_form.fields) {
+    bindField(fieldWidgets);
+  }
+
+  m_childMap.clear();
+  std::vector<ModelObject> children = childrenToLayout(workspaceObj, hideChildren);
+  for (size_t i = 0; i < children.size(); ++i) {
+    InspectorGadget* igChild = m_form.childGadgets[i];
+    igChild->disconnectWorkspaceObjectSignals();
+    igChild->bindForm(children[i], false);
+    igChild->connectWorkspaceObjectSignals();
+    m_childMap[children[i]] = igChild;
+  }
+}
+
+void InspectorGadget::bindField(const FieldWidgets& fieldWidgets) {
+  IddField field = m_workspaceObj->iddObject().getField(fieldWidgets.index).get();
+  IddFieldProperties prop = field.properties();
+
+  std::string curVal;
+  std::string comment;
+  if (fieldWidgets.exists) {
+    curVal = *(m_workspaceObj->getString(fieldWidgets.index, true));
+    comment = cleanUpComment(*(m_workspaceObj->fieldComment(fieldWidgets.index, true)));
+  }
+
+  if (fieldWidgets.text) {
+    std::string val = curVal;
+    if (prop.type.value() == IddFieldType::RealType) {
+      val = displayedRealValue(field, curVal, fieldWidgets.index);
+    }
+    fieldWidgets.text->setText(QString::fromStdString(val));
+
+    if (fieldWidgets.autoRadio) {
+      std::string keyword = prop.autosizable ? "autosize" : "autocalculate";
+      bool isAuto = istringEqual(curVal, keyword);
+      if (curVal.empty() && prop.stringDefault && istringEqual(prop.stringDefault.get(), keyword)) {
+        isAuto = true;
+      }
+
+      // the radios write to the object when toggled, this is only showing its value
+      bool autoBlocked = fieldWidgets.autoRadio->blockSignals(true);
+      bool hardSizedBlocked = fieldWidgets.hardSizedRadio->blockSignals(true);
+      fieldWidgets.autoRadio->setChecked(isAuto);
+      fieldWidgets.hardSizedRadio->setChecked(!isAuto);
+      fieldWidgets.autoRadio->blockSignals(autoBlocked);
+      fieldWidgets.hardSizedRadio->blockSignals(hardSizedBlocked);
+
+      if (isAuto) {
+        fieldWidgets.text->setText("");
+      }
+      fieldWidgets.text->setEnabled(!isAuto);
+    }
+  }
+
+  if (fieldWidgets.combo) {
+    QComboBox* combo = fieldWidgets.combo;
+    bool blocked = combo->blockSignals(true);
+
+    // the objects an object list refers to may have changed since the form was built
+    if (!prop.objectLists.empty()) {
+      combo->clear();
+      populateComboBox(combo, field, prop);
+    }
+
+    disconnect(combo, static_cast<void (QComboBox::*)(const QString&)>(&QComboBox::currentTextChanged), this, &InspectorGadget::IGdefaultRemoved);
+    combo->setStyleSheet(QString());
+    int idx = combo->findText(curVal.c_str(), Qt::MatchFixedString);
+    if (-1 == idx) {
+      idx = 0;
+      connect(combo, static_cast<void (QComboBox::*)(const QString&)>(&QComboBox::currentTextChanged), this, &InspectorGadget::IGdefaultRemoved);
+    }
+    combo->setCurrentIndex(idx);
+
+    combo->blockSignals(blocked);
+  }
+
+  if (fieldWidgets.comment) {
+    fieldWidgets.comment->setText(QString::fromStdString(comment));
+  }
+}
+
+void InspectorGadget::disconnectChildSignals() const {
+  for (const InspectorGadget* igChild : m_form.childGadgets) {
+    igChild->disconnectWorkspaceObjectSignals();
+    igChild->disconnectChildSignals();
+  }
+}
@@ -41,6 +41,7 @@
 
 #include <openstudio/nano/nano_signal_slot.hpp>  // Signal-Slot replacement
 
+#include <openstudio/utilities/idd/IddEnums.hpp>
 #include <openstudio/utilities/idd/IddField.hpp>
 #include <openstudio/utilities/idf/Workspace.hpp>
 #include <openstudio/utilities/idf/Workspace_Impl.hpp>
@@ -48,15 +49,19 @@
 #include <openstudio/utilities/idf/WorkspaceObject_Impl.hpp>
 
 #include <string>
+#include <vector>
 
 class QDoubleSpinBox;
 class QErrorMessage;
+class QLineEdit;
 class QPushButton;
+class QRadioButton;
 class QScrollArea;
 class QSpinBox;
 class QVBoxLayout;
 
 class ComboHighlightBridge;
+class IGLineEdit;
 
 class MODELEDITOR_API IGWidget
   : public QWidget
@@ -86,8 +91,9 @@ class IGComboBox : public QComboBox
 /*! \brief InspectorGadget will take a ModelObejct (or WorkspaceObject) and display it attributes
  *
  * InsepctorGadget interrogates objects and displays their fields/attributes based on the values
- * contained in the AccessPolicyStore. When a new model is passed into the IG, it will delete all
- * its old QWidgets and create new ones.
+ * contained in the AccessPolicyStore. When a new model is passed into the IG, its old QWidgets are
+ * pooled by IddObjectType and shape, and a pooled form matching the new object is rebound to it;
+ * only otherwise are new QWidgets created.
  *
  * AccessPolicy::FREE Real and Integers get displayed as spinboxes
  * AccessPolicy::LOCKED Real and Integer and all Alpha get displayed as labels.
@@ -104,6 +110,7 @@ class MODELEDITOR_API InspectorGadget
  public:
   friend class IGLineEdit;
   friend class IGDSpinBox;
+  friend class ModelEditorFixture;
 
   enum UNIT_SYSTEM
   {
@@ -142,11 +149,13 @@ class MODELEDITOR_API InspectorGadget
    * function will create an IGChildFrame and that child calls layoutItems for
    * its frame.
    *
-   * Calling this method a 2nd time will delete everything that was previously built and
+   * Calling this method a 2nd time with the same workObj will delete everything that was previously built and
    * regenerate the QWidgets.
    *
    * Recursive only effects anything if you are sending in the same workObj, if you pick a different one, the
-   * children are ALWAYS deleted and rebuilt. (because they are different children!)
+   * children are ALWAYS replaced. (because they are different children!) The previous form is pooled, and if
+   * an earlier form has the same IddObjectType, number of fields and children as the new workObj, its widgets
+   * are rebound to the new values instead of being built again.
    *
    * If you are calling this from a place where the user should not be allowed to edit the fields, set the lock
    * parameter to true
@@ -326,7 +335,63 @@ class MODELEDITOR_API InspectorGadget
   void disconnectWorkspaceObjectSignals() const;
 
  private:
+  // the widgets of one field that show a value of the object
+  struct FieldWidgets
+  {
+    int index = -1;
+    bool exists = true;
+    IGLineEdit* text = nullptr;
+    QComboBox* combo = nullptr;
+    QLineEdit* comment = nullptr;
+    QRadioButton* hardSizedRadio = nullptr;
+    QRadioButton* autoRadio = nullptr;
+  };
+
+  // a laid out object, along with the shape it was laid out for
+  struct Form
+  {
+    QWidget* widget = nullptr;
+    openstudio::IddObjectType type = openstudio::IddObjectType::UserCustom;
+    unsigned numFields = 0;
+    unsigned numNonextensibleFields = 0;
+    bool locked = false;
+    bool hideChildren = false;
+    bool showComments = false;
+    bool showAllFields = false;
+    UNIT_SYSTEM unitSystem = IP;
+    QLineEdit* objectComment = nullptr;
+    std::vector<FieldWidgets> fields;
+    std::vector<InspectorGadget*> childGadgets;
+  };
+
   void connectSignalsAndSlots();
+
+  void updateNameIndex();
+
+  std::string displayedRealValue(const openstudio::IddField& field, const std::string& curVal, int index);
+
+  void populateComboBox(QComboBox* combo, const openstudio::IddField& field, const openstudio::IddFieldProperties& prop);
+
+  // moves the current form into m_formPool
+  void stashForm();
+
+  // binds a pooled form that matches m_workspaceObj, returns false if there is none
+  bool takePooledForm(bool hideChildren);
+
+  bool formMatches(const Form& form, const openstudio::WorkspaceObject& workspaceObj, bool hideChildren) const;
+
+  void bindForm(const openstudio::WorkspaceObject& workspaceObj, bool hideChildren);
+
+  void bindField(const FieldWidgets& fieldWidgets);
+
+  void disconnectChildSignals() const;
+
+  // the form currently in m_deleteHandle
+  Form m_form;
+  // forms of objects shown earlier, at most one per IddObjectType and number of fields
+  std::vector<Form> m_formPool;
+
+  static const size_t s_maxPooledForms;
 };
 
 #endif  // MODELEDITOR_INSPECTORGADGET_HPP
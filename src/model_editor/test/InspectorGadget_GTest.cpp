@@ -0,0 +1,254 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) 2020-2022, OpenStudio Coalition and other contributors. All rights reserved.
+*
+*  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the
+*  following conditions are met:
+*
+*  (1) Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+*  disclaimer.
+*
+*  (2) Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following
+*  disclaimer in the documentation and/or other materials provided with the distribution.
+*
+*  (3) Neither the name of the copyright holder nor the names of any contributors may be used to endorse or promote products
+*  derived from this software without specific prior written permission from the respective party.
+*
+*  (4) Other than as required in clauses (1) and (2), distributions in any form of modifications or other derivative works
+*  may not use the "OpenStudio" trademark, "OS", "os", or any other confusingly similar designation without specific prior
+*  written permission from Alliance for Sustainable Energy, LLC.
+*
+*  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDER(S) AND ANY CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+*  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+*  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER(S), ANY CONTRIBUTORS, THE UNITED STATES GOVERNMENT, OR THE UNITED
+*  STATES DEPARTMENT OF ENERGY, NOR ANY OF THEIR EMPLOYEES, BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+*  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF
+*  USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+*  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+*  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+***********************************************************************************************************************/
+
+#include <gtest/gtest.h>
+
+#include "ModelEditorFixture.hpp"
+
+#include "../IGLineEdit.hpp"
+#include "../InspectorGadget.hpp"
+
+#include <openstudio/model/Model.hpp>
+#include <openstudio/model/FanVariableVolume.hpp>
+#include <openstudio/model/FanVariableVolume_Impl.hpp>
+#include <openstudio/model/Lights.hpp>
+#include <openstudio/model/Lights_Impl.hpp>
+#include <openstudio/model/LightsDefinition.hpp>
+#include <openstudio/model/LightsDefinition_Impl.hpp>
+#include <openstudio/model/ScheduleCompact.hpp>
+#include <openstudio/model/ScheduleCompact_Impl.hpp>
+#include <openstudio/model/Space.hpp>
+#include <openstudio/model/Space_Impl.hpp>
+
+#include <openstudio/utilities/idd/OS_Fan_VariableVolume_FieldEnums.hxx>
+#include <openstudio/utilities/idd/OS_Lights_FieldEnums.hxx>
+#include <openstudio/utilities/idd/OS_Schedule_Compact_FieldEnums.hxx>
+#include <openstudio/utilities/idd/OS_Space_FieldEnums.hxx>
+
+#include <openstudio/utilities/idf/WorkspaceObjectWatcher.hpp>
+
+#include <QApplication>
+#include <QComboBox>
+#include <QPointer>
+#include <QRadioButton>
+
+#include <string>
+#include <vector>
+
+using namespace openstudio::model;
+using namespace openstudio;
+
+TEST_F(ModelEditorFixture, InspectorGadget_RebindSameShape) {
+  Model model;
+  FanVariableVolume fanA(model);
+  fanA.setName("Fan A");
+  fanA.setComment("Object comment A");
+  fanA.setPressureRise(250.0);
+  fanA.autosizeMaximumFlowRate();
+  EXPECT_TRUE(fanA.setFanPowerMinimumFlowRateInputMethod("Fraction"));
+  EXPECT_TRUE(fanA.setFieldComment(OS_Fan_VariableVolumeFields::PressureRise, "Pressure comment A"));
+
+  FanVariableVolume fanB(model);
+  fanB.setName("Fan B");
+  fanB.setComment("Object comment B");
+  fanB.setPressureRise(500.0);
+  fanB.setMaximumFlowRate(2.0);
+  EXPECT_TRUE(fanB.setFanPowerMinimumFlowRateInputMethod("FixedFlowRate"));
+  EXPECT_TRUE(fanB.setFieldComment(OS_Fan_VariableVolumeFields::PressureRise, "Pressure comment B"));
+
+  ASSERT_EQ(fanA.numFields(), fanB.numFields());
+
+  InspectorGadget gadget;
+  gadget.setUnitSystem(InspectorGadget::SI);
+  gadget.layoutModelObj(fanA);
+
+  QPointer<QWidget> formA = getFormWidget(&gadget);
+  ASSERT_TRUE(formA);
+
+  IGLineEdit* nameEdit = getLineEdit(&gadget, OS_Fan_VariableVolumeFields::Name);
+  IGLineEdit* pressureRiseEdit = getLineEdit(&gadget, OS_Fan_VariableVolumeFields::PressureRise);
+  IGLineEdit* maxFlowEdit = getLineEdit(&gadget, OS_Fan_VariableVolumeFields::MaximumFlowRate);
+  QComboBox* inputMethodCombo = getComboBox(&gadget, OS_Fan_VariableVolumeFields::FanPowerMinimumFlowRateInputMethod);
+  QLineEdit* pressureRiseComment = getCommentEdit(&gadget, OS_Fan_VariableVolumeFields::PressureRise);
+  QRadioButton* hardSizedRadio = getHardSizedRadio(&gadget, OS_Fan_VariableVolumeFields::MaximumFlowRate);
+  QRadioButton* autosizedRadio = getAutoRadio(&gadget, OS_Fan_VariableVolumeFields::MaximumFlowRate);
+  QLineEdit* objectComment = getObjectCommentEdit(&gadget);
+  ASSERT_TRUE(nameEdit);
+  ASSERT_TRUE(pressureRiseEdit);
+  ASSERT_TRUE(maxFlowEdit);
+  ASSERT_TRUE(inputMethodCombo);
+  ASSERT_TRUE(pressureRiseComment);
+  ASSERT_TRUE(hardSizedRadio);
+  ASSERT_TRUE(autosizedRadio);
+  ASSERT_TRUE(objectComment);
+
+  EXPECT_EQ("Fan A", nameEdit->text().toStdString());
+  EXPECT_DOUBLE_EQ(250.0, pressureRiseEdit->text().toDouble());
+  EXPECT_TRUE(autosizedRadio->isChecked());
+  EXPECT_FALSE(maxFlowEdit->isEnabled());
+  EXPECT_EQ(0, inputMethodCombo->currentText().compare("Fraction", Qt::CaseInsensitive));
+
+  WorkspaceObjectWatcher watcherA(fanA);
+  WorkspaceObjectWatcher watcherB(fanB);
+
+  gadget.layoutModelObj(fanB);
+
+  // B has the same shape as A, so A's widgets are rebound to it rather than built again
+  EXPECT_EQ(formA.data(), getFormWidget(&gadget));
+  EXPECT_EQ(nameEdit, getLineEdit(&gadget, OS_Fan_VariableVolumeFields::Name));
+  EXPECT_EQ(inputMethodCombo, getComboBox(&gadget, OS_Fan_VariableVolumeFields::FanPowerMinimumFlowRateInputMethod));
+
+  EXPECT_EQ("Fan B", nameEdit->text().toStdString());
+  EXPECT_DOUBLE_EQ(500.0, pressureRiseEdit->text().toDouble());
+  EXPECT_TRUE(hardSizedRadio->isChecked());
+  EXPECT_FALSE(autosizedRadio->isChecked());
+  EXPECT_TRUE(maxFlowEdit->isEnabled());
+  EXPECT_DOUBLE_EQ(2.0, maxFlowEdit->text().toDouble());
+  EXPECT_EQ(0, inputMethodCombo->currentText().compare("FixedFlowRate", Qt::CaseInsensitive));
+  EXPECT_TRUE(pressureRiseComment->text().contains("Pressure comment B"));
+  EXPECT_TRUE(objectComment->text().contains("Object comment B"));
+
+  // showing B's values does not write to either object
+  processEvents();
+  EXPECT_FALSE(watcherA.dirty());
+  EXPECT_FALSE(watcherB.dirty());
+  EXPECT_EQ("Fan A", fanA.nameString());
+  EXPECT_TRUE(fanA.isMaximumFlowRateAutosized());
+  EXPECT_EQ("Fan B", fanB.nameString());
+  EXPECT_FALSE(fanB.isMaximumFlowRateAutosized());
+
+  // and back again
+  gadget.layoutModelObj(fanA);
+  EXPECT_EQ(formA.data(), getFormWidget(&gadget));
+  EXPECT_EQ("Fan A", nameEdit->text().toStdString());
+  EXPECT_TRUE(autosizedRadio->isChecked());
+  EXPECT_FALSE(maxFlowEdit->isEnabled());
+  EXPECT_EQ(0, inputMethodCombo->currentText().compare("Fraction", Qt::CaseInsensitive));
+  EXPECT_TRUE(pressureRiseComment->text().contains("Pressure comment A"));
+  EXPECT_TRUE(objectComment->text().contains("Object comment A"));
+
+  processEvents();
+  EXPECT_FALSE(watcherA.dirty());
+  EXPECT_FALSE(watcherB.dirty());
+}
+
+TEST_F(ModelEditorFixture, InspectorGadget_PendingEditGoesToPreviousObject) {
+  Model model;
+  FanVariableVolume fanA(model);
+  fanA.setName("Fan A");
+  FanVariableVolume fanB(model);
+  fanB.setName("Fan B");
+
+  InspectorGadget gadget;
+  gadget.layoutModelObj(fanA);
+
+  IGLineEdit* nameEdit = getLineEdit(&gadget, OS_Fan_VariableVolumeFields::Name);
+  ASSERT_TRUE(nameEdit);
+
+  gadget.show();
+  gadget.activateWindow();
+  processEvents();
+  nameEdit->setFocus();
+  processEvents();
+  ASSERT_EQ(nameEdit, QApplication::focusWidget());
+
+  // the user is typing in A's name when B gets selected
+  nameEdit->selectAll();
+  nameEdit->insert("Renamed A");
+  gadget.layoutModelObj(fanB);
+  processEvents();
+
+  EXPECT_EQ("Renamed A", fanA.nameString());
+  EXPECT_EQ("Fan B", fanB.nameString());
+
+  ASSERT_EQ(nameEdit, getLineEdit(&gadget, OS_Fan_VariableVolumeFields::Name));
+  EXPECT_EQ("Fan B", nameEdit->text().toStdString());
+}
+
+TEST_F(ModelEditorFixture, InspectorGadget_RebuildOtherShape) {
+  Model model;
+  ScheduleCompact compactA(model);
+  compactA.setName("Compact A");
+  ScheduleCompact compactB(model);
+  compactB.setName("Compact B");
+  compactB.pushExtensibleGroup(std::vector<std::string>{"Through: 12/31"});
+  ASSERT_NE(compactA.numFields(), compactB.numFields());
+
+  InspectorGadget gadget;
+  gadget.layoutModelObj(compactA);
+  QPointer<QWidget> formA = getFormWidget(&gadget);
+  ASSERT_TRUE(formA);
+
+  // another number of extensible groups needs other widgets
+  gadget.layoutModelObj(compactB);
+  ASSERT_TRUE(getFormWidget(&gadget));
+  EXPECT_NE(formA.data(), getFormWidget(&gadget));
+  IGLineEdit* nameEdit = getLineEdit(&gadget, OS_Schedule_CompactFields::Name);
+  ASSERT_TRUE(nameEdit);
+  EXPECT_EQ("Compact B", nameEdit->text().toStdString());
+
+  // objects with children of the same shape are rebound, child gadgets included
+  LightsDefinition definition(model);
+  Space spaceA(model);
+  spaceA.setName("Space A");
+  Lights lightsA(definition);
+  lightsA.setName("Lights A");
+  EXPECT_TRUE(lightsA.setSpace(spaceA));
+  Space spaceB(model);
+  spaceB.setName("Space B");
+  Lights lightsB(definition);
+  lightsB.setName("Lights B");
+  EXPECT_TRUE(lightsB.setSpace(spaceB));
+  Space spaceC(model);
+  spaceC.setName("Space C");
+
+  gadget.layoutModelObj(spaceA);
+  QPointer<QWidget> formSpaceA = getFormWidget(&gadget);
+  std::vector<InspectorGadget*> childGadgets = getChildGadgets(&gadget);
+  ASSERT_EQ(spaceA.children().size(), childGadgets.size());
+
+  gadget.layoutModelObj(spaceB);
+  EXPECT_EQ(formSpaceA.data(), getFormWidget(&gadget));
+  EXPECT_EQ(childGadgets, getChildGadgets(&gadget));
+  for (InspectorGadget* childGadget : childGadgets) {
+    if (IGLineEdit* lightsNameEdit = getLineEdit(childGadget, OS_LightsFields::Name)) {
+      EXPECT_EQ("Lights B", lightsNameEdit->text().toStdString());
+    }
+  }
+
+  // a different number of children falls back to a rebuild
+  ASSERT_NE(spaceB.children().size(), spaceC.children().size());
+  gadget.layoutModelObj(spaceC);
+  ASSERT_TRUE(getFormWidget(&gadget));
+  EXPECT_NE(formSpaceA.data(), getFormWidget(&gadget));
+  EXPECT_EQ(spaceC.children().size(), getChildGadgets(&gadget).size());
+  nameEdit = getLineEdit(&gadget, OS_SpaceFields::Name);
+  ASSERT_TRUE(nameEdit);
+  EXPECT_EQ("Space C", nameEdit->text().toStdString());
+}
@@ -30,6 +30,8 @@
 #include "ModelEditorFixture.hpp"
 
 #include "../../model_editor/Application.hpp"
+#include "../../model_editor/IGLineEdit.hpp"
+#include "../../model_editor/InspectorGadget.hpp"
 
 #include <openstudio/utilities/core/Path.hpp>
 
@@ -48,5 +50,66 @@ void ModelEditorFixture::SetUpTestCase() {
 
 void ModelEditorFixture::TearDownTestCase() {}
 
+void ModelEditorFixture::processEvents() {
+  openstudio::Application::instance().application(true)->processEvents();
+}
+
+QWidget* ModelEditorFixture::getFormWidget(InspectorGadget* ig) {
+  return ig->m_form.widget;
+}
+
+QLineEdit* ModelEditorFixture::getObjectCommentEdit(InspectorGadget* ig) {
+  return ig->m_form.objectComment;
+}
+
+IGLineEdit* ModelEditorFixture::getLineEdit(InspectorGadget* ig, int index) {
+  for (const auto& fieldWidgets : ig->m_form.fields) {
+    if (fieldWidgets.index == index) {
+      return fieldWidgets.text;
+    }
+  }
+  return nullptr;
+}
+
+QComboBox* ModelEditorFixture::getComboBox(InspectorGadget* ig, int index) {
+  for (const auto& fieldWidgets : ig->m_form.fields) {
+    if (fieldWidgets.index == index) {
+      return fieldWidgets.combo;
+    }
+  }
+  return nullptr;
+}
+
+QLineEdit* ModelEditorFixture::getCommentEdit(InspectorGadget* ig, int index) {
+  for (const auto& fieldWidgets : ig->m_form.fields) {
+    if (fieldWidgets.index == index) {
+      return fieldWidgets.comment;
+    }
+  }
+  return nullptr;
+}
+
+QRadioButton* ModelEditorFixture::getHardSizedRadio(InspectorGadget* ig, int index) {
+  for (const auto& fieldWidgets : ig->m_form.fields) {
+    if (fieldWidgets.index == index) {
+      return fieldWidgets.hardSizedRadio;
+    }
+  }
+  return nullptr;
+}
+
+QRadioButton* ModelEditorFixture::getAutoRadio(InspectorGadget* ig, int index) {
+  for (const auto& fieldWidgets : ig->m_form.fields) {
+    if (fieldWidgets.index == index) {
+      return fieldWidgets.autoRadio;
+    }
+  }
+  return nullptr;
+}
+
+std::vector<InspectorGadget*> ModelEditorFixture::getChildGadgets(InspectorGadget* ig) {
+  return ig->m_form.childGadgets;
+}
+
 // static variables
 boost::optional<openstudio::FileLogSink> ModelEditorFixture::logFile;
@@ -35,6 +35,15 @@
 #include <openstudio/utilities/core/Logger.hpp>
 #include <openstudio/utilities/core/FileLogSink.hpp>
 
+#include <vector>
+
+class IGLineEdit;
+class InspectorGadget;
+class QComboBox;
+class QLineEdit;
+class QRadioButton;
+class QWidget;
+
 class ModelEditorFixture : public ::testing::Test
 {
  protected:
@@ -50,6 +59,19 @@ class ModelEditorFixture : public ::testing::Test
   // tear down static members
   static void TearDownTestCase();
 
+  // Process events
+  void processEvents();
+
+  // Accessors for the widgets of the form an InspectorGadget shows, fields are looked up by index
+  QWidget* getFormWidget(InspectorGadget* ig);
+  QLineEdit* getObjectCommentEdit(InspectorGadget* ig);
+  IGLineEdit* getLineEdit(InspectorGadget* ig, int index);
+  QComboBox* getComboBox(InspectorGadget* ig, int index);
+  QLineEdit* getCommentEdit(InspectorGadget* ig, int index);
+  QRadioButton* getHardSizedRadio(InspectorGadget* ig, int index);
+  QRadioButton* getAutoRadio(InspectorGadget* ig, int index);
+  std::vector<InspectorGadget*> getChildGadgets(InspectorGadget* ig);
+
   // static variables
   static boost::optional<openstudio::FileLogSink> logFile;
 };
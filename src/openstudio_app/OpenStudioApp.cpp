@@ -33,6 +33,7 @@
 #include "StartupView.hpp"
 #include "LibraryDialog.hpp"
 #include "ExternalToolsDialog.hpp"
+#include "../openstudio_lib/ComponentLibraryCache.hpp"
 #include "../openstudio_lib/MainWindow.hpp"
 #include "../openstudio_lib/OSDocument.hpp"
 
@@ -136,6 +137,8 @@
 #include <QTranslator>
 
 #include <openstudio/utilities/idd/IddEnums.hxx>
+#include <algorithm>
+#include <numeric>
 #include <sstream>
 #include <cstdlib>
 #include <memory>
@@ -226,8 +229,8 @@ OpenStudioApp::OpenStudioApp(int& argc, char** argv)
   connect(&m_waitForMeasureManagerWatcher, &QFutureWatcher<void>::finished, this, &OpenStudioApp::onMeasureManagerAndLibraryReady);
   connect(&m_buildCompLibWatcher, &QFutureWatcher<std::vector<std::string>>::finished, this, &OpenStudioApp::onMeasureManagerAndLibraryReady);
 
-  auto waitForMeasureManagerFuture = QtConcurrent::run(&MeasureManager::waitForStarted, &measureManager(), 10000);
-  m_waitForMeasureManagerWatcher.setFuture(waitForMeasureManagerFuture);
+  // the measure manager pings the server from the event loop, no need for a worker thread
+  m_waitForMeasureManagerWatcher.setFuture(measureManager().waitForStartedAsync(10000));
 
   auto buildCompLibrariesFuture = QtConcurrent::run(&OpenStudioApp::buildCompLibraries, this);
   m_buildCompLibWatcher.setFuture(buildCompLibrariesFuture);
@@ -251,24 +254,23 @@ void OpenStudioApp::onMeasureManagerAndLibraryReady() {
     // So you do want to check the result of the future now that it catches the return type
     // (or call measureManager().isStarted() equivalently)
     if (!m_waitForMeasureManagerWatcher.future().result()) {
-      int currentTry = 1;
-      while (!measureManager().isStarted()) {
-        LOG(Fatal, "Failed to start the Measure Manager on try " << currentTry << ", timeout reached.");
-        QMessageBox msgBox;
-        msgBox.setWindowTitle(tr("Timeout"));
-        msgBox.setIcon(QMessageBox::Critical);
-        msgBox.setText(tr("Failed to start the Measure Manager. Would you like to retry?"));
-        msgBox.setStandardButtons(QMessageBox::Retry | QMessageBox::Close);
-        if (msgBox.exec() == QMessageBox::Close) {
-          LOG_AND_THROW("Exit after measure manager failed to start in given time.");
-          ;
-        } else {
-          measureManager().waitForStarted(10000);
-          ++currentTry;
-        }
+      LOG(Fatal, "Failed to start the Measure Manager on try " << m_measureManagerTries << ", timeout reached.");
+      QMessageBox msgBox;
+      msgBox.setWindowTitle(tr("Timeout"));
+      msgBox.setIcon(QMessageBox::Critical);
+      msgBox.setText(tr("Failed to start the Measure Manager. Would you like to retry?"));
+      msgBox.setStandardButtons(QMessageBox::Retry | QMessageBox::Close);
+      if (msgBox.exec() == QMessageBox::Close) {
+        LOG_AND_THROW("Exit after measure manager failed to start in given time.");
       }
-      LOG(Info, "Recovered from Measure Manager problem, managed to start it on try " << currentTry
-                                                                                      << " at: " << toString(measureManager().url().toString()));
+      // this slot is called again once the server answers or the new timeout is reached
+      ++m_measureManagerTries;
+      m_waitForMeasureManagerWatcher.setFuture(measureManager().waitForStartedAsync(10000));
+      return;
+    }
+    if (m_measureManagerTries > 1) {
+      LOG(Info, "Recovered from Measure Manager problem, managed to start it on try "
+                  << m_measureManagerTries << " at: " << toString(measureManager().url().toString()));
     }
 
     auto failed = m_buildCompLibWatcher.result();
@@ -405,35 +407,30 @@ std::vector<std::string> OpenStudioApp::buildCompLibraries() {
 
   m_compLibrary = model::Model();
 
-  std::string thisVersion = openStudioVersion();
+  std::vector<openstudio::path> paths = libraryPaths();
+  ComponentLibraryCache libraryCache;
+  std::vector<openstudio::path> cachePaths = QtConcurrent::blockingMapped<std::vector<openstudio::path>>(
+    paths, [&libraryCache](const openstudio::path& libPath) { return libraryCache.cachePath(libPath); });
+  libraryCache.prune(cachePaths);
 
-  for (const auto& libPath : libraryPaths()) {
-    try {
-      if (exists(libPath)) {
-        boost::optional<VersionString> version = openstudio::IdfFile::loadVersionOnly(libPath);
-        if (version) {
-          emit updateWaitDialog(3, tr("Translation From version ") + QString::fromStdString(version->str()) + tr(" to ")
-                                     + QString::fromStdString(thisVersion) + ": ");
-        } else {
-          emit updateWaitDialog(3, tr("Unknown starting version"));
-        }
+  emit updateWaitDialog(3, tr("Translating library files to version ") + QString::fromStdString(openStudioVersion()));
 
-        emit updateWaitDialog(4, toQString(libPath));
+  // Translate the libraries in parallel. The progress is reported from this thread as results come in, in the order of libraryPaths,
+  // the workers would otherwise race each other on the wait dialog lines
+  std::vector<size_t> indices(paths.size());
+  std::iota(indices.begin(), indices.end(), size_t(0));
+  QFuture<boost::optional<Model>> libraries =
+    QtConcurrent::mapped(indices, [&paths, &cachePaths](size_t i) { return ComponentLibraryCache::load(paths[i], cachePaths[i]); });
 
-        osversion::VersionTranslator versionTranslator;
-        versionTranslator.setAllowNewerVersions(false);
-        boost::optional<Model> temp = versionTranslator.loadModel(libPath);
-        if (temp) {
-          m_compLibrary.insertObjects(temp->objects());
-        } else {
-          LOG_FREE(Error, "OpenStudioApp", "Failed to load library");
-          failed.push_back(libPath.string());
-        }
-      } else {
-        failed.push_back(libPath.string());
-      }
-    } catch (...) {
-      failed.push_back(libPath.string());
+  for (size_t i = 0; i < paths.size(); ++i) {
+    emit updateWaitDialog(4, tr("Loading library %1 of %2: ").arg(i + 1).arg(paths.size()) + toQString(paths[i]));
+
+    // blocks until this library is loaded
+    boost::optional<Model> library = libraries.resultAt(static_cast<int>(i));
+    if (library) {
+      m_compLibrary.insertObjects(library->objects());
+    } else {
+      failed.push_back(paths[i].string());
     }
   }
 
@@ -279,6 +279,7 @@ class OpenStudioApp : public OSAppBase
 
   QFutureWatcher<std::vector<std::string>> m_buildCompLibWatcher;
   QFutureWatcher<bool> m_waitForMeasureManagerWatcher;
+  int m_measureManagerTries = 1;
   QFutureWatcher<std::vector<std::string>> m_changeLibrariesWatcher;
 
   bool switchLanguage(const QString& rLanguage);
@@ -338,9 +338,9 @@ void ApplyMeasureNowDialog::displayMeasure() {
 
     connect(m_currentMeasureStepItem.data(), &measuretab::MeasureStepItem::argumentsChanged, this, &ApplyMeasureNowDialog::disableOkButton);
 
-    m_currentMeasureStepItem->arguments();
+    // argumentsChanged re-enables the button once the arguments are computed
     bool hasIncompleteArguments = m_currentMeasureStepItem->hasIncompleteArguments();
-    disableOkButton(hasIncompleteArguments);
+    disableOkButton(hasIncompleteArguments || m_currentMeasureStepItem->isComputingArguments());
 
     //m_currentMeasureStepItem->setName(m_bclMeasure->name().c_str());
     m_currentMeasureStepItem->setName(m_bclMeasure->displayName().c_str());
@@ -0,0 +1,134 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) 2020-2022, OpenStudio Coalition and other contributors. All rights reserved.
+*
+*  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the
+*  following conditions are met:
+*
+*  (1) Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+*  disclaimer.
+*
+*  (2) Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following
+*  disclaimer in the documentation and/or other materials provided with the distribution.
+*
+*  (3) Neither the name of the copyright holder nor the names of any contributors may be used to endorse or promote products
+*  derived from this software without specific prior written permission from the respective party.
+*
+*  (4) Other than as required in clauses (1) and (2), distributions in any form of modifications or other derivative works
+*  may not use the "OpenStudio" trademark, "OS", "os", or any other confusingly similar designation without specific prior
+*  written permission from Alliance for Sustainable Energy, LLC.
+*
+*  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDER(S) AND ANY CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+*  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+*  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER(S), ANY CONTRIBUTORS, THE UNITED STATES GOVERNMENT, OR THE UNITED
+*  STATES DEPARTMENT OF ENERGY, NOR ANY OF THEIR EMPLOYEES, BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+*  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF
+*  USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+*  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+*  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+***********************************************************************************************************************/
+
+#include "ComponentLibraryCache.hpp"
+
+#include <openstudio/OpenStudio.hxx>
+
+#include <openstudio/osversion/VersionTranslator.hpp>
+
+#include <openstudio/utilities/core/Checksum.hpp>
+#include <openstudio/utilities/core/Logger.hpp>
+#include <openstudio/utilities/core/UUID.hpp>
+
+#include <QStandardPaths>
+
+#include <algorithm>
+
+namespace openstudio {
+
+ComponentLibraryCache::ComponentLibraryCache() {
+  QString cacheDir = QStandardPaths::writableLocation(QStandardPaths::CacheLocation);
+  if (!cacheDir.isEmpty()) {
+    m_cacheDir = toPath(cacheDir) / toPath("Libraries");
+  }
+}
+
+ComponentLibraryCache::ComponentLibraryCache(const openstudio::path& cacheDir) : m_cacheDir(cacheDir) {}
+
+openstudio::path ComponentLibraryCache::cachePath(const openstudio::path& libPath) const {
+  if (m_cacheDir.empty() || !exists(libPath)) {
+    return {};
+  }
+
+  boost::system::error_code ec;
+  boost::filesystem::create_directories(m_cacheDir, ec);
+  if (ec) {
+    return {};
+  }
+
+  std::string fileName = libPath.stem().string() + "_" + checksum(libPath) + "_" + openStudioVersion() + ".osm";
+  return m_cacheDir / toPath(fileName);
+}
+
+boost::optional<model::Model> ComponentLibraryCache::load(const openstudio::path& libPath, const openstudio::path& cachePath) {
+  try {
+    if (!exists(libPath)) {
+      return boost::none;
+    }
+
+    if (!cachePath.empty() && exists(cachePath)) {
+      if (boost::optional<model::Model> cached = model::Model::load(cachePath)) {
+        return cached;
+      }
+      LOG_FREE(Warn, "ComponentLibraryCache", "Failed to load cached library " << cachePath << ", translating " << libPath << " again");
+    }
+
+    osversion::VersionTranslator versionTranslator;
+    versionTranslator.setAllowNewerVersions(false);
+    boost::optional<model::Model> result = versionTranslator.loadModel(libPath);
+    if (!result) {
+      LOG_FREE(Error, "ComponentLibraryCache", "Failed to load library " << libPath);
+      return boost::none;
+    }
+
+    if (!cachePath.empty()) {
+      // save under a temporary name first so that another instance never reads a partial file
+      openstudio::path tempPath = cachePath;
+      tempPath += toPath(".tmp" + toString(createUUID()));
+      if (result->save(tempPath, true)) {
+        boost::system::error_code ec;
+        boost::filesystem::rename(tempPath, cachePath, ec);
+        if (ec) {
+          boost::filesystem::remove(tempPath, ec);
+        }
+      }
+    }
+
+    return result;
+  } catch (...) {
+    return boost::none;
+  }
+}
+
+void ComponentLibraryCache::prune(const std::vector<openstudio::path>& cachePaths) const {
+  boost::system::error_code ec;
+  if (m_cacheDir.empty() || !boost::filesystem::is_directory(m_cacheDir, ec)) {
+    return;
+  }
+
+  // copies made by other OpenStudio versions are still in use by those, a .tmp file may still be written by another instance
+  const std::string suffix = "_" + openStudioVersion() + ".osm";
+  std::vector<openstudio::path> stale;
+  for (boost::filesystem::directory_iterator it(m_cacheDir, ec), end; !ec && it != end; it.increment(ec)) {
+    const openstudio::path& cached = it->path();
+    const std::string fileName = cached.filename().string();
+    bool currentVersion = (fileName.size() > suffix.size()) && (fileName.compare(fileName.size() - suffix.size(), suffix.size(), suffix) == 0);
+    if (currentVersion && std::find(cachePaths.begin(), cachePaths.end(), cached) == cachePaths.end()) {
+      stale.push_back(cached);
+    }
+  }
+
+  for (const auto& cached : stale) {
+    LOG_FREE(Debug, "ComponentLibraryCache", "Removing stale cached library " << cached);
+    boost::filesystem::remove(cached, ec);
+  }
+}
+
+}  // namespace openstudio
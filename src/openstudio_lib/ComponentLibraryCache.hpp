@@ -0,0 +1,68 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) 2020-2022, OpenStudio Coalition and other contributors. All rights reserved.
+*
+*  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the
+*  following conditions are met:
+*
+*  (1) Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+*  disclaimer.
+*
+*  (2) Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following
+*  disclaimer in the documentation and/or other materials provided with the distribution.
+*
+*  (3) Neither the name of the copyright holder nor the names of any contributors may be used to endorse or promote products
+*  derived from this software without specific prior written permission from the respective party.
+*
+*  (4) Other than as required in clauses (1) and (2), distributions in any form of modifications or other derivative works
+*  may not use the "OpenStudio" trademark, "OS", "os", or any other confusingly similar designation without specific prior
+*  written permission from Alliance for Sustainable Energy, LLC.
+*
+*  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDER(S) AND ANY CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+*  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+*  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER(S), ANY CONTRIBUTORS, THE UNITED STATES GOVERNMENT, OR THE UNITED
+*  STATES DEPARTMENT OF ENERGY, NOR ANY OF THEIR EMPLOYEES, BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+*  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF
+*  USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+*  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+*  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+***********************************************************************************************************************/
+
+#ifndef OPENSTUDIO_COMPONENTLIBRARYCACHE_HPP
+#define OPENSTUDIO_COMPONENTLIBRARYCACHE_HPP
+
+#include "OpenStudioAPI.hpp"
+
+#include <openstudio/model/Model.hpp>
+#include <openstudio/utilities/core/Path.hpp>
+
+#include <vector>
+
+namespace openstudio {
+
+// Version translated copies of the component libraries loaded at startup, so that an unchanged library is not translated again.
+// The directory is shared by every installed OpenStudio version, each one only manages the copies carrying its own version.
+class OPENSTUDIO_API ComponentLibraryCache
+{
+ public:
+  // The Libraries directory in the application cache location
+  ComponentLibraryCache();
+
+  explicit ComponentLibraryCache(const openstudio::path& cacheDir);
+
+  // Where the copy of a library is cached, keyed by the library checksum and the OpenStudio version.
+  // Empty if the library does not exist or the cache directory cannot be created
+  openstudio::path cachePath(const openstudio::path& libPath) const;
+
+  // Loads a library, reusing the copy at cachePath when there is one and writing it otherwise. Safe to call concurrently
+  static boost::optional<model::Model> load(const openstudio::path& libPath, const openstudio::path& cachePath);
+
+  // Removes the copies for this OpenStudio version that are not in cachePaths, left behind by changed or removed libraries
+  void prune(const std::vector<openstudio::path>& cachePaths) const;
+
+ private:
+  openstudio::path m_cacheDir;
+};
+
+}  // namespace openstudio
+
+#endif  // OPENSTUDIO_COMPONENTLIBRARYCACHE_HPP
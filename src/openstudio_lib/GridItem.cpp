@@ -235,6 +235,9 @@ void ModelObjectGraphicsItem::setModelObject(model::OptionalModelObject modelObj
   setFlag(QGraphicsItem::ItemIsSelectable);
 
   this->onNameChange();
+
+  // What is drawn depends on the model object, so drop any cached painting
+  update();
 }
 
 void ModelObjectGraphicsItem::onNameChange() {
@@ -281,7 +284,10 @@ void ModelObjectGraphicsItem::dropEvent(QGraphicsSceneDragDropEvent* event) {
 
 // End move these to
 
-GridItem::GridItem(QGraphicsItem* parent) : ModelObjectGraphicsItem(parent), m_hLength(1), m_vLength(1) {}
+GridItem::GridItem(QGraphicsItem* parent) : ModelObjectGraphicsItem(parent), m_hLength(1), m_vLength(1) {
+  // Panning only translates the view, so each item can be repainted from a pixmap at device resolution
+  setCacheMode(QGraphicsItem::DeviceCoordinateCache);
+}
 
 QRectF GridItem::boundingRect() const {
   return {0.0, 0.0, m_hLength * 100.0, m_vLength * 100.0};
@@ -317,11 +323,17 @@ int GridItem::getYGridPos() const {
 }
 
 void GridItem::setHGridLength(int l) {
-  m_hLength = l;
+  if (l != m_hLength) {
+    prepareGeometryChange();
+    m_hLength = l;
+  }
 }
 
 void GridItem::setVGridLength(int l) {
-  m_vLength = l;
+  if (l != m_vLength) {
+    prepareGeometryChange();
+    m_vLength = l;
+  }
 }
 
 int GridItem::getHGridLength() const {
@@ -404,7 +416,7 @@ void HalfHeightOneThreeStraightItem::paint(QPainter* painter, const QStyleOption
 
   if (modelObject()) {
     const QPixmap* qPixmap = IconLibrary::Instance().findIcon(modelObject()->iddObject().type().value());
-    painter->drawPixmap(37, 12, 25, 25, *qPixmap);
+    drawDetailedPixmap(painter, QRectF(37, 12, 25, 25), *qPixmap);
   }
 }
 
@@ -674,7 +686,7 @@ void HorizontalBranchItem::paint(QPainter* painter, const QStyleOptionGraphicsIt
     QFont font = painter->font();
     font.setPixelSize(12);
     painter->setFont(font);
-    painter->drawText(9, 9, m_hLength * 100 - 18, m_vLength * 100 - 18, Qt::AlignCenter | Qt::TextWordWrap, m_text);
+    drawDetailedText(painter, QRectF(9, 9, m_hLength * 100 - 18, m_vLength * 100 - 18), Qt::AlignCenter | Qt::TextWordWrap, m_text);
   }
 }
 
@@ -832,8 +844,8 @@ bool sortBranches(std::vector<ModelObject> i, std::vector<ModelObject> j) {
 // That is the first thing that is either 1) a zone, 2) not a splitter/mixer or node, 3) a node if that is all that is found
 // This will be used later to find the components both upstream and downstream of the center ModelObject
 // This is unfortunately tricky, but necessary to handle air system demand branches that involve plenums
-std::vector<model::HVACComponent> centerHVACComponents(model::Splitter& splitter, model::Mixer& mixer) {
-  std::vector<model::HVACComponent> result;
+std::vector<DemandBranch> demandBranches(model::Splitter& splitter, model::Mixer& mixer) {
+  std::vector<DemandBranch> result;
 
   auto loop = splitter.loop();
 
@@ -846,14 +858,26 @@ std::vector<model::HVACComponent> centerHVACComponents(model::Splitter& splitter
            || (iddObjectType == openstudio::IddObjectType::OS_AirLoopHVAC_ReturnPlenum) || (iddObjectType == openstudio::IddObjectType::OS_Node);
   };
 
+  auto isPlenum = [](const model::ModelObject& modelObject) {
+    auto iddObjectType = modelObject.iddObjectType();
+
+    return (iddObjectType == openstudio::IddObjectType::OS_AirLoopHVAC_SupplyPlenum)
+           || (iddObjectType == openstudio::IddObjectType::OS_AirLoopHVAC_ReturnPlenum);
+  };
+
   if (loop) {
     auto outletObjects = subsetCastVector<model::HVACComponent>(splitter.outletModelObjects());
     for (const auto& object : outletObjects) {
-      auto branchObjects = subsetCastVector<model::HVACComponent>(loop->demandComponents(object, mixer));
+      auto components = loop->demandComponents(object, mixer);
+      bool isSinglePath = std::none_of(components.begin(), components.end(), isPlenum);
+
+      auto branchObjects = subsetCastVector<model::HVACComponent>(components);
 
       auto zones = subsetCastVector<model::ThermalZone>(branchObjects);
       if (!zones.empty()) {
-        result.insert(result.end(), zones.begin(), zones.end());
+        for (const auto& zone : zones) {
+          result.push_back(DemandBranch{zone, components, isSinglePath});
+        }
         continue;
       }
 
@@ -861,7 +885,7 @@ std::vector<model::HVACComponent> centerHVACComponents(model::Splitter& splitter
       // We are expecting a terminal. ie a branch with only a terminal and nodes on it
       auto reducedSetIt = std::remove_if(branchObjects.begin(), branchObjects.end(), removeUnwantedSplitterMixerNodesPred);
       if (reducedSetIt != branchObjects.end()) {
-        result.push_back(*reducedSetIt);
+        result.push_back(DemandBranch{*reducedSetIt, components, isSinglePath});
         continue;
       }
 
@@ -869,13 +893,23 @@ std::vector<model::HVACComponent> centerHVACComponents(model::Splitter& splitter
       // ie a branch with only a single node on it.
       auto nodes = subsetCastVector<model::Node>(branchObjects);
       if (!nodes.empty()) {
-        result.push_back(nodes.front());
+        result.push_back(DemandBranch{nodes.front(), components, isSinglePath});
       }
     }
   }
 
   WorkspaceObjectNameLess sorter;
-  std::sort(result.begin(), result.end(), sorter);
+  std::sort(result.begin(), result.end(), [&sorter](const DemandBranch& i, const DemandBranch& j) { return sorter(i.center, j.center); });
+
+  return result;
+}
+
+std::vector<model::HVACComponent> centerHVACComponents(model::Splitter& splitter, model::Mixer& mixer) {
+  std::vector<model::HVACComponent> result;
+
+  for (const auto& branch : demandBranches(splitter, mixer)) {
+    result.push_back(branch.center);
+  }
 
   return result;
 }
@@ -928,23 +962,48 @@ HorizontalBranchGroupItem::HorizontalBranchGroupItem(model::Splitter& splitter,
       // The reason is because of plenums. If we go from splitter outlet node,
       // to mixer inlet node (when there are plenums) there may be more than one path,
       // and we will receive all of those extra ModelObject instances from ::demandComponents
-      auto centerComps = centerHVACComponents(splitter, mixer);
+      auto branches = demandBranches(splitter, mixer);
       auto splitters = airLoop->zoneSplitters();
 
       std::pair<std::vector<model::ModelObject>, std::vector<model::ModelObject>> allCompsBeforeTerminal;
 
-      for (const auto& centerComp : centerComps) {
+      for (const auto& branch : branches) {
+        const auto& centerComp = branch.center;
+        // A single duct branch that does not go through a plenum is a single path from the splitter to the mixer,
+        // so the components on either side of the terminal can be read off the branch instead of searched for
+        bool isSinglePath = branch.isSinglePath && (splitters.size() == 1u);
+
         boost::optional<model::HVACComponent> keyComp = centerComp;
         if (auto zone = centerComp.optionalCast<model::ThermalZone>()) {
           auto terminals = zone->airLoopHVACTerminals();
           for (const auto& term : terminals) {
-            auto a = term.airLoopHVAC();
-            if (a && (a->handle() == airLoop->handle())) {
-              keyComp = term;
+            if (isSinglePath) {
+              if (std::find(branch.components.begin(), branch.components.end(), term) != branch.components.end()) {
+                keyComp = term;
+              }
+            } else {
+              auto a = term.airLoopHVAC();
+              if (a && (a->handle() == airLoop->handle())) {
+                keyComp = term;
+              }
             }
           }
         }
         OS_ASSERT(keyComp);
+
+        if (isSinglePath) {
+          auto keyIt = std::find(branch.components.begin(), branch.components.end(), keyComp.get());
+          if (keyIt != branch.components.end()) {
+            // Same as the searches below: after the terminal without the mixer, then before the terminal without the splitter
+            std::vector<model::ModelObject> comps(keyIt, branch.components.end() - 1);
+            std::reverse(comps.begin(), comps.end());
+            std::vector<model::ModelObject> compsBeforeTerminal(branch.components.begin(), keyIt);
+            comps.insert(comps.end(), compsBeforeTerminal.rbegin(), compsBeforeTerminal.rend());
+            m_branchItems.push_back(new HorizontalBranchItem(comps, this));
+            continue;
+          }
+        }
+
         {
           auto compsBeforeTerminal = airLoop->demandComponents(splitters[0], keyComp.get());
           compsBeforeTerminal.erase(compsBeforeTerminal.begin());
@@ -1117,15 +1176,66 @@ void HorizontalBranchGroupItem::layout() {
 void HorizontalBranchGroupItem::paint(QPainter* painter, const QStyleOptionGraphicsItem* option, QWidget* widget) {}
 
 SystemItem::SystemItem(const model::Loop& loop, LoopScene* loopScene) : m_loop(loop), m_loopScene(loopScene) {
-  std::shared_ptr<OSDocument> doc = OSAppBase::instance()->currentDocument();
-  std::shared_ptr<MainRightColumnController> mrc = doc->mainRightColumnController();
-  mrc->registerSystemItem(m_loop.handle(), this);
+  if (OSAppBase* app = OSAppBase::instance()) {
+    if (std::shared_ptr<OSDocument> doc = app->currentDocument()) {
+      doc->mainRightColumnController()->registerSystemItem(m_loop.handle(), this);
+    }
+  }
 
   m_loopScene->addItem(this);
 
+  updatePlenums();
+
   auto supplyInletNode = m_loop.supplyInletNode();
   auto supplyOutletNodes = m_loop.supplyOutletNodes();
 
+  m_supplySideItem = new SupplySideItem(this, supplyInletNode, supplyOutletNodes);
+
+  auto demandInletNodes = m_loop.demandInletNodes();
+  auto demandOutletNode = m_loop.demandOutletNode();
+
+  m_demandSideItem = new DemandSideItem(this, demandInletNodes, demandOutletNode);
+
+  layoutSides();
+}
+
+SystemItem::~SystemItem() {
+  if (OSAppBase* app = OSAppBase::instance()) {
+    if (std::shared_ptr<OSDocument> doc = app->currentDocument()) {
+      doc->mainRightColumnController()->unregisterSystemItem(m_loop.handle());
+    }
+  }
+}
+
+void SystemItem::rebuildSupplySide() {
+  delete m_supplySideItem;
+
+  auto supplyInletNode = m_loop.supplyInletNode();
+  auto supplyOutletNodes = m_loop.supplyOutletNodes();
+
+  m_supplySideItem = new SupplySideItem(this, supplyInletNode, supplyOutletNodes);
+
+  layoutSides();
+}
+
+void SystemItem::rebuildDemandSide() {
+  delete m_demandSideItem;
+
+  // Plenums live on the demand side, so their colors and indices can only change with it
+  updatePlenums();
+
+  auto demandInletNodes = m_loop.demandInletNodes();
+  auto demandOutletNode = m_loop.demandOutletNode();
+
+  m_demandSideItem = new DemandSideItem(this, demandInletNodes, demandOutletNode);
+
+  layoutSides();
+}
+
+void SystemItem::updatePlenums() {
+  m_plenumIndexMap.clear();
+  m_plenumColorMap.clear();
+
   std::vector<model::AirLoopHVACSupplyPlenum> supplyPlenums =
     subsetCastVector<model::AirLoopHVACSupplyPlenum>(m_loop.demandComponents(openstudio::IddObjectType::OS_AirLoopHVAC_SupplyPlenum));
 
@@ -1161,16 +1271,11 @@ SystemItem::SystemItem(const model::Loop& loop, LoopScene* loopScene) : m_loop(l
     m_plenumIndexMap.insert(std::make_pair(returnPlenum.handle(), i));
     i++;
   }
+}
 
-  m_supplySideItem = new SupplySideItem(this, supplyInletNode, supplyOutletNodes);
-
+void SystemItem::layoutSides() {
   m_supplySideItem->setGridPos(0, 0);
 
-  auto demandInletNodes = m_loop.demandInletNodes();
-  auto demandOutletNode = m_loop.demandOutletNode();
-
-  m_demandSideItem = new DemandSideItem(this, demandInletNodes, demandOutletNode);
-
   m_demandSideItem->setGridPos(0, m_supplySideItem->getVGridLength() + 1);
 
   int defaultDemandPadding = 0;
@@ -1190,6 +1295,9 @@ SystemItem::SystemItem(const model::Loop& loop, LoopScene* loopScene) : m_loop(l
     m_supplySideItem->setPadding((diff * -1) + defaultSupplyPadding);
   }
 
+  // The center item spans the width of the sides, so it is cheaper to recreate than to resize
+  delete m_systemCenterItem;
+
   m_systemCenterItem = new SystemCenterItem(this, m_loop);
 
   m_systemCenterItem->setHGridLength(m_supplySideItem->getHGridLength());
@@ -1201,12 +1309,6 @@ SystemItem::SystemItem(const model::Loop& loop, LoopScene* loopScene) : m_loop(l
   setHGridLength(m_supplySideItem->getHGridLength());
 }
 
-SystemItem::~SystemItem() {
-  std::shared_ptr<OSDocument> doc = OSAppBase::instance()->currentDocument();
-  std::shared_ptr<MainRightColumnController> mrc = doc->mainRightColumnController();
-  mrc->unregisterSystemItem(m_loop.handle());
-}
-
 int SystemItem::plenumIndex(const Handle& plenumHandle) {
   auto it = m_plenumIndexMap.find(plenumHandle);
   if (it != m_plenumIndexMap.end()) {
@@ -1271,11 +1373,11 @@ void SystemCenterItem::paint(QPainter* painter, const QStyleOptionGraphicsItem*
   painter->setPen(QPen(Qt::black, 4, Qt::SolidLine, Qt::RoundCap));
   painter->drawLine(50, yOrigin, 50, yOrigin + 100);
   painter->drawLine((m_hLength - 1) * 100 + 50, yOrigin, (m_hLength - 1) * 100 + 50, yOrigin + 100);
-  painter->drawPixmap((m_hLength - 1) * 100 + 37.5, yOrigin + 25, 25, 25, QPixmap(":/images/arrow.png"));
+  drawDetailedPixmap(painter, QRectF((m_hLength - 1) * 100 + 37.5, yOrigin + 25, 25, 25), QPixmap(":/images/arrow.png"));
 
   if (m_supplyDualDuct) {
     painter->drawLine((m_hLength - 3) * 100 + 50, yOrigin, (m_hLength - 3) * 100 + 50, yOrigin + 50);
-    painter->drawPixmap((m_hLength - 3) * 100 + 37.5, yOrigin + 25, 25, 25, QPixmap(":/images/arrow.png"));
+    drawDetailedPixmap(painter, QRectF((m_hLength - 3) * 100 + 37.5, yOrigin + 25, 25, 25), QPixmap(":/images/arrow.png"));
   }
   if (m_demandDualDuct) {
     painter->drawLine((m_hLength - 3) * 100 + 50, yOrigin + 50, (m_hLength - 3) * 100 + 50, yOrigin + 100);
@@ -1285,7 +1387,7 @@ void SystemCenterItem::paint(QPainter* painter, const QStyleOptionGraphicsItem*
   painter->drawLine(0, yOrigin + 50, (m_hLength)*100, yOrigin + 50);
 
   painter->rotate(180);
-  painter->drawPixmap(-62, -(yOrigin + 75), 25, 25, QPixmap(":/images/arrow.png"));
+  drawDetailedPixmap(painter, QRectF(-62, -(yOrigin + 75), 25, 25), QPixmap(":/images/arrow.png"));
 
   painter->rotate(-180);
 
@@ -1300,8 +1402,8 @@ void SystemCenterItem::paint(QPainter* painter, const QStyleOptionGraphicsItem*
   painter->setFont(font);
   painter->setPen(QPen(Qt::black, 1, Qt::SolidLine, Qt::RoundCap));
   painter->setBrush(QBrush(Qt::black, Qt::SolidPattern));
-  painter->drawText(QRect(110, 21, 200, 25), Qt::AlignBottom, "Supply Equipment");
-  painter->drawText(QRect(110, 52, 200, 25), Qt::AlignTop, "Demand Equipment");
+  drawDetailedText(painter, QRectF(110, 21, 200, 25), Qt::AlignBottom, "Supply Equipment");
+  drawDetailedText(painter, QRectF(110, 52, 200, 25), Qt::AlignTop, "Demand Equipment");
 }
 
 SupplyPlenumItem::SupplyPlenumItem(const model::ModelObject& modelObject, QGraphicsItem* parent) : GridItem(parent) {
@@ -1404,7 +1506,7 @@ void OneThreeDualDuctMixerItem::paint(QPainter* painter, const QStyleOptionGraph
 
   if (modelObject()) {
     const QPixmap* qPixmap = IconLibrary::Instance().findIcon(modelObject()->iddObject().type().value());
-    painter->drawPixmap(0, 0, 100, 100, *qPixmap);
+    drawDetailedPixmap(painter, QRectF(0, 0, 100, 100), *qPixmap);
   }
 }
 
@@ -1424,7 +1526,7 @@ void OneThreeStraightItem::paint(QPainter* painter, const QStyleOptionGraphicsIt
 
   if (modelObject()) {
     const QPixmap* qPixmap = IconLibrary::Instance().findIcon(modelObject()->iddObject().type().value());
-    painter->drawPixmap(12, 12, 75, 75, *qPixmap);
+    drawDetailedPixmap(painter, QRectF(12, 12, 75, 75), *qPixmap);
 
     //if(m_deleteAble)
     //{
@@ -1495,7 +1597,7 @@ void OneThreeWaterToAirItem::paint(QPainter* painter, const QStyleOptionGraphics
 
   if (modelObject()) {
     const QPixmap* qPixmap = IconLibrary::Instance().findIcon(modelObject()->iddObject().type().value());
-    painter->drawPixmap(12, 12, 75, 75, *qPixmap);
+    drawDetailedPixmap(painter, QRectF(12, 12, 75, 75), *qPixmap);
 
     //if(m_deleteAble)
     //{
@@ -1566,7 +1668,7 @@ void OneThreeWaterToWaterItem::paint(QPainter* painter, const QStyleOptionGraphi
 
   if (modelObject()) {
     const QPixmap* qPixmap = IconLibrary::Instance().findIcon(modelObject()->iddObject().type().value());
-    painter->drawPixmap(12, 12, 75, 75, *qPixmap);
+    drawDetailedPixmap(painter, QRectF(12, 12, 75, 75), *qPixmap);
 
     //if(m_deleteAble)
     //{
@@ -1607,7 +1709,7 @@ void TwoFourStraightItem::paint(QPainter* painter, const QStyleOptionGraphicsIte
     painter->rotate(90);
 
     const QPixmap* qPixmap = IconLibrary::Instance().findIcon(modelObject()->iddObject().type().value());
-    painter->drawPixmap(12, 12, 75, 75, *qPixmap);
+    drawDetailedPixmap(painter, QRectF(12, 12, 75, 75), *qPixmap);
 
     painter->rotate(-90);
     painter->translate(-100, 0);
@@ -1646,7 +1748,7 @@ void OASupplyStraightItem::paint(QPainter* painter, const QStyleOptionGraphicsIt
     painter->rotate(90);
 
     const QPixmap* qPixmap = IconLibrary::Instance().findIcon(modelObject()->iddObject().type().value());
-    painter->drawPixmap(12, 12, 75, 75, *qPixmap);
+    drawDetailedPixmap(painter, QRectF(12, 12, 75, 75), *qPixmap);
 
     painter->rotate(-90);
     painter->translate(-100, 0);
@@ -1698,7 +1800,7 @@ void OAReliefStraightItem::paint(QPainter* painter, const QStyleOptionGraphicsIt
     painter->rotate(-90);
 
     const QPixmap* qPixmap = IconLibrary::Instance().findIcon(modelObject()->iddObject().type().value());
-    painter->drawPixmap(12, 12, 75, 75, *qPixmap);
+    drawDetailedPixmap(painter, QRectF(12, 12, 75, 75), *qPixmap);
 
     painter->rotate(90);
     painter->translate(0, -100);
@@ -1756,7 +1858,7 @@ void OAAirToAirItem::paint(QPainter* painter, const QStyleOptionGraphicsItem* /*
 
   if (modelObject()) {
     const QPixmap* qPixmap = IconLibrary::Instance().findIcon(modelObject()->iddObject().type().value());
-    painter->drawPixmap(0, 0, 200, 100, *qPixmap);
+    drawDetailedPixmap(painter, QRectF(0, 0, 200, 100), *qPixmap);
   }
 }
 
@@ -1958,7 +2060,7 @@ void FourTwoStraightItem::paint(QPainter* painter, const QStyleOptionGraphicsIte
     painter->rotate(-90);
 
     const QPixmap* qPixmap = IconLibrary::Instance().findIcon(modelObject()->iddObject().type().value());
-    painter->drawPixmap(12, 12, 75, 75, *qPixmap);
+    drawDetailedPixmap(painter, QRectF(12, 12, 75, 75), *qPixmap);
 
     painter->rotate(90);
     painter->translate(0, -100);
@@ -2047,59 +2149,59 @@ void OneThreeNodeItem::paint(QPainter* painter, const QStyleOptionGraphicsItem*
       for (auto& spm : node->setpointManagers()) {
         if (spm.controlVariable().find("Temperature") != std::string::npos) {
           if (spm.iddObjectType() == SetpointManagerMixedAir::iddObjectType()) {
-            painter->drawPixmap(37, 13, 25, 25, QPixmap(":images/setpoint_mixed.png"));
+            drawDetailedPixmap(painter, QRectF(37, 13, 25, 25), QPixmap(":images/setpoint_mixed.png"));
           } else if ((spm.iddObjectType() == SetpointManagerSingleZoneReheat::iddObjectType())
                      || (spm.iddObjectType() == SetpointManagerSingleZoneCooling::iddObjectType())
                      || (spm.iddObjectType() == SetpointManagerSingleZoneHeating::iddObjectType())) {
-            painter->drawPixmap(37, 13, 25, 25, QPixmap(":images/setpoint_singlezone.png"));
+            drawDetailedPixmap(painter, QRectF(37, 13, 25, 25), QPixmap(":images/setpoint_singlezone.png"));
           } else if (spm.iddObjectType() == SetpointManagerScheduled::iddObjectType()) {
-            painter->drawPixmap(37, 13, 25, 25, QPixmap(":images/setpoint_scheduled.png"));
+            drawDetailedPixmap(painter, QRectF(37, 13, 25, 25), QPixmap(":images/setpoint_scheduled.png"));
           } else if (spm.iddObjectType() == SetpointManagerScheduledDualSetpoint::iddObjectType()) {
-            painter->drawPixmap(37, 13, 25, 25, QPixmap(":images/setpoint_dual.png"));
+            drawDetailedPixmap(painter, QRectF(37, 13, 25, 25), QPixmap(":images/setpoint_dual.png"));
           } else if (spm.iddObjectType() == SetpointManagerWarmest::iddObjectType()) {
-            painter->drawPixmap(37, 13, 25, 25, QPixmap(":images/setpoint_warmest.png"));
+            drawDetailedPixmap(painter, QRectF(37, 13, 25, 25), QPixmap(":images/setpoint_warmest.png"));
           } else if (spm.iddObjectType() == SetpointManagerColdest::iddObjectType()) {
-            painter->drawPixmap(37, 13, 25, 25, QPixmap(":images/setpoint_coldest.png"));
+            drawDetailedPixmap(painter, QRectF(37, 13, 25, 25), QPixmap(":images/setpoint_coldest.png"));
           } else if (spm.iddObjectType() == SetpointManagerOutdoorAirReset::iddObjectType()) {
-            painter->drawPixmap(37, 13, 25, 25, QPixmap(":images/setpoint_outdoorair.png"));
+            drawDetailedPixmap(painter, QRectF(37, 13, 25, 25), QPixmap(":images/setpoint_outdoorair.png"));
           } else if (spm.iddObjectType() == SetpointManagerFollowGroundTemperature::iddObjectType()) {
-            painter->drawPixmap(37, 13, 25, 25, QPixmap(":images/setpoint_follow_ground_temp.png"));
+            drawDetailedPixmap(painter, QRectF(37, 13, 25, 25), QPixmap(":images/setpoint_follow_ground_temp.png"));
           } else if (spm.iddObjectType() == SetpointManagerFollowOutdoorAirTemperature::iddObjectType()) {
-            painter->drawPixmap(37, 13, 25, 25, QPixmap(":images/setpoint_follow_outdoorair.png"));
+            drawDetailedPixmap(painter, QRectF(37, 13, 25, 25), QPixmap(":images/setpoint_follow_outdoorair.png"));
           } else if (spm.iddObjectType() == SetpointManagerFollowSystemNodeTemperature::iddObjectType()) {
-            painter->drawPixmap(37, 13, 25, 25, QPixmap(":images/setpoint_follow_system_node.png"));
+            drawDetailedPixmap(painter, QRectF(37, 13, 25, 25), QPixmap(":images/setpoint_follow_system_node.png"));
           } else if (spm.iddObjectType() == SetpointManagerMultiZoneCoolingAverage::iddObjectType()) {
-            painter->drawPixmap(37, 13, 25, 25, QPixmap(":images/setpoint_multizone_cooling.png"));
+            drawDetailedPixmap(painter, QRectF(37, 13, 25, 25), QPixmap(":images/setpoint_multizone_cooling.png"));
           } else if (spm.iddObjectType() == SetpointManagerMultiZoneHeatingAverage::iddObjectType()) {
-            painter->drawPixmap(37, 13, 25, 25, QPixmap(":images/setpoint_multizone_heating.png"));
+            drawDetailedPixmap(painter, QRectF(37, 13, 25, 25), QPixmap(":images/setpoint_multizone_heating.png"));
           } else if (spm.iddObjectType() == SetpointManagerOutdoorAirPretreat::iddObjectType()) {
-            painter->drawPixmap(37, 13, 25, 25, QPixmap(":images/setpoint_pretreat.png"));
+            drawDetailedPixmap(painter, QRectF(37, 13, 25, 25), QPixmap(":images/setpoint_pretreat.png"));
           } else if (spm.iddObjectType() == SetpointManagerSingleZoneOneStageCooling::iddObjectType()) {
-            painter->drawPixmap(37, 13, 25, 25, QPixmap(":images/setpoint_onestage_cooling.png"));
+            drawDetailedPixmap(painter, QRectF(37, 13, 25, 25), QPixmap(":images/setpoint_onestage_cooling.png"));
           } else if (spm.iddObjectType() == SetpointManagerSingleZoneOneStageHeating::iddObjectType()) {
-            painter->drawPixmap(37, 13, 25, 25, QPixmap(":images/setpoint_onestage_heating.png"));
+            drawDetailedPixmap(painter, QRectF(37, 13, 25, 25), QPixmap(":images/setpoint_onestage_heating.png"));
           } else if (spm.iddObjectType() == SetpointManagerWarmestTemperatureFlow::iddObjectType()) {
-            painter->drawPixmap(37, 13, 25, 25, QPixmap(":images/setpoint_warmest_tempflow.png"));
+            drawDetailedPixmap(painter, QRectF(37, 13, 25, 25), QPixmap(":images/setpoint_warmest_tempflow.png"));
           } else if (spm.iddObjectType() == SetpointManagerSystemNodeResetTemperature::iddObjectType()) {
-            painter->drawPixmap(37, 13, 25, 25, QPixmap(":images/setpoint_systemnodereset_temperature.png"));
+            drawDetailedPixmap(painter, QRectF(37, 13, 25, 25), QPixmap(":images/setpoint_systemnodereset_temperature.png"));
           }
           break;
         } else {
           // These are the Humidty SPMs
           if (spm.iddObjectType() == SetpointManagerMultiZoneHumidityMaximum::iddObjectType()) {
-            painter->drawPixmap(37, 13, 25, 25, QPixmap(":images/setpoint_multizone_humidity_max.png"));
+            drawDetailedPixmap(painter, QRectF(37, 13, 25, 25), QPixmap(":images/setpoint_multizone_humidity_max.png"));
           } else if (spm.iddObjectType() == SetpointManagerMultiZoneHumidityMinimum::iddObjectType()) {
-            painter->drawPixmap(37, 13, 25, 25, QPixmap(":images/setpoint_multizone_humidity_min.png"));
+            drawDetailedPixmap(painter, QRectF(37, 13, 25, 25), QPixmap(":images/setpoint_multizone_humidity_min.png"));
           } else if (spm.iddObjectType() == SetpointManagerMultiZoneMaximumHumidityAverage::iddObjectType()) {
-            painter->drawPixmap(37, 13, 25, 25, QPixmap(":images/setpoint_multizone_maxhumidity_avg.png"));
+            drawDetailedPixmap(painter, QRectF(37, 13, 25, 25), QPixmap(":images/setpoint_multizone_maxhumidity_avg.png"));
           } else if (spm.iddObjectType() == SetpointManagerMultiZoneMinimumHumidityAverage::iddObjectType()) {
-            painter->drawPixmap(37, 13, 25, 25, QPixmap(":images/setpoint_multizone_minhumidity_avg.png"));
+            drawDetailedPixmap(painter, QRectF(37, 13, 25, 25), QPixmap(":images/setpoint_multizone_minhumidity_avg.png"));
           } else if (spm.iddObjectType() == SetpointManagerSingleZoneHumidityMaximum::iddObjectType()) {
-            painter->drawPixmap(37, 13, 25, 25, QPixmap(":images/setpoint_singlezone_humidity_max.png"));
+            drawDetailedPixmap(painter, QRectF(37, 13, 25, 25), QPixmap(":images/setpoint_singlezone_humidity_max.png"));
           } else if (spm.iddObjectType() == SetpointManagerSingleZoneHumidityMinimum::iddObjectType()) {
-            painter->drawPixmap(37, 13, 25, 25, QPixmap(":images/setpoint_singlezone_humidity_min.png"));
+            drawDetailedPixmap(painter, QRectF(37, 13, 25, 25), QPixmap(":images/setpoint_singlezone_humidity_min.png"));
           } else if (spm.iddObjectType() == SetpointManagerSystemNodeResetHumidity::iddObjectType()) {
-            painter->drawPixmap(37, 13, 25, 25, QPixmap(":images/setpoint_systemnodereset_humidity.png"));
+            drawDetailedPixmap(painter, QRectF(37, 13, 25, 25), QPixmap(":images/setpoint_systemnodereset_humidity.png"));
           }
           break;
         }
@@ -2205,60 +2307,60 @@ void TwoFourNodeItem::paint(QPainter* painter, const QStyleOptionGraphicsItem* o
       for (auto& spm : node->setpointManagers()) {
         if (spm.controlVariable().find("Temperature") != std::string::npos) {
           if (spm.iddObjectType() == SetpointManagerMixedAir::iddObjectType()) {
-            painter->drawPixmap(62, 37, 25, 25, QPixmap(":images/setpoint_mixed_right.png"));
+            drawDetailedPixmap(painter, QRectF(62, 37, 25, 25), QPixmap(":images/setpoint_mixed_right.png"));
           } else if ((spm.iddObjectType() == SetpointManagerSingleZoneReheat::iddObjectType())
                      || (spm.iddObjectType() == SetpointManagerSingleZoneCooling::iddObjectType())
                      || (spm.iddObjectType() == SetpointManagerSingleZoneHeating::iddObjectType())) {
-            painter->drawPixmap(62, 37, 25, 25, QPixmap(":images/setpoint_singlezone_right.png"));
+            drawDetailedPixmap(painter, QRectF(62, 37, 25, 25), QPixmap(":images/setpoint_singlezone_right.png"));
           } else if (spm.iddObjectType() == SetpointManagerScheduled::iddObjectType()) {
-            painter->drawPixmap(62, 37, 25, 25, QPixmap(":images/setpoint_scheduled_right.png"));
+            drawDetailedPixmap(painter, QRectF(62, 37, 25, 25), QPixmap(":images/setpoint_scheduled_right.png"));
           } else if (spm.iddObjectType() == SetpointManagerScheduledDualSetpoint::iddObjectType()) {
-            painter->drawPixmap(62, 37, 25, 25, QPixmap(":images/setpoint_dual_right.png"));
+            drawDetailedPixmap(painter, QRectF(62, 37, 25, 25), QPixmap(":images/setpoint_dual_right.png"));
           } else if (spm.iddObjectType() == SetpointManagerWarmest::iddObjectType()) {
-            painter->drawPixmap(62, 37, 25, 25, QPixmap(":images/setpoint_warmest_right.png"));
+            drawDetailedPixmap(painter, QRectF(62, 37, 25, 25), QPixmap(":images/setpoint_warmest_right.png"));
           } else if (spm.iddObjectType() == SetpointManagerColdest::iddObjectType()) {
-            painter->drawPixmap(62, 37, 25, 25, QPixmap(":images/setpoint_coldest_right.png"));
+            drawDetailedPixmap(painter, QRectF(62, 37, 25, 25), QPixmap(":images/setpoint_coldest_right.png"));
           } else if (spm.iddObjectType() == SetpointManagerOutdoorAirReset::iddObjectType()) {
-            painter->drawPixmap(62, 37, 25, 25, QPixmap(":images/setpoint_outdoorair_right.png"));
+            drawDetailedPixmap(painter, QRectF(62, 37, 25, 25), QPixmap(":images/setpoint_outdoorair_right.png"));
           } else if (spm.iddObjectType() == SetpointManagerFollowGroundTemperature::iddObjectType()) {
-            painter->drawPixmap(62, 37, 25, 25, QPixmap(":images/setpoint_follow_ground_temp_right.png"));
+            drawDetailedPixmap(painter, QRectF(62, 37, 25, 25), QPixmap(":images/setpoint_follow_ground_temp_right.png"));
           } else if (spm.iddObjectType() == SetpointManagerFollowOutdoorAirTemperature::iddObjectType()) {
-            painter->drawPixmap(62, 37, 25, 25, QPixmap(":images/setpoint_follow_outdoorair_right.png"));
+            drawDetailedPixmap(painter, QRectF(62, 37, 25, 25), QPixmap(":images/setpoint_follow_outdoorair_right.png"));
           } else if (spm.iddObjectType() == SetpointManagerFollowSystemNodeTemperature::iddObjectType()) {
-            painter->drawPixmap(62, 37, 25, 25, QPixmap(":images/setpoint_follow_system_node_right.png"));
+            drawDetailedPixmap(painter, QRectF(62, 37, 25, 25), QPixmap(":images/setpoint_follow_system_node_right.png"));
           } else if (spm.iddObjectType() == SetpointManagerMultiZoneCoolingAverage::iddObjectType()) {
-            painter->drawPixmap(62, 37, 25, 25, QPixmap(":images/setpoint_multizone_cooling_right.png"));
+            drawDetailedPixmap(painter, QRectF(62, 37, 25, 25), QPixmap(":images/setpoint_multizone_cooling_right.png"));
           } else if (spm.iddObjectType() == SetpointManagerMultiZoneHeatingAverage::iddObjectType()) {
-            painter->drawPixmap(62, 37, 25, 25, QPixmap(":images/setpoint_multizone_heating_right.png"));
+            drawDetailedPixmap(painter, QRectF(62, 37, 25, 25), QPixmap(":images/setpoint_multizone_heating_right.png"));
           } else if (spm.iddObjectType() == SetpointManagerOutdoorAirPretreat::iddObjectType()) {
-            painter->drawPixmap(62, 37, 25, 25, QPixmap(":images/setpoint_pretreat_right.png"));
+            drawDetailedPixmap(painter, QRectF(62, 37, 25, 25), QPixmap(":images/setpoint_pretreat_right.png"));
           } else if (spm.iddObjectType() == SetpointManagerSingleZoneOneStageCooling::iddObjectType()) {
-            painter->drawPixmap(62, 37, 25, 25, QPixmap(":images/setpoint_onestage_cooling_right.png"));
+            drawDetailedPixmap(painter, QRectF(62, 37, 25, 25), QPixmap(":images/setpoint_onestage_cooling_right.png"));
           } else if (spm.iddObjectType() == SetpointManagerSingleZoneOneStageHeating::iddObjectType()) {
-            painter->drawPixmap(62, 37, 25, 25, QPixmap(":images/setpoint_onestage_heating_right.png"));
+            drawDetailedPixmap(painter, QRectF(62, 37, 25, 25), QPixmap(":images/setpoint_onestage_heating_right.png"));
           } else if (spm.iddObjectType() == SetpointManagerWarmestTemperatureFlow::iddObjectType()) {
-            painter->drawPixmap(62, 37, 25, 25, QPixmap(":images/setpoint_warmest_tempflow_right.png"));
+            drawDetailedPixmap(painter, QRectF(62, 37, 25, 25), QPixmap(":images/setpoint_warmest_tempflow_right.png"));
           } else if (spm.iddObjectType() == SetpointManagerSystemNodeResetTemperature::iddObjectType()) {
-            painter->drawPixmap(62, 37, 25, 25, QPixmap(":images/setpoint_systemnodereset_temperature_right.png"));
+            drawDetailedPixmap(painter, QRectF(62, 37, 25, 25), QPixmap(":images/setpoint_systemnodereset_temperature_right.png"));
           }
 
           break;
         } else {
           // These are the humidity ones
           if (spm.iddObjectType() == SetpointManagerMultiZoneHumidityMaximum::iddObjectType()) {
-            painter->drawPixmap(62, 37, 25, 25, QPixmap(":images/setpoint_multizone_humidity_max_right.png"));
+            drawDetailedPixmap(painter, QRectF(62, 37, 25, 25), QPixmap(":images/setpoint_multizone_humidity_max_right.png"));
           } else if (spm.iddObjectType() == SetpointManagerMultiZoneHumidityMinimum::iddObjectType()) {
-            painter->drawPixmap(62, 37, 25, 25, QPixmap(":images/setpoint_multizone_humidity_min_right.png"));
+            drawDetailedPixmap(painter, QRectF(62, 37, 25, 25), QPixmap(":images/setpoint_multizone_humidity_min_right.png"));
           } else if (spm.iddObjectType() == SetpointManagerMultiZoneMaximumHumidityAverage::iddObjectType()) {
-            painter->drawPixmap(62, 37, 25, 25, QPixmap(":images/setpoint_multizone_maxhumidity_avg_right.png"));
+            drawDetailedPixmap(painter, QRectF(62, 37, 25, 25), QPixmap(":images/setpoint_multizone_maxhumidity_avg_right.png"));
           } else if (spm.iddObjectType() == SetpointManagerMultiZoneMinimumHumidityAverage::iddObjectType()) {
-            painter->drawPixmap(62, 37, 25, 25, QPixmap(":images/setpoint_multizone_minhumidity_avg_right.png"));
+            drawDetailedPixmap(painter, QRectF(62, 37, 25, 25), QPixmap(":images/setpoint_multizone_minhumidity_avg_right.png"));
           } else if (spm.iddObjectType() == SetpointManagerSingleZoneHumidityMaximum::iddObjectType()) {
-            painter->drawPixmap(62, 37, 25, 25, QPixmap(":images/setpoint_singlezone_humidity_max_right.png"));
+            drawDetailedPixmap(painter, QRectF(62, 37, 25, 25), QPixmap(":images/setpoint_singlezone_humidity_max_right.png"));
           } else if (spm.iddObjectType() == SetpointManagerSingleZoneHumidityMinimum::iddObjectType()) {
-            painter->drawPixmap(62, 37, 25, 25, QPixmap(":images/setpoint_singlezone_humidity_min_right.png"));
+            drawDetailedPixmap(painter, QRectF(62, 37, 25, 25), QPixmap(":images/setpoint_singlezone_humidity_min_right.png"));
           } else if (spm.iddObjectType() == SetpointManagerSystemNodeResetHumidity::iddObjectType()) {
-            painter->drawPixmap(62, 37, 25, 25, QPixmap(":images/setpoint_systemnodereset_humidity_right.png"));
+            drawDetailedPixmap(painter, QRectF(62, 37, 25, 25), QPixmap(":images/setpoint_systemnodereset_humidity_right.png"));
           }
           break;
         }
@@ -2313,59 +2415,59 @@ void OAStraightNodeItem::paint(QPainter* painter, const QStyleOptionGraphicsItem
       for (auto& spm : node->setpointManagers()) {
         if (spm.controlVariable().find("Temperature") != std::string::npos) {
           if (spm.iddObjectType() == SetpointManagerMixedAir::iddObjectType()) {
-            painter->drawPixmap(62, 37, 25, 25, QPixmap(":images/setpoint_mixed.png"));
+            drawDetailedPixmap(painter, QRectF(62, 37, 25, 25), QPixmap(":images/setpoint_mixed.png"));
           } else if ((spm.iddObjectType() == SetpointManagerSingleZoneReheat::iddObjectType())
                      || (spm.iddObjectType() == SetpointManagerSingleZoneCooling::iddObjectType())
                      || (spm.iddObjectType() == SetpointManagerSingleZoneHeating::iddObjectType())) {
-            painter->drawPixmap(62, 37, 25, 25, QPixmap(":images/setpoint_singlezone.png"));
+            drawDetailedPixmap(painter, QRectF(62, 37, 25, 25), QPixmap(":images/setpoint_singlezone.png"));
           } else if (spm.iddObjectType() == SetpointManagerScheduled::iddObjectType()) {
-            painter->drawPixmap(62, 37, 25, 25, QPixmap(":images/setpoint_scheduled.png"));
+            drawDetailedPixmap(painter, QRectF(62, 37, 25, 25), QPixmap(":images/setpoint_scheduled.png"));
           } else if (spm.iddObjectType() == SetpointManagerScheduledDualSetpoint::iddObjectType()) {
-            painter->drawPixmap(62, 37, 25, 25, QPixmap(":images/setpoint_dual.png"));
+            drawDetailedPixmap(painter, QRectF(62, 37, 25, 25), QPixmap(":images/setpoint_dual.png"));
           } else if (spm.iddObjectType() == SetpointManagerWarmest::iddObjectType()) {
-            painter->drawPixmap(62, 37, 25, 25, QPixmap(":images/setpoint_warmest.png"));
+            drawDetailedPixmap(painter, QRectF(62, 37, 25, 25), QPixmap(":images/setpoint_warmest.png"));
           } else if (spm.iddObjectType() == SetpointManagerColdest::iddObjectType()) {
-            painter->drawPixmap(62, 37, 25, 25, QPixmap(":images/setpoint_coldest.png"));
+            drawDetailedPixmap(painter, QRectF(62, 37, 25, 25), QPixmap(":images/setpoint_coldest.png"));
           } else if (spm.iddObjectType() == SetpointManagerOutdoorAirReset::iddObjectType()) {
-            painter->drawPixmap(62, 37, 25, 25, QPixmap(":images/setpoint_outdoorair.png"));
+            drawDetailedPixmap(painter, QRectF(62, 37, 25, 25), QPixmap(":images/setpoint_outdoorair.png"));
           } else if (spm.iddObjectType() == SetpointManagerFollowGroundTemperature::iddObjectType()) {
-            painter->drawPixmap(62, 37, 25, 25, QPixmap(":images/setpoint_follow_ground_temp.png"));
+            drawDetailedPixmap(painter, QRectF(62, 37, 25, 25), QPixmap(":images/setpoint_follow_ground_temp.png"));
           } else if (spm.iddObjectType() == SetpointManagerFollowOutdoorAirTemperature::iddObjectType()) {
-            painter->drawPixmap(62, 37, 25, 25, QPixmap(":images/setpoint_follow_outdoorair.png"));
+            drawDetailedPixmap(painter, QRectF(62, 37, 25, 25), QPixmap(":images/setpoint_follow_outdoorair.png"));
           } else if (spm.iddObjectType() == SetpointManagerFollowSystemNodeTemperature::iddObjectType()) {
-            painter->drawPixmap(62, 37, 25, 25, QPixmap(":images/setpoint_follow_system_node.png"));
+            drawDetailedPixmap(painter, QRectF(62, 37, 25, 25), QPixmap(":images/setpoint_follow_system_node.png"));
           } else if (spm.iddObjectType() == SetpointManagerMultiZoneCoolingAverage::iddObjectType()) {
-            painter->drawPixmap(62, 37, 25, 25, QPixmap(":images/setpoint_multizone_cooling.png"));
+            drawDetailedPixmap(painter, QRectF(62, 37, 25, 25), QPixmap(":images/setpoint_multizone_cooling.png"));
           } else if (spm.iddObjectType() == SetpointManagerMultiZoneHeatingAverage::iddObjectType()) {
-            painter->drawPixmap(62, 37, 25, 25, QPixmap(":images/setpoint_multizone_heating.png"));
+            drawDetailedPixmap(painter, QRectF(62, 37, 25, 25), QPixmap(":images/setpoint_multizone_heating.png"));
           } else if (spm.iddObjectType() == SetpointManagerOutdoorAirPretreat::iddObjectType()) {
-            painter->drawPixmap(62, 37, 25, 25, QPixmap(":images/setpoint_pretreat.png"));
+            drawDetailedPixmap(painter, QRectF(62, 37, 25, 25), QPixmap(":images/setpoint_pretreat.png"));
           } else if (spm.iddObjectType() == SetpointManagerSingleZoneOneStageCooling::iddObjectType()) {
-            painter->drawPixmap(62, 37, 25, 25, QPixmap(":images/setpoint_onestage_cooling.png"));
+            drawDetailedPixmap(painter, QRectF(62, 37, 25, 25), QPixmap(":images/setpoint_onestage_cooling.png"));
           } else if (spm.iddObjectType() == SetpointManagerSingleZoneOneStageHeating::iddObjectType()) {
-            painter->drawPixmap(62, 37, 25, 25, QPixmap(":images/setpoint_onestage_heating.png"));
+            drawDetailedPixmap(painter, QRectF(62, 37, 25, 25), QPixmap(":images/setpoint_onestage_heating.png"));
           } else if (spm.iddObjectType() == SetpointManagerWarmestTemperatureFlow::iddObjectType()) {
-            painter->drawPixmap(62, 37, 25, 25, QPixmap(":images/setpoint_warmest_tempflow.png"));
+            drawDetailedPixmap(painter, QRectF(62, 37, 25, 25), QPixmap(":images/setpoint_warmest_tempflow.png"));
           } else if (spm.iddObjectType() == SetpointManagerSystemNodeResetTemperature::iddObjectType()) {
-            painter->drawPixmap(62, 37, 25, 25, QPixmap(":images/setpoint_systemnodereset_temperature.png"));
+            drawDetailedPixmap(painter, QRectF(62, 37, 25, 25), QPixmap(":images/setpoint_systemnodereset_temperature.png"));
           }
           break;
         } else {
           // These are the humidity ones
           if (spm.iddObjectType() == SetpointManagerMultiZoneHumidityMaximum::iddObjectType()) {
-            painter->drawPixmap(62, 37, 25, 25, QPixmap(":images/setpoint_multizone_humidity_max.png"));
+            drawDetailedPixmap(painter, QRectF(62, 37, 25, 25), QPixmap(":images/setpoint_multizone_humidity_max.png"));
           } else if (spm.iddObjectType() == SetpointManagerMultiZoneHumidityMinimum::iddObjectType()) {
-            painter->drawPixmap(62, 37, 25, 25, QPixmap(":images/setpoint_multizone_humidity_min.png"));
+            drawDetailedPixmap(painter, QRectF(62, 37, 25, 25), QPixmap(":images/setpoint_multizone_humidity_min.png"));
           } else if (spm.iddObjectType() == SetpointManagerMultiZoneMaximumHumidityAverage::iddObjectType()) {
-            painter->drawPixmap(62, 37, 25, 25, QPixmap(":images/setpoint_multizone_maxhumidity_avg.png"));
+            drawDetailedPixmap(painter, QRectF(62, 37, 25, 25), QPixmap(":images/setpoint_multizone_maxhumidity_avg.png"));
           } else if (spm.iddObjectType() == SetpointManagerMultiZoneMinimumHumidityAverage::iddObjectType()) {
-            painter->drawPixmap(62, 37, 25, 25, QPixmap(":images/setpoint_multizone_minhumidity_avg.png"));
+            drawDetailedPixmap(painter, QRectF(62, 37, 25, 25), QPixmap(":images/setpoint_multizone_minhumidity_avg.png"));
           } else if (spm.iddObjectType() == SetpointManagerSingleZoneHumidityMaximum::iddObjectType()) {
-            painter->drawPixmap(62, 37, 25, 25, QPixmap(":images/setpoint_singlezone_humidity_max.png"));
+            drawDetailedPixmap(painter, QRectF(62, 37, 25, 25), QPixmap(":images/setpoint_singlezone_humidity_max.png"));
           } else if (spm.iddObjectType() == SetpointManagerSingleZoneHumidityMinimum::iddObjectType()) {
-            painter->drawPixmap(62, 37, 25, 25, QPixmap(":images/setpoint_singlezone_humidity_min.png"));
+            drawDetailedPixmap(painter, QRectF(62, 37, 25, 25), QPixmap(":images/setpoint_singlezone_humidity_min.png"));
           } else if (spm.iddObjectType() == SetpointManagerSystemNodeResetHumidity::iddObjectType()) {
-            painter->drawPixmap(62, 37, 25, 25, QPixmap(":images/setpoint_systemnodereset_humidity.png"));
+            drawDetailedPixmap(painter, QRectF(62, 37, 25, 25), QPixmap(":images/setpoint_systemnodereset_humidity.png"));
           }
           break;
         }
@@ -2392,7 +2494,7 @@ void OAMixerItem::paint(QPainter* painter, const QStyleOptionGraphicsItem* optio
 
   if (modelObject()) {
     const QPixmap* qPixmap = IconLibrary::Instance().findIcon(modelObject()->iddObject().type().value());
-    painter->drawPixmap(0, 0, 200, 100, *qPixmap);
+    drawDetailedPixmap(painter, QRectF(0, 0, 200, 100), *qPixmap);
   }
 }
 
@@ -2453,7 +2555,7 @@ void SplitterItem::paint(QPainter* painter, const QStyleOptionGraphicsItem* opti
   int midpointIndex = m_numberBranches - 1;
   if (m_numberBranches == 1) {
     const QPixmap* qPixmap = IconLibrary::Instance().findIcon(modelObject()->iddObject().type().value());
-    painter->drawPixmap(12, (midpointIndex * 100) + 12, 75, 75, *qPixmap);
+    drawDetailedPixmap(painter, QRectF(12, (midpointIndex * 100) + 12, 75, 75), *qPixmap);
   }
 
   if (m_terminalTypes.empty()) {
@@ -2576,7 +2678,7 @@ void SupplySplitterItem::paint(QPainter* painter, const QStyleOptionGraphicsItem
     painter->drawLine(50, m_baselineBranchPositions.front() * 100 + 50, 50, m_baselineBranchPositions.back() * 100 + 50);
   } else {
     QPixmap qPixmap(":images/supply_splitter.png");
-    painter->drawPixmap(12, 12, 75, 75, qPixmap);
+    drawDetailedPixmap(painter, QRectF(12, 12, 75, 75), qPixmap);
   }
   painter->drawLine(0, (midpointIndex * 100) + 50, 50, (midpointIndex * 100) + 50);
 }
@@ -2631,7 +2733,7 @@ void MixerItem::paint(QPainter* painter, const QStyleOptionGraphicsItem* option,
   int midpointIndex = m_numberBranches - 1;
   if (m_numberBranches == 1) {
     const QPixmap* qPixmap = IconLibrary::Instance().findIcon(modelObject()->iddObject().type().value());
-    painter->drawPixmap(12, (midpointIndex * 100) + 12, 75, 75, *qPixmap);
+    drawDetailedPixmap(painter, QRectF(12, (midpointIndex * 100) + 12, 75, 75), *qPixmap);
   }
   painter->drawLine(0, (midpointIndex * 100) + 50, 50, (midpointIndex * 100) + 50);
 
@@ -2665,7 +2767,7 @@ void SupplyMixerItem::paint(QPainter* painter, const QStyleOptionGraphicsItem* o
   int midpointIndex = m_numberBranches - 1;
   if (m_numberBranches == 1) {
     QPixmap qPixmap(":/images/supply_mixer.png");
-    painter->drawPixmap(12, (midpointIndex * 100) + 12, 75, 75, qPixmap);
+    drawDetailedPixmap(painter, QRectF(12, (midpointIndex * 100) + 12, 75, 75), qPixmap);
   }
   painter->drawLine(50, (midpointIndex * 100) + 50, 100, (midpointIndex * 100) + 50);
 
@@ -694,6 +694,23 @@ class HorizontalBranchItem : public GridItem
   bool m_dualDuct;
 };
 
+// One parallel branch of an air loop demand side, as drawn by HorizontalBranchGroupItem
+struct DemandBranch
+{
+  // The zone, or the terminal or node when there is no zone, that the branch is laid out around
+  model::HVACComponent center;
+
+  // Everything from the splitter outlet to the mixer, mixer included
+  std::vector<model::ModelObject> components;
+
+  // True when the branch is a single path, i.e. it does not go through a plenum shared with other branches
+  bool isSinglePath = true;
+};
+
+// Walks each branch between the splitter and the mixer once and returns the branches sorted by the name of their center.
+// Building the graphics items from this snapshot avoids searching the whole demand side again for every terminal.
+std::vector<DemandBranch> demandBranches(model::Splitter& splitter, model::Mixer& mixer);
+
 class HorizontalBranchGroupItem : public GridItem
 {
  public:
@@ -938,21 +955,31 @@ class SystemItem : public GridItem
 
   QColor plenumColor(const Handle& plenumHandle);
 
+  // Recreate only the supply or demand half of the system, leaving the other half's items in place
+  void rebuildSupplySide();
+
+  void rebuildDemandSide();
+
  private:
   model::Loop m_loop;
 
   LoopScene* m_loopScene;
 
-  SupplySideItem* m_supplySideItem;
+  SupplySideItem* m_supplySideItem = nullptr;
 
-  DemandSideItem* m_demandSideItem;
+  DemandSideItem* m_demandSideItem = nullptr;
 
-  SystemCenterItem* m_systemCenterItem;
+  SystemCenterItem* m_systemCenterItem = nullptr;
 
   std::map<Handle, int> m_plenumIndexMap;
   std::map<Handle, QColor> m_plenumColorMap;
 
   int plenumIndex(const Handle& plenumHandle);
+
+  void updatePlenums();
+
+  // Positions and pads the two sides against each other and recreates the center item
+  void layoutSides();
 };
 
 class OneTwoFourStraightItem : public GridItem
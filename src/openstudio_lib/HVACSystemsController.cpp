@@ -144,7 +144,11 @@ const QString REFRIGERATION = "REFRIGERATION";
 const QString VRF = "VRF";
 
 HVACSystemsController::HVACSystemsController(bool isIP, const model::Model& model)
-  : m_hvacSystemsView(new HVACSystemsView()), m_updateMutex(new QMutex()), m_model(model), m_isIP(isIP) {
+  : m_hvacSystemsView(new HVACSystemsView()),
+    m_loopSceneCache(std::make_shared<LoopSceneCache>()),
+    m_updateMutex(new QMutex()),
+    m_model(model),
+    m_isIP(isIP) {
 
   m_hvacLayoutController = std::make_shared<HVACLayoutController>(this);
 
@@ -323,7 +327,15 @@ void HVACSystemsController::update() {
     // Show Controls, to avoid still displaying the name of a previously selected "Water Use Connection" object for eg
     m_hvacSystemsView->hvacToolbarView->showControls(true);
 
-    m_hvacLayoutController.reset();
+    // The topology view only needs to switch scenes, which the layout controller does from the cached loop scenes
+    bool showLoopTopology =
+      (handle != REFRIGERATION) && (handle != VRF) && m_hvacSystemsView->hvacToolbarView->topologyViewButton->isChecked();
+
+    if (showLoopTopology && m_hvacLayoutController) {
+      m_hvacLayoutController->updateLater();
+    } else {
+      m_hvacLayoutController.reset();
+    }
     m_hvacControlsController.reset();
     m_refrigerationController.reset();
     m_vrfController.reset();
@@ -383,7 +395,9 @@ void HVACSystemsController::update() {
     } else  // NOT VRF NOR REFRIGERATION
     {
       if (m_hvacSystemsView->hvacToolbarView->topologyViewButton->isChecked()) {
-        m_hvacLayoutController = std::make_shared<HVACLayoutController>(this);
+        if (!m_hvacLayoutController) {
+          m_hvacLayoutController = std::make_shared<HVACLayoutController>(this);
+        }
         m_hvacSystemsView->mainViewSwitcher->setView(m_hvacLayoutController->hvacGraphicsView());
 
         m_hvacSystemsView->hvacToolbarView->zoomInButton->setEnabled(true);
@@ -454,6 +468,10 @@ std::shared_ptr<HVACControlsController> HVACSystemsController::hvacControlsContr
   return m_hvacControlsController;
 }
 
+std::shared_ptr<LoopSceneCache> HVACSystemsController::loopSceneCache() const {
+  return m_loopSceneCache;
+}
+
 std::vector<IddObjectType> HVACSystemsController::systemComboBoxTypes() const {
   std::vector<IddObjectType> types;
 
@@ -485,6 +503,8 @@ void HVACSystemsController::onObjectRemoved(const WorkspaceObject& workspaceObje
   std::vector<IddObjectType> types = systemComboBoxTypes();
 
   if (std::find(types.begin(), types.end(), workspaceObject.cast<model::ModelObject>().iddObjectType()) != types.end()) {
+    m_loopSceneCache->remove(workspaceObject.handle());
+
     updateLater();
   }
 }
@@ -1500,9 +1520,11 @@ void HVACLayoutController::update() {
   if (m_dirty) {
     model::Model t_model = m_hvacSystemsController->model();
 
-    // Remove old stuff
+    // Remove old stuff, loop scenes are owned by the cache
     if (QGraphicsScene* oldScene = m_hvacGraphicsView->scene()) {
-      oldScene->deleteLater();
+      if (!qobject_cast<LoopScene*>(oldScene)) {
+        oldScene->deleteLater();
+      }
     }
 
     QString handle = m_hvacSystemsController->currentHandle();
@@ -1513,18 +1535,22 @@ void HVACLayoutController::update() {
       if (boost::optional<model::Loop> loop = mo->optionalCast<model::Loop>()) {
         m_hvacSystemsController->hvacSystemsView()->hvacToolbarView->showControls(true);
 
-        auto* loopScene = new LoopScene(loop.get());
+        LoopScene* loopScene = m_hvacSystemsController->loopSceneCache()->scene(loop.get());
+
+        // A cached scene may still hold the selection from the last time it was shown
+        loopScene->clearSelection();
 
         m_hvacGraphicsView->setScene(loopScene);
 
-        connect(loopScene, &LoopScene::modelObjectSelected, this, &HVACLayoutController::onModelObjectSelected);
+        // Cached scenes may already be connected to this controller
+        connect(loopScene, &LoopScene::modelObjectSelected, this, &HVACLayoutController::onModelObjectSelected, Qt::UniqueConnection);
 
-        connect(loopScene, &LoopScene::removeModelObjectClicked, this, &HVACLayoutController::removeModelObject);
+        connect(loopScene, &LoopScene::removeModelObjectClicked, this, &HVACLayoutController::removeModelObject, Qt::UniqueConnection);
 
-        connect(loopScene, &LoopScene::innerNodeClicked, this, &HVACLayoutController::goToOtherLoop);
+        connect(loopScene, &LoopScene::innerNodeClicked, this, &HVACLayoutController::goToOtherLoop, Qt::UniqueConnection);
 
         connect(loopScene, static_cast<void (LoopScene::*)(OSItemId, model::HVACComponent&)>(&LoopScene::hvacComponentDropped), this,
-                &HVACLayoutController::addLibraryObjectToModelNode);
+                &HVACLayoutController::addLibraryObjectToModelNode, Qt::UniqueConnection);
       } else if (boost::optional<model::WaterUseConnections> waterUseConnections = mo->optionalCast<model::WaterUseConnections>()) {
         m_hvacSystemsController->hvacSystemsView()->hvacToolbarView->showControls(false);
 
@@ -84,6 +84,7 @@ class RefrigerationController;
 class RefrigerationGridController;
 class RefrigerationGridView;
 class VRFController;
+class LoopSceneCache;
 
 class HVACSystemsController
   : public QObject
@@ -108,6 +109,9 @@ class HVACSystemsController
 
   std::shared_ptr<HVACControlsController> hvacControlsController() const;
 
+  // Loop scenes outlive the layout controller so switching systems or views can reuse them
+  std::shared_ptr<LoopSceneCache> loopSceneCache() const;
+
   model::Model model() const;
 
   // Indicates what object or system to display
@@ -166,6 +170,8 @@ class HVACSystemsController
 
   QPointer<HVACSystemsView> m_hvacSystemsView;
 
+  std::shared_ptr<LoopSceneCache> m_loopSceneCache;
+
   std::shared_ptr<HVACLayoutController> m_hvacLayoutController;
 
   std::shared_ptr<HVACControlsController> m_hvacControlsController;
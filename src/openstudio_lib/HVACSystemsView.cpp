@@ -48,6 +48,7 @@
 #include <QPainter>
 #include <QLabel>
 #include <QButtonGroup>
+#include <QElapsedTimer>
 
 namespace openstudio {
 
@@ -254,6 +255,24 @@ void HVACGraphicsView::resetZoom() {
   this->scale(0.65, 0.65);
 }
 
+void HVACGraphicsView::paintEvent(QPaintEvent* event) {
+  QElapsedTimer timer;
+  timer.start();
+
+  QGraphicsView::paintEvent(event);
+
+  m_lastFrameTime = static_cast<double>(timer.nsecsElapsed()) / 1.0e6;
+  m_averageFrameTime = (m_averageFrameTime == 0.0) ? m_lastFrameTime : (0.9 * m_averageFrameTime + 0.1 * m_lastFrameTime);
+}
+
+double HVACGraphicsView::lastFrameTime() const {
+  return m_lastFrameTime;
+}
+
+double HVACGraphicsView::averageFrameTime() const {
+  return m_averageFrameTime;
+}
+
 /* Controls tab for an AirLoopHVAC */
 HVACAirLoopControlsView::HVACAirLoopControlsView() {
   auto* widget = new QWidget();
@@ -119,6 +119,11 @@ class HVACGraphicsView : public QGraphicsView
 
   virtual ~HVACGraphicsView() = default;
 
+  // Time spent repainting the viewport, in milliseconds, for the last frame and as a moving average
+  double lastFrameTime() const;
+
+  double averageFrameTime() const;
+
  public slots:
 
   void zoomIn();
@@ -127,10 +132,17 @@ class HVACGraphicsView : public QGraphicsView
 
   void resetZoom();
 
+ protected:
+  void paintEvent(QPaintEvent* event) override;
+
  private:
   float m_zoomX = 0.0;
 
   float m_zoomY = 0.0;
+
+  double m_lastFrameTime = 0.0;
+
+  double m_averageFrameTime = 0.0;
 };
 
 /* Controls tab for an AirLoopHVAC */
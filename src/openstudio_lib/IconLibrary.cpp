@@ -30,6 +30,10 @@
 #include "IconLibrary.hpp"
 #include <openstudio/utilities/idd/IddEnums.hpp>
 #include <openstudio/utilities/idd/IddEnums.hxx>
+#include <openstudio/utilities/core/Assert.hpp>
+
+
+#include <algorithm>
 
 using std::map;
 
@@ -46,720 +50,710 @@ IconLibrary& IconLibrary::Instance() {
 }
 
 const QPixmap* IconLibrary::findIcon(unsigned int val) const {
-  auto i = m_icons.find(val);
-  if (i != m_icons.end()) {
-    return (*i).second;
-  } else {
+  return find(m_icons, val);
+}
+
+const QPixmap* IconLibrary::findMiniIcon(unsigned int val) const {
+  return find(m_miniIcons, val);
+}
+
+const QPixmap* IconLibrary::find(const IconTable& table, unsigned int val) {
+  auto lessType = [](const Icon& icon, unsigned int type) { return icon.type < type; };
+
+  auto i = std::lower_bound(table.begin(), table.end(), val, lessType);
+  if ((i == table.end()) || (i->type != val)) {
     // LOG(Debug, "Missing Icon for IddObjectType=" << openstudio::IddObjectType(v).valueName());
-    return m_icons.at(openstudio::IddObjectType(openstudio::IddObjectType::Catchall).value());
+    i = std::lower_bound(table.begin(), table.end(), openstudio::IddObjectType(openstudio::IddObjectType::Catchall).value(), lessType);
+    OS_ASSERT(i != table.end());
+  }
+
+  if (!i->loaded) {
+    i->pixmap = QPixmap(i->path);
+    i->loaded = true;
   }
+
+  return &i->pixmap;
 }
 
-const QPixmap* IconLibrary::findMiniIcon(unsigned int val) const {
-  auto i = m_miniIcons.find(val);
-  if (i != m_miniIcons.end()) {
-    return (*i).second;
-  } else {
-    // LOG(Debug, "Missing Mini Icon for IddObjectType=" << openstudio::IddObjectType(v).valueName());
-    return m_miniIcons.at(openstudio::IddObjectType(openstudio::IddObjectType::Catchall).value());
+IconLibrary::IconTable IconLibrary::makeTable(const std::map<unsigned int, QString>& paths) {
+  IconTable table;
+  table.reserve(paths.size());
+
+  // std::map is already sorted by type
+  for (const auto& [type, path] : paths) {
+    table.push_back(Icon{type, path});
   }
+
+  return table;
+}
+
+size_t IconLibrary::decodedCount() const {
+  auto isLoaded = [](const Icon& icon) { return icon.loaded; };
+  return std::count_if(m_icons.begin(), m_icons.end(), isLoaded) + std::count_if(m_miniIcons.begin(), m_miniIcons.end(), isLoaded);
 }
 
 IconLibrary::IconLibrary() {
+  // Only the resource paths are recorded here, see find()
+  std::map<unsigned int, QString> icons;
+  std::map<unsigned int, QString> miniIcons;
+
   // Default icon to avoid a crash
-  m_icons[openstudio::IddObjectType(openstudio::IddObjectType::Catchall).value()] = new QPixmap(":images/missing_icon.png");
+  icons[openstudio::IddObjectType(openstudio::IddObjectType::Catchall).value()] = ":images/missing_icon.png";
 
-  m_icons[openstudio::IddObjectType(openstudio::IddObjectType::OS_AirConditioner_VariableRefrigerantFlow).value()] =
-    new QPixmap(":images/vrf_outdoor.png");
-  m_icons[openstudio::IddObjectType(openstudio::IddObjectType::OS_AirLoopHVAC_OutdoorAirSystem).value()] = new QPixmap(":images/OAMixer.png");
-  m_icons[openstudio::IddObjectType(openstudio::IddObjectType::OS_AirLoopHVAC_UnitaryCoolOnly).value()] = new QPixmap(":images/DXCoolingCoil.png");
-  m_icons[openstudio::IddObjectType(openstudio::IddObjectType::OS_AirLoopHVAC_UnitaryHeatPump_AirToAir).value()] =
-    new QPixmap(":images/heat_pump3.png");
-  m_icons[openstudio::IddObjectType(openstudio::IddObjectType::OS_AirLoopHVAC_UnitaryHeatPump_AirToAir_MultiSpeed).value()] =
-    new QPixmap(":images/heat_pump3.png");
-  m_icons[openstudio::IddObjectType(openstudio::IddObjectType::OS_AirLoopHVAC_UnitarySystem).value()] = new QPixmap(":images/unitary_system.png");
-  m_icons[openstudio::IddObjectType(openstudio::IddObjectType::OS_AirLoopHVAC_UnitaryHeatCool_VAVChangeoverBypass).value()] =
-    new QPixmap(":images/unitary_system.png");
-  m_icons[openstudio::IddObjectType(openstudio::IddObjectType::OS_AirLoopHVAC_ReturnPlenum).value()] = new QPixmap(":images/mixer.png");
-  m_icons[openstudio::IddObjectType(openstudio::IddObjectType::OS_AirLoopHVAC_SupplyPlenum).value()] = new QPixmap(":images/splitter.png");
-  m_icons[openstudio::IddObjectType(openstudio::IddObjectType::OS_AirLoopHVAC_ZoneMixer).value()] = new QPixmap(":images/mixer.png");
-  m_icons[openstudio::IddObjectType(openstudio::IddObjectType::OS_AirLoopHVAC_ZoneSplitter).value()] = new QPixmap(":images/splitter.png");
-  m_icons[openstudio::IddObjectType(openstudio::IddObjectType::OS_AirTerminal_DualDuct_VAV).value()] =
-    new QPixmap(":images/airterminal_dualduct_vav.png");
-  m_icons[openstudio::IddObjectType(openstudio::IddObjectType::OS_AirTerminal_DualDuct_ConstantVolume).value()] =
-    new QPixmap(":images/airterminal_dualduct_constantvolume.png");
-  m_icons[openstudio::IddObjectType(openstudio::IddObjectType::OS_AirTerminal_DualDuct_VAV_OutdoorAir).value()] =
-    new QPixmap(":images/airterminal_dualduct_vav_outdoorair.png");
-  m_icons[openstudio::IddObjectType(openstudio::IddObjectType::OS_AirTerminal_SingleDuct_ConstantVolume_CooledBeam).value()] =
-    new QPixmap(":images/chilled_beam.png");
-  m_icons[openstudio::IddObjectType(openstudio::IddObjectType::OS_AirTerminal_SingleDuct_ConstantVolume_Reheat).value()] =
-    new QPixmap(":images/cav_reheat.png");
-  m_icons[openstudio::IddObjectType(openstudio::IddObjectType::OS_AirTerminal_SingleDuct_ConstantVolume_FourPipeInduction).value()] =
-    new QPixmap(":images/single_ducts_constant_vol_4pipe.png");
-  m_icons[openstudio::IddObjectType(openstudio::IddObjectType::OS_AirTerminal_SingleDuct_ConstantVolume_FourPipeBeam).value()] =
-    new QPixmap(":images/airterminal_fourpipebeam.png");
-  m_icons[openstudio::IddObjectType(openstudio::IddObjectType::OS_AirTerminal_SingleDuct_ParallelPIU_Reheat).value()] =
-    new QPixmap(":images/parallel_fan_terminal.png");
-  m_icons[openstudio::IddObjectType(openstudio::IddObjectType::OS_AirTerminal_SingleDuct_SeriesPIU_Reheat).value()] =
-    new QPixmap(":images/series_fan_terminal.png");
-  m_icons[openstudio::IddObjectType(openstudio::IddObjectType::OS_AirTerminal_SingleDuct_ConstantVolume_NoReheat).value()] =
-    new QPixmap(":images/direct-air.png");
-  m_icons[openstudio::IddObjectType(openstudio::IddObjectType::OS_AirTerminal_SingleDuct_VAV_NoReheat).value()] =
-    new QPixmap(":images/vav_noreheat.png");
-  m_icons[openstudio::IddObjectType(openstudio::IddObjectType::OS_AirTerminal_SingleDuct_VAV_Reheat).value()] = new QPixmap(":images/vav-reheat.png");
-  m_icons[openstudio::IddObjectType(openstudio::IddObjectType::OS_AirTerminal_SingleDuct_InletSideMixer).value()] =
-    new QPixmap(":images/air_terminal_inlet_mixer.png");
-  m_icons[openstudio::IddObjectType(openstudio::IddObjectType::OS_AirTerminal_SingleDuct_VAV_HeatAndCool_NoReheat).value()] =
-    new QPixmap(":images/vav_noreheat.png");
-  m_icons[openstudio::IddObjectType(openstudio::IddObjectType::OS_AirTerminal_SingleDuct_VAV_HeatAndCool_Reheat).value()] =
-    new QPixmap(":images/vav-reheat.png");
-  m_icons[openstudio::IddObjectType(openstudio::IddObjectType::OS_Boiler_HotWater).value()] = new QPixmap(":images/boiler.png");
-  m_icons[openstudio::IddObjectType(openstudio::IddObjectType::OS_Boiler_Steam).value()] = new QPixmap(":images/boiler_steam.png");
-  m_icons[openstudio::IddObjectType(openstudio::IddObjectType::OS_CentralHeatPumpSystem).value()] = new QPixmap(":images/centralheatpumpsystem.png");
-  m_icons[openstudio::IddObjectType(openstudio::IddObjectType::OS_Chiller_Electric_EIR).value()] = new QPixmap(":images/chiller_air.png");
-  m_icons[openstudio::IddObjectType(openstudio::IddObjectType::OS_Chiller_Absorption_Indirect).value()] =
-    new QPixmap(":images/chiller_absorption_indirect.png");
-  m_icons[openstudio::IddObjectType(openstudio::IddObjectType::OS_Chiller_Absorption).value()] = new QPixmap(":images/chiller_absorption_direct.png");
-  m_icons[openstudio::IddObjectType(openstudio::IddObjectType::OS_Coil_Cooling_DX_SingleSpeed).value()] =
-    new QPixmap(":images/dxcoolingcoil_singlespeed.png");
-  m_icons[openstudio::IddObjectType(openstudio::IddObjectType::OS_Coil_Cooling_DX_TwoSpeed).value()] =
-    new QPixmap(":images/dxcoolingcoil_2speed.png");
-  m_icons[openstudio::IddObjectType(openstudio::IddObjectType::OS_Coil_Cooling_DX_MultiSpeed).value()] =
-    new QPixmap(":images/dx_cooling_multispeed.png");
-  m_icons[openstudio::IddObjectType(openstudio::IddObjectType::OS_Coil_Cooling_DX_VariableSpeed).value()] =
-    new QPixmap(":images/cool_coil_dx_vari_speed.png");
-  m_icons[openstudio::IddObjectType(openstudio::IddObjectType::OS_Coil_Cooling_LowTemperatureRadiant_ConstantFlow).value()] =
-    new QPixmap(":images/coilcoolinglowtemprad_constflow.png");
-  m_icons[openstudio::IddObjectType(openstudio::IddObjectType::OS_Coil_Cooling_LowTemperatureRadiant_VariableFlow).value()] =
-    new QPixmap(":images/coilcoolinglowtemprad_varflow.png");
-  m_icons[openstudio::IddObjectType(openstudio::IddObjectType::OS_Coil_Cooling_WaterToAirHeatPump_EquationFit).value()] =
-    new QPixmap(":images/wahpDXCC.png");
-  m_icons[openstudio::IddObjectType(openstudio::IddObjectType::OS_Coil_Cooling_WaterToAirHeatPump_VariableSpeedEquationFit).value()] =
-    new QPixmap(":images/Coil_Cooling_WaterToAirHeatPump_VariableSpeedEquationFit.png");
-  m_icons[openstudio::IddObjectType(openstudio::IddObjectType::OS_Coil_Cooling_Water).value()] = new QPixmap(":images/cool_coil.png");
-  m_icons[openstudio::IddObjectType(openstudio::IddObjectType::OS_Coil_Cooling_Water_Panel_Radiant).value()] =
-    new QPixmap(":images/coilcooling_water_panel_radiant.png");
-  m_icons[openstudio::IddObjectType(openstudio::IddObjectType::OS_Coil_Heating_DX_SingleSpeed).value()] =
-    new QPixmap(":images/coil_ht_dx_singlespeed.png");
-  m_icons[openstudio::IddObjectType(openstudio::IddObjectType::OS_Coil_Heating_DX_VariableSpeed).value()] =
-    new QPixmap(":images/ht_coil_dx_vari.png");
-  m_icons[openstudio::IddObjectType(openstudio::IddObjectType::OS_Coil_Heating_Electric).value()] = new QPixmap(":images/electric_furnace.png");
-  m_icons[openstudio::IddObjectType(openstudio::IddObjectType::OS_Coil_Heating_Gas).value()] = new QPixmap(":images/furnace.png");
-  m_icons[openstudio::IddObjectType(openstudio::IddObjectType::OS_Coil_Heating_Gas_MultiStage).value()] =
-    new QPixmap(":images/furnace_multi_stage.png");
-  m_icons[openstudio::IddObjectType(openstudio::IddObjectType::OS_Coil_Heating_Water).value()] = new QPixmap(":images/heat_coil.png");
-  m_icons[openstudio::IddObjectType(openstudio::IddObjectType::OS_Coil_Heating_LowTemperatureRadiant_ConstantFlow).value()] =
-    new QPixmap(":images/coilheatinglowtemprad_constflow.png");
-  m_icons[openstudio::IddObjectType(openstudio::IddObjectType::OS_Coil_Heating_LowTemperatureRadiant_VariableFlow).value()] =
-    new QPixmap(":images/coilheatinglowtemprad_varflow.png");
-  m_icons[openstudio::IddObjectType(openstudio::IddObjectType::OS_Coil_Heating_WaterToAirHeatPump_EquationFit).value()] =
-    new QPixmap(":images/wahpDXHC.png");
-  m_icons[openstudio::IddObjectType(openstudio::IddObjectType::OS_Coil_Heating_WaterToAirHeatPump_VariableSpeedEquationFit).value()] =
-    new QPixmap(":images/Coil_Heating_WaterToAirHeatPump_VariableSpeedEquationFit.png");
-  m_icons[openstudio::IddObjectType(openstudio::IddObjectType::OS_CoolingTower_SingleSpeed).value()] = new QPixmap(":images/cooling_tower.png");
-  m_icons[openstudio::IddObjectType(openstudio::IddObjectType::OS_CoolingTower_TwoSpeed).value()] = new QPixmap(":images/cooling_tower_2speed.png");
-  m_icons[openstudio::IddObjectType(openstudio::IddObjectType::OS_CoolingTower_VariableSpeed).value()] =
-    new QPixmap(":images/cooling_tower_variable.png");
-  m_icons[openstudio::IddObjectType(openstudio::IddObjectType::OS_Connector_Mixer).value()] = new QPixmap(":images/mixer.png");
-  m_icons[openstudio::IddObjectType(openstudio::IddObjectType::OS_Connector_Splitter).value()] = new QPixmap(":images/splitter.png");
-  m_icons[openstudio::IddObjectType(openstudio::IddObjectType::OS_DistrictCooling).value()] = new QPixmap(":images/districtcooling.png");
-  m_icons[openstudio::IddObjectType(openstudio::IddObjectType::OS_DistrictHeating).value()] = new QPixmap(":images/districtheating.png");
-  m_icons[openstudio::IddObjectType(openstudio::IddObjectType::OS_Duct).value()] = new QPixmap(":images/duct.png");
-  m_icons[openstudio::IddObjectType(openstudio::IddObjectType::OS_EvaporativeCooler_Direct_ResearchSpecial).value()] =
-    new QPixmap(":images/directEvap.png");
-  m_icons[openstudio::IddObjectType(openstudio::IddObjectType::OS_EvaporativeCooler_Indirect_ResearchSpecial).value()] =
-    new QPixmap(":images/indirectEvap.png");
-  m_icons[openstudio::IddObjectType(openstudio::IddObjectType::OS_Fan_ComponentModel).value()] = new QPixmap(":images/fan_componentmodel.png");
-  m_icons[openstudio::IddObjectType(openstudio::IddObjectType::OS_Fan_ConstantVolume).value()] = new QPixmap(":images/fan_constant.png");
-  m_icons[openstudio::IddObjectType(openstudio::IddObjectType::OS_Fan_OnOff).value()] = new QPixmap(":images/fan_on_off.png");
-  m_icons[openstudio::IddObjectType(openstudio::IddObjectType::OS_Fan_SystemModel).value()] = new QPixmap(":images/fan_systemmodel.png");
-  m_icons[openstudio::IddObjectType(openstudio::IddObjectType::OS_Fan_VariableVolume).value()] = new QPixmap(":images/fan_variable.png");
-  m_icons[openstudio::IddObjectType(openstudio::IddObjectType::OS_Fan_ZoneExhaust).value()] = new QPixmap(":images/fan_zoneexhaust.png");
-  m_icons[openstudio::IddObjectType(openstudio::IddObjectType::OS_FluidCooler_SingleSpeed).value()] = new QPixmap(":images/fluid_cooler_single.png");
-  m_icons[openstudio::IddObjectType(openstudio::IddObjectType::OS_FluidCooler_TwoSpeed).value()] = new QPixmap(":images/fluid_cooler_two.png");
-  m_icons[openstudio::IddObjectType(openstudio::IddObjectType::OS_GroundHeatExchanger_Vertical).value()] =
-    new QPixmap(":images/ground_heat_exchanger_vertical.png");
-  m_icons[openstudio::IddObjectType(openstudio::IddObjectType::OS_GroundHeatExchanger_HorizontalTrench).value()] =
-    new QPixmap(":images/ground_heat_exchanger_horizontal.png");
-  m_icons[openstudio::IddObjectType(openstudio::IddObjectType::OS_HeaderedPumps_ConstantSpeed).value()] =
-    new QPixmap(":images/headered_pumps_constant.png");
-  m_icons[openstudio::IddObjectType(openstudio::IddObjectType::OS_HeaderedPumps_VariableSpeed).value()] =
-    new QPixmap(":images/headered_pumps_variable.png");
-  m_icons[openstudio::IddObjectType(openstudio::IddObjectType::OS_HeatExchanger_AirToAir_SensibleAndLatent).value()] =
-    new QPixmap(":images/heat_transfer_outdoorair.png");
-  m_icons[openstudio::IddObjectType(openstudio::IddObjectType::OS_HeatExchanger_FluidToFluid).value()] = new QPixmap(":images/fluid_hx.png");
-  m_icons[openstudio::IddObjectType(openstudio::IddObjectType::OS_HeatPump_WaterToWater_EquationFit_Cooling).value()] =
-    new QPixmap(":images/heatpump_watertowater_equationfit_cooling.png");
-  m_icons[openstudio::IddObjectType(openstudio::IddObjectType::OS_HeatPump_WaterToWater_EquationFit_Heating).value()] =
-    new QPixmap(":images/heatpump_watertowater_equationfit_heating.png");
-  m_icons[openstudio::IddObjectType(openstudio::IddObjectType::OS_Humidifier_Steam_Electric).value()] =
-    new QPixmap(":images/electric_humidifier.png");
-  m_icons[openstudio::IddObjectType(openstudio::IddObjectType::OS_Humidifier_Steam_Gas).value()] = new QPixmap(":images/gas_humidifier.png");
-  m_icons[openstudio::IddObjectType(openstudio::IddObjectType::OS_EvaporativeFluidCooler_SingleSpeed).value()] =
-    new QPixmap(":images/evap_fluid_cooler.png");
-  m_icons[openstudio::IddObjectType(openstudio::IddObjectType::OS_EvaporativeFluidCooler_TwoSpeed).value()] =
-    new QPixmap(":images/evap_fluid_cooler_two_speed.png");
-  m_icons[openstudio::IddObjectType(openstudio::IddObjectType::OS_Generator_FuelCell_ExhaustGasToWaterHeatExchanger).value()] =
-    new QPixmap(":images/generator_fuelcell_exhaustgastowaterheatexchanger.png");
-  m_icons[openstudio::IddObjectType(openstudio::IddObjectType::OS_Generator_MicroTurbine_HeatRecovery).value()] =
-    new QPixmap(":images/generator_microturbine_heatrecovery.png");
-  m_icons[openstudio::IddObjectType(openstudio::IddObjectType::OS_LoadProfile_Plant).value()] = new QPixmap(":images/plant_profile.png");
-  m_icons[openstudio::IddObjectType(openstudio::IddObjectType::OS_Pipe_Adiabatic).value()] = new QPixmap(":images/pipe.png");
-  m_icons[openstudio::IddObjectType(openstudio::IddObjectType::OS_Pipe_Indoor).value()] = new QPixmap(":images/pipe_indoor.png");
-  m_icons[openstudio::IddObjectType(openstudio::IddObjectType::OS_Pipe_Outdoor).value()] = new QPixmap(":images/pipe_outdoor.png");
-  m_icons[openstudio::IddObjectType(openstudio::IddObjectType::OS_PlantComponent_TemperatureSource).value()] =
-    new QPixmap(":images/plant_temp_source.png");
-  m_icons[openstudio::IddObjectType(openstudio::IddObjectType::OS_PlantComponent_UserDefined).value()] = new QPixmap(":images/user_defined.png");
-  m_icons[openstudio::IddObjectType(openstudio::IddObjectType::OS_Pump_ConstantSpeed).value()] = new QPixmap(":images/pump_constant.png");
-  m_icons[openstudio::IddObjectType(openstudio::IddObjectType::OS_Pump_VariableSpeed).value()] = new QPixmap(":images/pump_variable.png");
-  m_icons[openstudio::IddObjectType(openstudio::IddObjectType::OS_Refrigeration_Condenser_AirCooled).value()] = new QPixmap(":images/air_cooled.png");
-  m_icons[openstudio::IddObjectType(openstudio::IddObjectType::OS_Refrigeration_Condenser_Cascade).value()] =
-    new QPixmap(":images/condenser_cascade.png");
-  m_icons[openstudio::IddObjectType(openstudio::IddObjectType::OS_Refrigeration_Condenser_EvaporativeCooled).value()] =
-    new QPixmap(":images/evap_cooled.png");
-  m_icons[openstudio::IddObjectType(openstudio::IddObjectType::OS_Refrigeration_Condenser_WaterCooled).value()] =
-    new QPixmap(":images/water_cooled.png");
-  m_icons[openstudio::IddObjectType(openstudio::IddObjectType::OS_SolarCollector_FlatPlate_PhotovoltaicThermal).value()] =
-    new QPixmap(":images/solarcollector_flatplate_photovoltaicthermal.png");
-  m_icons[openstudio::IddObjectType(openstudio::IddObjectType::OS_SolarCollector_FlatPlate_Water).value()] =
-    new QPixmap(":images/solarcollector_flatplate_water.png");
-  m_icons[openstudio::IddObjectType(openstudio::IddObjectType::OS_SolarCollector_IntegralCollectorStorage).value()] =
-    new QPixmap(":images/solarcollector_integralstorage.png");
-  m_icons[openstudio::IddObjectType(openstudio::IddObjectType::OS_TemperingValve).value()] = new QPixmap(":images/tempering_valve.png");
-  m_icons[openstudio::IddObjectType(openstudio::IddObjectType::OS_ThermalZone).value()] = new QPixmap(":images/zone.png");
-  m_icons[openstudio::IddObjectType(openstudio::IddObjectType::OS_ThermalStorage_Ice_Detailed).value()] =
-    new QPixmap(":images/thermal_storage_ice.png");
-  m_icons[openstudio::IddObjectType(openstudio::IddObjectType::OS_ThermalStorage_ChilledWater_Stratified).value()] =
-    new QPixmap(":images/thermal_storage_strat.png");
-  m_icons[openstudio::IddObjectType(openstudio::IddObjectType::OS_WaterHeater_HeatPump).value()] = new QPixmap(":images/water_heater.png");
-  m_icons[openstudio::IddObjectType(openstudio::IddObjectType::OS_WaterHeater_Mixed).value()] = new QPixmap(":images/water_heater_mixed.png");
-  m_icons[openstudio::IddObjectType(openstudio::IddObjectType::OS_WaterHeater_Stratified).value()] =
-    new QPixmap(":images/water_heater_stratified.png");
-  m_icons[openstudio::IddObjectType(openstudio::IddObjectType::OS_WaterUse_Connections).value()] = new QPixmap(":images/water_connection.png");
-  m_icons[openstudio::IddObjectType(openstudio::IddObjectType::OS_WaterUse_Equipment).value()] = new QPixmap(":images/sink.png");
-  m_icons[openstudio::IddObjectType(openstudio::IddObjectType::OS_ZoneHVAC_Baseboard_RadiantConvective_Electric).value()] =
-    new QPixmap("images/baseboard_rad_convect_electric.png");
-  m_icons[openstudio::IddObjectType(openstudio::IddObjectType::OS_ZoneHVAC_Baseboard_RadiantConvective_Water).value()] =
-    new QPixmap("images/baseboard_rad_convect_water.png");
-  m_icons[openstudio::IddObjectType(openstudio::IddObjectType::OS_ZoneHVAC_Baseboard_Convective_Electric).value()] =
-    new QPixmap(":images/baseboard_electric.png");
-  m_icons[openstudio::IddObjectType(openstudio::IddObjectType::OS_ZoneHVAC_Baseboard_Convective_Water).value()] =
-    new QPixmap(":images/baseboard_water.png");
-  m_icons[openstudio::IddObjectType(openstudio::IddObjectType::OS_ZoneHVAC_CoolingPanel_RadiantConvective_Water).value()] =
-    new QPixmap(":images/zonehvac_coolingpanel_radiantconvective_water.png");
-  m_icons[openstudio::IddObjectType(openstudio::IddObjectType::OS_ZoneHVAC_Dehumidifier_DX).value()] = new QPixmap(":images/dehumidifier_dx.png");
-  m_icons[openstudio::IddObjectType(openstudio::IddObjectType::OS_ZoneHVAC_EnergyRecoveryVentilator).value()] =
-    new QPixmap(":images/energy_recov_vent.png");
-  m_icons[openstudio::IddObjectType(openstudio::IddObjectType::OS_Coil_Heating_Water_Baseboard).value()] =
-    new QPixmap(":images/coilheatingwater_baseboard.png");
-  m_icons[openstudio::IddObjectType(openstudio::IddObjectType::OS_Coil_Heating_Water_Baseboard_Radiant).value()] =
-    new QPixmap(":images/Coil_Heating_Water_Baseboard_Radiant.png");
-  m_icons[openstudio::IddObjectType(openstudio::IddObjectType::OS_Coil_Cooling_CooledBeam).value()] =
-    new QPixmap(":images/coilcoolingchilledbeam.png");
-  m_icons[openstudio::IddObjectType(openstudio::IddObjectType::OS_Coil_Cooling_FourPipeBeam).value()] =
-    new QPixmap(":images/coilcoolingfourpipebeam.png");
-  m_icons[openstudio::IddObjectType(openstudio::IddObjectType::OS_Coil_Heating_FourPipeBeam).value()] =
-    new QPixmap(":images/coilheatingfourpipebeam.png");
-  m_icons[openstudio::IddObjectType(openstudio::IddObjectType::OS_Coil_Heating_Desuperheater).value()] =
-    new QPixmap(":images/coilheatingdesuperheater.png");
-  m_icons[openstudio::IddObjectType(openstudio::IddObjectType::OS_Coil_Cooling_DX_TwoStageWithHumidityControlMode).value()] =
-    new QPixmap(":images/dxcoolingcoil_2stage_humidity.png");
-  m_icons[openstudio::IddObjectType(openstudio::IddObjectType::OS_CoilSystem_Cooling_Water_HeatExchangerAssisted).value()] =
-    new QPixmap(":images/coil_system_coolingwater_heat_exchanger.png");
-  m_icons[openstudio::IddObjectType(openstudio::IddObjectType::OS_CoilSystem_Cooling_DX_HeatExchangerAssisted).value()] =
-    new QPixmap(":images/coilsystem_cooling_dx.png");
-  m_icons[openstudio::IddObjectType(openstudio::IddObjectType::OS_ZoneHVAC_FourPipeFanCoil).value()] = new QPixmap(":images/four_pipe_fan_coil.png");
-  m_icons[openstudio::IddObjectType(openstudio::IddObjectType::OS_ZoneHVAC_HighTemperatureRadiant).value()] =
-    new QPixmap(":images/hightempradiant.png");
-  m_icons[openstudio::IddObjectType(openstudio::IddObjectType::OS_ZoneHVAC_LowTemperatureRadiant_VariableFlow).value()] =
-    new QPixmap(":images/lowtempradiant_varflow.png");
-  m_icons[openstudio::IddObjectType(openstudio::IddObjectType::OS_ZoneHVAC_LowTemperatureRadiant_VariableFlow).value()] =
-    new QPixmap(":images/lowtempradiant_varflow.png");
-  m_icons[openstudio::IddObjectType(openstudio::IddObjectType::OS_ZoneHVAC_LowTemperatureRadiant_ConstantFlow).value()] =
-    new QPixmap(":images/lowtempradiant_constflow.png");
-  m_icons[openstudio::IddObjectType(openstudio::IddObjectType::OS_ZoneHVAC_PackagedTerminalAirConditioner).value()] =
-    new QPixmap(":images/system_type_1.png");
-  m_icons[openstudio::IddObjectType(openstudio::IddObjectType::OS_ZoneHVAC_PackagedTerminalHeatPump).value()] =
-    new QPixmap(":images/system_type_2.png");
-  m_icons[openstudio::IddObjectType(openstudio::IddObjectType::OS_ZoneHVAC_TerminalUnit_VariableRefrigerantFlow).value()] =
-    new QPixmap(":images/vrf_unit.png");
-  m_icons[openstudio::IddObjectType(openstudio::IddObjectType::OS_ZoneHVAC_WaterToAirHeatPump).value()] = new QPixmap(":images/watertoairHP.png");
-  m_icons[openstudio::IddObjectType(openstudio::IddObjectType::OS_ZoneHVAC_UnitHeater).value()] = new QPixmap(":images/heat_coil-uht.png");
-  m_icons[openstudio::IddObjectType(openstudio::IddObjectType::OS_ZoneHVAC_UnitVentilator).value()] = new QPixmap(":images/unit_ventilator.png");
+  icons[openstudio::IddObjectType(openstudio::IddObjectType::OS_AirConditioner_VariableRefrigerantFlow).value()] =
+    ":images/vrf_outdoor.png";
+  icons[openstudio::IddObjectType(openstudio::IddObjectType::OS_AirLoopHVAC_OutdoorAirSystem).value()] = ":images/OAMixer.png";
+  icons[openstudio::IddObjectType(openstudio::IddObjectType::OS_AirLoopHVAC_UnitaryCoolOnly).value()] = ":images/DXCoolingCoil.png";
+  icons[openstudio::IddObjectType(openstudio::IddObjectType::OS_AirLoopHVAC_UnitaryHeatPump_AirToAir).value()] = ":images/heat_pump3.png";
+  icons[openstudio::IddObjectType(openstudio::IddObjectType::OS_AirLoopHVAC_UnitaryHeatPump_AirToAir_MultiSpeed).value()] =
+    ":images/heat_pump3.png";
+  icons[openstudio::IddObjectType(openstudio::IddObjectType::OS_AirLoopHVAC_UnitarySystem).value()] = ":images/unitary_system.png";
+  icons[openstudio::IddObjectType(openstudio::IddObjectType::OS_AirLoopHVAC_UnitaryHeatCool_VAVChangeoverBypass).value()] =
+    ":images/unitary_system.png";
+  icons[openstudio::IddObjectType(openstudio::IddObjectType::OS_AirLoopHVAC_ReturnPlenum).value()] = ":images/mixer.png";
+  icons[openstudio::IddObjectType(openstudio::IddObjectType::OS_AirLoopHVAC_SupplyPlenum).value()] = ":images/splitter.png";
+  icons[openstudio::IddObjectType(openstudio::IddObjectType::OS_AirLoopHVAC_ZoneMixer).value()] = ":images/mixer.png";
+  icons[openstudio::IddObjectType(openstudio::IddObjectType::OS_AirLoopHVAC_ZoneSplitter).value()] = ":images/splitter.png";
+  icons[openstudio::IddObjectType(openstudio::IddObjectType::OS_AirTerminal_DualDuct_VAV).value()] = ":images/airterminal_dualduct_vav.png";
+  icons[openstudio::IddObjectType(openstudio::IddObjectType::OS_AirTerminal_DualDuct_ConstantVolume).value()] =
+    ":images/airterminal_dualduct_constantvolume.png";
+  icons[openstudio::IddObjectType(openstudio::IddObjectType::OS_AirTerminal_DualDuct_VAV_OutdoorAir).value()] =
+    ":images/airterminal_dualduct_vav_outdoorair.png";
+  icons[openstudio::IddObjectType(openstudio::IddObjectType::OS_AirTerminal_SingleDuct_ConstantVolume_CooledBeam).value()] =
+    ":images/chilled_beam.png";
+  icons[openstudio::IddObjectType(openstudio::IddObjectType::OS_AirTerminal_SingleDuct_ConstantVolume_Reheat).value()] =
+    ":images/cav_reheat.png";
+  icons[openstudio::IddObjectType(openstudio::IddObjectType::OS_AirTerminal_SingleDuct_ConstantVolume_FourPipeInduction).value()] =
+    ":images/single_ducts_constant_vol_4pipe.png";
+  icons[openstudio::IddObjectType(openstudio::IddObjectType::OS_AirTerminal_SingleDuct_ConstantVolume_FourPipeBeam).value()] =
+    ":images/airterminal_fourpipebeam.png";
+  icons[openstudio::IddObjectType(openstudio::IddObjectType::OS_AirTerminal_SingleDuct_ParallelPIU_Reheat).value()] =
+    ":images/parallel_fan_terminal.png";
+  icons[openstudio::IddObjectType(openstudio::IddObjectType::OS_AirTerminal_SingleDuct_SeriesPIU_Reheat).value()] =
+    ":images/series_fan_terminal.png";
+  icons[openstudio::IddObjectType(openstudio::IddObjectType::OS_AirTerminal_SingleDuct_ConstantVolume_NoReheat).value()] =
+    ":images/direct-air.png";
+  icons[openstudio::IddObjectType(openstudio::IddObjectType::OS_AirTerminal_SingleDuct_VAV_NoReheat).value()] = ":images/vav_noreheat.png";
+  icons[openstudio::IddObjectType(openstudio::IddObjectType::OS_AirTerminal_SingleDuct_VAV_Reheat).value()] = ":images/vav-reheat.png";
+  icons[openstudio::IddObjectType(openstudio::IddObjectType::OS_AirTerminal_SingleDuct_InletSideMixer).value()] =
+    ":images/air_terminal_inlet_mixer.png";
+  icons[openstudio::IddObjectType(openstudio::IddObjectType::OS_AirTerminal_SingleDuct_VAV_HeatAndCool_NoReheat).value()] =
+    ":images/vav_noreheat.png";
+  icons[openstudio::IddObjectType(openstudio::IddObjectType::OS_AirTerminal_SingleDuct_VAV_HeatAndCool_Reheat).value()] =
+    ":images/vav-reheat.png";
+  icons[openstudio::IddObjectType(openstudio::IddObjectType::OS_Boiler_HotWater).value()] = ":images/boiler.png";
+  icons[openstudio::IddObjectType(openstudio::IddObjectType::OS_Boiler_Steam).value()] = ":images/boiler_steam.png";
+  icons[openstudio::IddObjectType(openstudio::IddObjectType::OS_CentralHeatPumpSystem).value()] = ":images/centralheatpumpsystem.png";
+  icons[openstudio::IddObjectType(openstudio::IddObjectType::OS_Chiller_Electric_EIR).value()] = ":images/chiller_air.png";
+  icons[openstudio::IddObjectType(openstudio::IddObjectType::OS_Chiller_Absorption_Indirect).value()] =
+    ":images/chiller_absorption_indirect.png";
+  icons[openstudio::IddObjectType(openstudio::IddObjectType::OS_Chiller_Absorption).value()] = ":images/chiller_absorption_direct.png";
+  icons[openstudio::IddObjectType(openstudio::IddObjectType::OS_Coil_Cooling_DX_SingleSpeed).value()] =
+    ":images/dxcoolingcoil_singlespeed.png";
+  icons[openstudio::IddObjectType(openstudio::IddObjectType::OS_Coil_Cooling_DX_TwoSpeed).value()] = ":images/dxcoolingcoil_2speed.png";
+  icons[openstudio::IddObjectType(openstudio::IddObjectType::OS_Coil_Cooling_DX_MultiSpeed).value()] = ":images/dx_cooling_multispeed.png";
+  icons[openstudio::IddObjectType(openstudio::IddObjectType::OS_Coil_Cooling_DX_VariableSpeed).value()] =
+    ":images/cool_coil_dx_vari_speed.png";
+  icons[openstudio::IddObjectType(openstudio::IddObjectType::OS_Coil_Cooling_LowTemperatureRadiant_ConstantFlow).value()] =
+    ":images/coilcoolinglowtemprad_constflow.png";
+  icons[openstudio::IddObjectType(openstudio::IddObjectType::OS_Coil_Cooling_LowTemperatureRadiant_VariableFlow).value()] =
+    ":images/coilcoolinglowtemprad_varflow.png";
+  icons[openstudio::IddObjectType(openstudio::IddObjectType::OS_Coil_Cooling_WaterToAirHeatPump_EquationFit).value()] =
+    ":images/wahpDXCC.png";
+  icons[openstudio::IddObjectType(openstudio::IddObjectType::OS_Coil_Cooling_WaterToAirHeatPump_VariableSpeedEquationFit).value()] =
+    ":images/Coil_Cooling_WaterToAirHeatPump_VariableSpeedEquationFit.png";
+  icons[openstudio::IddObjectType(openstudio::IddObjectType::OS_Coil_Cooling_Water).value()] = ":images/cool_coil.png";
+  icons[openstudio::IddObjectType(openstudio::IddObjectType::OS_Coil_Cooling_Water_Panel_Radiant).value()] =
+    ":images/coilcooling_water_panel_radiant.png";
+  icons[openstudio::IddObjectType(openstudio::IddObjectType::OS_Coil_Heating_DX_SingleSpeed).value()] =
+    ":images/coil_ht_dx_singlespeed.png";
+  icons[openstudio::IddObjectType(openstudio::IddObjectType::OS_Coil_Heating_DX_VariableSpeed).value()] = ":images/ht_coil_dx_vari.png";
+  icons[openstudio::IddObjectType(openstudio::IddObjectType::OS_Coil_Heating_Electric).value()] = ":images/electric_furnace.png";
+  icons[openstudio::IddObjectType(openstudio::IddObjectType::OS_Coil_Heating_Gas).value()] = ":images/furnace.png";
+  icons[openstudio::IddObjectType(openstudio::IddObjectType::OS_Coil_Heating_Gas_MultiStage).value()] = ":images/furnace_multi_stage.png";
+  icons[openstudio::IddObjectType(openstudio::IddObjectType::OS_Coil_Heating_Water).value()] = ":images/heat_coil.png";
+  icons[openstudio::IddObjectType(openstudio::IddObjectType::OS_Coil_Heating_LowTemperatureRadiant_ConstantFlow).value()] =
+    ":images/coilheatinglowtemprad_constflow.png";
+  icons[openstudio::IddObjectType(openstudio::IddObjectType::OS_Coil_Heating_LowTemperatureRadiant_VariableFlow).value()] =
+    ":images/coilheatinglowtemprad_varflow.png";
+  icons[openstudio::IddObjectType(openstudio::IddObjectType::OS_Coil_Heating_WaterToAirHeatPump_EquationFit).value()] =
+    ":images/wahpDXHC.png";
+  icons[openstudio::IddObjectType(openstudio::IddObjectType::OS_Coil_Heating_WaterToAirHeatPump_VariableSpeedEquationFit).value()] =
+    ":images/Coil_Heating_WaterToAirHeatPump_VariableSpeedEquationFit.png";
+  icons[openstudio::IddObjectType(openstudio::IddObjectType::OS_CoolingTower_SingleSpeed).value()] = ":images/cooling_tower.png";
+  icons[openstudio::IddObjectType(openstudio::IddObjectType::OS_CoolingTower_TwoSpeed).value()] = ":images/cooling_tower_2speed.png";
+  icons[openstudio::IddObjectType(openstudio::IddObjectType::OS_CoolingTower_VariableSpeed).value()] = ":images/cooling_tower_variable.png";
+  icons[openstudio::IddObjectType(openstudio::IddObjectType::OS_Connector_Mixer).value()] = ":images/mixer.png";
+  icons[openstudio::IddObjectType(openstudio::IddObjectType::OS_Connector_Splitter).value()] = ":images/splitter.png";
+  icons[openstudio::IddObjectType(openstudio::IddObjectType::OS_DistrictCooling).value()] = ":images/districtcooling.png";
+  icons[openstudio::IddObjectType(openstudio::IddObjectType::OS_DistrictHeating).value()] = ":images/districtheating.png";
+  icons[openstudio::IddObjectType(openstudio::IddObjectType::OS_Duct).value()] = ":images/duct.png";
+  icons[openstudio::IddObjectType(openstudio::IddObjectType::OS_EvaporativeCooler_Direct_ResearchSpecial).value()] =
+    ":images/directEvap.png";
+  icons[openstudio::IddObjectType(openstudio::IddObjectType::OS_EvaporativeCooler_Indirect_ResearchSpecial).value()] =
+    ":images/indirectEvap.png";
+  icons[openstudio::IddObjectType(openstudio::IddObjectType::OS_Fan_ComponentModel).value()] = ":images/fan_componentmodel.png";
+  icons[openstudio::IddObjectType(openstudio::IddObjectType::OS_Fan_ConstantVolume).value()] = ":images/fan_constant.png";
+  icons[openstudio::IddObjectType(openstudio::IddObjectType::OS_Fan_OnOff).value()] = ":images/fan_on_off.png";
+  icons[openstudio::IddObjectType(openstudio::IddObjectType::OS_Fan_SystemModel).value()] = ":images/fan_systemmodel.png";
+  icons[openstudio::IddObjectType(openstudio::IddObjectType::OS_Fan_VariableVolume).value()] = ":images/fan_variable.png";
+  icons[openstudio::IddObjectType(openstudio::IddObjectType::OS_Fan_ZoneExhaust).value()] = ":images/fan_zoneexhaust.png";
+  icons[openstudio::IddObjectType(openstudio::IddObjectType::OS_FluidCooler_SingleSpeed).value()] = ":images/fluid_cooler_single.png";
+  icons[openstudio::IddObjectType(openstudio::IddObjectType::OS_FluidCooler_TwoSpeed).value()] = ":images/fluid_cooler_two.png";
+  icons[openstudio::IddObjectType(openstudio::IddObjectType::OS_GroundHeatExchanger_Vertical).value()] =
+    ":images/ground_heat_exchanger_vertical.png";
+  icons[openstudio::IddObjectType(openstudio::IddObjectType::OS_GroundHeatExchanger_HorizontalTrench).value()] =
+    ":images/ground_heat_exchanger_horizontal.png";
+  icons[openstudio::IddObjectType(openstudio::IddObjectType::OS_HeaderedPumps_ConstantSpeed).value()] =
+    ":images/headered_pumps_constant.png";
+  icons[openstudio::IddObjectType(openstudio::IddObjectType::OS_HeaderedPumps_VariableSpeed).value()] =
+    ":images/headered_pumps_variable.png";
+  icons[openstudio::IddObjectType(openstudio::IddObjectType::OS_HeatExchanger_AirToAir_SensibleAndLatent).value()] =
+    ":images/heat_transfer_outdoorair.png";
+  icons[openstudio::IddObjectType(openstudio::IddObjectType::OS_HeatExchanger_FluidToFluid).value()] = ":images/fluid_hx.png";
+  icons[openstudio::IddObjectType(openstudio::IddObjectType::OS_HeatPump_WaterToWater_EquationFit_Cooling).value()] =
+    ":images/heatpump_watertowater_equationfit_cooling.png";
+  icons[openstudio::IddObjectType(openstudio::IddObjectType::OS_HeatPump_WaterToWater_EquationFit_Heating).value()] =
+    ":images/heatpump_watertowater_equationfit_heating.png";
+  icons[openstudio::IddObjectType(openstudio::IddObjectType::OS_Humidifier_Steam_Electric).value()] = ":images/electric_humidifier.png";
+  icons[openstudio::IddObjectType(openstudio::IddObjectType::OS_Humidifier_Steam_Gas).value()] = ":images/gas_humidifier.png";
+  icons[openstudio::IddObjectType(openstudio::IddObjectType::OS_EvaporativeFluidCooler_SingleSpeed).value()] =
+    ":images/evap_fluid_cooler.png";
+  icons[openstudio::IddObjectType(openstudio::IddObjectType::OS_EvaporativeFluidCooler_TwoSpeed).value()] =
+    ":images/evap_fluid_cooler_two_speed.png";
+  icons[openstudio::IddObjectType(openstudio::IddObjectType::OS_Generator_FuelCell_ExhaustGasToWaterHeatExchanger).value()] =
+    ":images/generator_fuelcell_exhaustgastowaterheatexchanger.png";
+  icons[openstudio::IddObjectType(openstudio::IddObjectType::OS_Generator_MicroTurbine_HeatRecovery).value()] =
+    ":images/generator_microturbine_heatrecovery.png";
+  icons[openstudio::IddObjectType(openstudio::IddObjectType::OS_LoadProfile_Plant).value()] = ":images/plant_profile.png";
+  icons[openstudio::IddObjectType(openstudio::IddObjectType::OS_Pipe_Adiabatic).value()] = ":images/pipe.png";
+  icons[openstudio::IddObjectType(openstudio::IddObjectType::OS_Pipe_Indoor).value()] = ":images/pipe_indoor.png";
+  icons[openstudio::IddObjectType(openstudio::IddObjectType::OS_Pipe_Outdoor).value()] = ":images/pipe_outdoor.png";
+  icons[openstudio::IddObjectType(openstudio::IddObjectType::OS_PlantComponent_TemperatureSource).value()] =
+    ":images/plant_temp_source.png";
+  icons[openstudio::IddObjectType(openstudio::IddObjectType::OS_PlantComponent_UserDefined).value()] = ":images/user_defined.png";
+  icons[openstudio::IddObjectType(openstudio::IddObjectType::OS_Pump_ConstantSpeed).value()] = ":images/pump_constant.png";
+  icons[openstudio::IddObjectType(openstudio::IddObjectType::OS_Pump_VariableSpeed).value()] = ":images/pump_variable.png";
+  icons[openstudio::IddObjectType(openstudio::IddObjectType::OS_Refrigeration_Condenser_AirCooled).value()] = ":images/air_cooled.png";
+  icons[openstudio::IddObjectType(openstudio::IddObjectType::OS_Refrigeration_Condenser_Cascade).value()] = ":images/condenser_cascade.png";
+  icons[openstudio::IddObjectType(openstudio::IddObjectType::OS_Refrigeration_Condenser_EvaporativeCooled).value()] =
+    ":images/evap_cooled.png";
+  icons[openstudio::IddObjectType(openstudio::IddObjectType::OS_Refrigeration_Condenser_WaterCooled).value()] = ":images/water_cooled.png";
+  icons[openstudio::IddObjectType(openstudio::IddObjectType::OS_SolarCollector_FlatPlate_PhotovoltaicThermal).value()] =
+    ":images/solarcollector_flatplate_photovoltaicthermal.png";
+  icons[openstudio::IddObjectType(openstudio::IddObjectType::OS_SolarCollector_FlatPlate_Water).value()] =
+    ":images/solarcollector_flatplate_water.png";
+  icons[openstudio::IddObjectType(openstudio::IddObjectType::OS_SolarCollector_IntegralCollectorStorage).value()] =
+    ":images/solarcollector_integralstorage.png";
+  icons[openstudio::IddObjectType(openstudio::IddObjectType::OS_TemperingValve).value()] = ":images/tempering_valve.png";
+  icons[openstudio::IddObjectType(openstudio::IddObjectType::OS_ThermalZone).value()] = ":images/zone.png";
+  icons[openstudio::IddObjectType(openstudio::IddObjectType::OS_ThermalStorage_Ice_Detailed).value()] = ":images/thermal_storage_ice.png";
+  icons[openstudio::IddObjectType(openstudio::IddObjectType::OS_ThermalStorage_ChilledWater_Stratified).value()] =
+    ":images/thermal_storage_strat.png";
+  icons[openstudio::IddObjectType(openstudio::IddObjectType::OS_WaterHeater_HeatPump).value()] = ":images/water_heater.png";
+  icons[openstudio::IddObjectType(openstudio::IddObjectType::OS_WaterHeater_Mixed).value()] = ":images/water_heater_mixed.png";
+  icons[openstudio::IddObjectType(openstudio::IddObjectType::OS_WaterHeater_Stratified).value()] = ":images/water_heater_stratified.png";
+  icons[openstudio::IddObjectType(openstudio::IddObjectType::OS_WaterUse_Connections).value()] = ":images/water_connection.png";
+  icons[openstudio::IddObjectType(openstudio::IddObjectType::OS_WaterUse_Equipment).value()] = ":images/sink.png";
+  icons[openstudio::IddObjectType(openstudio::IddObjectType::OS_ZoneHVAC_Baseboard_RadiantConvective_Electric).value()] =
+    "images/baseboard_rad_convect_electric.png";
+  icons[openstudio::IddObjectType(openstudio::IddObjectType::OS_ZoneHVAC_Baseboard_RadiantConvective_Water).value()] =
+    "images/baseboard_rad_convect_water.png";
+  icons[openstudio::IddObjectType(openstudio::IddObjectType::OS_ZoneHVAC_Baseboard_Convective_Electric).value()] =
+    ":images/baseboard_electric.png";
+  icons[openstudio::IddObjectType(openstudio::IddObjectType::OS_ZoneHVAC_Baseboard_Convective_Water).value()] =
+    ":images/baseboard_water.png";
+  icons[openstudio::IddObjectType(openstudio::IddObjectType::OS_ZoneHVAC_CoolingPanel_RadiantConvective_Water).value()] =
+    ":images/zonehvac_coolingpanel_radiantconvective_water.png";
+  icons[openstudio::IddObjectType(openstudio::IddObjectType::OS_ZoneHVAC_Dehumidifier_DX).value()] = ":images/dehumidifier_dx.png";
+  icons[openstudio::IddObjectType(openstudio::IddObjectType::OS_ZoneHVAC_EnergyRecoveryVentilator).value()] =
+    ":images/energy_recov_vent.png";
+  icons[openstudio::IddObjectType(openstudio::IddObjectType::OS_Coil_Heating_Water_Baseboard).value()] =
+    ":images/coilheatingwater_baseboard.png";
+  icons[openstudio::IddObjectType(openstudio::IddObjectType::OS_Coil_Heating_Water_Baseboard_Radiant).value()] =
+    ":images/Coil_Heating_Water_Baseboard_Radiant.png";
+  icons[openstudio::IddObjectType(openstudio::IddObjectType::OS_Coil_Cooling_CooledBeam).value()] = ":images/coilcoolingchilledbeam.png";
+  icons[openstudio::IddObjectType(openstudio::IddObjectType::OS_Coil_Cooling_FourPipeBeam).value()] = ":images/coilcoolingfourpipebeam.png";
+  icons[openstudio::IddObjectType(openstudio::IddObjectType::OS_Coil_Heating_FourPipeBeam).value()] = ":images/coilheatingfourpipebeam.png";
+  icons[openstudio::IddObjectType(openstudio::IddObjectType::OS_Coil_Heating_Desuperheater).value()] =
+    ":images/coilheatingdesuperheater.png";
+  icons[openstudio::IddObjectType(openstudio::IddObjectType::OS_Coil_Cooling_DX_TwoStageWithHumidityControlMode).value()] =
+    ":images/dxcoolingcoil_2stage_humidity.png";
+  icons[openstudio::IddObjectType(openstudio::IddObjectType::OS_CoilSystem_Cooling_Water_HeatExchangerAssisted).value()] =
+    ":images/coil_system_coolingwater_heat_exchanger.png";
+  icons[openstudio::IddObjectType(openstudio::IddObjectType::OS_CoilSystem_Cooling_DX_HeatExchangerAssisted).value()] =
+    ":images/coilsystem_cooling_dx.png";
+  icons[openstudio::IddObjectType(openstudio::IddObjectType::OS_ZoneHVAC_FourPipeFanCoil).value()] = ":images/four_pipe_fan_coil.png";
+  icons[openstudio::IddObjectType(openstudio::IddObjectType::OS_ZoneHVAC_HighTemperatureRadiant).value()] = ":images/hightempradiant.png";
+  icons[openstudio::IddObjectType(openstudio::IddObjectType::OS_ZoneHVAC_LowTemperatureRadiant_VariableFlow).value()] =
+    ":images/lowtempradiant_varflow.png";
+  icons[openstudio::IddObjectType(openstudio::IddObjectType::OS_ZoneHVAC_LowTemperatureRadiant_VariableFlow).value()] =
+    ":images/lowtempradiant_varflow.png";
+  icons[openstudio::IddObjectType(openstudio::IddObjectType::OS_ZoneHVAC_LowTemperatureRadiant_ConstantFlow).value()] =
+    ":images/lowtempradiant_constflow.png";
+  icons[openstudio::IddObjectType(openstudio::IddObjectType::OS_ZoneHVAC_PackagedTerminalAirConditioner).value()] =
+    ":images/system_type_1.png";
+  icons[openstudio::IddObjectType(openstudio::IddObjectType::OS_ZoneHVAC_PackagedTerminalHeatPump).value()] = ":images/system_type_2.png";
+  icons[openstudio::IddObjectType(openstudio::IddObjectType::OS_ZoneHVAC_TerminalUnit_VariableRefrigerantFlow).value()] =
+    ":images/vrf_unit.png";
+  icons[openstudio::IddObjectType(openstudio::IddObjectType::OS_ZoneHVAC_WaterToAirHeatPump).value()] = ":images/watertoairHP.png";
+  icons[openstudio::IddObjectType(openstudio::IddObjectType::OS_ZoneHVAC_UnitHeater).value()] = ":images/heat_coil-uht.png";
+  icons[openstudio::IddObjectType(openstudio::IddObjectType::OS_ZoneHVAC_UnitVentilator).value()] = ":images/unit_ventilator.png";
 
   // TODO: Update if create new icons... placeholder for now
-  m_icons[openstudio::IddObjectType(openstudio::IddObjectType::OS_AvailabilityManager_Scheduled).value()] = new QPixmap(":images/hvac-icon.png");
-  m_icons[openstudio::IddObjectType(openstudio::IddObjectType::OS_AvailabilityManager_ScheduledOn).value()] = new QPixmap(":images/hvac-icon.png");
-  m_icons[openstudio::IddObjectType(openstudio::IddObjectType::OS_AvailabilityManager_ScheduledOff).value()] = new QPixmap(":images/hvac-icon.png");
-  m_icons[openstudio::IddObjectType(openstudio::IddObjectType::OS_AvailabilityManager_LowTemperatureTurnOn).value()] =
-    new QPixmap(":images/hvac-icon.png");
-  m_icons[openstudio::IddObjectType(openstudio::IddObjectType::OS_AvailabilityManager_LowTemperatureTurnOff).value()] =
-    new QPixmap(":images/hvac-icon.png");
-  m_icons[openstudio::IddObjectType(openstudio::IddObjectType::OS_AvailabilityManager_HighTemperatureTurnOn).value()] =
-    new QPixmap(":images/hvac-icon.png");
-  m_icons[openstudio::IddObjectType(openstudio::IddObjectType::OS_AvailabilityManager_HighTemperatureTurnOff).value()] =
-    new QPixmap(":images/hvac-icon.png");
-  m_icons[openstudio::IddObjectType(openstudio::IddObjectType::OS_AvailabilityManager_DifferentialThermostat).value()] =
-    new QPixmap(":images/hvac-icon.png");
-  m_icons[openstudio::IddObjectType(openstudio::IddObjectType::OS_AvailabilityManager_OptimumStart).value()] = new QPixmap(":images/hvac-icon.png");
-  m_icons[openstudio::IddObjectType(openstudio::IddObjectType::OS_AvailabilityManager_NightCycle).value()] = new QPixmap(":images/hvac-icon.png");
-  m_icons[openstudio::IddObjectType(openstudio::IddObjectType::OS_AvailabilityManager_NightVentilation).value()] =
-    new QPixmap(":images/hvac-icon.png");
-  m_icons[openstudio::IddObjectType(openstudio::IddObjectType::OS_AvailabilityManager_HybridVentilation).value()] =
-    new QPixmap(":images/hvac-icon.png");
+  icons[openstudio::IddObjectType(openstudio::IddObjectType::OS_AvailabilityManager_Scheduled).value()] = ":images/hvac-icon.png";
+  icons[openstudio::IddObjectType(openstudio::IddObjectType::OS_AvailabilityManager_ScheduledOn).value()] = ":images/hvac-icon.png";
+  icons[openstudio::IddObjectType(openstudio::IddObjectType::OS_AvailabilityManager_ScheduledOff).value()] = ":images/hvac-icon.png";
+  icons[openstudio::IddObjectType(openstudio::IddObjectType::OS_AvailabilityManager_LowTemperatureTurnOn).value()] =
+    ":images/hvac-icon.png";
+  icons[openstudio::IddObjectType(openstudio::IddObjectType::OS_AvailabilityManager_LowTemperatureTurnOff).value()] =
+    ":images/hvac-icon.png";
+  icons[openstudio::IddObjectType(openstudio::IddObjectType::OS_AvailabilityManager_HighTemperatureTurnOn).value()] =
+    ":images/hvac-icon.png";
+  icons[openstudio::IddObjectType(openstudio::IddObjectType::OS_AvailabilityManager_HighTemperatureTurnOff).value()] =
+    ":images/hvac-icon.png";
+  icons[openstudio::IddObjectType(openstudio::IddObjectType::OS_AvailabilityManager_DifferentialThermostat).value()] =
+    ":images/hvac-icon.png";
+  icons[openstudio::IddObjectType(openstudio::IddObjectType::OS_AvailabilityManager_OptimumStart).value()] = ":images/hvac-icon.png";
+  icons[openstudio::IddObjectType(openstudio::IddObjectType::OS_AvailabilityManager_NightCycle).value()] = ":images/hvac-icon.png";
+  icons[openstudio::IddObjectType(openstudio::IddObjectType::OS_AvailabilityManager_NightVentilation).value()] = ":images/hvac-icon.png";
+  icons[openstudio::IddObjectType(openstudio::IddObjectType::OS_AvailabilityManager_HybridVentilation).value()] = ":images/hvac-icon.png";
 
   // mini icons
   // Default mini icon to avoid a crash
-  m_miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::Catchall).value()] = new QPixmap(":images/mini_icons/missing_icon.png");
+  miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::Catchall).value()] = ":images/mini_icons/missing_icon.png";
 
-  m_miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_AirConditioner_VariableRefrigerantFlow).value()] =
-    new QPixmap(":images/mini_icons/mini_vrf_outdoor.png");
-  m_miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_Building).value()] = new QPixmap(":images/mini_icons/building.png");
-  m_miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_BuildingStory).value()] = new QPixmap(":images/mini_icons/building_story.png");
-  m_miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_Construction).value()] = new QPixmap(":images/mini_icons/construction.png");
-  m_miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_Construction_AirBoundary).value()] =
-    new QPixmap(":images/mini_icons/construction_air_boundary.png");
-  m_miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_Construction_CfactorUndergroundWall).value()] =
-    new QPixmap(":images/mini_icons/construction_undergnd.png");
-  m_miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_Construction_FfactorGroundFloor).value()] =
-    new QPixmap(":images/mini_icons/construction_gnd.png");
-  m_miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_Construction_InternalSource).value()] =
-    new QPixmap(":images/mini_icons/construct_inter_source.png");
-  m_miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_Construction_WindowDataFile).value()] =
-    new QPixmap(":images/mini_icons/min_window_data.png");
-  m_miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_Daylighting_Control).value()] =
-    new QPixmap(":images/mini_icons/daylighting_control.png");
-  m_miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_DefaultConstructionSet).value()] =
-    new QPixmap(":images/mini_icons/default_construction_set.png");
-  m_miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_DefaultScheduleSet).value()] =
-    new QPixmap(":images/mini_icons/default_schedule_set.png");
-  m_miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_DefaultSubSurfaceConstructions).value()] =
-    new QPixmap(":images/mini_icons/default_subsurface_constructions.png");
-  m_miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_DefaultSurfaceConstructions).value()] =
-    new QPixmap(":images/mini_icons/default_surface_constructions.png");
-  m_miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_DistrictCooling).value()] =
-    new QPixmap(":images/mini_icons/districtcooling.png");
-  m_miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_DistrictHeating).value()] =
-    new QPixmap(":images/mini_icons/districtheating.png");
-  m_miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_Duct).value()] = new QPixmap(":images/mini_icons/mini_duct.png");
-  m_miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_ElectricEquipment).value()] =
-    new QPixmap(":images/mini_icons/electric_equipment.png");
-  m_miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_ElectricEquipment_Definition).value()] =
-    new QPixmap(":images/mini_icons/electric_equipment_definition.png");
-  m_miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_Facility).value()] = new QPixmap(":images/mini_icons/facility.png");
-  m_miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_FluidCooler_SingleSpeed).value()] =
-    new QPixmap(":images/mini_icons/mini_fluid_cooler_single.png");
-  m_miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_FluidCooler_TwoSpeed).value()] =
-    new QPixmap(":images/mini_icons/mini_fluid_cooler_two.png");
-  m_miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_GasEquipment).value()] = new QPixmap(":images/mini_icons/gas_equipment.png");
-  m_miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_GasEquipment_Definition).value()] =
-    new QPixmap(":images/mini_icons/gas_equipment_definition.png");
-  m_miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_Generator_FuelCell_ExhaustGasToWaterHeatExchanger).value()] =
-    new QPixmap(":images/mini_icons/generator_fuelcell_exhaustgastowaterheatexchanger.png");
-  m_miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_Generator_MicroTurbine_HeatRecovery).value()] =
-    new QPixmap(":images/mini_icons/generator_microturbine_heatrecovery.png");
-  m_miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_GroundHeatExchanger_HorizontalTrench).value()] =
-    new QPixmap(":images/mini_icons/mini_ground_heat_exchanger_horizontal.png");
-  m_miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_GroundHeatExchanger_Vertical).value()] =
-    new QPixmap(":images/mini_icons/ground_heat_exchanger_vertical.png");
-  m_miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_HeaderedPumps_ConstantSpeed).value()] =
-    new QPixmap(":images/mini_icons/mini_headered_pumps_constant.png");
-  m_miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_HeaderedPumps_VariableSpeed).value()] =
-    new QPixmap(":images/mini_icons/mini_headered_pumps_variable.png");
-  m_miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_HeatExchanger_AirToAir_SensibleAndLatent).value()] =
-    new QPixmap(":images/mini_icons/heat_transfer_mini.png");
-  m_miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_HeatExchanger_FluidToFluid).value()] =
-    new QPixmap(":images/mini_icons/fluid_hx_mini.png");
-  m_miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_Humidifier_Steam_Electric).value()] =
-    new QPixmap(":images/mini_icons/mini_electric_humidifier.png");
-  m_miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_Humidifier_Steam_Gas).value()] =
-    new QPixmap(":images/mini_icons/gas_humidifier.png");
-  m_miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_IlluminanceMap).value()] =
-    new QPixmap(":images/mini_icons/illuminance_map.png");
-  m_miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_SpaceInfiltration_DesignFlowRate).value()] =
-    new QPixmap(":images/mini_icons/infiltration.png");
-  m_miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_SpaceInfiltration_EffectiveLeakageArea).value()] =
-    new QPixmap(":images/mini_icons/mini_infiltration_leak.png");
-  m_miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_TemperingValve).value()] =
-    new QPixmap(":images/mini_icons/mini_tempering_valve.png");
-  m_miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_InteriorPartitionSurface).value()] =
-    new QPixmap(":images/mini_icons/interior_partition_surface.png");
-  m_miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_InteriorPartitionSurfaceGroup).value()] =
-    new QPixmap(":images/mini_icons/interior_partition_surface_group.png");
-  m_miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_InternalMass).value()] = new QPixmap(":images/mini_icons/internal_mass.png");
-  m_miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_InternalMass_Definition).value()] =
-    new QPixmap(":images/mini_icons/internal_mass_definition.png");
-  m_miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_Lights).value()] = new QPixmap(":images/mini_icons/lights.png");
-  m_miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_Lights_Definition).value()] =
-    new QPixmap(":images/mini_icons/lights_definition.png");
-  m_miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_Luminaire).value()] = new QPixmap(":images/mini_icons/luminaire.png");
-  m_miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_Luminaire_Definition).value()] =
-    new QPixmap(":images/mini_icons/luminaire_definition.png");
-  m_miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_Glare_Sensor).value()] = new QPixmap(":images/mini_icons/glare_sensor.png");
-  m_miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_Material).value()] = new QPixmap(":images/mini_icons/material.png");
-  m_miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_Material_AirGap).value()] =
-    new QPixmap(":images/mini_icons/material_airgap.png");
-  m_miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_Material_InfraredTransparent).value()] =
-    new QPixmap(":images/mini_icons/material_infrared_transparent.png");
-  m_miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_Material_NoMass).value()] = new QPixmap(":images/mini_icons/insulation.png");
-  m_miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_Material_RoofVegetation).value()] =
-    new QPixmap(":images/mini_icons/grassanddirt.png");
-  m_miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_OtherEquipment).value()] =
-    new QPixmap(":images/mini_icons/other_equipment.png");
-  m_miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_OtherEquipment_Definition).value()] =
-    new QPixmap(":images/mini_icons/other_equipment_definition.png");
-  m_miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_DesignSpecification_OutdoorAir).value()] =
-    new QPixmap(":images/mini_icons/outdoor_air.png");
-  m_miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_People).value()] = new QPixmap(":images/mini_icons/people.png");
-  m_miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_People_Definition).value()] =
-    new QPixmap(":images/mini_icons/people_definition.png");
-  m_miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_Pipe_Indoor).value()] = new QPixmap(":images/mini_icons/mini_pipe_indoor.png");
-  m_miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_Pipe_Outdoor).value()] =
-    new QPixmap(":images/mini_icons/mini_pipe_outdoor.png");
-  m_miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_PlantComponent_TemperatureSource).value()] =
-    new QPixmap(":images/mini_icons/mini_plant_temp_source.png");
-  m_miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_PlantComponent_UserDefined).value()] =
-    new QPixmap(":images/mini_icons/user_defined.png");
-  m_miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_Refrigeration_Compressor).value()] =
-    new QPixmap(":images/mini_icons/mini_compressor.png");
-  m_miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_Refrigeration_Condenser_AirCooled).value()] =
-    new QPixmap(":images/mini_icons/mini_condensor.png");
-  m_miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_Refrigeration_Case).value()] =
-    new QPixmap(":images/mini_icons/mini_display_case.png");
-  m_miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_Refrigeration_Subcooler_Mechanical).value()] =
-    new QPixmap(":images/mini_icons/mini_mechanical-sub-cooler.png");
-  m_miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_Refrigeration_Subcooler_LiquidSuction).value()] =
-    new QPixmap(":images/mini_icons/mini_slhx.png");
-  m_miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_Refrigeration_System).value()] =
-    new QPixmap(":images/mini_icons/mini_refrigeration_system.png");
-  m_miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_Refrigeration_WalkIn).value()] =
-    new QPixmap(":images/mini_icons/mini_walkin_case.png");
-  m_miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_Refrigeration_Condenser_AirCooled).value()] =
-    new QPixmap(":images/mini_icons/mini_air_cooled.png");
-  m_miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_Refrigeration_Condenser_Cascade).value()] =
-    new QPixmap(":images/mini_icons/mini_condenser_cascade.png");
-  m_miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_Refrigeration_Condenser_EvaporativeCooled).value()] =
-    new QPixmap(":images/mini_icons/mini_evap_cooled.png");
-  m_miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_Refrigeration_Condenser_WaterCooled).value()] =
-    new QPixmap(":images/mini_icons/mini_water_cooled.png");
-  m_miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_Schedule_Compact).value()] = new QPixmap(":images/mini_icons/schedule.png");
-  m_miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_Schedule_Constant).value()] = new QPixmap(":images/mini_icons/schedule.png");
-  m_miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_Schedule_FixedInterval).value()] =
-    new QPixmap(":images/mini_icons/schedule.png");
-  m_miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_Schedule_Ruleset).value()] = new QPixmap(":images/mini_icons/schedule.png");
-  m_miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_Schedule_VariableInterval).value()] =
-    new QPixmap(":images/mini_icons/schedule.png");
-  m_miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_ShadingSurface).value()] =
-    new QPixmap(":images/mini_icons/shading_surface.png");
-  m_miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_ShadingSurfaceGroup).value()] =
-    new QPixmap(":images/mini_icons/shading_surface_group.png");
-  m_miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_Site).value()] = new QPixmap(":images/mini_icons/site.png");
-  m_miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_SolarCollector_FlatPlate_PhotovoltaicThermal).value()] =
-    new QPixmap(":images/mini_icons/solarcollector_flatplate_photovoltaicthermal.png");
-  m_miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_SolarCollector_FlatPlate_Water).value()] =
-    new QPixmap(":images/mini_icons/solarcollector_flatplate_water.png");
-  m_miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_SolarCollector_IntegralCollectorStorage).value()] =
-    new QPixmap(":images/mini_icons/solarcollector_integralstorage.png");
-  m_miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_Space).value()] = new QPixmap(":images/mini_icons/space.png");
-  m_miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_SpaceType).value()] = new QPixmap(":images/mini_icons/space_type.png");
-  m_miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_SteamEquipment).value()] =
-    new QPixmap(":images/mini_icons/steam_equipment.png");
-  m_miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_SteamEquipment_Definition).value()] =
-    new QPixmap(":images/mini_icons/steam_equipment_definition.png");
-  m_miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_SubSurface).value()] = new QPixmap(":images/mini_icons/subsurface.png");
-  m_miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_Surface).value()] = new QPixmap(":images/mini_icons/surface.png");
-  m_miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_ThermalStorage_Ice_Detailed).value()] =
-    new QPixmap(":images/mini_icons/mini_thermal_storage_ice.png");
-  m_miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_ThermalStorage_ChilledWater_Stratified).value()] =
-    new QPixmap(":images/mini_icons/mini_thermal_storage_strat.png");
-  m_miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_ThermalZone).value()] = new QPixmap(":images/mini_icons/thermal_zone.png");
-  m_miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_WaterHeater_HeatPump).value()] =
-    new QPixmap(":images/mini_icons/water_heater.png");
-  m_miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_WaterHeater_Mixed).value()] =
-    new QPixmap(":images/mini_icons/water_heater_mixed.png");
-  m_miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_WaterHeater_Stratified).value()] =
-    new QPixmap(":images/mini_icons/water_heater_stratified.png");
-  m_miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_WaterUse_Connections).value()] =
-    new QPixmap(":images/mini_icons/water_connection.png");
-  m_miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_WaterUse_Equipment).value()] =
-    new QPixmap(":images/mini_icons/sinkmini_icon_definition.png");
-  m_miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_WaterUse_Equipment_Definition).value()] =
-    new QPixmap(":images/mini_icons/sink.png");
-  m_miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_WindowMaterial_Blind).value()] =
-    new QPixmap(":images/mini_icons/mini_window_blinds.png");
-  m_miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_WindowMaterial_DaylightRedirectionDevice).value()] =
-    new QPixmap(":images/mini_icons/mini_window_daylightredirectiondevice.png");
-  m_miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_WindowMaterial_Gas).value()] =
-    new QPixmap(":images/mini_icons/window_material_glazing.png");  //new QPixmap(":images/mini_icons/window_material_gas.png");
-  m_miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_WindowMaterial_GasMixture).value()] =
-    new QPixmap(":images/mini_icons/window_material_glazing.png");  //new QPixmap(":images/mini_icons/window_material_gasmixture.png");
-  m_miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_WindowMaterial_Glazing).value()] =
-    new QPixmap(":images/mini_icons/window_material_glazing.png");
-  m_miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_WindowMaterial_Glazing_RefractionExtinctionMethod).value()] =
-    new QPixmap(":images/mini_icons/mini_window_refraction.png");
-  m_miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_WindowMaterial_GlazingGroup_Thermochromic).value()] =
-    new QPixmap(":images/mini_icons/mini_window_thermoc.png");
-  m_miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_WindowMaterial_Screen).value()] =
-    new QPixmap(":images/mini_icons/mini_window_screen.png");
-  m_miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_WindowMaterial_Shade).value()] =
-    new QPixmap(":images/mini_icons/mini-window-shade.png");
-  m_miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_WindowMaterial_SimpleGlazingSystem).value()] =
-    new QPixmap(":images/mini_icons/min_window_simple_glazing.png");
-  m_miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_AirLoopHVAC_OutdoorAirSystem).value()] =
-    new QPixmap(":images/mini_icons/OAMixer.png");
-  m_miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_AirLoopHVAC_UnitaryHeatPump_AirToAir).value()] =
-    new QPixmap(":images/mini_icons/heat_pump3.png");
-  m_miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_AirLoopHVAC_UnitaryHeatPump_AirToAir_MultiSpeed).value()] =
-    new QPixmap(":images/mini_icons/heat_pump3.png");
-  m_miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_AirLoopHVAC_UnitarySystem).value()] =
-    new QPixmap(":images/mini_icons/mini_unitary_system.png");
-  m_miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_AirLoopHVAC_UnitaryHeatCool_VAVChangeoverBypass).value()] =
-    new QPixmap(":images/mini_icons/mini_unitary_system.png");
-  m_miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_AirTerminal_DualDuct_VAV).value()] =
-    new QPixmap(":images/mini_icons/airterminal_dualduct_vav.png");
-  m_miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_AirTerminal_DualDuct_ConstantVolume).value()] =
-    new QPixmap(":images/mini_icons/airterminal_dualduct_constantvolume.png");
-  m_miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_AirTerminal_DualDuct_VAV_OutdoorAir).value()] =
-    new QPixmap(":images/mini_icons/airterminal_dualduct_vav_outdoorair.png");
-  m_miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_AirTerminal_SingleDuct_ConstantVolume_CooledBeam).value()] =
-    new QPixmap(":images/mini_icons/chilled_beam.png");
-  m_miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_AirTerminal_SingleDuct_ConstantVolume_FourPipeInduction).value()] =
-    new QPixmap(":images/mini_icons/four_pipe_induction_terminal.png");
-  m_miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_AirTerminal_SingleDuct_ConstantVolume_FourPipeBeam).value()] =
-    new QPixmap(":images/mini_icons/airterminal_fourpipebeam.png");
-  m_miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_AirTerminal_SingleDuct_ConstantVolume_Reheat).value()] =
-    new QPixmap(":images/mini_icons/cav_reheat.png");
-  m_miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_AirTerminal_SingleDuct_ParallelPIU_Reheat).value()] =
-    new QPixmap(":images/mini_icons/parallel_fan_terminal.png");
-  m_miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_AirTerminal_SingleDuct_SeriesPIU_Reheat).value()] =
-    new QPixmap(":images/mini_icons/series_fan_terminal.png");
-  m_miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_AirTerminal_SingleDuct_ConstantVolume_NoReheat).value()] =
-    new QPixmap(":images/mini_icons/direct-air.png");
-  m_miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_AirTerminal_SingleDuct_VAV_NoReheat).value()] =
-    new QPixmap(":images/mini_icons/vav_noreheat.png");
-  m_miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_AirTerminal_SingleDuct_VAV_Reheat).value()] =
-    new QPixmap(":images/mini_icons/vav-reheat.png");
-  m_miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_AirTerminal_SingleDuct_VAV_HeatAndCool_NoReheat).value()] =
-    new QPixmap(":images/mini_icons/vav_noreheat.png");
-  m_miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_AirTerminal_SingleDuct_VAV_HeatAndCool_Reheat).value()] =
-    new QPixmap(":images/mini_icons/vav-reheat.png");
-  m_miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_AirTerminal_SingleDuct_InletSideMixer).value()] =
-    new QPixmap(":images/mini_icons/mini_air_terminal_inlet_mixer.png");
-  m_miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_Boiler_HotWater).value()] = new QPixmap(":images/mini_icons/boiler_steam.png");
-  m_miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_Boiler_Steam).value()] = new QPixmap(":images/mini_icons/boiler.png");
-  m_miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_CentralHeatPumpSystem).value()] =
-    new QPixmap(":images/mini_icons/centralheatpumpsystem.png");
-  m_miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_Chiller_Electric_EIR).value()] =
-    new QPixmap(":images/mini_icons/chiller_air.png");
-  m_miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_Chiller_Absorption_Indirect).value()] =
-    new QPixmap(":images/mini_icons/mini_chiller_absorption_indirect.png");
-  m_miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_Chiller_Absorption).value()] =
-    new QPixmap(":images/mini_icons/mini_chiller_absorption_direct.png");
-  m_miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_Coil_Cooling_CooledBeam).value()] =
-    new QPixmap(":images/mini_icons/coilcoolingchilledbeam_mini.png");
-  m_miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_Coil_Cooling_FourPipeBeam).value()] =
-    new QPixmap(":images/mini_icons/coilcoolingfourpipebeam.png");
-  m_miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_Coil_Heating_FourPipeBeam).value()] =
-    new QPixmap(":images/mini_icons/coilheatingfourpipebeam.png");
-  m_miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_Coil_Heating_Desuperheater).value()] =
-    new QPixmap(":images/mini_icons/coilheatingdesuperheater.png");
-  m_miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_Coil_Cooling_DX_SingleSpeed).value()] =
-    new QPixmap(":images/mini_icons/mini_dxcoolingcoil_singlespeed.png");
-  m_miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_Coil_Cooling_DX_TwoSpeed).value()] =
-    new QPixmap(":images/mini_icons/mini-dxcoolingcoil_2speed.png");
-  m_miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_Coil_Cooling_DX_TwoStageWithHumidityControlMode).value()] =
-    new QPixmap(":images/mini_icons/mini_dxcoolingcoil_2stage_humidity.png");
-  m_miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_Coil_Cooling_DX_MultiSpeed).value()] =
-    new QPixmap(":images/mini_icons/mini_dx_cooling_coil_multispeed.png");
-  m_miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_Coil_Cooling_DX_VariableSpeed).value()] =
-    new QPixmap(":images/mini_icons/mini_cool_coil_dx_vari_speed.png");
-  m_miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_Coil_Cooling_LowTemperatureRadiant_ConstantFlow).value()] =
-    new QPixmap(":images/mini_icons/coilcoolinglowtemprad_constflow.png");
-  m_miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_Coil_Cooling_LowTemperatureRadiant_VariableFlow).value()] =
-    new QPixmap(":images/mini_icons/coilcoolinglowtemprad_varflow.png");
-  m_miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_Coil_Cooling_Water).value()] = new QPixmap(":images/mini_icons/cool_coil.png");
-  m_miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_Coil_Cooling_Water_Panel_Radiant).value()] =
-    new QPixmap(":images/mini_icons/coilcooling_water_panel_radiant.png");
-  m_miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_Coil_Cooling_WaterToAirHeatPump_EquationFit).value()] =
-    new QPixmap(":images/mini_icons/wahpDXCC_mini.png");
-  m_miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_Coil_Cooling_WaterToAirHeatPump_VariableSpeedEquationFit).value()] =
-    new QPixmap(":images/mini_icons/Coil_Cooling_WaterToAirHeatPump_VariableSpeedEquationFit.png");
-  m_miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_Coil_Heating_DX_SingleSpeed).value()] =
-    new QPixmap(":images/mini_icons/coil_ht_dx_singlespeed_mini.png");
-  m_miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_Coil_Heating_DX_VariableSpeed).value()] =
-    new QPixmap(":images/mini_icons/mini_ht_coil_dx_vari.png");
-  m_miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_Coil_Heating_Electric).value()] =
-    new QPixmap(":images/mini_icons/electric_furnace_mini.png");
-  m_miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_Coil_Heating_Gas).value()] = new QPixmap(":images/mini_icons/furnace.png");
-  m_miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_Coil_Heating_Gas_MultiStage).value()] =
-    new QPixmap(":images/mini_icons/mini_furnace_multi_stage.png");
-  m_miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_Coil_Heating_LowTemperatureRadiant_ConstantFlow).value()] =
-    new QPixmap(":images/mini_icons/coilheatinglowtemprad_constflow.png");
-  m_miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_Coil_Heating_LowTemperatureRadiant_VariableFlow).value()] =
-    new QPixmap(":images/mini_icons/coilheatinglowtemprad_varflow.png");
-  m_miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_Coil_Heating_Water).value()] = new QPixmap(":images/mini_icons/heat_coil.png");
-  m_miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_Coil_Heating_WaterToAirHeatPump_EquationFit).value()] =
-    new QPixmap(":images/mini_icons/wahpDXHC_mini.png");
-  m_miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_Coil_Heating_WaterToAirHeatPump_VariableSpeedEquationFit).value()] =
-    new QPixmap(":images/mini_icons/Coil_Heating_WaterToAirHeatPump_VariableSpeedEquationFit.png");
-  m_miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_CoilSystem_Cooling_Water_HeatExchangerAssisted).value()] =
-    new QPixmap(":images/mini_icons/mini_coil_system_water.png");
-  m_miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_CoilSystem_Cooling_DX_HeatExchangerAssisted).value()] =
-    new QPixmap(":images/mini_icons/mini_coilsystem_cooling_DX.png");
-  m_miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_CoolingTower_SingleSpeed).value()] =
-    new QPixmap(":images/mini_icons/mini_cooling_tower.png");
-  m_miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_CoolingTower_TwoSpeed).value()] =
-    new QPixmap(":images/mini_icons/mini_cooling_tower_2speed.png");
-  m_miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_CoolingTower_VariableSpeed).value()] =
-    new QPixmap(":images/mini_icons/mini_cooling_tower_variable.png");
-  m_miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_EvaporativeCooler_Direct_ResearchSpecial).value()] =
-    new QPixmap(":images/mini_icons/directEvap.png");
-  m_miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_EvaporativeCooler_Indirect_ResearchSpecial).value()] =
-    new QPixmap(":images/mini_icons/indirectEvap.png");
-  m_miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_Fan_ComponentModel).value()] =
-    new QPixmap(":images/mini_icons/fan_componentmodel.png");
-  m_miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_Fan_ConstantVolume).value()] =
-    new QPixmap(":images/mini_icons/fan_constant.png");
-  m_miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_Fan_OnOff).value()] = new QPixmap(":images/mini_icons/fan_on_off_mini.png");
-  m_miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_Fan_SystemModel).value()] =
-    new QPixmap(":images/mini_icons/fan_systemmodel.png");
-  m_miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_Fan_VariableVolume).value()] =
-    new QPixmap(":images/mini_icons/fan_variable.png");
-  m_miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_Fan_ZoneExhaust).value()] =
-    new QPixmap(":images/mini_icons/fan_zoneexhaust.png");
-  m_miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_EvaporativeFluidCooler_SingleSpeed).value()] =
-    new QPixmap(":images/mini_icons/evap_fluid_cooler.png");
-  m_miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_EvaporativeFluidCooler_TwoSpeed).value()] =
-    new QPixmap(":images/mini_icons/evap_fluid_cooler_two_speed.png");
-  m_miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_HeatPump_WaterToWater_EquationFit_Cooling).value()] =
-    new QPixmap(":images/mini_icons/heatpump_watertowater_equationfit_cooling.png");
-  m_miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_HeatPump_WaterToWater_EquationFit_Heating).value()] =
-    new QPixmap(":images/mini_icons/heatpump_watertowater_equationfit_heating.png");
-  m_miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_LoadProfile_Plant).value()] =
-    new QPixmap(":images/mini_icons/mini_plant_profile.png");
-  m_miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_Pipe_Adiabatic).value()] = new QPixmap(":images/mini_icons/pipe.png");
-  m_miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_Pump_ConstantSpeed).value()] =
-    new QPixmap(":images/mini_icons/pump_constant.png");
-  m_miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_Pump_VariableSpeed).value()] =
-    new QPixmap(":images/mini_icons/pump_variable.png");
-  m_miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_SetpointManager_Coldest).value()] =
-    new QPixmap(":images/mini_icons/setpoint_coldest.png");
-  m_miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_SetpointManager_FollowGroundTemperature).value()] =
-    new QPixmap(":images/mini_icons/setpoint_follow_ground_temp.png");
-  m_miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_SetpointManager_FollowOutdoorAirTemperature).value()] =
-    new QPixmap(":images/mini_icons/setpoint_follow_outdoorair.png");
-  m_miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_SetpointManager_FollowSystemNodeTemperature).value()] =
-    new QPixmap(":images/mini_icons/setpoint_follow_system_node.png");
-  m_miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_SetpointManager_MixedAir).value()] =
-    new QPixmap(":images/mini_icons/setpoint_mixed.png");
-  m_miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_SetpointManager_MultiZone_Cooling_Average).value()] =
-    new QPixmap(":images/mini_icons/setpoint_multizone_cooling.png");
-  m_miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_SetpointManager_MultiZone_Heating_Average).value()] =
-    new QPixmap(":images/mini_icons/setpoint_multizone_heating.png");
-  m_miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_SetpointManager_MultiZone_Humidity_Maximum).value()] =
-    new QPixmap(":images/mini_icons/setpoint_multizone_humidity_max.png");
-  m_miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_SetpointManager_MultiZone_Humidity_Minimum).value()] =
-    new QPixmap(":images/mini_icons/setpoint_multizone_humidity_min.png");
-  m_miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_SetpointManager_MultiZone_MaximumHumidity_Average).value()] =
-    new QPixmap(":images/mini_icons/setpoint_multizone_maxhumidity_avg.png");
-  m_miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_SetpointManager_MultiZone_MinimumHumidity_Average).value()] =
-    new QPixmap(":images/mini_icons/setpoint_multizone_minhumidity_avg.png");
-  m_miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_SetpointManager_OutdoorAirPretreat).value()] =
-    new QPixmap(":images/mini_icons/setpoint_pretreat.png");
-  m_miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_SetpointManager_OutdoorAirReset).value()] =
-    new QPixmap(":images/mini_icons/setpoint_outdoorair.png");
-  m_miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_SetpointManager_Scheduled).value()] =
-    new QPixmap(":images/mini_icons/setpoint_scheduled.png");
-  m_miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_SetpointManager_Scheduled_DualSetpoint).value()] =
-    new QPixmap(":images/mini_icons/setpoint_dual.png");
-  m_miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_SetpointManager_SingleZone_Humidity_Maximum).value()] =
-    new QPixmap(":images/mini_icons/setpoint_singlezone_humidity_max.png");
-  m_miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_SetpointManager_SingleZone_Humidity_Minimum).value()] =
-    new QPixmap(":images/mini_icons/setpoint_singlezone_humidity_min.png");
-  m_miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_SetpointManager_SingleZone_OneStageCooling).value()] =
-    new QPixmap(":images/mini_icons/setpoint_onestage_cooling.png");
-  m_miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_SetpointManager_SingleZone_OneStageHeating).value()] =
-    new QPixmap(":images/mini_icons/setpoint_onestage_heating.png");
-  m_miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_SetpointManager_SingleZone_Reheat).value()] =
-    new QPixmap(":images/mini_icons/setpoint_singlezone.png");
-  m_miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_SetpointManager_SingleZone_Cooling).value()] =
-    new QPixmap(":images/mini_icons/setpoint_singlezone.png");
-  m_miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_SetpointManager_SingleZone_Heating).value()] =
-    new QPixmap(":images/mini_icons/setpoint_singlezone.png");
-  m_miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_SetpointManager_Warmest).value()] =
-    new QPixmap(":images/mini_icons/setpoint_warmest.png");
-  m_miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_SetpointManager_WarmestTemperatureFlow).value()] =
-    new QPixmap(":images/mini_icons/setpoint_warmest_tempflow.png");
-  m_miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_SetpointManager_SystemNodeReset_Temperature).value()] =
-    new QPixmap(":images/mini_icons/setpoint_systemnodereset_temperature.png");
-  m_miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_SetpointManager_SystemNodeReset_Humidity).value()] =
-    new QPixmap(":images/mini_icons/setpoint_systemnodereset_humidity.png");
-  m_miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_ZoneHVAC_TerminalUnit_VariableRefrigerantFlow).value()] =
-    new QPixmap(":images/mini_icons/mini_vrf_unit.png");
-  m_miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_ZoneHVAC_Baseboard_RadiantConvective_Electric).value()] =
-    new QPixmap(":images/mini_icons/mini_baseboard_rad_convect_electric.png");
-  m_miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_ZoneHVAC_Baseboard_RadiantConvective_Water).value()] =
-    new QPixmap(":images/mini_icons/mini_baseboard_rad_convect_water.png");
-  m_miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_ZoneHVAC_Baseboard_Convective_Electric).value()] =
-    new QPixmap(":images/mini_icons/baseboard_electric.png");
-  m_miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_ZoneHVAC_Baseboard_Convective_Water).value()] =
-    new QPixmap(":images/mini_icons/baseboard_water.png");
-  m_miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_ZoneHVAC_CoolingPanel_RadiantConvective_Water).value()] =
-    new QPixmap(":images/mini_icons/zonehvac_coolingpanel_radiantconvective_water.png");
-  m_miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_ZoneHVAC_Dehumidifier_DX).value()] =
-    new QPixmap(":images/mini_icons/mini_dehumidifier_dx.png");
-  m_miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_ZoneHVAC_EnergyRecoveryVentilator).value()] =
-    new QPixmap(":images/mini_icons/mini_energy_recov_vent.png");
-  m_miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_Coil_Heating_Water_Baseboard).value()] =
-    new QPixmap(":images/mini_icons/coilheatingwater_baseboard_mini.png");
-  m_miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_Coil_Heating_Water_Baseboard_Radiant).value()] =
-    new QPixmap(":images/mini_icons/Coil_Heating_Water_Baseboard_Radiant.png");
-  m_miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_ZoneHVAC_FourPipeFanCoil).value()] =
-    new QPixmap(":images/mini_single_ducts_constant_vol_4pipe.png");
-  m_miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_ZoneHVAC_HighTemperatureRadiant).value()] =
-    new QPixmap(":images/mini_icons/hightempradiant.png");
-  m_miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_ZoneHVAC_LowTemperatureRadiant_Electric).value()] =
-    new QPixmap(":images/mini_icons/zonehvac_low_temperature_radiant_electric.png");
-  m_miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_ZoneHVAC_LowTemperatureRadiant_VariableFlow).value()] =
-    new QPixmap(":images/mini_icons/lowtempradiant_varflow.png");
-  m_miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_ZoneHVAC_LowTemperatureRadiant_ConstantFlow).value()] =
-    new QPixmap(":images/mini_icons/lowtempradiant_constflow.png");
-  m_miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_ZoneHVAC_WaterToAirHeatPump).value()] =
-    new QPixmap(":images/mini_icons/watertoairHP.png");
-  m_miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_ZoneHVAC_PackagedTerminalAirConditioner).value()] =
-    new QPixmap(":images/mini_icons/system_type_1.png");
-  m_miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_ZoneHVAC_PackagedTerminalHeatPump).value()] =
-    new QPixmap(":images/mini_icons/system_type_2.png");
-  m_miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_ZoneHVAC_UnitHeater).value()] =
-    new QPixmap(":images/mini_icons/heat_coil-uht.png");
-  m_miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_ZoneHVAC_UnitVentilator).value()] =
-    new QPixmap(":images/mini_icons/mini_unit_ventilator.png");
+  miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_AirConditioner_VariableRefrigerantFlow).value()] =
+    ":images/mini_icons/mini_vrf_outdoor.png";
+  miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_Building).value()] = ":images/mini_icons/building.png";
+  miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_BuildingStory).value()] = ":images/mini_icons/building_story.png";
+  miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_Construction).value()] = ":images/mini_icons/construction.png";
+  miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_Construction_AirBoundary).value()] =
+    ":images/mini_icons/construction_air_boundary.png";
+  miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_Construction_CfactorUndergroundWall).value()] =
+    ":images/mini_icons/construction_undergnd.png";
+  miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_Construction_FfactorGroundFloor).value()] =
+    ":images/mini_icons/construction_gnd.png";
+  miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_Construction_InternalSource).value()] =
+    ":images/mini_icons/construct_inter_source.png";
+  miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_Construction_WindowDataFile).value()] =
+    ":images/mini_icons/min_window_data.png";
+  miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_Daylighting_Control).value()] =
+    ":images/mini_icons/daylighting_control.png";
+  miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_DefaultConstructionSet).value()] =
+    ":images/mini_icons/default_construction_set.png";
+  miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_DefaultScheduleSet).value()] =
+    ":images/mini_icons/default_schedule_set.png";
+  miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_DefaultSubSurfaceConstructions).value()] =
+    ":images/mini_icons/default_subsurface_constructions.png";
+  miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_DefaultSurfaceConstructions).value()] =
+    ":images/mini_icons/default_surface_constructions.png";
+  miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_DistrictCooling).value()] = ":images/mini_icons/districtcooling.png";
+  miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_DistrictHeating).value()] = ":images/mini_icons/districtheating.png";
+  miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_Duct).value()] = ":images/mini_icons/mini_duct.png";
+  miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_ElectricEquipment).value()] =
+    ":images/mini_icons/electric_equipment.png";
+  miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_ElectricEquipment_Definition).value()] =
+    ":images/mini_icons/electric_equipment_definition.png";
+  miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_Facility).value()] = ":images/mini_icons/facility.png";
+  miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_FluidCooler_SingleSpeed).value()] =
+    ":images/mini_icons/mini_fluid_cooler_single.png";
+  miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_FluidCooler_TwoSpeed).value()] =
+    ":images/mini_icons/mini_fluid_cooler_two.png";
+  miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_GasEquipment).value()] = ":images/mini_icons/gas_equipment.png";
+  miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_GasEquipment_Definition).value()] =
+    ":images/mini_icons/gas_equipment_definition.png";
+  miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_Generator_FuelCell_ExhaustGasToWaterHeatExchanger).value()] =
+    ":images/mini_icons/generator_fuelcell_exhaustgastowaterheatexchanger.png";
+  miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_Generator_MicroTurbine_HeatRecovery).value()] =
+    ":images/mini_icons/generator_microturbine_heatrecovery.png";
+  miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_GroundHeatExchanger_HorizontalTrench).value()] =
+    ":images/mini_icons/mini_ground_heat_exchanger_horizontal.png";
+  miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_GroundHeatExchanger_Vertical).value()] =
+    ":images/mini_icons/ground_heat_exchanger_vertical.png";
+  miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_HeaderedPumps_ConstantSpeed).value()] =
+    ":images/mini_icons/mini_headered_pumps_constant.png";
+  miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_HeaderedPumps_VariableSpeed).value()] =
+    ":images/mini_icons/mini_headered_pumps_variable.png";
+  miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_HeatExchanger_AirToAir_SensibleAndLatent).value()] =
+    ":images/mini_icons/heat_transfer_mini.png";
+  miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_HeatExchanger_FluidToFluid).value()] =
+    ":images/mini_icons/fluid_hx_mini.png";
+  miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_Humidifier_Steam_Electric).value()] =
+    ":images/mini_icons/mini_electric_humidifier.png";
+  miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_Humidifier_Steam_Gas).value()] =
+    ":images/mini_icons/gas_humidifier.png";
+  miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_IlluminanceMap).value()] = ":images/mini_icons/illuminance_map.png";
+  miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_SpaceInfiltration_DesignFlowRate).value()] =
+    ":images/mini_icons/infiltration.png";
+  miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_SpaceInfiltration_EffectiveLeakageArea).value()] =
+    ":images/mini_icons/mini_infiltration_leak.png";
+  miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_TemperingValve).value()] =
+    ":images/mini_icons/mini_tempering_valve.png";
+  miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_InteriorPartitionSurface).value()] =
+    ":images/mini_icons/interior_partition_surface.png";
+  miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_InteriorPartitionSurfaceGroup).value()] =
+    ":images/mini_icons/interior_partition_surface_group.png";
+  miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_InternalMass).value()] = ":images/mini_icons/internal_mass.png";
+  miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_InternalMass_Definition).value()] =
+    ":images/mini_icons/internal_mass_definition.png";
+  miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_Lights).value()] = ":images/mini_icons/lights.png";
+  miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_Lights_Definition).value()] =
+    ":images/mini_icons/lights_definition.png";
+  miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_Luminaire).value()] = ":images/mini_icons/luminaire.png";
+  miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_Luminaire_Definition).value()] =
+    ":images/mini_icons/luminaire_definition.png";
+  miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_Glare_Sensor).value()] = ":images/mini_icons/glare_sensor.png";
+  miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_Material).value()] = ":images/mini_icons/material.png";
+  miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_Material_AirGap).value()] = ":images/mini_icons/material_airgap.png";
+  miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_Material_InfraredTransparent).value()] =
+    ":images/mini_icons/material_infrared_transparent.png";
+  miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_Material_NoMass).value()] = ":images/mini_icons/insulation.png";
+  miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_Material_RoofVegetation).value()] =
+    ":images/mini_icons/grassanddirt.png";
+  miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_OtherEquipment).value()] = ":images/mini_icons/other_equipment.png";
+  miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_OtherEquipment_Definition).value()] =
+    ":images/mini_icons/other_equipment_definition.png";
+  miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_DesignSpecification_OutdoorAir).value()] =
+    ":images/mini_icons/outdoor_air.png";
+  miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_People).value()] = ":images/mini_icons/people.png";
+  miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_People_Definition).value()] =
+    ":images/mini_icons/people_definition.png";
+  miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_Pipe_Indoor).value()] = ":images/mini_icons/mini_pipe_indoor.png";
+  miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_Pipe_Outdoor).value()] = ":images/mini_icons/mini_pipe_outdoor.png";
+  miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_PlantComponent_TemperatureSource).value()] =
+    ":images/mini_icons/mini_plant_temp_source.png";
+  miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_PlantComponent_UserDefined).value()] =
+    ":images/mini_icons/user_defined.png";
+  miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_Refrigeration_Compressor).value()] =
+    ":images/mini_icons/mini_compressor.png";
+  miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_Refrigeration_Condenser_AirCooled).value()] =
+    ":images/mini_icons/mini_condensor.png";
+  miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_Refrigeration_Case).value()] =
+    ":images/mini_icons/mini_display_case.png";
+  miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_Refrigeration_Subcooler_Mechanical).value()] =
+    ":images/mini_icons/mini_mechanical-sub-cooler.png";
+  miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_Refrigeration_Subcooler_LiquidSuction).value()] =
+    ":images/mini_icons/mini_slhx.png";
+  miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_Refrigeration_System).value()] =
+    ":images/mini_icons/mini_refrigeration_system.png";
+  miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_Refrigeration_WalkIn).value()] =
+    ":images/mini_icons/mini_walkin_case.png";
+  miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_Refrigeration_Condenser_AirCooled).value()] =
+    ":images/mini_icons/mini_air_cooled.png";
+  miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_Refrigeration_Condenser_Cascade).value()] =
+    ":images/mini_icons/mini_condenser_cascade.png";
+  miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_Refrigeration_Condenser_EvaporativeCooled).value()] =
+    ":images/mini_icons/mini_evap_cooled.png";
+  miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_Refrigeration_Condenser_WaterCooled).value()] =
+    ":images/mini_icons/mini_water_cooled.png";
+  miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_Schedule_Compact).value()] = ":images/mini_icons/schedule.png";
+  miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_Schedule_Constant).value()] = ":images/mini_icons/schedule.png";
+  miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_Schedule_FixedInterval).value()] = ":images/mini_icons/schedule.png";
+  miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_Schedule_Ruleset).value()] = ":images/mini_icons/schedule.png";
+  miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_Schedule_VariableInterval).value()] = ":images/mini_icons/schedule.png";
+  miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_ShadingSurface).value()] = ":images/mini_icons/shading_surface.png";
+  miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_ShadingSurfaceGroup).value()] =
+    ":images/mini_icons/shading_surface_group.png";
+  miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_Site).value()] = ":images/mini_icons/site.png";
+  miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_SolarCollector_FlatPlate_PhotovoltaicThermal).value()] =
+    ":images/mini_icons/solarcollector_flatplate_photovoltaicthermal.png";
+  miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_SolarCollector_FlatPlate_Water).value()] =
+    ":images/mini_icons/solarcollector_flatplate_water.png";
+  miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_SolarCollector_IntegralCollectorStorage).value()] =
+    ":images/mini_icons/solarcollector_integralstorage.png";
+  miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_Space).value()] = ":images/mini_icons/space.png";
+  miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_SpaceType).value()] = ":images/mini_icons/space_type.png";
+  miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_SteamEquipment).value()] = ":images/mini_icons/steam_equipment.png";
+  miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_SteamEquipment_Definition).value()] =
+    ":images/mini_icons/steam_equipment_definition.png";
+  miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_SubSurface).value()] = ":images/mini_icons/subsurface.png";
+  miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_Surface).value()] = ":images/mini_icons/surface.png";
+  miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_ThermalStorage_Ice_Detailed).value()] =
+    ":images/mini_icons/mini_thermal_storage_ice.png";
+  miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_ThermalStorage_ChilledWater_Stratified).value()] =
+    ":images/mini_icons/mini_thermal_storage_strat.png";
+  miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_ThermalZone).value()] = ":images/mini_icons/thermal_zone.png";
+  miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_WaterHeater_HeatPump).value()] = ":images/mini_icons/water_heater.png";
+  miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_WaterHeater_Mixed).value()] =
+    ":images/mini_icons/water_heater_mixed.png";
+  miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_WaterHeater_Stratified).value()] =
+    ":images/mini_icons/water_heater_stratified.png";
+  miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_WaterUse_Connections).value()] =
+    ":images/mini_icons/water_connection.png";
+  miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_WaterUse_Equipment).value()] =
+    ":images/mini_icons/sinkmini_icon_definition.png";
+  miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_WaterUse_Equipment_Definition).value()] = ":images/mini_icons/sink.png";
+  miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_WindowMaterial_Blind).value()] =
+    ":images/mini_icons/mini_window_blinds.png";
+  miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_WindowMaterial_DaylightRedirectionDevice).value()] =
+    ":images/mini_icons/mini_window_daylightredirectiondevice.png";
+  miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_WindowMaterial_Gas).value()] =
+    ":images/mini_icons/window_material_glazing.png";  //":images/mini_icons/window_material_gas.png";
+  miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_WindowMaterial_GasMixture).value()] =
+    ":images/mini_icons/window_material_glazing.png";  //":images/mini_icons/window_material_gasmixture.png";
+  miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_WindowMaterial_Glazing).value()] =
+    ":images/mini_icons/window_material_glazing.png";
+  miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_WindowMaterial_Glazing_RefractionExtinctionMethod).value()] =
+    ":images/mini_icons/mini_window_refraction.png";
+  miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_WindowMaterial_GlazingGroup_Thermochromic).value()] =
+    ":images/mini_icons/mini_window_thermoc.png";
+  miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_WindowMaterial_Screen).value()] =
+    ":images/mini_icons/mini_window_screen.png";
+  miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_WindowMaterial_Shade).value()] =
+    ":images/mini_icons/mini-window-shade.png";
+  miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_WindowMaterial_SimpleGlazingSystem).value()] =
+    ":images/mini_icons/min_window_simple_glazing.png";
+  miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_AirLoopHVAC_OutdoorAirSystem).value()] =
+    ":images/mini_icons/OAMixer.png";
+  miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_AirLoopHVAC_UnitaryHeatPump_AirToAir).value()] =
+    ":images/mini_icons/heat_pump3.png";
+  miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_AirLoopHVAC_UnitaryHeatPump_AirToAir_MultiSpeed).value()] =
+    ":images/mini_icons/heat_pump3.png";
+  miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_AirLoopHVAC_UnitarySystem).value()] =
+    ":images/mini_icons/mini_unitary_system.png";
+  miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_AirLoopHVAC_UnitaryHeatCool_VAVChangeoverBypass).value()] =
+    ":images/mini_icons/mini_unitary_system.png";
+  miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_AirTerminal_DualDuct_VAV).value()] =
+    ":images/mini_icons/airterminal_dualduct_vav.png";
+  miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_AirTerminal_DualDuct_ConstantVolume).value()] =
+    ":images/mini_icons/airterminal_dualduct_constantvolume.png";
+  miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_AirTerminal_DualDuct_VAV_OutdoorAir).value()] =
+    ":images/mini_icons/airterminal_dualduct_vav_outdoorair.png";
+  miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_AirTerminal_SingleDuct_ConstantVolume_CooledBeam).value()] =
+    ":images/mini_icons/chilled_beam.png";
+  miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_AirTerminal_SingleDuct_ConstantVolume_FourPipeInduction).value()] =
+    ":images/mini_icons/four_pipe_induction_terminal.png";
+  miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_AirTerminal_SingleDuct_ConstantVolume_FourPipeBeam).value()] =
+    ":images/mini_icons/airterminal_fourpipebeam.png";
+  miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_AirTerminal_SingleDuct_ConstantVolume_Reheat).value()] =
+    ":images/mini_icons/cav_reheat.png";
+  miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_AirTerminal_SingleDuct_ParallelPIU_Reheat).value()] =
+    ":images/mini_icons/parallel_fan_terminal.png";
+  miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_AirTerminal_SingleDuct_SeriesPIU_Reheat).value()] =
+    ":images/mini_icons/series_fan_terminal.png";
+  miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_AirTerminal_SingleDuct_ConstantVolume_NoReheat).value()] =
+    ":images/mini_icons/direct-air.png";
+  miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_AirTerminal_SingleDuct_VAV_NoReheat).value()] =
+    ":images/mini_icons/vav_noreheat.png";
+  miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_AirTerminal_SingleDuct_VAV_Reheat).value()] =
+    ":images/mini_icons/vav-reheat.png";
+  miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_AirTerminal_SingleDuct_VAV_HeatAndCool_NoReheat).value()] =
+    ":images/mini_icons/vav_noreheat.png";
+  miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_AirTerminal_SingleDuct_VAV_HeatAndCool_Reheat).value()] =
+    ":images/mini_icons/vav-reheat.png";
+  miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_AirTerminal_SingleDuct_InletSideMixer).value()] =
+    ":images/mini_icons/mini_air_terminal_inlet_mixer.png";
+  miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_Boiler_HotWater).value()] = ":images/mini_icons/boiler_steam.png";
+  miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_Boiler_Steam).value()] = ":images/mini_icons/boiler.png";
+  miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_CentralHeatPumpSystem).value()] =
+    ":images/mini_icons/centralheatpumpsystem.png";
+  miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_Chiller_Electric_EIR).value()] = ":images/mini_icons/chiller_air.png";
+  miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_Chiller_Absorption_Indirect).value()] =
+    ":images/mini_icons/mini_chiller_absorption_indirect.png";
+  miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_Chiller_Absorption).value()] =
+    ":images/mini_icons/mini_chiller_absorption_direct.png";
+  miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_Coil_Cooling_CooledBeam).value()] =
+    ":images/mini_icons/coilcoolingchilledbeam_mini.png";
+  miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_Coil_Cooling_FourPipeBeam).value()] =
+    ":images/mini_icons/coilcoolingfourpipebeam.png";
+  miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_Coil_Heating_FourPipeBeam).value()] =
+    ":images/mini_icons/coilheatingfourpipebeam.png";
+  miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_Coil_Heating_Desuperheater).value()] =
+    ":images/mini_icons/coilheatingdesuperheater.png";
+  miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_Coil_Cooling_DX_SingleSpeed).value()] =
+    ":images/mini_icons/mini_dxcoolingcoil_singlespeed.png";
+  miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_Coil_Cooling_DX_TwoSpeed).value()] =
+    ":images/mini_icons/mini-dxcoolingcoil_2speed.png";
+  miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_Coil_Cooling_DX_TwoStageWithHumidityControlMode).value()] =
+    ":images/mini_icons/mini_dxcoolingcoil_2stage_humidity.png";
+  miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_Coil_Cooling_DX_MultiSpeed).value()] =
+    ":images/mini_icons/mini_dx_cooling_coil_multispeed.png";
+  miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_Coil_Cooling_DX_VariableSpeed).value()] =
+    ":images/mini_icons/mini_cool_coil_dx_vari_speed.png";
+  miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_Coil_Cooling_LowTemperatureRadiant_ConstantFlow).value()] =
+    ":images/mini_icons/coilcoolinglowtemprad_constflow.png";
+  miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_Coil_Cooling_LowTemperatureRadiant_VariableFlow).value()] =
+    ":images/mini_icons/coilcoolinglowtemprad_varflow.png";
+  miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_Coil_Cooling_Water).value()] = ":images/mini_icons/cool_coil.png";
+  miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_Coil_Cooling_Water_Panel_Radiant).value()] =
+    ":images/mini_icons/coilcooling_water_panel_radiant.png";
+  miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_Coil_Cooling_WaterToAirHeatPump_EquationFit).value()] =
+    ":images/mini_icons/wahpDXCC_mini.png";
+  miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_Coil_Cooling_WaterToAirHeatPump_VariableSpeedEquationFit).value()] =
+    ":images/mini_icons/Coil_Cooling_WaterToAirHeatPump_VariableSpeedEquationFit.png";
+  miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_Coil_Heating_DX_SingleSpeed).value()] =
+    ":images/mini_icons/coil_ht_dx_singlespeed_mini.png";
+  miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_Coil_Heating_DX_VariableSpeed).value()] =
+    ":images/mini_icons/mini_ht_coil_dx_vari.png";
+  miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_Coil_Heating_Electric).value()] =
+    ":images/mini_icons/electric_furnace_mini.png";
+  miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_Coil_Heating_Gas).value()] = ":images/mini_icons/furnace.png";
+  miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_Coil_Heating_Gas_MultiStage).value()] =
+    ":images/mini_icons/mini_furnace_multi_stage.png";
+  miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_Coil_Heating_LowTemperatureRadiant_ConstantFlow).value()] =
+    ":images/mini_icons/coilheatinglowtemprad_constflow.png";
+  miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_Coil_Heating_LowTemperatureRadiant_VariableFlow).value()] =
+    ":images/mini_icons/coilheatinglowtemprad_varflow.png";
+  miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_Coil_Heating_Water).value()] = ":images/mini_icons/heat_coil.png";
+  miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_Coil_Heating_WaterToAirHeatPump_EquationFit).value()] =
+    ":images/mini_icons/wahpDXHC_mini.png";
+  miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_Coil_Heating_WaterToAirHeatPump_VariableSpeedEquationFit).value()] =
+    ":images/mini_icons/Coil_Heating_WaterToAirHeatPump_VariableSpeedEquationFit.png";
+  miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_CoilSystem_Cooling_Water_HeatExchangerAssisted).value()] =
+    ":images/mini_icons/mini_coil_system_water.png";
+  miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_CoilSystem_Cooling_DX_HeatExchangerAssisted).value()] =
+    ":images/mini_icons/mini_coilsystem_cooling_DX.png";
+  miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_CoolingTower_SingleSpeed).value()] =
+    ":images/mini_icons/mini_cooling_tower.png";
+  miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_CoolingTower_TwoSpeed).value()] =
+    ":images/mini_icons/mini_cooling_tower_2speed.png";
+  miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_CoolingTower_VariableSpeed).value()] =
+    ":images/mini_icons/mini_cooling_tower_variable.png";
+  miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_EvaporativeCooler_Direct_ResearchSpecial).value()] =
+    ":images/mini_icons/directEvap.png";
+  miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_EvaporativeCooler_Indirect_ResearchSpecial).value()] =
+    ":images/mini_icons/indirectEvap.png";
+  miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_Fan_ComponentModel).value()] =
+    ":images/mini_icons/fan_componentmodel.png";
+  miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_Fan_ConstantVolume).value()] = ":images/mini_icons/fan_constant.png";
+  miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_Fan_OnOff).value()] = ":images/mini_icons/fan_on_off_mini.png";
+  miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_Fan_SystemModel).value()] = ":images/mini_icons/fan_systemmodel.png";
+  miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_Fan_VariableVolume).value()] = ":images/mini_icons/fan_variable.png";
+  miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_Fan_ZoneExhaust).value()] = ":images/mini_icons/fan_zoneexhaust.png";
+  miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_EvaporativeFluidCooler_SingleSpeed).value()] =
+    ":images/mini_icons/evap_fluid_cooler.png";
+  miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_EvaporativeFluidCooler_TwoSpeed).value()] =
+    ":images/mini_icons/evap_fluid_cooler_two_speed.png";
+  miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_HeatPump_WaterToWater_EquationFit_Cooling).value()] =
+    ":images/mini_icons/heatpump_watertowater_equationfit_cooling.png";
+  miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_HeatPump_WaterToWater_EquationFit_Heating).value()] =
+    ":images/mini_icons/heatpump_watertowater_equationfit_heating.png";
+  miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_LoadProfile_Plant).value()] =
+    ":images/mini_icons/mini_plant_profile.png";
+  miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_Pipe_Adiabatic).value()] = ":images/mini_icons/pipe.png";
+  miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_Pump_ConstantSpeed).value()] = ":images/mini_icons/pump_constant.png";
+  miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_Pump_VariableSpeed).value()] = ":images/mini_icons/pump_variable.png";
+  miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_SetpointManager_Coldest).value()] =
+    ":images/mini_icons/setpoint_coldest.png";
+  miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_SetpointManager_FollowGroundTemperature).value()] =
+    ":images/mini_icons/setpoint_follow_ground_temp.png";
+  miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_SetpointManager_FollowOutdoorAirTemperature).value()] =
+    ":images/mini_icons/setpoint_follow_outdoorair.png";
+  miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_SetpointManager_FollowSystemNodeTemperature).value()] =
+    ":images/mini_icons/setpoint_follow_system_node.png";
+  miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_SetpointManager_MixedAir).value()] =
+    ":images/mini_icons/setpoint_mixed.png";
+  miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_SetpointManager_MultiZone_Cooling_Average).value()] =
+    ":images/mini_icons/setpoint_multizone_cooling.png";
+  miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_SetpointManager_MultiZone_Heating_Average).value()] =
+    ":images/mini_icons/setpoint_multizone_heating.png";
+  miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_SetpointManager_MultiZone_Humidity_Maximum).value()] =
+    ":images/mini_icons/setpoint_multizone_humidity_max.png";
+  miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_SetpointManager_MultiZone_Humidity_Minimum).value()] =
+    ":images/mini_icons/setpoint_multizone_humidity_min.png";
+  miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_SetpointManager_MultiZone_MaximumHumidity_Average).value()] =
+    ":images/mini_icons/setpoint_multizone_maxhumidity_avg.png";
+  miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_SetpointManager_MultiZone_MinimumHumidity_Average).value()] =
+    ":images/mini_icons/setpoint_multizone_minhumidity_avg.png";
+  miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_SetpointManager_OutdoorAirPretreat).value()] =
+    ":images/mini_icons/setpoint_pretreat.png";
+  miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_SetpointManager_OutdoorAirReset).value()] =
+    ":images/mini_icons/setpoint_outdoorair.png";
+  miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_SetpointManager_Scheduled).value()] =
+    ":images/mini_icons/setpoint_scheduled.png";
+  miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_SetpointManager_Scheduled_DualSetpoint).value()] =
+    ":images/mini_icons/setpoint_dual.png";
+  miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_SetpointManager_SingleZone_Humidity_Maximum).value()] =
+    ":images/mini_icons/setpoint_singlezone_humidity_max.png";
+  miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_SetpointManager_SingleZone_Humidity_Minimum).value()] =
+    ":images/mini_icons/setpoint_singlezone_humidity_min.png";
+  miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_SetpointManager_SingleZone_OneStageCooling).value()] =
+    ":images/mini_icons/setpoint_onestage_cooling.png";
+  miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_SetpointManager_SingleZone_OneStageHeating).value()] =
+    ":images/mini_icons/setpoint_onestage_heating.png";
+  miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_SetpointManager_SingleZone_Reheat).value()] =
+    ":images/mini_icons/setpoint_singlezone.png";
+  miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_SetpointManager_SingleZone_Cooling).value()] =
+    ":images/mini_icons/setpoint_singlezone.png";
+  miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_SetpointManager_SingleZone_Heating).value()] =
+    ":images/mini_icons/setpoint_singlezone.png";
+  miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_SetpointManager_Warmest).value()] =
+    ":images/mini_icons/setpoint_warmest.png";
+  miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_SetpointManager_WarmestTemperatureFlow).value()] =
+    ":images/mini_icons/setpoint_warmest_tempflow.png";
+  miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_SetpointManager_SystemNodeReset_Temperature).value()] =
+    ":images/mini_icons/setpoint_systemnodereset_temperature.png";
+  miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_SetpointManager_SystemNodeReset_Humidity).value()] =
+    ":images/mini_icons/setpoint_systemnodereset_humidity.png";
+  miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_ZoneHVAC_TerminalUnit_VariableRefrigerantFlow).value()] =
+    ":images/mini_icons/mini_vrf_unit.png";
+  miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_ZoneHVAC_Baseboard_RadiantConvective_Electric).value()] =
+    ":images/mini_icons/mini_baseboard_rad_convect_electric.png";
+  miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_ZoneHVAC_Baseboard_RadiantConvective_Water).value()] =
+    ":images/mini_icons/mini_baseboard_rad_convect_water.png";
+  miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_ZoneHVAC_Baseboard_Convective_Electric).value()] =
+    ":images/mini_icons/baseboard_electric.png";
+  miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_ZoneHVAC_Baseboard_Convective_Water).value()] =
+    ":images/mini_icons/baseboard_water.png";
+  miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_ZoneHVAC_CoolingPanel_RadiantConvective_Water).value()] =
+    ":images/mini_icons/zonehvac_coolingpanel_radiantconvective_water.png";
+  miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_ZoneHVAC_Dehumidifier_DX).value()] =
+    ":images/mini_icons/mini_dehumidifier_dx.png";
+  miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_ZoneHVAC_EnergyRecoveryVentilator).value()] =
+    ":images/mini_icons/mini_energy_recov_vent.png";
+  miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_Coil_Heating_Water_Baseboard).value()] =
+    ":images/mini_icons/coilheatingwater_baseboard_mini.png";
+  miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_Coil_Heating_Water_Baseboard_Radiant).value()] =
+    ":images/mini_icons/Coil_Heating_Water_Baseboard_Radiant.png";
+  miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_ZoneHVAC_FourPipeFanCoil).value()] =
+    ":images/mini_single_ducts_constant_vol_4pipe.png";
+  miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_ZoneHVAC_HighTemperatureRadiant).value()] =
+    ":images/mini_icons/hightempradiant.png";
+  miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_ZoneHVAC_LowTemperatureRadiant_Electric).value()] =
+    ":images/mini_icons/zonehvac_low_temperature_radiant_electric.png";
+  miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_ZoneHVAC_LowTemperatureRadiant_VariableFlow).value()] =
+    ":images/mini_icons/lowtempradiant_varflow.png";
+  miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_ZoneHVAC_LowTemperatureRadiant_ConstantFlow).value()] =
+    ":images/mini_icons/lowtempradiant_constflow.png";
+  miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_ZoneHVAC_WaterToAirHeatPump).value()] =
+    ":images/mini_icons/watertoairHP.png";
+  miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_ZoneHVAC_PackagedTerminalAirConditioner).value()] =
+    ":images/mini_icons/system_type_1.png";
+  miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_ZoneHVAC_PackagedTerminalHeatPump).value()] =
+    ":images/mini_icons/system_type_2.png";
+  miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_ZoneHVAC_UnitHeater).value()] = ":images/mini_icons/heat_coil-uht.png";
+  miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_ZoneHVAC_UnitVentilator).value()] =
+    ":images/mini_icons/mini_unit_ventilator.png";
 
   // TODO: Update if create new icons... placeholder for now
-  m_miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_AvailabilityManager_Scheduled).value()] =
-    new QPixmap(":images/mini_icons/setpoint_mixed.png");
-  m_miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_AvailabilityManager_ScheduledOn).value()] =
-    new QPixmap(":images/mini_icons/setpoint_mixed.png");
-  m_miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_AvailabilityManager_ScheduledOff).value()] =
-    new QPixmap(":images/mini_icons/setpoint_mixed.png");
-  m_miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_AvailabilityManager_LowTemperatureTurnOn).value()] =
-    new QPixmap(":images/mini_icons/setpoint_mixed.png");
-  m_miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_AvailabilityManager_LowTemperatureTurnOff).value()] =
-    new QPixmap(":images/mini_icons/setpoint_mixed.png");
-  m_miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_AvailabilityManager_HighTemperatureTurnOn).value()] =
-    new QPixmap(":images/mini_icons/setpoint_mixed.png");
-  m_miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_AvailabilityManager_HighTemperatureTurnOff).value()] =
-    new QPixmap(":images/mini_icons/setpoint_mixed.png");
-  m_miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_AvailabilityManager_DifferentialThermostat).value()] =
-    new QPixmap(":images/mini_icons/setpoint_mixed.png");
-  m_miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_AvailabilityManager_OptimumStart).value()] =
-    new QPixmap(":images/mini_icons/setpoint_mixed.png");
-  m_miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_AvailabilityManager_NightCycle).value()] =
-    new QPixmap(":images/mini_icons/setpoint_mixed.png");
-  m_miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_AvailabilityManager_NightVentilation).value()] =
-    new QPixmap(":images/mini_icons/setpoint_mixed.png");
-  m_miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_AvailabilityManager_HybridVentilation).value()] =
-    new QPixmap(":images/mini_icons/setpoint_mixed.png");
+  miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_AvailabilityManager_Scheduled).value()] =
+    ":images/mini_icons/setpoint_mixed.png";
+  miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_AvailabilityManager_ScheduledOn).value()] =
+    ":images/mini_icons/setpoint_mixed.png";
+  miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_AvailabilityManager_ScheduledOff).value()] =
+    ":images/mini_icons/setpoint_mixed.png";
+  miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_AvailabilityManager_LowTemperatureTurnOn).value()] =
+    ":images/mini_icons/setpoint_mixed.png";
+  miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_AvailabilityManager_LowTemperatureTurnOff).value()] =
+    ":images/mini_icons/setpoint_mixed.png";
+  miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_AvailabilityManager_HighTemperatureTurnOn).value()] =
+    ":images/mini_icons/setpoint_mixed.png";
+  miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_AvailabilityManager_HighTemperatureTurnOff).value()] =
+    ":images/mini_icons/setpoint_mixed.png";
+  miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_AvailabilityManager_DifferentialThermostat).value()] =
+    ":images/mini_icons/setpoint_mixed.png";
+  miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_AvailabilityManager_OptimumStart).value()] =
+    ":images/mini_icons/setpoint_mixed.png";
+  miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_AvailabilityManager_NightCycle).value()] =
+    ":images/mini_icons/setpoint_mixed.png";
+  miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_AvailabilityManager_NightVentilation).value()] =
+    ":images/mini_icons/setpoint_mixed.png";
+  miniIcons[openstudio::IddObjectType(openstudio::IddObjectType::OS_AvailabilityManager_HybridVentilation).value()] =
+    ":images/mini_icons/setpoint_mixed.png";
+
+  m_icons = makeTable(icons);
+  m_miniIcons = makeTable(miniIcons);
 }
 
 }  // namespace openstudio
@@ -34,16 +34,17 @@
 #include <openstudio/utilities/core/Logger.hpp>
 
 #include <QPixmap>
+#include <QString>
 #include <map>
+#include <vector>
 
 namespace openstudio {
 
 /*! This class is a simple singleton that maps IddObjectType.value() to QPixmaps
  *
- *
- * Pretty straightforward. The class stores pointers, there is no real advantage to using pointers over by value semantics
- * since Qt is doing internal reference counting in QPixMap anyway. Just check the pointer when you do a find operation on
- * it, because it might return NULL.
+ * Icons are decoded the first time they are found, so only the icons that are actually displayed cost anything.
+ * The returned pointers stay valid for the lifetime of the application. Every lookup falls back to the Catchall icon,
+ * so a find operation does not return NULL in practice, but checking the pointer does not hurt.
  *
  */
 class OPENSTUDIO_API IconLibrary
@@ -63,6 +64,9 @@ class OPENSTUDIO_API IconLibrary
   */
   const QPixmap* findMiniIcon(unsigned int val) const;
 
+  //! Number of icons and mini icons decoded so far
+  size_t decodedCount() const;
+
  protected:
  private:
   REGISTER_LOGGER("openstudio.openstudio_lib.IconLibrary");
@@ -71,10 +75,25 @@ class OPENSTUDIO_API IconLibrary
   IconLibrary(const IconLibrary&);
   IconLibrary& operator=(const IconLibrary&);
 
+  struct Icon
+  {
+    unsigned int type;
+    QString path;
+    mutable QPixmap pixmap;
+    mutable bool loaded = false;
+  };
+
+  // Sorted by type, never resized after construction so pointers to the pixmaps stay valid
+  using IconTable = std::vector<Icon>;
+
+  static IconTable makeTable(const std::map<unsigned int, QString>& paths);
+
+  static const QPixmap* find(const IconTable& table, unsigned int val);
+
   static IconLibrary* s_instance;
 
-  std::map<unsigned int, QPixmap*> m_icons;
-  std::map<unsigned int, QPixmap*> m_miniIcons;
+  IconTable m_icons;
+  IconTable m_miniIcons;
 };
 
 }  // namespace openstudio
@@ -37,6 +37,7 @@
 #include <QGraphicsItem>
 #include <QMimeData>
 #include <cmath>
+#include <algorithm>
 #include <openstudio/model/Loop.hpp>
 #include <openstudio/model/Model.hpp>
 #include <openstudio/model/Model_Impl.hpp>
@@ -53,7 +54,16 @@
 #include <openstudio/model/ThermalZone_Impl.hpp>
 #include <openstudio/model/Node.hpp>
 #include <openstudio/model/Node_Impl.hpp>
+#include <openstudio/model/AirLoopHVAC.hpp>
+#include <openstudio/model/AirLoopHVAC_Impl.hpp>
+#include <openstudio/model/SetpointManager.hpp>
+#include <openstudio/model/SetpointManager_Impl.hpp>
+#include <openstudio/model/WaterToAirComponent.hpp>
+#include <openstudio/model/WaterToAirComponent_Impl.hpp>
+#include <openstudio/model/WaterToWaterComponent.hpp>
+#include <openstudio/model/WaterToWaterComponent_Impl.hpp>
 #include <QTimer>
+#include <openstudio/utilities/core/Assert.hpp>
 
 using namespace openstudio::model;
 
@@ -61,7 +71,9 @@ namespace openstudio {
 
 LoopScene::LoopScene(model::Loop loop, QObject* parent) : GridScene(parent), m_loop(loop), m_dirty(true) {
   // loop.model().getImpl<model::detail::Model_Impl>().get()->addWorkspaceObjectPtr.connect<LoopScene, &LoopScene::addedWorkspaceObject>(this);
-  connect(OSAppBase::instance(), &OSAppBase::workspaceObjectAddedPtr, this, &LoopScene::addedWorkspaceObject, Qt::QueuedConnection);
+  if (OSAppBase* app = OSAppBase::instance()) {
+    connect(app, &OSAppBase::workspaceObjectAddedPtr, this, &LoopScene::addedWorkspaceObject, Qt::QueuedConnection);
+  }
 
   loop.model().getImpl<model::detail::Model_Impl>()->removeWorkspaceObjectPtr.connect<LoopScene, &LoopScene::removedWorkspaceObject>(this);
 
@@ -71,22 +83,99 @@ LoopScene::LoopScene(model::Loop loop, QObject* parent) : GridScene(parent), m_l
 void LoopScene::initDefault() {}
 
 void LoopScene::layout() {
-  if (m_dirty && !m_loop.handle().isNull()) {
+  if (m_loop.handle().isNull()) {
+    return;
+  }
+
+  if (m_dirty || !m_systemItem) {
     QList<QGraphicsItem*> itemList = items();
     for (QList<QGraphicsItem*>::iterator it = itemList.begin(); it < itemList.end(); ++it) {
       removeItem(*it);
       delete *it;
     }
 
-    auto* systemItem = new SystemItem(m_loop, this);
+    m_systemItem = new SystemItem(m_loop, this);
 
-    systemItem->setPos(50, 50);
+    m_systemItem->setPos(50, 50);
+  } else if (m_supplySideDirty || m_demandSideDirty) {
+    if (m_supplySideDirty) {
+      m_systemItem->rebuildSupplySide();
+    }
 
-    this->setSceneRect(0, 0, (systemItem->getHGridLength() * 100) + 100, ((systemItem->getVGridLength()) * 100) + 100);
+    if (m_demandSideDirty) {
+      m_systemItem->rebuildDemandSide();
+    }
+  } else {
+    return;
+  }
+
+  this->setSceneRect(0, 0, (m_systemItem->getHGridLength() * 100) + 100, ((m_systemItem->getVGridLength()) * 100) + 100);
 
-    update();
+  updateComponentHandles();
 
-    m_dirty = false;
+  update();
+
+  m_dirty = false;
+  m_supplySideDirty = false;
+  m_demandSideDirty = false;
+}
+
+void LoopScene::invalidateSupplySide() {
+  if (!m_supplySideDirty) {
+    m_supplySideDirty = true;
+
+    QTimer::singleShot(0, this, &LoopScene::layout);
+  }
+}
+
+void LoopScene::invalidateDemandSide() {
+  if (!m_demandSideDirty) {
+    m_demandSideDirty = true;
+
+    QTimer::singleShot(0, this, &LoopScene::layout);
+  }
+}
+
+void LoopScene::updateComponentHandles() {
+  m_supplyHandles.clear();
+  m_demandHandles.clear();
+
+  auto insertComponents = [](const std::vector<model::ModelObject>& components, std::set<Handle>& handles) {
+    for (const auto& component : components) {
+      handles.insert(component.handle());
+
+      // Setpoint managers are drawn on the node they control
+      if (auto node = component.optionalCast<model::Node>()) {
+        for (const auto& spm : node->setpointManagers()) {
+          handles.insert(spm.handle());
+        }
+      }
+
+      // Components that sit on two loops draw a link to the other one, which depends on the nodes next to them there
+      std::vector<boost::optional<model::ModelObject>> linked;
+      if (auto waterToAir = component.optionalCast<model::WaterToAirComponent>()) {
+        linked = {waterToAir->airInletModelObject(), waterToAir->airOutletModelObject(), waterToAir->waterInletModelObject(),
+                  waterToAir->waterOutletModelObject()};
+      } else if (auto waterToWater = component.optionalCast<model::WaterToWaterComponent>()) {
+        linked = {waterToWater->supplyInletModelObject(),   waterToWater->supplyOutletModelObject(),
+                  waterToWater->demandInletModelObject(),   waterToWater->demandOutletModelObject(),
+                  waterToWater->tertiaryInletModelObject(), waterToWater->tertiaryOutletModelObject()};
+      }
+      for (const auto& mo : linked) {
+        if (mo) {
+          handles.insert(mo->handle());
+        }
+      }
+    }
+  };
+
+  insertComponents(m_loop.supplyComponents(), m_supplyHandles);
+  insertComponents(m_loop.demandComponents(), m_demandHandles);
+
+  if (auto airLoop = m_loop.optionalCast<model::AirLoopHVAC>()) {
+    if (auto oaSystem = airLoop->airLoopHVACOutdoorAirSystem()) {
+      insertComponents(oaSystem->components(), m_supplyHandles);
+    }
   }
 }
 
@@ -115,18 +204,121 @@ model::Loop LoopScene::loop() {
 void LoopScene::addedWorkspaceObject(std::shared_ptr<openstudio::detail::WorkspaceObject_Impl> wPtr, const openstudio::IddObjectType& type,
                                      const openstudio::UUID& uuid) {
   auto* hvac_impl = dynamic_cast<model::detail::HVACComponent_Impl*>(wPtr.get());
-  if (hvac_impl) {
-    m_dirty = true;
+  if (!hvac_impl || m_dirty || !wPtr->initialized() || m_loop.handle().isNull()) {
+    return;
+  }
 
-    QTimer::singleShot(0, this, &LoopScene::layout);
+  // This slot is queued, so by now the new component has been connected to whichever loop it belongs to.
+  // Components added to other loops, or not connected at all, do not change this scene.
+  auto component = hvac_impl->getObject<model::HVACComponent>();
+
+  Handle handle = component.handle();
+  if (auto spm = component.optionalCast<model::SetpointManager>()) {
+    if (auto node = spm->setpointNode()) {
+      handle = node->handle();
+    }
+  }
+
+  if (!m_supplySideDirty) {
+    bool onSupplySide(m_loop.supplyComponent(handle));
+    if (!onSupplySide) {
+      if (auto oaSystem = component.airLoopHVACOutdoorAirSystem()) {
+        if (auto airLoop = oaSystem->airLoop()) {
+          onSupplySide = (airLoop->handle() == m_loop.handle());
+        }
+      }
+    }
+
+    if (onSupplySide) {
+      invalidateSupplySide();
+      return;
+    }
+  }
+
+  if (!m_demandSideDirty && m_loop.demandComponent(handle)) {
+    invalidateDemandSide();
+    return;
+  }
+
+  // A node added on another loop next to one of this loop's components, e.g. a water coil being connected to a plant loop
+  if (auto node = component.optionalCast<model::Node>()) {
+    for (const auto& neighbor : {node->inletModelObject(), node->outletModelObject()}) {
+      if (neighbor) {
+        if (m_supplyHandles.count(neighbor->handle()) > 0) {
+          invalidateSupplySide();
+        } else if (m_demandHandles.count(neighbor->handle()) > 0) {
+          invalidateDemandSide();
+        }
+      }
+    }
   }
 }
 
 void LoopScene::removedWorkspaceObject(std::shared_ptr<openstudio::detail::WorkspaceObject_Impl> wPtr, const openstudio::IddObjectType& type,
                                        const openstudio::UUID& uuid) {
-  m_dirty = true;
+  // The object is already on its way out of the model, so locate it through the handles drawn by the last layout
+  if (m_supplyHandles.count(uuid) > 0) {
+    invalidateSupplySide();
+  } else if (m_demandHandles.count(uuid) > 0) {
+    invalidateDemandSide();
+  }
+}
+
+LoopSceneCache::LoopSceneCache(unsigned capacity) : m_capacity(capacity) {
+  OS_ASSERT(m_capacity > 0);
+}
+
+LoopSceneCache::~LoopSceneCache() {
+  clear();
+}
+
+LoopScene* LoopSceneCache::scene(const model::Loop& loop) {
+  auto it = std::find_if(m_scenes.begin(), m_scenes.end(), [&loop](const auto& entry) { return entry.first == loop.handle(); });
+
+  if (it != m_scenes.end() && it->second) {
+    m_scenes.splice(m_scenes.begin(), m_scenes, it);
+  } else {
+    if (it != m_scenes.end()) {
+      m_scenes.erase(it);
+    }
+
+    m_scenes.emplace_front(loop.handle(), new LoopScene(loop));
+
+    while (m_scenes.size() > m_capacity) {
+      if (m_scenes.back().second) {
+        m_scenes.back().second->deleteLater();
+      }
+      m_scenes.pop_back();
+    }
+  }
+
+  return m_scenes.front().second;
+}
+
+void LoopSceneCache::remove(const Handle& loopHandle) {
+  auto it = std::find_if(m_scenes.begin(), m_scenes.end(), [&loopHandle](const auto& entry) { return entry.first == loopHandle; });
+
+  if (it != m_scenes.end()) {
+    if (it->second) {
+      it->second->deleteLater();
+    }
+    m_scenes.erase(it);
+  }
+}
+
+void LoopSceneCache::clear() {
+  for (auto& entry : m_scenes) {
+    delete entry.second;
+  }
+  m_scenes.clear();
+}
+
+bool LoopSceneCache::contains(const Handle& loopHandle) const {
+  return std::any_of(m_scenes.begin(), m_scenes.end(), [&loopHandle](const auto& entry) { return entry.first == loopHandle && entry.second; });
+}
 
-  QTimer::singleShot(0, this, &LoopScene::layout);
+unsigned LoopSceneCache::capacity() const {
+  return m_capacity;
 }
 
 }  // namespace openstudio
@@ -37,6 +37,9 @@
 #include "OSItem.hpp"
 #include "GridScene.hpp"
 #include "../model_editor/QMetaTypes.hpp"
+#include <list>
+#include <set>
+#include <QPointer>
 
 namespace openstudio {
 
@@ -64,6 +67,8 @@ class SupplySideItem;
 
 class OASystemItem;
 
+class SystemItem;
+
 class LoopScene : public GridScene
 {
 
@@ -103,9 +108,56 @@ class LoopScene : public GridScene
 
   void initDefault();
 
+  // Marks one side of the loop for rebuild on the next layout
+  void invalidateSupplySide();
+
+  void invalidateDemandSide();
+
+  // Refreshes the handles drawn on each side; removed objects can no longer be located in the loop
+  void updateComponentHandles();
+
   model::Loop m_loop;
 
+  // m_dirty forces a full rebuild, the side flags rebuild only that part of the SystemItem
   bool m_dirty;
+
+  bool m_supplySideDirty = false;
+
+  bool m_demandSideDirty = false;
+
+  SystemItem* m_systemItem = nullptr;
+
+  std::set<Handle> m_supplyHandles;
+
+  std::set<Handle> m_demandHandles;
+};
+
+// Keeps the most recently shown loop scenes alive, keyed by loop handle, so switching back to a loop does not rebuild
+// its whole topology. A cached scene keeps tracking model changes to its loop while it is not displayed.
+class LoopSceneCache
+{
+ public:
+  explicit LoopSceneCache(unsigned capacity = 8);
+
+  ~LoopSceneCache();
+
+  // Returns the scene for this loop, building it if it is not cached, and marks it as the most recently used.
+  // Building a scene may evict the least recently used one, so only the returned scene should be held on to.
+  LoopScene* scene(const model::Loop& loop);
+
+  void remove(const Handle& loopHandle);
+
+  void clear();
+
+  bool contains(const Handle& loopHandle) const;
+
+  unsigned capacity() const;
+
+ private:
+  unsigned m_capacity;
+
+  // Most recently used first
+  std::list<std::pair<Handle, QPointer<LoopScene>>> m_scenes;
 };
 
 }  // namespace openstudio
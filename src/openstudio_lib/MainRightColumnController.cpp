@@ -211,7 +211,9 @@ void MainRightColumnController::setMyModelView(QWidget* widget) {
   if (QWidget* oldwidget = m_myModelView->currentWidget()) {
     m_myModelView->removeWidget(oldwidget);
 
-    delete oldwidget;
+    if (!isCachedView(oldwidget)) {
+      delete oldwidget;
+    }
   }
 
   if (widget) {
@@ -223,7 +225,7 @@ void MainRightColumnController::setLibraryView(QWidget* widget) {
   if (QWidget* oldwidget = m_libraryView->currentWidget()) {
     m_libraryView->removeWidget(oldwidget);
 
-    if (oldwidget != m_measureLibraryController->localLibraryView) {
+    if (oldwidget != m_measureLibraryController->localLibraryView && !isCachedView(oldwidget)) {
       delete oldwidget;
     }
   }
@@ -233,6 +235,49 @@ void MainRightColumnController::setLibraryView(QWidget* widget) {
   }
 }
 
+bool MainRightColumnController::showCachedMyModelView(const std::string& key) {
+  QWidget* widget = m_cachedMyModelViews.find(key);
+  if (!widget) {
+    return false;
+  }
+
+  if (m_myModelView->currentWidget() != widget) {
+    setMyModelView(widget);
+  }
+  return true;
+}
+
+bool MainRightColumnController::showCachedLibraryView(const std::string& key) {
+  // once the component library is replaced, the panels built from the previous one are stale
+  if (m_cachedLibraryViews.resetForLibrary(OSAppBase::instance()->currentDocument()->componentLibrary())) {
+    return false;
+  }
+
+  QWidget* widget = m_cachedLibraryViews.find(key);
+  if (!widget) {
+    return false;
+  }
+
+  if (m_libraryView->currentWidget() != widget) {
+    setLibraryView(widget);
+  }
+  return true;
+}
+
+void MainRightColumnController::setCachedMyModelView(const std::string& key, QWidget* widget) {
+  m_cachedMyModelViews.insert(key, widget);
+  setMyModelView(widget);
+}
+
+void MainRightColumnController::setCachedLibraryView(const std::string& key, QWidget* widget) {
+  m_cachedLibraryViews.insert(key, widget);
+  setLibraryView(widget);
+}
+
+bool MainRightColumnController::isCachedView(QWidget* widget) const {
+  return m_cachedMyModelViews.contains(widget) || m_cachedLibraryViews.contains(widget);
+}
+
 void MainRightColumnController::configureForSiteSubTab(int subTabID) {
   std::shared_ptr<OSDocument> doc = OSAppBase::instance()->currentDocument();
 
@@ -262,35 +307,39 @@ void MainRightColumnController::configureForSchedulesSubTab(int subTabID) {
       model::Model lib = doc->componentLibrary();
 
       // my model
-      auto* myModelList = new ModelObjectTypeListView(m_model, true, OSItemType::CollapsibleListHeader);
-      myModelList->setItemsType(OSItemType::LibraryItem);
-      myModelList->setItemsDraggable(true);
-      myModelList->setItemsRemoveable(false);
-
-      myModelList->addModelObjectType(IddObjectType::OS_Schedule_VariableInterval, "Variable Interval Schedules");
-      myModelList->addModelObjectType(IddObjectType::OS_Schedule_FixedInterval, "Fixed Interval Schedules");
-      myModelList->addModelObjectType(IddObjectType::OS_Schedule_Year, "Year Schedules");
-      myModelList->addModelObjectType(IddObjectType::OS_Schedule_Constant, "Constant Schedules");
-      myModelList->addModelObjectType(IddObjectType::OS_Schedule_Compact, "Compact Schedules");
-      myModelList->addModelObjectType(IddObjectType::OS_Schedule_Ruleset, "Ruleset Schedules");
-
-      setMyModelView(myModelList);
+      if (!showCachedMyModelView("Schedules/ScheduleSets")) {
+        auto* myModelList = new ModelObjectTypeListView(m_model, true, OSItemType::CollapsibleListHeader);
+        myModelList->setItemsType(OSItemType::LibraryItem);
+        myModelList->setItemsDraggable(true);
+        myModelList->setItemsRemoveable(false);
+
+        myModelList->addModelObjectType(IddObjectType::OS_Schedule_VariableInterval, "Variable Interval Schedules");
+        myModelList->addModelObjectType(IddObjectType::OS_Schedule_FixedInterval, "Fixed Interval Schedules");
+        myModelList->addModelObjectType(IddObjectType::OS_Schedule_Year, "Year Schedules");
+        myModelList->addModelObjectType(IddObjectType::OS_Schedule_Constant, "Constant Schedules");
+        myModelList->addModelObjectType(IddObjectType::OS_Schedule_Compact, "Compact Schedules");
+        myModelList->addModelObjectType(IddObjectType::OS_Schedule_Ruleset, "Ruleset Schedules");
+
+        setCachedMyModelView("Schedules/ScheduleSets", myModelList);
+      }
 
       // my library
-      auto* myLibraryList = new ModelObjectTypeListView(lib, true, OSItemType::CollapsibleListHeader);
-      myLibraryList->setItemsDraggable(true);
-      myLibraryList->setItemsRemoveable(false);
-      myLibraryList->setItemsType(OSItemType::LibraryItem);
-
-      myLibraryList->addModelObjectType(IddObjectType::OS_Schedule_VariableInterval, "Variable Interval Schedules");
-      myLibraryList->addModelObjectType(IddObjectType::OS_Schedule_FixedInterval, "Fixed Interval Schedules");
-      myLibraryList->addModelObjectType(IddObjectType::OS_Schedule_Year, "Year Schedules");
-      myLibraryList->addModelObjectType(IddObjectType::OS_Schedule_Constant, "Constant Schedules");
-      myLibraryList->addModelObjectType(IddObjectType::OS_Schedule_Compact, "Compact Schedules");
-      myLibraryList->addModelObjectType(IddObjectType::OS_Schedule_Ruleset, "Ruleset Schedules");
-      myLibraryList->addModelObjectType(IddObjectType::OS_DefaultScheduleSet, "Schedule Sets");
-
-      setLibraryView(myLibraryList);
+      if (!showCachedLibraryView("Schedules/ScheduleSets")) {
+        auto* myLibraryList = new ModelObjectTypeListView(lib, true, OSItemType::CollapsibleListHeader);
+        myLibraryList->setItemsDraggable(true);
+        myLibraryList->setItemsRemoveable(false);
+        myLibraryList->setItemsType(OSItemType::LibraryItem);
+
+        myLibraryList->addModelObjectType(IddObjectType::OS_Schedule_VariableInterval, "Variable Interval Schedules");
+        myLibraryList->addModelObjectType(IddObjectType::OS_Schedule_FixedInterval, "Fixed Interval Schedules");
+        myLibraryList->addModelObjectType(IddObjectType::OS_Schedule_Year, "Year Schedules");
+        myLibraryList->addModelObjectType(IddObjectType::OS_Schedule_Constant, "Constant Schedules");
+        myLibraryList->addModelObjectType(IddObjectType::OS_Schedule_Compact, "Compact Schedules");
+        myLibraryList->addModelObjectType(IddObjectType::OS_Schedule_Ruleset, "Ruleset Schedules");
+        myLibraryList->addModelObjectType(IddObjectType::OS_DefaultScheduleSet, "Schedule Sets");
+
+        setCachedLibraryView("Schedules/ScheduleSets", myLibraryList);
+      }
       doc->openSidebar();
       //doc->closeSidebar();
 
@@ -300,14 +349,16 @@ void MainRightColumnController::configureForSchedulesSubTab(int subTabID) {
       model::Model lib = doc->componentLibrary();
 
       // my library
-      auto* myLibraryList = new ModelObjectTypeListView(lib, true, OSItemType::CollapsibleListHeader);
-      myLibraryList->setItemsDraggable(true);
-      myLibraryList->setItemsRemoveable(false);
-      myLibraryList->setItemsType(OSItemType::LibraryItem);
+      if (!showCachedLibraryView("Schedules/Schedules")) {
+        auto* myLibraryList = new ModelObjectTypeListView(lib, true, OSItemType::CollapsibleListHeader);
+        myLibraryList->setItemsDraggable(true);
+        myLibraryList->setItemsRemoveable(false);
+        myLibraryList->setItemsType(OSItemType::LibraryItem);
 
-      myLibraryList->addModelObjectType(IddObjectType::OS_Schedule_Ruleset, "Schedule Rulesets");
+        myLibraryList->addModelObjectType(IddObjectType::OS_Schedule_Ruleset, "Schedule Rulesets");
 
-      setLibraryView(myLibraryList);
+        setCachedLibraryView("Schedules/Schedules", myLibraryList);
+      }
       doc->openSidebar();
       //doc->closeSidebar();
 
@@ -330,35 +381,39 @@ void MainRightColumnController::configureForConstructionsSubTab(int subTabID) {
       model::Model lib = doc->componentLibrary();
 
       // my model
-      auto* myModelList = new ModelObjectTypeListView(m_model, true, OSItemType::CollapsibleListHeader);
-      myModelList->setItemsDraggable(true);
-      myModelList->setItemsRemoveable(false);
-      myModelList->setItemsType(OSItemType::LibraryItem);
-
-      myModelList->addModelObjectType(IddObjectType::OS_Construction_WindowDataFile, "Window Data File Constructions");
-      myModelList->addModelObjectType(IddObjectType::OS_Construction_FfactorGroundFloor, "F-factor Ground Floor Constructions");
-      myModelList->addModelObjectType(IddObjectType::OS_Construction_CfactorUndergroundWall, "C-factor Underground Wall Constructions");
-      myModelList->addModelObjectType(IddObjectType::OS_Construction_InternalSource, "Internal Source Constructions");
-      myModelList->addModelObjectType(IddObjectType::OS_Construction_AirBoundary, "Air Boundary Constructions");
-      myModelList->addModelObjectType(IddObjectType::OS_Construction, "Constructions");
-
-      setMyModelView(myModelList);
+      if (!showCachedMyModelView("Constructions/DefaultConstructions")) {
+        auto* myModelList = new ModelObjectTypeListView(m_model, true, OSItemType::CollapsibleListHeader);
+        myModelList->setItemsDraggable(true);
+        myModelList->setItemsRemoveable(false);
+        myModelList->setItemsType(OSItemType::LibraryItem);
+
+        myModelList->addModelObjectType(IddObjectType::OS_Construction_WindowDataFile, "Window Data File Constructions");
+        myModelList->addModelObjectType(IddObjectType::OS_Construction_FfactorGroundFloor, "F-factor Ground Floor Constructions");
+        myModelList->addModelObjectType(IddObjectType::OS_Construction_CfactorUndergroundWall, "C-factor Underground Wall Constructions");
+        myModelList->addModelObjectType(IddObjectType::OS_Construction_InternalSource, "Internal Source Constructions");
+        myModelList->addModelObjectType(IddObjectType::OS_Construction_AirBoundary, "Air Boundary Constructions");
+        myModelList->addModelObjectType(IddObjectType::OS_Construction, "Constructions");
+
+        setCachedMyModelView("Constructions/DefaultConstructions", myModelList);
+      }
 
       // my library
-      auto* myLibraryList = new ModelObjectTypeListView(lib, true, OSItemType::CollapsibleListHeader, true);
-      myLibraryList->setItemsDraggable(true);
-      myLibraryList->setItemsRemoveable(false);
-      myLibraryList->setItemsType(OSItemType::LibraryItem);
-
-      myLibraryList->addModelObjectType(IddObjectType::OS_Construction_WindowDataFile, "Window Data File Constructions");
-      myLibraryList->addModelObjectType(IddObjectType::OS_Construction_FfactorGroundFloor, "F-factor Ground Floor Constructions");
-      myLibraryList->addModelObjectType(IddObjectType::OS_Construction_CfactorUndergroundWall, "C-factor Underground Wall Constructions");
-      myLibraryList->addModelObjectType(IddObjectType::OS_Construction_InternalSource, "Internal Source Constructions");
-      myLibraryList->addModelObjectType(IddObjectType::OS_Construction_AirBoundary, "Air Boundary Constructions");
-      myLibraryList->addModelObjectType(IddObjectType::OS_Construction, "Constructions");
-      myLibraryList->addModelObjectType(IddObjectType::OS_DefaultConstructionSet, "Construction Sets");
-
-      setLibraryView(myLibraryList);
+      if (!showCachedLibraryView("Constructions/DefaultConstructions")) {
+        auto* myLibraryList = new ModelObjectTypeListView(lib, true, OSItemType::CollapsibleListHeader, true);
+        myLibraryList->setItemsDraggable(true);
+        myLibraryList->setItemsRemoveable(false);
+        myLibraryList->setItemsType(OSItemType::LibraryItem);
+
+        myLibraryList->addModelObjectType(IddObjectType::OS_Construction_WindowDataFile, "Window Data File Constructions");
+        myLibraryList->addModelObjectType(IddObjectType::OS_Construction_FfactorGroundFloor, "F-factor Ground Floor Constructions");
+        myLibraryList->addModelObjectType(IddObjectType::OS_Construction_CfactorUndergroundWall, "C-factor Underground Wall Constructions");
+        myLibraryList->addModelObjectType(IddObjectType::OS_Construction_InternalSource, "Internal Source Constructions");
+        myLibraryList->addModelObjectType(IddObjectType::OS_Construction_AirBoundary, "Air Boundary Constructions");
+        myLibraryList->addModelObjectType(IddObjectType::OS_Construction, "Constructions");
+        myLibraryList->addModelObjectType(IddObjectType::OS_DefaultConstructionSet, "Construction Sets");
+
+        setCachedLibraryView("Constructions/DefaultConstructions", myLibraryList);
+      }
 
       doc->openSidebar();
       break;
@@ -367,66 +422,70 @@ void MainRightColumnController::configureForConstructionsSubTab(int subTabID) {
       model::Model lib = doc->componentLibrary();
 
       // my model
-      auto* myModelList = new ModelObjectTypeListView(m_model, true, OSItemType::CollapsibleListHeader);
-      myModelList->setItemsDraggable(true);
-      myModelList->setItemsRemoveable(false);
-      myModelList->setItemsType(OSItemType::LibraryItem);
-
-      // TODO: commented out until ThermochromicGlazing is properly wrapped
-      // myModelList->addModelObjectType(IddObjectType::OS_WindowMaterial_GlazingGroup_Thermochromic, "Glazing Group Thermochromic Window Materials");
-
-      myModelList->addModelObjectType(IddObjectType::OS_WindowMaterial_Glazing_RefractionExtinctionMethod,
-                                      "Refraction Extinction Method Glazing Window Materials");
-      myModelList->addModelObjectType(IddObjectType::OS_WindowMaterial_Shade, "Shade Window Materials");
-      myModelList->addModelObjectType(IddObjectType::OS_WindowMaterial_Screen, "Screen Window Materials");
-      myModelList->addModelObjectType(IddObjectType::OS_WindowMaterial_Blind, "Blind Window Materials");
-      myModelList->addModelObjectType(IddObjectType::OS_WindowMaterial_DaylightRedirectionDevice, "Daylight Redirection Device Window Materials");
-      myModelList->addModelObjectType(IddObjectType::OS_WindowMaterial_GasMixture, "Gas Mixture Window Materials");
-      myModelList->addModelObjectType(IddObjectType::OS_WindowMaterial_Gas, "Gas Window Materials");
-      myModelList->addModelObjectType(IddObjectType::OS_WindowMaterial_Glazing, "Glazing Window Materials");
-      myModelList->addModelObjectType(IddObjectType::OS_WindowMaterial_SimpleGlazingSystem, "Simple Glazing System Window Materials");
-
-      myModelList->addModelObjectType(IddObjectType::OS_Material_RoofVegetation, "Roof Vegetation Materials");
-      myModelList->addModelObjectType(IddObjectType::OS_Material_InfraredTransparent, "Infrared Transparent Materials");
-      myModelList->addModelObjectType(IddObjectType::OS_Material_AirGap, "Air Gap Materials");
-      myModelList->addModelObjectType(IddObjectType::OS_Material_NoMass, "No Mass Materials");
-      myModelList->addModelObjectType(IddObjectType::OS_Material, "Materials");
-
-      setMyModelView(myModelList);
+      if (!showCachedMyModelView("Constructions/Constructions")) {
+        auto* myModelList = new ModelObjectTypeListView(m_model, true, OSItemType::CollapsibleListHeader);
+        myModelList->setItemsDraggable(true);
+        myModelList->setItemsRemoveable(false);
+        myModelList->setItemsType(OSItemType::LibraryItem);
 
-      // my library
-      auto* myLibraryList = new ModelObjectTypeListView(lib, true, OSItemType::CollapsibleListHeader, true);
-      myLibraryList->setItemsDraggable(true);
-      myLibraryList->setItemsRemoveable(false);
-      myLibraryList->setItemsType(OSItemType::LibraryItem);
-
-      // TODO: commented out until ThermochromicGlazing is properly wrapped
-      // myLibraryList->addModelObjectType(IddObjectType::OS_WindowMaterial_GlazingGroup_Thermochromic, "Glazing Group Thermochromic Window Materials");
-      myLibraryList->addModelObjectType(IddObjectType::OS_WindowMaterial_Glazing_RefractionExtinctionMethod,
+        // TODO: commented out until ThermochromicGlazing is properly wrapped
+        // myModelList->addModelObjectType(IddObjectType::OS_WindowMaterial_GlazingGroup_Thermochromic, "Glazing Group Thermochromic Window Materials");
+
+        myModelList->addModelObjectType(IddObjectType::OS_WindowMaterial_Glazing_RefractionExtinctionMethod,
                                         "Refraction Extinction Method Glazing Window Materials");
-      myLibraryList->addModelObjectType(IddObjectType::OS_WindowMaterial_Shade, "Shade Window Materials");
-      myLibraryList->addModelObjectType(IddObjectType::OS_WindowMaterial_Screen, "Screen Window Materials");
-      myLibraryList->addModelObjectType(IddObjectType::OS_WindowMaterial_Blind, "Blind Window Materials");
-      myLibraryList->addModelObjectType(IddObjectType::OS_WindowMaterial_DaylightRedirectionDevice, "Daylight Redirection Device Window Materials");
-      myLibraryList->addModelObjectType(IddObjectType::OS_WindowMaterial_GasMixture, "Gas Mixture Window Materials");
-      myLibraryList->addModelObjectType(IddObjectType::OS_WindowMaterial_Gas, "Gas Window Materials");
-      myLibraryList->addModelObjectType(IddObjectType::OS_WindowMaterial_Glazing, "Glazing Window Materials");
-      myLibraryList->addModelObjectType(IddObjectType::OS_WindowMaterial_SimpleGlazingSystem, "Simple Glazing System Window Materials");
-
-      myLibraryList->addModelObjectType(IddObjectType::OS_Material_RoofVegetation, "Roof Vegetation Materials");
-      myLibraryList->addModelObjectType(IddObjectType::OS_Material_InfraredTransparent, "Infrared Transparent Materials");
-      myLibraryList->addModelObjectType(IddObjectType::OS_Material_AirGap, "Air Gap Materials");
-      myLibraryList->addModelObjectType(IddObjectType::OS_Material_NoMass, "No Mass Materials");
-      myLibraryList->addModelObjectType(IddObjectType::OS_Material, "Materials");
-
-      myLibraryList->addModelObjectType(IddObjectType::OS_Construction_WindowDataFile, "Window Data File Constructions");
-      myLibraryList->addModelObjectType(IddObjectType::OS_Construction_FfactorGroundFloor, "F-factor Ground Floor Constructions");
-      myLibraryList->addModelObjectType(IddObjectType::OS_Construction_CfactorUndergroundWall, "C-factor Underground Wall Constructions");
-      myLibraryList->addModelObjectType(IddObjectType::OS_Construction_InternalSource, "Internal Source Constructions");
-      myLibraryList->addModelObjectType(IddObjectType::OS_Construction_AirBoundary, "Air Boundary Constructions");
-      myLibraryList->addModelObjectType(IddObjectType::OS_Construction, "Constructions");
-
-      setLibraryView(myLibraryList);
+        myModelList->addModelObjectType(IddObjectType::OS_WindowMaterial_Shade, "Shade Window Materials");
+        myModelList->addModelObjectType(IddObjectType::OS_WindowMaterial_Screen, "Screen Window Materials");
+        myModelList->addModelObjectType(IddObjectType::OS_WindowMaterial_Blind, "Blind Window Materials");
+        myModelList->addModelObjectType(IddObjectType::OS_WindowMaterial_DaylightRedirectionDevice, "Daylight Redirection Device Window Materials");
+        myModelList->addModelObjectType(IddObjectType::OS_WindowMaterial_GasMixture, "Gas Mixture Window Materials");
+        myModelList->addModelObjectType(IddObjectType::OS_WindowMaterial_Gas, "Gas Window Materials");
+        myModelList->addModelObjectType(IddObjectType::OS_WindowMaterial_Glazing, "Glazing Window Materials");
+        myModelList->addModelObjectType(IddObjectType::OS_WindowMaterial_SimpleGlazingSystem, "Simple Glazing System Window Materials");
+
+        myModelList->addModelObjectType(IddObjectType::OS_Material_RoofVegetation, "Roof Vegetation Materials");
+        myModelList->addModelObjectType(IddObjectType::OS_Material_InfraredTransparent, "Infrared Transparent Materials");
+        myModelList->addModelObjectType(IddObjectType::OS_Material_AirGap, "Air Gap Materials");
+        myModelList->addModelObjectType(IddObjectType::OS_Material_NoMass, "No Mass Materials");
+        myModelList->addModelObjectType(IddObjectType::OS_Material, "Materials");
+
+        setCachedMyModelView("Constructions/Constructions", myModelList);
+      }
+
+      // my library
+      if (!showCachedLibraryView("Constructions/Constructions")) {
+        auto* myLibraryList = new ModelObjectTypeListView(lib, true, OSItemType::CollapsibleListHeader, true);
+        myLibraryList->setItemsDraggable(true);
+        myLibraryList->setItemsRemoveable(false);
+        myLibraryList->setItemsType(OSItemType::LibraryItem);
+
+        // TODO: commented out until ThermochromicGlazing is properly wrapped
+        // myLibraryList->addModelObjectType(IddObjectType::OS_WindowMaterial_GlazingGroup_Thermochromic, "Glazing Group Thermochromic Window Materials");
+        myLibraryList->addModelObjectType(IddObjectType::OS_WindowMaterial_Glazing_RefractionExtinctionMethod,
+                                          "Refraction Extinction Method Glazing Window Materials");
+        myLibraryList->addModelObjectType(IddObjectType::OS_WindowMaterial_Shade, "Shade Window Materials");
+        myLibraryList->addModelObjectType(IddObjectType::OS_WindowMaterial_Screen, "Screen Window Materials");
+        myLibraryList->addModelObjectType(IddObjectType::OS_WindowMaterial_Blind, "Blind Window Materials");
+        myLibraryList->addModelObjectType(IddObjectType::OS_WindowMaterial_DaylightRedirectionDevice, "Daylight Redirection Device Window Materials");
+        myLibraryList->addModelObjectType(IddObjectType::OS_WindowMaterial_GasMixture, "Gas Mixture Window Materials");
+        myLibraryList->addModelObjectType(IddObjectType::OS_WindowMaterial_Gas, "Gas Window Materials");
+        myLibraryList->addModelObjectType(IddObjectType::OS_WindowMaterial_Glazing, "Glazing Window Materials");
+        myLibraryList->addModelObjectType(IddObjectType::OS_WindowMaterial_SimpleGlazingSystem, "Simple Glazing System Window Materials");
+
+        myLibraryList->addModelObjectType(IddObjectType::OS_Material_RoofVegetation, "Roof Vegetation Materials");
+        myLibraryList->addModelObjectType(IddObjectType::OS_Material_InfraredTransparent, "Infrared Transparent Materials");
+        myLibraryList->addModelObjectType(IddObjectType::OS_Material_AirGap, "Air Gap Materials");
+        myLibraryList->addModelObjectType(IddObjectType::OS_Material_NoMass, "No Mass Materials");
+        myLibraryList->addModelObjectType(IddObjectType::OS_Material, "Materials");
+
+        myLibraryList->addModelObjectType(IddObjectType::OS_Construction_WindowDataFile, "Window Data File Constructions");
+        myLibraryList->addModelObjectType(IddObjectType::OS_Construction_FfactorGroundFloor, "F-factor Ground Floor Constructions");
+        myLibraryList->addModelObjectType(IddObjectType::OS_Construction_CfactorUndergroundWall, "C-factor Underground Wall Constructions");
+        myLibraryList->addModelObjectType(IddObjectType::OS_Construction_InternalSource, "Internal Source Constructions");
+        myLibraryList->addModelObjectType(IddObjectType::OS_Construction_AirBoundary, "Air Boundary Constructions");
+        myLibraryList->addModelObjectType(IddObjectType::OS_Construction, "Constructions");
+
+        setCachedLibraryView("Constructions/Constructions", myLibraryList);
+      }
 
       doc->openSidebar();
       break;
@@ -435,40 +494,44 @@ void MainRightColumnController::configureForConstructionsSubTab(int subTabID) {
       model::Model lib = doc->componentLibrary();
 
       // my model
-      auto* myModelList = new ModelObjectTypeListView(m_model, true, OSItemType::CollapsibleListHeader);
-      myModelList->setItemsDraggable(true);
-      myModelList->setItemsRemoveable(false);
-      myModelList->setItemsType(OSItemType::LibraryItem);
+      if (!showCachedMyModelView("Constructions/Materials")) {
+        auto* myModelList = new ModelObjectTypeListView(m_model, true, OSItemType::CollapsibleListHeader);
+        myModelList->setItemsDraggable(true);
+        myModelList->setItemsRemoveable(false);
+        myModelList->setItemsType(OSItemType::LibraryItem);
 
-      setMyModelView(myModelList);
+        setCachedMyModelView("Constructions/Materials", myModelList);
+      }
 
       // my library
-      auto* myLibraryList = new ModelObjectTypeListView(lib, true, OSItemType::CollapsibleListHeader, true);
-      myLibraryList->setItemsDraggable(true);
-      myLibraryList->setItemsRemoveable(false);
-      myLibraryList->setItemsType(OSItemType::LibraryItem);
-
-      // TODO: commented out until ThermochromicGlazing is properly wrapped
-      // myLibraryList->addModelObjectType(IddObjectType::OS_WindowMaterial_GlazingGroup_Thermochromic, "Glazing Group Thermochromic Window Materials");
-
-      myLibraryList->addModelObjectType(IddObjectType::OS_WindowMaterial_Glazing_RefractionExtinctionMethod,
-                                        "Refraction Extinction Method Glazing Window Materials");
-      myLibraryList->addModelObjectType(IddObjectType::OS_WindowMaterial_Shade, "Shade Window Materials");
-      myLibraryList->addModelObjectType(IddObjectType::OS_WindowMaterial_Screen, "Screen Window Materials");
-      myLibraryList->addModelObjectType(IddObjectType::OS_WindowMaterial_Blind, "Blind Window Materials");
-      myLibraryList->addModelObjectType(IddObjectType::OS_WindowMaterial_DaylightRedirectionDevice, "Daylight Redirection Device Window Materials");
-      myLibraryList->addModelObjectType(IddObjectType::OS_WindowMaterial_GasMixture, "Gas Mixture Window Materials");
-      myLibraryList->addModelObjectType(IddObjectType::OS_WindowMaterial_Gas, "Gas Window Materials");
-      myLibraryList->addModelObjectType(IddObjectType::OS_WindowMaterial_Glazing, "Glazing Window Materials");
-      myLibraryList->addModelObjectType(IddObjectType::OS_WindowMaterial_SimpleGlazingSystem, "Simple Glazing System Window Materials");
-
-      myLibraryList->addModelObjectType(IddObjectType::OS_Material_RoofVegetation, "Roof Vegetation Materials");
-      myLibraryList->addModelObjectType(IddObjectType::OS_Material_InfraredTransparent, "Infrared Transparent Materials");
-      myLibraryList->addModelObjectType(IddObjectType::OS_Material_AirGap, "Air Gap Materials");
-      myLibraryList->addModelObjectType(IddObjectType::OS_Material_NoMass, "No Mass Materials");
-      myLibraryList->addModelObjectType(IddObjectType::OS_Material, "Materials");
-
-      setLibraryView(myLibraryList);
+      if (!showCachedLibraryView("Constructions/Materials")) {
+        auto* myLibraryList = new ModelObjectTypeListView(lib, true, OSItemType::CollapsibleListHeader, true);
+        myLibraryList->setItemsDraggable(true);
+        myLibraryList->setItemsRemoveable(false);
+        myLibraryList->setItemsType(OSItemType::LibraryItem);
+
+        // TODO: commented out until ThermochromicGlazing is properly wrapped
+        // myLibraryList->addModelObjectType(IddObjectType::OS_WindowMaterial_GlazingGroup_Thermochromic, "Glazing Group Thermochromic Window Materials");
+
+        myLibraryList->addModelObjectType(IddObjectType::OS_WindowMaterial_Glazing_RefractionExtinctionMethod,
+                                          "Refraction Extinction Method Glazing Window Materials");
+        myLibraryList->addModelObjectType(IddObjectType::OS_WindowMaterial_Shade, "Shade Window Materials");
+        myLibraryList->addModelObjectType(IddObjectType::OS_WindowMaterial_Screen, "Screen Window Materials");
+        myLibraryList->addModelObjectType(IddObjectType::OS_WindowMaterial_Blind, "Blind Window Materials");
+        myLibraryList->addModelObjectType(IddObjectType::OS_WindowMaterial_DaylightRedirectionDevice, "Daylight Redirection Device Window Materials");
+        myLibraryList->addModelObjectType(IddObjectType::OS_WindowMaterial_GasMixture, "Gas Mixture Window Materials");
+        myLibraryList->addModelObjectType(IddObjectType::OS_WindowMaterial_Gas, "Gas Window Materials");
+        myLibraryList->addModelObjectType(IddObjectType::OS_WindowMaterial_Glazing, "Glazing Window Materials");
+        myLibraryList->addModelObjectType(IddObjectType::OS_WindowMaterial_SimpleGlazingSystem, "Simple Glazing System Window Materials");
+
+        myLibraryList->addModelObjectType(IddObjectType::OS_Material_RoofVegetation, "Roof Vegetation Materials");
+        myLibraryList->addModelObjectType(IddObjectType::OS_Material_InfraredTransparent, "Infrared Transparent Materials");
+        myLibraryList->addModelObjectType(IddObjectType::OS_Material_AirGap, "Air Gap Materials");
+        myLibraryList->addModelObjectType(IddObjectType::OS_Material_NoMass, "No Mass Materials");
+        myLibraryList->addModelObjectType(IddObjectType::OS_Material, "Materials");
+
+        setCachedLibraryView("Constructions/Materials", myLibraryList);
+      }
 
       doc->openSidebar();
       break;
@@ -508,57 +571,61 @@ void MainRightColumnController::configureForLoadsSubTab(int subTabID) {
 
   // my model
 
-  auto* myModelList = new ModelObjectTypeListView(m_model, true, OSItemType::CollapsibleListHeader);
-  myModelList->setItemsDraggable(true);
-  myModelList->setItemsRemoveable(false);
-  myModelList->setItemsType(OSItemType::LibraryItem);
-
-  myModelList->addModelObjectType(IddObjectType::OS_Construction_WindowDataFile, "Window Data File Constructions");
-  myModelList->addModelObjectType(IddObjectType::OS_Construction_FfactorGroundFloor, "F-factor Ground Floor Constructions");
-  myModelList->addModelObjectType(IddObjectType::OS_Construction_CfactorUndergroundWall, "C-factor Underground Wall Constructions");
-  myModelList->addModelObjectType(IddObjectType::OS_Construction_InternalSource, "Internal Source Constructions");
-  myModelList->addModelObjectType(IddObjectType::OS_Construction_AirBoundary, "Air Boundary Constructions");
-  myModelList->addModelObjectType(IddObjectType::OS_Construction, "Constructions");
-  myModelList->addModelObjectType(IddObjectType::OS_Schedule_VariableInterval, "Variable Interval Schedules");
-  myModelList->addModelObjectType(IddObjectType::OS_Schedule_FixedInterval, "Fixed Interval Schedules");
-  myModelList->addModelObjectType(IddObjectType::OS_Schedule_Year, "Year Schedules");
-  myModelList->addModelObjectType(IddObjectType::OS_Schedule_Constant, "Constant Schedules");
-  myModelList->addModelObjectType(IddObjectType::OS_Schedule_Compact, "Compact Schedules");
-  myModelList->addModelObjectType(IddObjectType::OS_Schedule_Ruleset, "Ruleset Schedules");
-
-  setMyModelView(myModelList);
+  if (!showCachedMyModelView("Loads")) {
+    auto* myModelList = new ModelObjectTypeListView(m_model, true, OSItemType::CollapsibleListHeader);
+    myModelList->setItemsDraggable(true);
+    myModelList->setItemsRemoveable(false);
+    myModelList->setItemsType(OSItemType::LibraryItem);
+
+    myModelList->addModelObjectType(IddObjectType::OS_Construction_WindowDataFile, "Window Data File Constructions");
+    myModelList->addModelObjectType(IddObjectType::OS_Construction_FfactorGroundFloor, "F-factor Ground Floor Constructions");
+    myModelList->addModelObjectType(IddObjectType::OS_Construction_CfactorUndergroundWall, "C-factor Underground Wall Constructions");
+    myModelList->addModelObjectType(IddObjectType::OS_Construction_InternalSource, "Internal Source Constructions");
+    myModelList->addModelObjectType(IddObjectType::OS_Construction_AirBoundary, "Air Boundary Constructions");
+    myModelList->addModelObjectType(IddObjectType::OS_Construction, "Constructions");
+    myModelList->addModelObjectType(IddObjectType::OS_Schedule_VariableInterval, "Variable Interval Schedules");
+    myModelList->addModelObjectType(IddObjectType::OS_Schedule_FixedInterval, "Fixed Interval Schedules");
+    myModelList->addModelObjectType(IddObjectType::OS_Schedule_Year, "Year Schedules");
+    myModelList->addModelObjectType(IddObjectType::OS_Schedule_Constant, "Constant Schedules");
+    myModelList->addModelObjectType(IddObjectType::OS_Schedule_Compact, "Compact Schedules");
+    myModelList->addModelObjectType(IddObjectType::OS_Schedule_Ruleset, "Ruleset Schedules");
+
+    setCachedMyModelView("Loads", myModelList);
+  }
 
   // my library
 
-  auto* myLibraryList = new ModelObjectTypeListView(lib, true, OSItemType::CollapsibleListHeader, true);
-  myLibraryList->setItemsDraggable(true);
-  myLibraryList->setItemsRemoveable(false);
-  myLibraryList->setItemsType(OSItemType::LibraryItem);
-
-  myLibraryList->addModelObjectType(IddObjectType::OS_Construction_WindowDataFile, "Window Data File Constructions");
-  myLibraryList->addModelObjectType(IddObjectType::OS_Construction_FfactorGroundFloor, "F-factor Ground Floor Constructions");
-  myLibraryList->addModelObjectType(IddObjectType::OS_Construction_CfactorUndergroundWall, "C-factor Underground Wall Constructions");
-  myLibraryList->addModelObjectType(IddObjectType::OS_Construction_InternalSource, "Internal Source Constructions");
-  myLibraryList->addModelObjectType(IddObjectType::OS_Construction_AirBoundary, "Air Boundary Constructions");
-  myLibraryList->addModelObjectType(IddObjectType::OS_Construction, "Constructions");
-  myLibraryList->addModelObjectType(IddObjectType::OS_InternalMass_Definition, "Internal Mass Definitions");
-  myLibraryList->addModelObjectType(IddObjectType::OS_OtherEquipment_Definition, "Other Equipment Definitions");
-  myLibraryList->addModelObjectType(IddObjectType::OS_SteamEquipment_Definition, "Steam Equipment Definitions");
-  myLibraryList->addModelObjectType(IddObjectType::OS_HotWaterEquipment_Definition, "Hot Water Equipment Definitions");
-  myLibraryList->addModelObjectType(IddObjectType::OS_WaterUse_Equipment_Definition, "Water Use Equipment Definitions");
-  myLibraryList->addModelObjectType(IddObjectType::OS_GasEquipment_Definition, "Gas Equipment Definitions");
-  myLibraryList->addModelObjectType(IddObjectType::OS_ElectricEquipment_Definition, "Electric Equipment Definitions");
-  myLibraryList->addModelObjectType(IddObjectType::OS_Luminaire_Definition, "Luminaire Definitions");
-  myLibraryList->addModelObjectType(IddObjectType::OS_Lights_Definition, "Lights Definitions");
-  myLibraryList->addModelObjectType(IddObjectType::OS_People_Definition, "People Definitions");
-  myLibraryList->addModelObjectType(IddObjectType::OS_Schedule_VariableInterval, "Variable Interval Schedules");
-  myLibraryList->addModelObjectType(IddObjectType::OS_Schedule_FixedInterval, "Fixed Interval Schedules");
-  myLibraryList->addModelObjectType(IddObjectType::OS_Schedule_Year, "Year Schedules");
-  myLibraryList->addModelObjectType(IddObjectType::OS_Schedule_Constant, "Constant Schedules");
-  myLibraryList->addModelObjectType(IddObjectType::OS_Schedule_Compact, "Compact Schedules");
-  myLibraryList->addModelObjectType(IddObjectType::OS_Schedule_Ruleset, "Ruleset Schedules");
-
-  setLibraryView(myLibraryList);
+  if (!showCachedLibraryView("Loads")) {
+    auto* myLibraryList = new ModelObjectTypeListView(lib, true, OSItemType::CollapsibleListHeader, true);
+    myLibraryList->setItemsDraggable(true);
+    myLibraryList->setItemsRemoveable(false);
+    myLibraryList->setItemsType(OSItemType::LibraryItem);
+
+    myLibraryList->addModelObjectType(IddObjectType::OS_Construction_WindowDataFile, "Window Data File Constructions");
+    myLibraryList->addModelObjectType(IddObjectType::OS_Construction_FfactorGroundFloor, "F-factor Ground Floor Constructions");
+    myLibraryList->addModelObjectType(IddObjectType::OS_Construction_CfactorUndergroundWall, "C-factor Underground Wall Constructions");
+    myLibraryList->addModelObjectType(IddObjectType::OS_Construction_InternalSource, "Internal Source Constructions");
+    myLibraryList->addModelObjectType(IddObjectType::OS_Construction_AirBoundary, "Air Boundary Constructions");
+    myLibraryList->addModelObjectType(IddObjectType::OS_Construction, "Constructions");
+    myLibraryList->addModelObjectType(IddObjectType::OS_InternalMass_Definition, "Internal Mass Definitions");
+    myLibraryList->addModelObjectType(IddObjectType::OS_OtherEquipment_Definition, "Other Equipment Definitions");
+    myLibraryList->addModelObjectType(IddObjectType::OS_SteamEquipment_Definition, "Steam Equipment Definitions");
+    myLibraryList->addModelObjectType(IddObjectType::OS_HotWaterEquipment_Definition, "Hot Water Equipment Definitions");
+    myLibraryList->addModelObjectType(IddObjectType::OS_WaterUse_Equipment_Definition, "Water Use Equipment Definitions");
+    myLibraryList->addModelObjectType(IddObjectType::OS_GasEquipment_Definition, "Gas Equipment Definitions");
+    myLibraryList->addModelObjectType(IddObjectType::OS_ElectricEquipment_Definition, "Electric Equipment Definitions");
+    myLibraryList->addModelObjectType(IddObjectType::OS_Luminaire_Definition, "Luminaire Definitions");
+    myLibraryList->addModelObjectType(IddObjectType::OS_Lights_Definition, "Lights Definitions");
+    myLibraryList->addModelObjectType(IddObjectType::OS_People_Definition, "People Definitions");
+    myLibraryList->addModelObjectType(IddObjectType::OS_Schedule_VariableInterval, "Variable Interval Schedules");
+    myLibraryList->addModelObjectType(IddObjectType::OS_Schedule_FixedInterval, "Fixed Interval Schedules");
+    myLibraryList->addModelObjectType(IddObjectType::OS_Schedule_Year, "Year Schedules");
+    myLibraryList->addModelObjectType(IddObjectType::OS_Schedule_Constant, "Constant Schedules");
+    myLibraryList->addModelObjectType(IddObjectType::OS_Schedule_Compact, "Compact Schedules");
+    myLibraryList->addModelObjectType(IddObjectType::OS_Schedule_Ruleset, "Ruleset Schedules");
+
+    setCachedLibraryView("Loads", myLibraryList);
+  }
 
   doc->openSidebar();
 }
@@ -572,76 +639,80 @@ void MainRightColumnController::configureForSpaceTypesSubTab(int subTabID) {
   std::shared_ptr<OSDocument> doc = OSAppBase::instance()->currentDocument();
 
   // my model
-  auto* myModelList = new ModelObjectTypeListView(m_model, true, OSItemType::CollapsibleListHeader);
-  myModelList->setItemsDraggable(true);
-  myModelList->setItemsRemoveable(false);
-  myModelList->setItemsType(OSItemType::LibraryItem);
-
-  myModelList->addModelObjectType(IddObjectType::OS_Schedule_VariableInterval, "Variable Interval Schedules");
-  myModelList->addModelObjectType(IddObjectType::OS_Schedule_FixedInterval, "Fixed Interval Schedules");
-  myModelList->addModelObjectType(IddObjectType::OS_Schedule_Year, "Year Schedules");
-  myModelList->addModelObjectType(IddObjectType::OS_Schedule_Constant, "Constant Schedules");
-  myModelList->addModelObjectType(IddObjectType::OS_Schedule_Compact, "Compact Schedules");
-  myModelList->addModelObjectType(IddObjectType::OS_Schedule_Ruleset, "Ruleset Schedules");
-
-  myModelList->addModelObjectType(IddObjectType::OS_InternalMass_Definition, "Internal Mass Definitions");
-  myModelList->addModelObjectType(IddObjectType::OS_OtherEquipment_Definition, "Other Equipment Definitions");
-  myModelList->addModelObjectType(IddObjectType::OS_SteamEquipment_Definition, "Steam Equipment Definitions");
-  myModelList->addModelObjectType(IddObjectType::OS_HotWaterEquipment_Definition, "Hot Water Equipment Definitions");
-  myModelList->addModelObjectType(IddObjectType::OS_WaterUse_Equipment_Definition, "Water Use Equipment Definitions");
-  myModelList->addModelObjectType(IddObjectType::OS_GasEquipment_Definition, "Gas Equipment Definitions");
-  myModelList->addModelObjectType(IddObjectType::OS_ElectricEquipment_Definition, "Electric Equipment Definitions");
-  myModelList->addModelObjectType(IddObjectType::OS_Luminaire_Definition, "Luminaire Definitions");
-  myModelList->addModelObjectType(IddObjectType::OS_Lights_Definition, "Lights Definitions");
-  myModelList->addModelObjectType(IddObjectType::OS_People_Definition, "People Definitions");
-
-  //OSCollapsibleItemHeader* unassignedSpacesCollapsibleHeader = new OSCollapsibleItemHeader("Unassigned Spaces", OSItemId("",""), OSItemType::CollapsibleListHeader);
-  //unassignedSpacesCollapsibleHeader->setRemoveable(false);
-  //SpaceTypeUnassignedSpacesVectorController* unassignedSpacesVectorController = new SpaceTypeUnassignedSpacesVectorController();
-  //unassignedSpacesVectorController->attachModel(m_model);
-  //OSItemList* unassignedSpacesList = new OSItemList(unassignedSpacesVectorController, false);
-  //OSCollapsibleItem* unassignedSpacesCollapsibleItem = new OSCollapsibleItem(unassignedSpacesCollapsibleHeader, unassignedSpacesList);
-  //myModelList->addCollapsibleItem(unassignedSpacesCollapsibleItem);
-
-  //myModelList->addModelObjectType(IddObjectType::OS_SpaceInfiltration_DesignFlowRate, "Space Infiltration Design Flow Rates"); // do not show in my model because these are not shareable
-  myModelList->addModelObjectType(IddObjectType::OS_DesignSpecification_OutdoorAir, "Design Specification Outdoor Air");
-  myModelList->addModelObjectType(IddObjectType::OS_DefaultScheduleSet, "Schedule Sets");
-  myModelList->addModelObjectType(IddObjectType::OS_DefaultConstructionSet, "Construction Sets");
-
-  setMyModelView(myModelList);
+  if (!showCachedMyModelView("SpaceTypes")) {
+    auto* myModelList = new ModelObjectTypeListView(m_model, true, OSItemType::CollapsibleListHeader);
+    myModelList->setItemsDraggable(true);
+    myModelList->setItemsRemoveable(false);
+    myModelList->setItemsType(OSItemType::LibraryItem);
+
+    myModelList->addModelObjectType(IddObjectType::OS_Schedule_VariableInterval, "Variable Interval Schedules");
+    myModelList->addModelObjectType(IddObjectType::OS_Schedule_FixedInterval, "Fixed Interval Schedules");
+    myModelList->addModelObjectType(IddObjectType::OS_Schedule_Year, "Year Schedules");
+    myModelList->addModelObjectType(IddObjectType::OS_Schedule_Constant, "Constant Schedules");
+    myModelList->addModelObjectType(IddObjectType::OS_Schedule_Compact, "Compact Schedules");
+    myModelList->addModelObjectType(IddObjectType::OS_Schedule_Ruleset, "Ruleset Schedules");
+
+    myModelList->addModelObjectType(IddObjectType::OS_InternalMass_Definition, "Internal Mass Definitions");
+    myModelList->addModelObjectType(IddObjectType::OS_OtherEquipment_Definition, "Other Equipment Definitions");
+    myModelList->addModelObjectType(IddObjectType::OS_SteamEquipment_Definition, "Steam Equipment Definitions");
+    myModelList->addModelObjectType(IddObjectType::OS_HotWaterEquipment_Definition, "Hot Water Equipment Definitions");
+    myModelList->addModelObjectType(IddObjectType::OS_WaterUse_Equipment_Definition, "Water Use Equipment Definitions");
+    myModelList->addModelObjectType(IddObjectType::OS_GasEquipment_Definition, "Gas Equipment Definitions");
+    myModelList->addModelObjectType(IddObjectType::OS_ElectricEquipment_Definition, "Electric Equipment Definitions");
+    myModelList->addModelObjectType(IddObjectType::OS_Luminaire_Definition, "Luminaire Definitions");
+    myModelList->addModelObjectType(IddObjectType::OS_Lights_Definition, "Lights Definitions");
+    myModelList->addModelObjectType(IddObjectType::OS_People_Definition, "People Definitions");
+
+    //OSCollapsibleItemHeader* unassignedSpacesCollapsibleHeader = new OSCollapsibleItemHeader("Unassigned Spaces", OSItemId("",""), OSItemType::CollapsibleListHeader);
+    //unassignedSpacesCollapsibleHeader->setRemoveable(false);
+    //SpaceTypeUnassignedSpacesVectorController* unassignedSpacesVectorController = new SpaceTypeUnassignedSpacesVectorController();
+    //unassignedSpacesVectorController->attachModel(m_model);
+    //OSItemList* unassignedSpacesList = new OSItemList(unassignedSpacesVectorController, false);
+    //OSCollapsibleItem* unassignedSpacesCollapsibleItem = new OSCollapsibleItem(unassignedSpacesCollapsibleHeader, unassignedSpacesList);
+    //myModelList->addCollapsibleItem(unassignedSpacesCollapsibleItem);
+
+    //myModelList->addModelObjectType(IddObjectType::OS_SpaceInfiltration_DesignFlowRate, "Space Infiltration Design Flow Rates"); // do not show in my model because these are not shareable
+    myModelList->addModelObjectType(IddObjectType::OS_DesignSpecification_OutdoorAir, "Design Specification Outdoor Air");
+    myModelList->addModelObjectType(IddObjectType::OS_DefaultScheduleSet, "Schedule Sets");
+    myModelList->addModelObjectType(IddObjectType::OS_DefaultConstructionSet, "Construction Sets");
+
+    setCachedMyModelView("SpaceTypes", myModelList);
+  }
 
   // my library
   model::Model lib = doc->componentLibrary();
 
-  auto* myLibraryList = new ModelObjectTypeListView(lib, true, OSItemType::CollapsibleListHeader, true);
-  myLibraryList->setItemsDraggable(true);
-  myLibraryList->setItemsRemoveable(false);
-  myLibraryList->setItemsType(OSItemType::LibraryItem);
-
-  myLibraryList->addModelObjectType(IddObjectType::OS_Schedule_VariableInterval, "Variable Interval Schedules");
-  myLibraryList->addModelObjectType(IddObjectType::OS_Schedule_FixedInterval, "Fixed Interval Schedules");
-  myLibraryList->addModelObjectType(IddObjectType::OS_Schedule_Year, "Year Schedules");
-  myLibraryList->addModelObjectType(IddObjectType::OS_Schedule_Constant, "Constant Schedules");
-  myLibraryList->addModelObjectType(IddObjectType::OS_Schedule_Compact, "Compact Schedules");
-  myLibraryList->addModelObjectType(IddObjectType::OS_Schedule_Ruleset, "Ruleset Schedules");
-
-  myLibraryList->addModelObjectType(IddObjectType::OS_InternalMass_Definition, "Internal Mass Definitions");
-  myLibraryList->addModelObjectType(IddObjectType::OS_OtherEquipment_Definition, "Other Equipment Definitions");
-  myLibraryList->addModelObjectType(IddObjectType::OS_SteamEquipment_Definition, "Steam Equipment Definitions");
-  myLibraryList->addModelObjectType(IddObjectType::OS_HotWaterEquipment_Definition, "Hot Water Equipment Definitions");
-  myLibraryList->addModelObjectType(IddObjectType::OS_WaterUse_Equipment_Definition, "Water Use Equipment Definitions");
-  myLibraryList->addModelObjectType(IddObjectType::OS_GasEquipment_Definition, "Gas Equipment Definitions");
-  myLibraryList->addModelObjectType(IddObjectType::OS_ElectricEquipment_Definition, "Electric Equipment Definitions");
-  myLibraryList->addModelObjectType(IddObjectType::OS_Luminaire_Definition, "Luminaire Definitions");
-  myLibraryList->addModelObjectType(IddObjectType::OS_Lights_Definition, "Lights Definitions");
-  myLibraryList->addModelObjectType(IddObjectType::OS_People_Definition, "People Definitions");
-  myLibraryList->addModelObjectType(IddObjectType::OS_SpaceInfiltration_DesignFlowRate, "Space Infiltration Design Flow Rates");
-  myLibraryList->addModelObjectType(IddObjectType::OS_SpaceInfiltration_EffectiveLeakageArea, "Space Infiltration Effective Leakage Areas");
-  myLibraryList->addModelObjectType(IddObjectType::OS_DesignSpecification_OutdoorAir, "Design Specification Outdoor Air");
-  myLibraryList->addModelObjectType(IddObjectType::OS_DefaultScheduleSet, "Schedule Sets");
-  myLibraryList->addModelObjectType(IddObjectType::OS_DefaultConstructionSet, "Construction Sets");
-  myLibraryList->addModelObjectType(IddObjectType::OS_SpaceType, "Space Types");
-  setLibraryView(myLibraryList);
+  if (!showCachedLibraryView("SpaceTypes")) {
+    auto* myLibraryList = new ModelObjectTypeListView(lib, true, OSItemType::CollapsibleListHeader, true);
+    myLibraryList->setItemsDraggable(true);
+    myLibraryList->setItemsRemoveable(false);
+    myLibraryList->setItemsType(OSItemType::LibraryItem);
+
+    myLibraryList->addModelObjectType(IddObjectType::OS_Schedule_VariableInterval, "Variable Interval Schedules");
+    myLibraryList->addModelObjectType(IddObjectType::OS_Schedule_FixedInterval, "Fixed Interval Schedules");
+    myLibraryList->addModelObjectType(IddObjectType::OS_Schedule_Year, "Year Schedules");
+    myLibraryList->addModelObjectType(IddObjectType::OS_Schedule_Constant, "Constant Schedules");
+    myLibraryList->addModelObjectType(IddObjectType::OS_Schedule_Compact, "Compact Schedules");
+    myLibraryList->addModelObjectType(IddObjectType::OS_Schedule_Ruleset, "Ruleset Schedules");
+
+    myLibraryList->addModelObjectType(IddObjectType::OS_InternalMass_Definition, "Internal Mass Definitions");
+    myLibraryList->addModelObjectType(IddObjectType::OS_OtherEquipment_Definition, "Other Equipment Definitions");
+    myLibraryList->addModelObjectType(IddObjectType::OS_SteamEquipment_Definition, "Steam Equipment Definitions");
+    myLibraryList->addModelObjectType(IddObjectType::OS_HotWaterEquipment_Definition, "Hot Water Equipment Definitions");
+    myLibraryList->addModelObjectType(IddObjectType::OS_WaterUse_Equipment_Definition, "Water Use Equipment Definitions");
+    myLibraryList->addModelObjectType(IddObjectType::OS_GasEquipment_Definition, "Gas Equipment Definitions");
+    myLibraryList->addModelObjectType(IddObjectType::OS_ElectricEquipment_Definition, "Electric Equipment Definitions");
+    myLibraryList->addModelObjectType(IddObjectType::OS_Luminaire_Definition, "Luminaire Definitions");
+    myLibraryList->addModelObjectType(IddObjectType::OS_Lights_Definition, "Lights Definitions");
+    myLibraryList->addModelObjectType(IddObjectType::OS_People_Definition, "People Definitions");
+    myLibraryList->addModelObjectType(IddObjectType::OS_SpaceInfiltration_DesignFlowRate, "Space Infiltration Design Flow Rates");
+    myLibraryList->addModelObjectType(IddObjectType::OS_SpaceInfiltration_EffectiveLeakageArea, "Space Infiltration Effective Leakage Areas");
+    myLibraryList->addModelObjectType(IddObjectType::OS_DesignSpecification_OutdoorAir, "Design Specification Outdoor Air");
+    myLibraryList->addModelObjectType(IddObjectType::OS_DefaultScheduleSet, "Schedule Sets");
+    myLibraryList->addModelObjectType(IddObjectType::OS_DefaultConstructionSet, "Construction Sets");
+    myLibraryList->addModelObjectType(IddObjectType::OS_SpaceType, "Space Types");
+    setCachedLibraryView("SpaceTypes", myLibraryList);
+  }
 
   doc->openSidebar();
 }
@@ -652,100 +723,104 @@ void MainRightColumnController::configureForFacilitySubTab(int subTabID) {
   std::shared_ptr<OSDocument> doc = OSAppBase::instance()->currentDocument();
 
   // my model
-  auto* myModelList = new ModelObjectTypeListView(m_model, true, OSItemType::CollapsibleListHeader);
-  myModelList->setItemsDraggable(true);
-  myModelList->setItemsRemoveable(false);
-  myModelList->setItemsType(OSItemType::LibraryItem);
-
-  myModelList->addModelObjectType(IddObjectType::OS_SubSurface, "Sub Surfaces");
-  myModelList->addModelObjectType(IddObjectType::OS_Surface, "Surfaces");
-  myModelList->addModelObjectType(IddObjectType::OS_Construction_WindowDataFile, "Window Data File Constructions");
-  myModelList->addModelObjectType(IddObjectType::OS_Construction_FfactorGroundFloor, "F-factor Ground Floor Constructions");
-  myModelList->addModelObjectType(IddObjectType::OS_Construction_CfactorUndergroundWall, "C-factor Underground Wall Constructions");
-  myModelList->addModelObjectType(IddObjectType::OS_Construction_InternalSource, "Internal Source Constructions");
-  myModelList->addModelObjectType(IddObjectType::OS_Construction_AirBoundary, "Air Boundary Constructions");
-  myModelList->addModelObjectType(IddObjectType::OS_Construction, "Constructions");
-  myModelList->addModelObjectType(IddObjectType::OS_Schedule_VariableInterval, "Variable Interval Schedules");
-  myModelList->addModelObjectType(IddObjectType::OS_Schedule_FixedInterval, "Fixed Interval Schedules");
-  myModelList->addModelObjectType(IddObjectType::OS_Schedule_Year, "Year Schedules");
-  myModelList->addModelObjectType(IddObjectType::OS_Schedule_Constant, "Constant Schedules");
-  myModelList->addModelObjectType(IddObjectType::OS_Schedule_Compact, "Compact Schedules");
-  myModelList->addModelObjectType(IddObjectType::OS_Schedule_Ruleset, "Ruleset Schedules");
-  myModelList->addModelObjectType(IddObjectType::OS_InternalMass_Definition, "Internal Mass Definitions");
-  myModelList->addModelObjectType(IddObjectType::OS_OtherEquipment_Definition, "Other Equipment Definitions");
-  myModelList->addModelObjectType(IddObjectType::OS_SteamEquipment_Definition, "Steam Equipment Definitions");
-  myModelList->addModelObjectType(IddObjectType::OS_HotWaterEquipment_Definition, "Hot Water Equipment Definitions");
-  myModelList->addModelObjectType(IddObjectType::OS_WaterUse_Equipment_Definition, "Water Use Equipment Definitions");
-  myModelList->addModelObjectType(IddObjectType::OS_GasEquipment_Definition, "Gas Equipment Definitions");
-  myModelList->addModelObjectType(IddObjectType::OS_ElectricEquipment_Definition, "Electric Equipment Definitions");
-  myModelList->addModelObjectType(IddObjectType::OS_Luminaire_Definition, "Luminaire Definitions");
-  myModelList->addModelObjectType(IddObjectType::OS_Lights_Definition, "Lights Definitions");
-  myModelList->addModelObjectType(IddObjectType::OS_People_Definition, "People Definitions");
-  myModelList->addModelObjectType(IddObjectType::OS_Exterior_WaterEquipment_Definition, "Exterior Water Equipment Definitions");
-  myModelList->addModelObjectType(IddObjectType::OS_Exterior_FuelEquipment_Definition, "Exterior Fuel Equipment Definitions");
-  myModelList->addModelObjectType(IddObjectType::OS_Exterior_Lights_Definition, "Exterior Lights Definitions");
-  //myModelList->addModelObjectType(IddObjectType::OS_SpaceInfiltration_DesignFlowRate, "Space Infiltration Design Flow Rates"); // do not show in my model because these are not shareable
-  myModelList->addModelObjectType(IddObjectType::OS_DesignSpecification_OutdoorAir, "Design Specification Outdoor Air");
-  myModelList->addModelObjectType(IddObjectType::OS_DefaultScheduleSet, "Schedule Sets");
-  myModelList->addModelObjectType(IddObjectType::OS_DefaultConstructionSet, "Construction Sets");
-  myModelList->addModelObjectType(IddObjectType::OS_SpaceType, "Space Types");
-  myModelList->addModelObjectType(IddObjectType::OS_ThermalZone, "Thermal Zones");
-  myModelList->addModelObjectType(IddObjectType::OS_BuildingStory, "Building Stories");
-
-  setMyModelView(myModelList);
+  if (!showCachedMyModelView("Facility")) {
+    auto* myModelList = new ModelObjectTypeListView(m_model, true, OSItemType::CollapsibleListHeader);
+    myModelList->setItemsDraggable(true);
+    myModelList->setItemsRemoveable(false);
+    myModelList->setItemsType(OSItemType::LibraryItem);
+
+    myModelList->addModelObjectType(IddObjectType::OS_SubSurface, "Sub Surfaces");
+    myModelList->addModelObjectType(IddObjectType::OS_Surface, "Surfaces");
+    myModelList->addModelObjectType(IddObjectType::OS_Construction_WindowDataFile, "Window Data File Constructions");
+    myModelList->addModelObjectType(IddObjectType::OS_Construction_FfactorGroundFloor, "F-factor Ground Floor Constructions");
+    myModelList->addModelObjectType(IddObjectType::OS_Construction_CfactorUndergroundWall, "C-factor Underground Wall Constructions");
+    myModelList->addModelObjectType(IddObjectType::OS_Construction_InternalSource, "Internal Source Constructions");
+    myModelList->addModelObjectType(IddObjectType::OS_Construction_AirBoundary, "Air Boundary Constructions");
+    myModelList->addModelObjectType(IddObjectType::OS_Construction, "Constructions");
+    myModelList->addModelObjectType(IddObjectType::OS_Schedule_VariableInterval, "Variable Interval Schedules");
+    myModelList->addModelObjectType(IddObjectType::OS_Schedule_FixedInterval, "Fixed Interval Schedules");
+    myModelList->addModelObjectType(IddObjectType::OS_Schedule_Year, "Year Schedules");
+    myModelList->addModelObjectType(IddObjectType::OS_Schedule_Constant, "Constant Schedules");
+    myModelList->addModelObjectType(IddObjectType::OS_Schedule_Compact, "Compact Schedules");
+    myModelList->addModelObjectType(IddObjectType::OS_Schedule_Ruleset, "Ruleset Schedules");
+    myModelList->addModelObjectType(IddObjectType::OS_InternalMass_Definition, "Internal Mass Definitions");
+    myModelList->addModelObjectType(IddObjectType::OS_OtherEquipment_Definition, "Other Equipment Definitions");
+    myModelList->addModelObjectType(IddObjectType::OS_SteamEquipment_Definition, "Steam Equipment Definitions");
+    myModelList->addModelObjectType(IddObjectType::OS_HotWaterEquipment_Definition, "Hot Water Equipment Definitions");
+    myModelList->addModelObjectType(IddObjectType::OS_WaterUse_Equipment_Definition, "Water Use Equipment Definitions");
+    myModelList->addModelObjectType(IddObjectType::OS_GasEquipment_Definition, "Gas Equipment Definitions");
+    myModelList->addModelObjectType(IddObjectType::OS_ElectricEquipment_Definition, "Electric Equipment Definitions");
+    myModelList->addModelObjectType(IddObjectType::OS_Luminaire_Definition, "Luminaire Definitions");
+    myModelList->addModelObjectType(IddObjectType::OS_Lights_Definition, "Lights Definitions");
+    myModelList->addModelObjectType(IddObjectType::OS_People_Definition, "People Definitions");
+    myModelList->addModelObjectType(IddObjectType::OS_Exterior_WaterEquipment_Definition, "Exterior Water Equipment Definitions");
+    myModelList->addModelObjectType(IddObjectType::OS_Exterior_FuelEquipment_Definition, "Exterior Fuel Equipment Definitions");
+    myModelList->addModelObjectType(IddObjectType::OS_Exterior_Lights_Definition, "Exterior Lights Definitions");
+    //myModelList->addModelObjectType(IddObjectType::OS_SpaceInfiltration_DesignFlowRate, "Space Infiltration Design Flow Rates"); // do not show in my model because these are not shareable
+    myModelList->addModelObjectType(IddObjectType::OS_DesignSpecification_OutdoorAir, "Design Specification Outdoor Air");
+    myModelList->addModelObjectType(IddObjectType::OS_DefaultScheduleSet, "Schedule Sets");
+    myModelList->addModelObjectType(IddObjectType::OS_DefaultConstructionSet, "Construction Sets");
+    myModelList->addModelObjectType(IddObjectType::OS_SpaceType, "Space Types");
+    myModelList->addModelObjectType(IddObjectType::OS_ThermalZone, "Thermal Zones");
+    myModelList->addModelObjectType(IddObjectType::OS_BuildingStory, "Building Stories");
+
+    setCachedMyModelView("Facility", myModelList);
+  }
 
   // Library
   model::Model lib = doc->componentLibrary();
 
-  auto* myLibraryList = new ModelObjectTypeListView(lib, true, OSItemType::CollapsibleListHeader);
-  myLibraryList->setItemsDraggable(true);
-  myLibraryList->setItemsRemoveable(false);
-  myLibraryList->setItemsType(OSItemType::LibraryItem);
-
-  myLibraryList->addModelObjectType(IddObjectType::OS_Fan_ZoneExhaust, "Fan Zone Exhaust");
-  myLibraryList->addModelObjectType(IddObjectType::OS_ZoneHVAC_PackagedTerminalHeatPump, "PTHP");
-  myLibraryList->addModelObjectType(IddObjectType::OS_ZoneHVAC_PackagedTerminalAirConditioner, "PTAC");
-  myLibraryList->addModelObjectType(IddObjectType::OS_ZoneHVAC_WaterToAirHeatPump, "Water To Air HP");
-  myLibraryList->addModelObjectType(IddObjectType::OS_ZoneHVAC_LowTemperatureRadiant_ConstantFlow, "Low Temp Radiant Constant Flow");
-  myLibraryList->addModelObjectType(IddObjectType::OS_ZoneHVAC_LowTemperatureRadiant_VariableFlow, "Low Temp Radiant Variable Flow");
-  myLibraryList->addModelObjectType(IddObjectType::OS_ZoneHVAC_LowTemperatureRadiant_Electric, "Low Temp Radiant Electric");
-  myLibraryList->addModelObjectType(IddObjectType::OS_ZoneHVAC_HighTemperatureRadiant, "High Temp Radiant");
-  myLibraryList->addModelObjectType(IddObjectType::OS_Construction_WindowDataFile, "Window Data File Constructions");
-  myLibraryList->addModelObjectType(IddObjectType::OS_Construction_FfactorGroundFloor, "F-factor Ground Floor Constructions");
-  myLibraryList->addModelObjectType(IddObjectType::OS_Construction_CfactorUndergroundWall, "C-factor Underground Wall Constructions");
-  myLibraryList->addModelObjectType(IddObjectType::OS_Construction_InternalSource, "Internal Source Constructions");
-  myLibraryList->addModelObjectType(IddObjectType::OS_Construction_AirBoundary, "Air Boundary Constructions");
-  myLibraryList->addModelObjectType(IddObjectType::OS_Construction, "Constructions");
-  myLibraryList->addModelObjectType(IddObjectType::OS_Schedule_VariableInterval, "Variable Interval Schedules");
-  myLibraryList->addModelObjectType(IddObjectType::OS_Schedule_FixedInterval, "Fixed Interval Schedules");
-  myLibraryList->addModelObjectType(IddObjectType::OS_Schedule_Year, "Year Schedules");
-  myLibraryList->addModelObjectType(IddObjectType::OS_Schedule_Constant, "Constant Schedules");
-  myLibraryList->addModelObjectType(IddObjectType::OS_Schedule_Compact, "Compact Schedules");
-  myLibraryList->addModelObjectType(IddObjectType::OS_Schedule_Ruleset, "Ruleset Schedules");
-  myLibraryList->addModelObjectType(IddObjectType::OS_InternalMass_Definition, "Internal Mass Definitions");
-  myLibraryList->addModelObjectType(IddObjectType::OS_OtherEquipment_Definition, "Other Equipment Definitions");
-  myLibraryList->addModelObjectType(IddObjectType::OS_SteamEquipment_Definition, "Steam Equipment Definitions");
-  myLibraryList->addModelObjectType(IddObjectType::OS_HotWaterEquipment_Definition, "Hot Water Equipment Definitions");
-  myLibraryList->addModelObjectType(IddObjectType::OS_WaterUse_Equipment_Definition, "Water Use Equipment Definitions");
-  myLibraryList->addModelObjectType(IddObjectType::OS_GasEquipment_Definition, "Gas Equipment Definitions");
-  myLibraryList->addModelObjectType(IddObjectType::OS_ElectricEquipment_Definition, "Electric Equipment Definitions");
-  myLibraryList->addModelObjectType(IddObjectType::OS_Luminaire_Definition, "Luminaire Definitions");
-  myLibraryList->addModelObjectType(IddObjectType::OS_Lights_Definition, "Lights Definitions");
-  myLibraryList->addModelObjectType(IddObjectType::OS_People_Definition, "People Definitions");
-  myLibraryList->addModelObjectType(IddObjectType::OS_Exterior_WaterEquipment_Definition, "Exterior Water Equipment Definitions");
-  myLibraryList->addModelObjectType(IddObjectType::OS_Exterior_FuelEquipment_Definition, "Exterior Fuel Equipment Definitions");
-  myLibraryList->addModelObjectType(IddObjectType::OS_Exterior_Lights_Definition, "Exterior Lights Definitions");
-  myLibraryList->addModelObjectType(IddObjectType::OS_Exterior_WaterEquipment, "Exterior Water Equipment");
-  myLibraryList->addModelObjectType(IddObjectType::OS_Exterior_FuelEquipment, "Exterior Fuel Equipment");
-  myLibraryList->addModelObjectType(IddObjectType::OS_Exterior_Lights, "Exterior Lights");
-  myLibraryList->addModelObjectType(IddObjectType::OS_SpaceInfiltration_DesignFlowRate, "Space Infiltration Design Flow Rates");
-  myLibraryList->addModelObjectType(IddObjectType::OS_SpaceInfiltration_EffectiveLeakageArea, "Space Infiltration Effective Leakage Areas");
-  myLibraryList->addModelObjectType(IddObjectType::OS_DesignSpecification_OutdoorAir, "Design Specification Outdoor Air");
-  myLibraryList->addModelObjectType(IddObjectType::OS_DefaultScheduleSet, "Schedule Sets");
-  myLibraryList->addModelObjectType(IddObjectType::OS_DefaultConstructionSet, "Construction Sets");
-  myLibraryList->addModelObjectType(IddObjectType::OS_SpaceType, "Space Types");
-
-  setLibraryView(myLibraryList);
+  if (!showCachedLibraryView("Facility")) {
+    auto* myLibraryList = new ModelObjectTypeListView(lib, true, OSItemType::CollapsibleListHeader);
+    myLibraryList->setItemsDraggable(true);
+    myLibraryList->setItemsRemoveable(false);
+    myLibraryList->setItemsType(OSItemType::LibraryItem);
+
+    myLibraryList->addModelObjectType(IddObjectType::OS_Fan_ZoneExhaust, "Fan Zone Exhaust");
+    myLibraryList->addModelObjectType(IddObjectType::OS_ZoneHVAC_PackagedTerminalHeatPump, "PTHP");
+    myLibraryList->addModelObjectType(IddObjectType::OS_ZoneHVAC_PackagedTerminalAirConditioner, "PTAC");
+    myLibraryList->addModelObjectType(IddObjectType::OS_ZoneHVAC_WaterToAirHeatPump, "Water To Air HP");
+    myLibraryList->addModelObjectType(IddObjectType::OS_ZoneHVAC_LowTemperatureRadiant_ConstantFlow, "Low Temp Radiant Constant Flow");
+    myLibraryList->addModelObjectType(IddObjectType::OS_ZoneHVAC_LowTemperatureRadiant_VariableFlow, "Low Temp Radiant Variable Flow");
+    myLibraryList->addModelObjectType(IddObjectType::OS_ZoneHVAC_LowTemperatureRadiant_Electric, "Low Temp Radiant Electric");
+    myLibraryList->addModelObjectType(IddObjectType::OS_ZoneHVAC_HighTemperatureRadiant, "High Temp Radiant");
+    myLibraryList->addModelObjectType(IddObjectType::OS_Construction_WindowDataFile, "Window Data File Constructions");
+    myLibraryList->addModelObjectType(IddObjectType::OS_Construction_FfactorGroundFloor, "F-factor Ground Floor Constructions");
+    myLibraryList->addModelObjectType(IddObjectType::OS_Construction_CfactorUndergroundWall, "C-factor Underground Wall Constructions");
+    myLibraryList->addModelObjectType(IddObjectType::OS_Construction_InternalSource, "Internal Source Constructions");
+    myLibraryList->addModelObjectType(IddObjectType::OS_Construction_AirBoundary, "Air Boundary Constructions");
+    myLibraryList->addModelObjectType(IddObjectType::OS_Construction, "Constructions");
+    myLibraryList->addModelObjectType(IddObjectType::OS_Schedule_VariableInterval, "Variable Interval Schedules");
+    myLibraryList->addModelObjectType(IddObjectType::OS_Schedule_FixedInterval, "Fixed Interval Schedules");
+    myLibraryList->addModelObjectType(IddObjectType::OS_Schedule_Year, "Year Schedules");
+    myLibraryList->addModelObjectType(IddObjectType::OS_Schedule_Constant, "Constant Schedules");
+    myLibraryList->addModelObjectType(IddObjectType::OS_Schedule_Compact, "Compact Schedules");
+    myLibraryList->addModelObjectType(IddObjectType::OS_Schedule_Ruleset, "Ruleset Schedules");
+    myLibraryList->addModelObjectType(IddObjectType::OS_InternalMass_Definition, "Internal Mass Definitions");
+    myLibraryList->addModelObjectType(IddObjectType::OS_OtherEquipment_Definition, "Other Equipment Definitions");
+    myLibraryList->addModelObjectType(IddObjectType::OS_SteamEquipment_Definition, "Steam Equipment Definitions");
+    myLibraryList->addModelObjectType(IddObjectType::OS_HotWaterEquipment_Definition, "Hot Water Equipment Definitions");
+    myLibraryList->addModelObjectType(IddObjectType::OS_WaterUse_Equipment_Definition, "Water Use Equipment Definitions");
+    myLibraryList->addModelObjectType(IddObjectType::OS_GasEquipment_Definition, "Gas Equipment Definitions");
+    myLibraryList->addModelObjectType(IddObjectType::OS_ElectricEquipment_Definition, "Electric Equipment Definitions");
+    myLibraryList->addModelObjectType(IddObjectType::OS_Luminaire_Definition, "Luminaire Definitions");
+    myLibraryList->addModelObjectType(IddObjectType::OS_Lights_Definition, "Lights Definitions");
+    myLibraryList->addModelObjectType(IddObjectType::OS_People_Definition, "People Definitions");
+    myLibraryList->addModelObjectType(IddObjectType::OS_Exterior_WaterEquipment_Definition, "Exterior Water Equipment Definitions");
+    myLibraryList->addModelObjectType(IddObjectType::OS_Exterior_FuelEquipment_Definition, "Exterior Fuel Equipment Definitions");
+    myLibraryList->addModelObjectType(IddObjectType::OS_Exterior_Lights_Definition, "Exterior Lights Definitions");
+    myLibraryList->addModelObjectType(IddObjectType::OS_Exterior_WaterEquipment, "Exterior Water Equipment");
+    myLibraryList->addModelObjectType(IddObjectType::OS_Exterior_FuelEquipment, "Exterior Fuel Equipment");
+    myLibraryList->addModelObjectType(IddObjectType::OS_Exterior_Lights, "Exterior Lights");
+    myLibraryList->addModelObjectType(IddObjectType::OS_SpaceInfiltration_DesignFlowRate, "Space Infiltration Design Flow Rates");
+    myLibraryList->addModelObjectType(IddObjectType::OS_SpaceInfiltration_EffectiveLeakageArea, "Space Infiltration Effective Leakage Areas");
+    myLibraryList->addModelObjectType(IddObjectType::OS_DesignSpecification_OutdoorAir, "Design Specification Outdoor Air");
+    myLibraryList->addModelObjectType(IddObjectType::OS_DefaultScheduleSet, "Schedule Sets");
+    myLibraryList->addModelObjectType(IddObjectType::OS_DefaultConstructionSet, "Construction Sets");
+    myLibraryList->addModelObjectType(IddObjectType::OS_SpaceType, "Space Types");
+
+    setCachedLibraryView("Facility", myLibraryList);
+  }
 
   doc->openSidebar();
   //doc->closeSidebar();
@@ -757,104 +832,108 @@ void MainRightColumnController::configureForSpacesSubTab(int subTabID) {
   std::shared_ptr<OSDocument> doc = OSAppBase::instance()->currentDocument();
 
   // my model
-  auto* myModelList = new ModelObjectTypeListView(m_model, true, OSItemType::CollapsibleListHeader);
-  myModelList->setItemsDraggable(true);
-  myModelList->setItemsRemoveable(false);
-  myModelList->setItemsType(OSItemType::LibraryItem);
-
-  myModelList->addModelObjectType(IddObjectType::OS_InteriorPartitionSurface, "Interior Partition Surface");
-  myModelList->addModelObjectType(IddObjectType::OS_ShadingSurface, "Shading Surface");
-  myModelList->addModelObjectType(IddObjectType::OS_ShadingControl, "ShadingControl");
-  myModelList->addModelObjectType(IddObjectType::OS_WindowProperty_FrameAndDivider, "Frame And Divider Window Property");
-  myModelList->addModelObjectType(IddObjectType::OS_DaylightingDevice_Shelf, "DaylightingDevice Shelf");
-  myModelList->addModelObjectType(IddObjectType::OS_SubSurface, "Sub Surfaces");
-  myModelList->addModelObjectType(IddObjectType::OS_Surface, "Surfaces");
-  myModelList->addModelObjectType(IddObjectType::OS_Construction_WindowDataFile, "Window Data File Constructions");
-  myModelList->addModelObjectType(IddObjectType::OS_Construction_FfactorGroundFloor, "F-factor Ground Floor Constructions");
-  myModelList->addModelObjectType(IddObjectType::OS_Construction_CfactorUndergroundWall, "C-factor Underground Wall Constructions");
-  myModelList->addModelObjectType(IddObjectType::OS_Construction_InternalSource, "Internal Source Constructions");
-  myModelList->addModelObjectType(IddObjectType::OS_Construction_AirBoundary, "Air Boundary Constructions");
-  myModelList->addModelObjectType(IddObjectType::OS_Construction, "Constructions");
-  myModelList->addModelObjectType(IddObjectType::OS_Schedule_VariableInterval, "Variable Interval Schedules");
-  myModelList->addModelObjectType(IddObjectType::OS_Schedule_FixedInterval, "Fixed Interval Schedules");
-  myModelList->addModelObjectType(IddObjectType::OS_Schedule_Year, "Year Schedules");
-  myModelList->addModelObjectType(IddObjectType::OS_Schedule_Constant, "Constant Schedules");
-  myModelList->addModelObjectType(IddObjectType::OS_Schedule_Compact, "Compact Schedules");
-  myModelList->addModelObjectType(IddObjectType::OS_Schedule_Ruleset, "Ruleset Schedules");
-  myModelList->addModelObjectType(IddObjectType::OS_InternalMass_Definition, "Internal Mass Definitions");
-  myModelList->addModelObjectType(IddObjectType::OS_OtherEquipment_Definition, "Other Equipment Definitions");
-  myModelList->addModelObjectType(IddObjectType::OS_SteamEquipment_Definition, "Steam Equipment Definitions");
-  myModelList->addModelObjectType(IddObjectType::OS_HotWaterEquipment_Definition, "Hot Water Equipment Definitions");
-  myModelList->addModelObjectType(IddObjectType::OS_WaterHeater_HeatPump, "Water Heater - Heat Pump");
-  myModelList->addModelObjectType(IddObjectType::OS_WaterHeater_HeatPump_WrappedCondenser, "Water Heater - Heat Pump - Wrapped Condenser");
-  myModelList->addModelObjectType(IddObjectType::OS_WaterUse_Equipment_Definition, "Water Use Equipment Definitions");
-  myModelList->addModelObjectType(IddObjectType::OS_GasEquipment_Definition, "Gas Equipment Definitions");
-  myModelList->addModelObjectType(IddObjectType::OS_ElectricEquipment_Definition, "Electric Equipment Definitions");
-  myModelList->addModelObjectType(IddObjectType::OS_Luminaire_Definition, "Luminaire Definitions");
-  myModelList->addModelObjectType(IddObjectType::OS_Lights_Definition, "Lights Definitions");
-  myModelList->addModelObjectType(IddObjectType::OS_People_Definition, "People Definitions");
-  //myModelList->addModelObjectType(IddObjectType::OS_SpaceInfiltration_DesignFlowRate, "Space Infiltration Design Flow Rates"); // do not show in my model because these are not shareable
-  myModelList->addModelObjectType(IddObjectType::OS_DesignSpecification_OutdoorAir, "Design Specification Outdoor Air");
-  myModelList->addModelObjectType(IddObjectType::OS_DefaultScheduleSet, "Schedule Sets");
-  myModelList->addModelObjectType(IddObjectType::OS_DefaultConstructionSet, "Construction Sets");
-  myModelList->addModelObjectType(IddObjectType::OS_SpaceType, "Space Types");
-  myModelList->addModelObjectType(IddObjectType::OS_ThermalZone, "Thermal Zones");
-  myModelList->addModelObjectType(IddObjectType::OS_BuildingStory, "Building Stories");
-  myModelList->addModelObjectType(IddObjectType::OS_InteriorPartitionSurface, "Interior Partition Surface");
-
-  setMyModelView(myModelList);
+  if (!showCachedMyModelView("Spaces")) {
+    auto* myModelList = new ModelObjectTypeListView(m_model, true, OSItemType::CollapsibleListHeader);
+    myModelList->setItemsDraggable(true);
+    myModelList->setItemsRemoveable(false);
+    myModelList->setItemsType(OSItemType::LibraryItem);
+
+    myModelList->addModelObjectType(IddObjectType::OS_InteriorPartitionSurface, "Interior Partition Surface");
+    myModelList->addModelObjectType(IddObjectType::OS_ShadingSurface, "Shading Surface");
+    myModelList->addModelObjectType(IddObjectType::OS_ShadingControl, "ShadingControl");
+    myModelList->addModelObjectType(IddObjectType::OS_WindowProperty_FrameAndDivider, "Frame And Divider Window Property");
+    myModelList->addModelObjectType(IddObjectType::OS_DaylightingDevice_Shelf, "DaylightingDevice Shelf");
+    myModelList->addModelObjectType(IddObjectType::OS_SubSurface, "Sub Surfaces");
+    myModelList->addModelObjectType(IddObjectType::OS_Surface, "Surfaces");
+    myModelList->addModelObjectType(IddObjectType::OS_Construction_WindowDataFile, "Window Data File Constructions");
+    myModelList->addModelObjectType(IddObjectType::OS_Construction_FfactorGroundFloor, "F-factor Ground Floor Constructions");
+    myModelList->addModelObjectType(IddObjectType::OS_Construction_CfactorUndergroundWall, "C-factor Underground Wall Constructions");
+    myModelList->addModelObjectType(IddObjectType::OS_Construction_InternalSource, "Internal Source Constructions");
+    myModelList->addModelObjectType(IddObjectType::OS_Construction_AirBoundary, "Air Boundary Constructions");
+    myModelList->addModelObjectType(IddObjectType::OS_Construction, "Constructions");
+    myModelList->addModelObjectType(IddObjectType::OS_Schedule_VariableInterval, "Variable Interval Schedules");
+    myModelList->addModelObjectType(IddObjectType::OS_Schedule_FixedInterval, "Fixed Interval Schedules");
+    myModelList->addModelObjectType(IddObjectType::OS_Schedule_Year, "Year Schedules");
+    myModelList->addModelObjectType(IddObjectType::OS_Schedule_Constant, "Constant Schedules");
+    myModelList->addModelObjectType(IddObjectType::OS_Schedule_Compact, "Compact Schedules");
+    myModelList->addModelObjectType(IddObjectType::OS_Schedule_Ruleset, "Ruleset Schedules");
+    myModelList->addModelObjectType(IddObjectType::OS_InternalMass_Definition, "Internal Mass Definitions");
+    myModelList->addModelObjectType(IddObjectType::OS_OtherEquipment_Definition, "Other Equipment Definitions");
+    myModelList->addModelObjectType(IddObjectType::OS_SteamEquipment_Definition, "Steam Equipment Definitions");
+    myModelList->addModelObjectType(IddObjectType::OS_HotWaterEquipment_Definition, "Hot Water Equipment Definitions");
+    myModelList->addModelObjectType(IddObjectType::OS_WaterHeater_HeatPump, "Water Heater - Heat Pump");
+    myModelList->addModelObjectType(IddObjectType::OS_WaterHeater_HeatPump_WrappedCondenser, "Water Heater - Heat Pump - Wrapped Condenser");
+    myModelList->addModelObjectType(IddObjectType::OS_WaterUse_Equipment_Definition, "Water Use Equipment Definitions");
+    myModelList->addModelObjectType(IddObjectType::OS_GasEquipment_Definition, "Gas Equipment Definitions");
+    myModelList->addModelObjectType(IddObjectType::OS_ElectricEquipment_Definition, "Electric Equipment Definitions");
+    myModelList->addModelObjectType(IddObjectType::OS_Luminaire_Definition, "Luminaire Definitions");
+    myModelList->addModelObjectType(IddObjectType::OS_Lights_Definition, "Lights Definitions");
+    myModelList->addModelObjectType(IddObjectType::OS_People_Definition, "People Definitions");
+    //myModelList->addModelObjectType(IddObjectType::OS_SpaceInfiltration_DesignFlowRate, "Space Infiltration Design Flow Rates"); // do not show in my model because these are not shareable
+    myModelList->addModelObjectType(IddObjectType::OS_DesignSpecification_OutdoorAir, "Design Specification Outdoor Air");
+    myModelList->addModelObjectType(IddObjectType::OS_DefaultScheduleSet, "Schedule Sets");
+    myModelList->addModelObjectType(IddObjectType::OS_DefaultConstructionSet, "Construction Sets");
+    myModelList->addModelObjectType(IddObjectType::OS_SpaceType, "Space Types");
+    myModelList->addModelObjectType(IddObjectType::OS_ThermalZone, "Thermal Zones");
+    myModelList->addModelObjectType(IddObjectType::OS_BuildingStory, "Building Stories");
+    myModelList->addModelObjectType(IddObjectType::OS_InteriorPartitionSurface, "Interior Partition Surface");
+
+    setCachedMyModelView("Spaces", myModelList);
+  }
 
   // Library
   model::Model lib = doc->componentLibrary();
 
-  auto* myLibraryList = new ModelObjectTypeListView(lib, true, OSItemType::CollapsibleListHeader, true);
-  myLibraryList->setItemsDraggable(true);
-  myLibraryList->setItemsRemoveable(false);
-  myLibraryList->setItemsType(OSItemType::LibraryItem);
-
-  myLibraryList->addModelObjectType(IddObjectType::OS_ShadingControl, "ShadingControl");
-  myLibraryList->addModelObjectType(IddObjectType::OS_WindowProperty_FrameAndDivider, "Frame And Divider Window Property");
-  myLibraryList->addModelObjectType(IddObjectType::OS_DaylightingDevice_Shelf, "DaylightingDevice Shelf");
-  myLibraryList->addModelObjectType(IddObjectType::OS_Fan_ZoneExhaust, "Fan Zone Exhaust");
-  myLibraryList->addModelObjectType(IddObjectType::OS_ZoneHVAC_PackagedTerminalHeatPump, "PTHP");
-  myLibraryList->addModelObjectType(IddObjectType::OS_ZoneHVAC_PackagedTerminalAirConditioner, "PTAC");
-  myLibraryList->addModelObjectType(IddObjectType::OS_ZoneHVAC_WaterToAirHeatPump, "Water To Air HP");
-  myLibraryList->addModelObjectType(IddObjectType::OS_ZoneHVAC_LowTemperatureRadiant_ConstantFlow, "Low Temp Radiant Constant Flow");
-  myLibraryList->addModelObjectType(IddObjectType::OS_ZoneHVAC_LowTemperatureRadiant_VariableFlow, "Low Temp Radiant Variable Flow");
-  myLibraryList->addModelObjectType(IddObjectType::OS_ZoneHVAC_LowTemperatureRadiant_Electric, "Low Temp Radiant Electric");
-  myLibraryList->addModelObjectType(IddObjectType::OS_ZoneHVAC_HighTemperatureRadiant, "High Temp Radiant");
-  myLibraryList->addModelObjectType(IddObjectType::OS_Construction_WindowDataFile, "Window Data File Constructions");
-  myLibraryList->addModelObjectType(IddObjectType::OS_Construction_FfactorGroundFloor, "F-factor Ground Floor Constructions");
-  myLibraryList->addModelObjectType(IddObjectType::OS_Construction_CfactorUndergroundWall, "C-factor Underground Wall Constructions");
-  myLibraryList->addModelObjectType(IddObjectType::OS_Construction_InternalSource, "Internal Source Constructions");
-  myLibraryList->addModelObjectType(IddObjectType::OS_Construction_AirBoundary, "Air Boundary Constructions");
-  myLibraryList->addModelObjectType(IddObjectType::OS_Construction, "Constructions");
-  myLibraryList->addModelObjectType(IddObjectType::OS_Schedule_VariableInterval, "Variable Interval Schedules");
-  myLibraryList->addModelObjectType(IddObjectType::OS_Schedule_FixedInterval, "Fixed Interval Schedules");
-  myLibraryList->addModelObjectType(IddObjectType::OS_Schedule_Year, "Year Schedules");
-  myLibraryList->addModelObjectType(IddObjectType::OS_Schedule_Constant, "Constant Schedules");
-  myLibraryList->addModelObjectType(IddObjectType::OS_Schedule_Compact, "Compact Schedules");
-  myLibraryList->addModelObjectType(IddObjectType::OS_Schedule_Ruleset, "Ruleset Schedules");
-  myLibraryList->addModelObjectType(IddObjectType::OS_InternalMass_Definition, "Internal Mass Definitions");
-  myLibraryList->addModelObjectType(IddObjectType::OS_OtherEquipment_Definition, "Other Equipment Definitions");
-  myLibraryList->addModelObjectType(IddObjectType::OS_SteamEquipment_Definition, "Steam Equipment Definitions");
-  myLibraryList->addModelObjectType(IddObjectType::OS_HotWaterEquipment_Definition, "Hot Water Equipment Definitions");
-  myLibraryList->addModelObjectType(IddObjectType::OS_WaterUse_Equipment_Definition, "Water Use Equipment Definitions");
-  myLibraryList->addModelObjectType(IddObjectType::OS_WaterHeater_HeatPump, "Water Heater - Heat Pump");
-  myLibraryList->addModelObjectType(IddObjectType::OS_WaterHeater_HeatPump_WrappedCondenser, "Water Heater - Heat Pump - Wrapped Condenser");
-  myLibraryList->addModelObjectType(IddObjectType::OS_GasEquipment_Definition, "Gas Equipment Definitions");
-  myLibraryList->addModelObjectType(IddObjectType::OS_ElectricEquipment_Definition, "Electric Equipment Definitions");
-  myLibraryList->addModelObjectType(IddObjectType::OS_Luminaire_Definition, "Luminaire Definitions");
-  myLibraryList->addModelObjectType(IddObjectType::OS_Lights_Definition, "Lights Definitions");
-  myLibraryList->addModelObjectType(IddObjectType::OS_People_Definition, "People Definitions");
-  myLibraryList->addModelObjectType(IddObjectType::OS_SpaceInfiltration_DesignFlowRate, "Space Infiltration Design Flow Rates");
-  myLibraryList->addModelObjectType(IddObjectType::OS_SpaceInfiltration_EffectiveLeakageArea, "Space Infiltration Effective Leakage Areas");
-  myLibraryList->addModelObjectType(IddObjectType::OS_DesignSpecification_OutdoorAir, "Design Specification Outdoor Air");
-  myLibraryList->addModelObjectType(IddObjectType::OS_DefaultScheduleSet, "Schedule Sets");
-  myLibraryList->addModelObjectType(IddObjectType::OS_DefaultConstructionSet, "Construction Sets");
-  myLibraryList->addModelObjectType(IddObjectType::OS_SpaceType, "Space Types");
-
-  setLibraryView(myLibraryList);
+  if (!showCachedLibraryView("Spaces")) {
+    auto* myLibraryList = new ModelObjectTypeListView(lib, true, OSItemType::CollapsibleListHeader, true);
+    myLibraryList->setItemsDraggable(true);
+    myLibraryList->setItemsRemoveable(false);
+    myLibraryList->setItemsType(OSItemType::LibraryItem);
+
+    myLibraryList->addModelObjectType(IddObjectType::OS_ShadingControl, "ShadingControl");
+    myLibraryList->addModelObjectType(IddObjectType::OS_WindowProperty_FrameAndDivider, "Frame And Divider Window Property");
+    myLibraryList->addModelObjectType(IddObjectType::OS_DaylightingDevice_Shelf, "DaylightingDevice Shelf");
+    myLibraryList->addModelObjectType(IddObjectType::OS_Fan_ZoneExhaust, "Fan Zone Exhaust");
+    myLibraryList->addModelObjectType(IddObjectType::OS_ZoneHVAC_PackagedTerminalHeatPump, "PTHP");
+    myLibraryList->addModelObjectType(IddObjectType::OS_ZoneHVAC_PackagedTerminalAirConditioner, "PTAC");
+    myLibraryList->addModelObjectType(IddObjectType::OS_ZoneHVAC_WaterToAirHeatPump, "Water To Air HP");
+    myLibraryList->addModelObjectType(IddObjectType::OS_ZoneHVAC_LowTemperatureRadiant_ConstantFlow, "Low Temp Radiant Constant Flow");
+    myLibraryList->addModelObjectType(IddObjectType::OS_ZoneHVAC_LowTemperatureRadiant_VariableFlow, "Low Temp Radiant Variable Flow");
+    myLibraryList->addModelObjectType(IddObjectType::OS_ZoneHVAC_LowTemperatureRadiant_Electric, "Low Temp Radiant Electric");
+    myLibraryList->addModelObjectType(IddObjectType::OS_ZoneHVAC_HighTemperatureRadiant, "High Temp Radiant");
+    myLibraryList->addModelObjectType(IddObjectType::OS_Construction_WindowDataFile, "Window Data File Constructions");
+    myLibraryList->addModelObjectType(IddObjectType::OS_Construction_FfactorGroundFloor, "F-factor Ground Floor Constructions");
+    myLibraryList->addModelObjectType(IddObjectType::OS_Construction_CfactorUndergroundWall, "C-factor Underground Wall Constructions");
+    myLibraryList->addModelObjectType(IddObjectType::OS_Construction_InternalSource, "Internal Source Constructions");
+    myLibraryList->addModelObjectType(IddObjectType::OS_Construction_AirBoundary, "Air Boundary Constructions");
+    myLibraryList->addModelObjectType(IddObjectType::OS_Construction, "Constructions");
+    myLibraryList->addModelObjectType(IddObjectType::OS_Schedule_VariableInterval, "Variable Interval Schedules");
+    myLibraryList->addModelObjectType(IddObjectType::OS_Schedule_FixedInterval, "Fixed Interval Schedules");
+    myLibraryList->addModelObjectType(IddObjectType::OS_Schedule_Year, "Year Schedules");
+    myLibraryList->addModelObjectType(IddObjectType::OS_Schedule_Constant, "Constant Schedules");
+    myLibraryList->addModelObjectType(IddObjectType::OS_Schedule_Compact, "Compact Schedules");
+    myLibraryList->addModelObjectType(IddObjectType::OS_Schedule_Ruleset, "Ruleset Schedules");
+    myLibraryList->addModelObjectType(IddObjectType::OS_InternalMass_Definition, "Internal Mass Definitions");
+    myLibraryList->addModelObjectType(IddObjectType::OS_OtherEquipment_Definition, "Other Equipment Definitions");
+    myLibraryList->addModelObjectType(IddObjectType::OS_SteamEquipment_Definition, "Steam Equipment Definitions");
+    myLibraryList->addModelObjectType(IddObjectType::OS_HotWaterEquipment_Definition, "Hot Water Equipment Definitions");
+    myLibraryList->addModelObjectType(IddObjectType::OS_WaterUse_Equipment_Definition, "Water Use Equipment Definitions");
+    myLibraryList->addModelObjectType(IddObjectType::OS_WaterHeater_HeatPump, "Water Heater - Heat Pump");
+    myLibraryList->addModelObjectType(IddObjectType::OS_WaterHeater_HeatPump_WrappedCondenser, "Water Heater - Heat Pump - Wrapped Condenser");
+    myLibraryList->addModelObjectType(IddObjectType::OS_GasEquipment_Definition, "Gas Equipment Definitions");
+    myLibraryList->addModelObjectType(IddObjectType::OS_ElectricEquipment_Definition, "Electric Equipment Definitions");
+    myLibraryList->addModelObjectType(IddObjectType::OS_Luminaire_Definition, "Luminaire Definitions");
+    myLibraryList->addModelObjectType(IddObjectType::OS_Lights_Definition, "Lights Definitions");
+    myLibraryList->addModelObjectType(IddObjectType::OS_People_Definition, "People Definitions");
+    myLibraryList->addModelObjectType(IddObjectType::OS_SpaceInfiltration_DesignFlowRate, "Space Infiltration Design Flow Rates");
+    myLibraryList->addModelObjectType(IddObjectType::OS_SpaceInfiltration_EffectiveLeakageArea, "Space Infiltration Effective Leakage Areas");
+    myLibraryList->addModelObjectType(IddObjectType::OS_DesignSpecification_OutdoorAir, "Design Specification Outdoor Air");
+    myLibraryList->addModelObjectType(IddObjectType::OS_DefaultScheduleSet, "Schedule Sets");
+    myLibraryList->addModelObjectType(IddObjectType::OS_DefaultConstructionSet, "Construction Sets");
+    myLibraryList->addModelObjectType(IddObjectType::OS_SpaceType, "Space Types");
+
+    setCachedLibraryView("Spaces", myLibraryList);
+  }
 
   doc->openSidebar();
   //doc->closeSidebar();
@@ -870,57 +949,61 @@ void MainRightColumnController::configureForThermalZonesSubTab(int subTabID) {
 
   // My Model
 
-  auto* myModelList = new ModelObjectTypeListView(m_model, true, OSItemType::CollapsibleListHeader);
-  myModelList->setItemsDraggable(true);
-  myModelList->setItemsRemoveable(false);
-  myModelList->setItemsType(OSItemType::LibraryItem);
-
-  myModelList->addModelObjectType(IddObjectType::OS_WaterHeater_HeatPump, "Water Heater - Heat Pump");
-  myModelList->addModelObjectType(IddObjectType::OS_WaterHeater_HeatPump_WrappedCondenser, "Water Heater - Heat Pump - Wrapped Condenser");
-  myModelList->addModelObjectType(IddObjectType::OS_Schedule_VariableInterval, "Variable Interval Schedules");
-  myModelList->addModelObjectType(IddObjectType::OS_Schedule_FixedInterval, "Fixed Interval Schedules");
-  myModelList->addModelObjectType(IddObjectType::OS_Schedule_Year, "Year Schedules");
-  myModelList->addModelObjectType(IddObjectType::OS_Schedule_Constant, "Constant Schedules");
-  myModelList->addModelObjectType(IddObjectType::OS_Schedule_Compact, "Compact Schedules");
-  myModelList->addModelObjectType(IddObjectType::OS_Schedule_Ruleset, "Ruleset Schedules");
-
-  setMyModelView(myModelList);
+  if (!showCachedMyModelView("ThermalZones")) {
+    auto* myModelList = new ModelObjectTypeListView(m_model, true, OSItemType::CollapsibleListHeader);
+    myModelList->setItemsDraggable(true);
+    myModelList->setItemsRemoveable(false);
+    myModelList->setItemsType(OSItemType::LibraryItem);
+
+    myModelList->addModelObjectType(IddObjectType::OS_WaterHeater_HeatPump, "Water Heater - Heat Pump");
+    myModelList->addModelObjectType(IddObjectType::OS_WaterHeater_HeatPump_WrappedCondenser, "Water Heater - Heat Pump - Wrapped Condenser");
+    myModelList->addModelObjectType(IddObjectType::OS_Schedule_VariableInterval, "Variable Interval Schedules");
+    myModelList->addModelObjectType(IddObjectType::OS_Schedule_FixedInterval, "Fixed Interval Schedules");
+    myModelList->addModelObjectType(IddObjectType::OS_Schedule_Year, "Year Schedules");
+    myModelList->addModelObjectType(IddObjectType::OS_Schedule_Constant, "Constant Schedules");
+    myModelList->addModelObjectType(IddObjectType::OS_Schedule_Compact, "Compact Schedules");
+    myModelList->addModelObjectType(IddObjectType::OS_Schedule_Ruleset, "Ruleset Schedules");
+
+    setCachedMyModelView("ThermalZones", myModelList);
+  }
 
   // Library
   model::Model lib = doc->componentLibrary();
 
-  auto* libraryWidget = new ModelObjectTypeListView(lib, true, OSItemType::CollapsibleListHeader);
-  libraryWidget->setItemsDraggable(true);
-  libraryWidget->setItemsRemoveable(false);
-  libraryWidget->setItemsType(OSItemType::LibraryItem);
-
-  libraryWidget->addModelObjectType(IddObjectType::OS_AirLoopHVAC_UnitarySystem, "Unitary System");
-  libraryWidget->addModelObjectType(IddObjectType::OS_ZoneHVAC_CoolingPanel_RadiantConvective_Water, "Cooling Panel Radiant Convective Water");
-  libraryWidget->addModelObjectType(IddObjectType::OS_ZoneHVAC_Baseboard_Convective_Electric, "Baseboard Convective Electric");
-  libraryWidget->addModelObjectType(IddObjectType::OS_ZoneHVAC_Baseboard_Convective_Water, "Baseboard Convective Water");
-  libraryWidget->addModelObjectType(IddObjectType::OS_ZoneHVAC_Baseboard_RadiantConvective_Electric, "Baseboard Radiant Convective Electric");
-  libraryWidget->addModelObjectType(IddObjectType::OS_ZoneHVAC_Baseboard_RadiantConvective_Water, "Baseboard Radiant Convective Water");
-  libraryWidget->addModelObjectType(IddObjectType::OS_ZoneHVAC_Dehumidifier_DX, "Dehumidifier - DX");
-  libraryWidget->addModelObjectType(IddObjectType::OS_ZoneHVAC_EnergyRecoveryVentilator, "ERV");
-  libraryWidget->addModelObjectType(IddObjectType::OS_ZoneHVAC_FourPipeFanCoil, "Four Pipe Fan Coil");
-  libraryWidget->addModelObjectType(IddObjectType::OS_Fan_ZoneExhaust, "Fan Zone Exhaust");
-  libraryWidget->addModelObjectType(IddObjectType::OS_WaterHeater_HeatPump, "Water Heater - Heat Pump");
-  libraryWidget->addModelObjectType(IddObjectType::OS_WaterHeater_HeatPump_WrappedCondenser, "Water Heater - Heat Pump - Wrapped Condenser");
-  libraryWidget->addModelObjectType(IddObjectType::OS_ZoneHVAC_PackagedTerminalHeatPump, "PTHP");
-  libraryWidget->addModelObjectType(IddObjectType::OS_ZoneHVAC_WaterToAirHeatPump, "Water To Air HP");
-  libraryWidget->addModelObjectType(IddObjectType::OS_ZoneHVAC_PackagedTerminalAirConditioner, "PTAC");
-  libraryWidget->addModelObjectType(IddObjectType::OS_ZoneHVAC_LowTemperatureRadiant_ConstantFlow, "Low Temp Radiant Constant Flow");
-  libraryWidget->addModelObjectType(IddObjectType::OS_ZoneHVAC_LowTemperatureRadiant_VariableFlow, "Low Temp Radiant Variable Flow");
-  libraryWidget->addModelObjectType(IddObjectType::OS_ZoneHVAC_LowTemperatureRadiant_Electric, "Low Temp Radiant Electric");
-  libraryWidget->addModelObjectType(IddObjectType::OS_ZoneHVAC_HighTemperatureRadiant, "High Temp Radiant");
-  libraryWidget->addModelObjectType(IddObjectType::OS_ZoneHVAC_UnitHeater, "Unit Heater");
-  libraryWidget->addModelObjectType(IddObjectType::OS_ZoneHVAC_UnitVentilator, "Unit Ventilator");
-  libraryWidget->addModelObjectType(IddObjectType::OS_ZoneVentilation_DesignFlowRate, "Zone Ventilation Design Flow Rate");
-  libraryWidget->addModelObjectType(IddObjectType::OS_ZoneVentilation_WindandStackOpenArea, "Zone Ventilation Wind and Stack Open Area");
-  libraryWidget->addModelObjectType(IddObjectType::OS_Schedule_Compact, "Compact Schedules");
-  libraryWidget->addModelObjectType(IddObjectType::OS_Schedule_Ruleset, "Schedule Rulesets");
-
-  setLibraryView(libraryWidget);
+  if (!showCachedLibraryView("ThermalZones")) {
+    auto* libraryWidget = new ModelObjectTypeListView(lib, true, OSItemType::CollapsibleListHeader);
+    libraryWidget->setItemsDraggable(true);
+    libraryWidget->setItemsRemoveable(false);
+    libraryWidget->setItemsType(OSItemType::LibraryItem);
+
+    libraryWidget->addModelObjectType(IddObjectType::OS_AirLoopHVAC_UnitarySystem, "Unitary System");
+    libraryWidget->addModelObjectType(IddObjectType::OS_ZoneHVAC_CoolingPanel_RadiantConvective_Water, "Cooling Panel Radiant Convective Water");
+    libraryWidget->addModelObjectType(IddObjectType::OS_ZoneHVAC_Baseboard_Convective_Electric, "Baseboard Convective Electric");
+    libraryWidget->addModelObjectType(IddObjectType::OS_ZoneHVAC_Baseboard_Convective_Water, "Baseboard Convective Water");
+    libraryWidget->addModelObjectType(IddObjectType::OS_ZoneHVAC_Baseboard_RadiantConvective_Electric, "Baseboard Radiant Convective Electric");
+    libraryWidget->addModelObjectType(IddObjectType::OS_ZoneHVAC_Baseboard_RadiantConvective_Water, "Baseboard Radiant Convective Water");
+    libraryWidget->addModelObjectType(IddObjectType::OS_ZoneHVAC_Dehumidifier_DX, "Dehumidifier - DX");
+    libraryWidget->addModelObjectType(IddObjectType::OS_ZoneHVAC_EnergyRecoveryVentilator, "ERV");
+    libraryWidget->addModelObjectType(IddObjectType::OS_ZoneHVAC_FourPipeFanCoil, "Four Pipe Fan Coil");
+    libraryWidget->addModelObjectType(IddObjectType::OS_Fan_ZoneExhaust, "Fan Zone Exhaust");
+    libraryWidget->addModelObjectType(IddObjectType::OS_WaterHeater_HeatPump, "Water Heater - Heat Pump");
+    libraryWidget->addModelObjectType(IddObjectType::OS_WaterHeater_HeatPump_WrappedCondenser, "Water Heater - Heat Pump - Wrapped Condenser");
+    libraryWidget->addModelObjectType(IddObjectType::OS_ZoneHVAC_PackagedTerminalHeatPump, "PTHP");
+    libraryWidget->addModelObjectType(IddObjectType::OS_ZoneHVAC_WaterToAirHeatPump, "Water To Air HP");
+    libraryWidget->addModelObjectType(IddObjectType::OS_ZoneHVAC_PackagedTerminalAirConditioner, "PTAC");
+    libraryWidget->addModelObjectType(IddObjectType::OS_ZoneHVAC_LowTemperatureRadiant_ConstantFlow, "Low Temp Radiant Constant Flow");
+    libraryWidget->addModelObjectType(IddObjectType::OS_ZoneHVAC_LowTemperatureRadiant_VariableFlow, "Low Temp Radiant Variable Flow");
+    libraryWidget->addModelObjectType(IddObjectType::OS_ZoneHVAC_LowTemperatureRadiant_Electric, "Low Temp Radiant Electric");
+    libraryWidget->addModelObjectType(IddObjectType::OS_ZoneHVAC_HighTemperatureRadiant, "High Temp Radiant");
+    libraryWidget->addModelObjectType(IddObjectType::OS_ZoneHVAC_UnitHeater, "Unit Heater");
+    libraryWidget->addModelObjectType(IddObjectType::OS_ZoneHVAC_UnitVentilator, "Unit Ventilator");
+    libraryWidget->addModelObjectType(IddObjectType::OS_ZoneVentilation_DesignFlowRate, "Zone Ventilation Design Flow Rate");
+    libraryWidget->addModelObjectType(IddObjectType::OS_ZoneVentilation_WindandStackOpenArea, "Zone Ventilation Wind and Stack Open Area");
+    libraryWidget->addModelObjectType(IddObjectType::OS_Schedule_Compact, "Compact Schedules");
+    libraryWidget->addModelObjectType(IddObjectType::OS_Schedule_Ruleset, "Schedule Rulesets");
+
+    setCachedLibraryView("ThermalZones", libraryWidget);
+  }
 
   m_horizontalTabWidget->setCurrentId(LIBRARY);
 
@@ -936,214 +1019,218 @@ void MainRightColumnController::configureForHVACSystemsSubTab(int subTabID) {
   setEditView(nullptr);
 
   // my model
-  auto* myModelList = new ModelObjectTypeListView(m_model, true, OSItemType::CollapsibleListHeader);
-  myModelList->setItemsDraggable(true);
-  myModelList->setItemsRemoveable(false);
-  myModelList->setItemsType(OSItemType::LibraryItem);
-
-  // Water and Tanks
-  myModelList->addModelObjectType(IddObjectType::OS_WaterUse_Equipment_Definition, "Water Use Equipment Definition");
-  myModelList->addModelObjectType(IddObjectType::OS_WaterUse_Connections, "Water Use Connections");
-  myModelList->addModelObjectType(IddObjectType::OS_WaterHeater_Mixed, "Water Heater Mixed");
-  myModelList->addModelObjectType(IddObjectType::OS_WaterHeater_Stratified, "Water Heater Stratified");
-  myModelList->addModelObjectType(IddObjectType::OS_AirConditioner_VariableRefrigerantFlow, "VRF System");
-  myModelList->addModelObjectType(IddObjectType::OS_ThermalStorage_ChilledWater_Stratified, "Thermal Storage - Chilled Water");
-
-  // Refrigeration
-  myModelList->addModelObjectType(IddObjectType::OS_Refrigeration_System, "Refrigeration System");
-  myModelList->addModelObjectType(IddObjectType::OS_Refrigeration_Condenser_WaterCooled, "Refrigeration Condenser Water Cooled");
-
-  // ZoneHVAC Components
-  myModelList->addModelObjectType(IddObjectType::OS_ZoneHVAC_WaterToAirHeatPump, "Water To Air HP");
-  myModelList->addModelObjectType(IddObjectType::OS_ZoneHVAC_TerminalUnit_VariableRefrigerantFlow, "VRF Terminal");
-  myModelList->addModelObjectType(IddObjectType::OS_ZoneHVAC_UnitVentilator, "Unit Ventilator");
-  myModelList->addModelObjectType(IddObjectType::OS_ZoneHVAC_UnitHeater, "Unit Heater");
-  myModelList->addModelObjectType(IddObjectType::OS_ZoneHVAC_PackagedTerminalHeatPump, "PTHP");
-  myModelList->addModelObjectType(IddObjectType::OS_ZoneHVAC_PackagedTerminalAirConditioner, "PTAC");
-  myModelList->addModelObjectType(IddObjectType::OS_ZoneHVAC_FourPipeFanCoil, "Four Pipe Fan Coil");
-
-  // Central components and coils
-  myModelList->addModelObjectType(IddObjectType::OS_HeatPump_WaterToWater_EquationFit_Heating, "Heat Pump - Water to Water - Heating");
-  myModelList->addModelObjectType(IddObjectType::OS_HeatPump_WaterToWater_EquationFit_Cooling, "Heat Pump - Water to Water - Cooling");
-  myModelList->addModelObjectType(IddObjectType::OS_HeatExchanger_FluidToFluid, "Heat Exchanger Fluid To Fluid");
-  myModelList->addModelObjectType(IddObjectType::OS_Coil_Heating_Water, "Coil Heating Water");
-  myModelList->addModelObjectType(IddObjectType::OS_Coil_Cooling_Water, "Coil Cooling Water");
-  myModelList->addModelObjectType(IddObjectType::OS_CentralHeatPumpSystem, "Central Heat Pump System");
-  myModelList->addModelObjectType(IddObjectType::OS_Chiller_Electric_EIR, "Chiller - Electric EIR");
-  myModelList->addModelObjectType(IddObjectType::OS_Chiller_Absorption, "Chiller - Absorption");
-  myModelList->addModelObjectType(IddObjectType::OS_Chiller_Absorption_Indirect, "Chiller - Indirect Absorption");
-
-  // Zones
-  myModelList->addModelObjectType(IddObjectType::OS_ThermalZone, "Thermal Zone");
-
-  // Schedules
-  myModelList->addModelObjectType(IddObjectType::OS_Schedule_VariableInterval, "Variable Interval Schedules");
-  myModelList->addModelObjectType(IddObjectType::OS_Schedule_FixedInterval, "Fixed Interval Schedules");
-  myModelList->addModelObjectType(IddObjectType::OS_Schedule_Year, "Year Schedules");
-  myModelList->addModelObjectType(IddObjectType::OS_Schedule_Constant, "Constant Schedules");
-  myModelList->addModelObjectType(IddObjectType::OS_Schedule_Compact, "Compact Schedules");
-  myModelList->addModelObjectType(IddObjectType::OS_Schedule_Ruleset, "Ruleset Schedules");
-
-  setMyModelView(myModelList);
+  if (!showCachedMyModelView("HVACSystems")) {
+    auto* myModelList = new ModelObjectTypeListView(m_model, true, OSItemType::CollapsibleListHeader);
+    myModelList->setItemsDraggable(true);
+    myModelList->setItemsRemoveable(false);
+    myModelList->setItemsType(OSItemType::LibraryItem);
+
+    // Water and Tanks
+    myModelList->addModelObjectType(IddObjectType::OS_WaterUse_Equipment_Definition, "Water Use Equipment Definition");
+    myModelList->addModelObjectType(IddObjectType::OS_WaterUse_Connections, "Water Use Connections");
+    myModelList->addModelObjectType(IddObjectType::OS_WaterHeater_Mixed, "Water Heater Mixed");
+    myModelList->addModelObjectType(IddObjectType::OS_WaterHeater_Stratified, "Water Heater Stratified");
+    myModelList->addModelObjectType(IddObjectType::OS_AirConditioner_VariableRefrigerantFlow, "VRF System");
+    myModelList->addModelObjectType(IddObjectType::OS_ThermalStorage_ChilledWater_Stratified, "Thermal Storage - Chilled Water");
+
+    // Refrigeration
+    myModelList->addModelObjectType(IddObjectType::OS_Refrigeration_System, "Refrigeration System");
+    myModelList->addModelObjectType(IddObjectType::OS_Refrigeration_Condenser_WaterCooled, "Refrigeration Condenser Water Cooled");
+
+    // ZoneHVAC Components
+    myModelList->addModelObjectType(IddObjectType::OS_ZoneHVAC_WaterToAirHeatPump, "Water To Air HP");
+    myModelList->addModelObjectType(IddObjectType::OS_ZoneHVAC_TerminalUnit_VariableRefrigerantFlow, "VRF Terminal");
+    myModelList->addModelObjectType(IddObjectType::OS_ZoneHVAC_UnitVentilator, "Unit Ventilator");
+    myModelList->addModelObjectType(IddObjectType::OS_ZoneHVAC_UnitHeater, "Unit Heater");
+    myModelList->addModelObjectType(IddObjectType::OS_ZoneHVAC_PackagedTerminalHeatPump, "PTHP");
+    myModelList->addModelObjectType(IddObjectType::OS_ZoneHVAC_PackagedTerminalAirConditioner, "PTAC");
+    myModelList->addModelObjectType(IddObjectType::OS_ZoneHVAC_FourPipeFanCoil, "Four Pipe Fan Coil");
+
+    // Central components and coils
+    myModelList->addModelObjectType(IddObjectType::OS_HeatPump_WaterToWater_EquationFit_Heating, "Heat Pump - Water to Water - Heating");
+    myModelList->addModelObjectType(IddObjectType::OS_HeatPump_WaterToWater_EquationFit_Cooling, "Heat Pump - Water to Water - Cooling");
+    myModelList->addModelObjectType(IddObjectType::OS_HeatExchanger_FluidToFluid, "Heat Exchanger Fluid To Fluid");
+    myModelList->addModelObjectType(IddObjectType::OS_Coil_Heating_Water, "Coil Heating Water");
+    myModelList->addModelObjectType(IddObjectType::OS_Coil_Cooling_Water, "Coil Cooling Water");
+    myModelList->addModelObjectType(IddObjectType::OS_CentralHeatPumpSystem, "Central Heat Pump System");
+    myModelList->addModelObjectType(IddObjectType::OS_Chiller_Electric_EIR, "Chiller - Electric EIR");
+    myModelList->addModelObjectType(IddObjectType::OS_Chiller_Absorption, "Chiller - Absorption");
+    myModelList->addModelObjectType(IddObjectType::OS_Chiller_Absorption_Indirect, "Chiller - Indirect Absorption");
+
+    // Zones
+    myModelList->addModelObjectType(IddObjectType::OS_ThermalZone, "Thermal Zone");
+
+    // Schedules
+    myModelList->addModelObjectType(IddObjectType::OS_Schedule_VariableInterval, "Variable Interval Schedules");
+    myModelList->addModelObjectType(IddObjectType::OS_Schedule_FixedInterval, "Fixed Interval Schedules");
+    myModelList->addModelObjectType(IddObjectType::OS_Schedule_Year, "Year Schedules");
+    myModelList->addModelObjectType(IddObjectType::OS_Schedule_Constant, "Constant Schedules");
+    myModelList->addModelObjectType(IddObjectType::OS_Schedule_Compact, "Compact Schedules");
+    myModelList->addModelObjectType(IddObjectType::OS_Schedule_Ruleset, "Ruleset Schedules");
+
+    setCachedMyModelView("HVACSystems", myModelList);
+  }
 
   // Library
 
   model::Model lib = doc->componentLibrary();
 
-  auto* libraryWidget = new ModelObjectTypeListView(lib, true, OSItemType::CollapsibleListHeader, true);
-  libraryWidget->setItemsDraggable(true);
-  libraryWidget->setItemsRemoveable(false);
-  libraryWidget->setItemsType(OSItemType::LibraryItem);
-
-  libraryWidget->addModelObjectType(IddObjectType::OS_SolarCollector_IntegralCollectorStorage, "Solar Collector Integral Collector Storage");
-  libraryWidget->addModelObjectType(IddObjectType::OS_SolarCollector_FlatPlate_Water, "Solar Collector Flat Plate Water");
-  //libraryWidget->addModelObjectType(IddObjectType::OS_SolarCollector_FlatPlate_PhotovoltaicThermal, "Solar Collector Flat Plate Photovoltaic Thermal");
-  libraryWidget->addModelObjectType(IddObjectType::OS_WaterUse_Equipment, "Water Use Equipment");
-  libraryWidget->addModelObjectType(IddObjectType::OS_WaterUse_Connections, "Water Use Connections");
-  libraryWidget->addModelObjectType(IddObjectType::OS_WaterHeater_HeatPump, "Water Heater - Heat Pump");
-  libraryWidget->addModelObjectType(IddObjectType::OS_WaterHeater_HeatPump_WrappedCondenser, "Water Heater - Heat Pump - Wrapped Condenser");
-  libraryWidget->addModelObjectType(IddObjectType::OS_WaterHeater_Mixed, "Water Heater Mixed");
-  libraryWidget->addModelObjectType(IddObjectType::OS_WaterHeater_Stratified, "Water Heater Stratified");
-  libraryWidget->addModelObjectType(IddObjectType::OS_AirConditioner_VariableRefrigerantFlow, "VRF System");
-  libraryWidget->addModelObjectType(IddObjectType::OS_ZoneHVAC_TerminalUnit_VariableRefrigerantFlow, "VRF Terminal");
-  libraryWidget->addModelObjectType(IddObjectType::OS_ThermalStorage_Ice_Detailed, "Thermal Storage - Ice Storage");
-  libraryWidget->addModelObjectType(IddObjectType::OS_ThermalStorage_ChilledWater_Stratified, "Thermal Storage - Chilled Water");
-  libraryWidget->addModelObjectType(IddObjectType::OS_TemperingValve, "Tempering Valve");
-  libraryWidget->addModelObjectType(IddObjectType::OS_SetpointManager_SystemNodeReset_Humidity, "Setpoint Manager System Node Reset Humidity");
-  libraryWidget->addModelObjectType(IddObjectType::OS_SetpointManager_SystemNodeReset_Temperature, "Setpoint Manager System Node Reset Temperature");
-  libraryWidget->addModelObjectType(IddObjectType::OS_SetpointManager_Coldest, "Setpoint Manager Coldest");
-  libraryWidget->addModelObjectType(IddObjectType::OS_SetpointManager_FollowGroundTemperature, "Setpoint Manager Follow Ground Temperature");
-  libraryWidget->addModelObjectType(IddObjectType::OS_SetpointManager_FollowOutdoorAirTemperature, "Setpoint Manager Follow Outdoor Air Temperature");
-  libraryWidget->addModelObjectType(IddObjectType::OS_SetpointManager_FollowSystemNodeTemperature, "Setpoint Manager Follow System Node Temperature");
-  libraryWidget->addModelObjectType(IddObjectType::OS_SetpointManager_MixedAir, "Setpoint Manager Mixed Air");
-  libraryWidget->addModelObjectType(IddObjectType::OS_SetpointManager_MultiZone_Cooling_Average, "Setpoint Manager MultiZone Cooling Average");
-  libraryWidget->addModelObjectType(IddObjectType::OS_SetpointManager_MultiZone_Heating_Average, "Setpoint Manager MultiZone Heating Average");
-  libraryWidget->addModelObjectType(IddObjectType::OS_SetpointManager_MultiZone_Humidity_Maximum, "Setpoint Manager MultiZone Humidity Maximum");
-  libraryWidget->addModelObjectType(IddObjectType::OS_SetpointManager_MultiZone_Humidity_Minimum, "Setpoint Manager MultiZone Humidity Minimum");
-  libraryWidget->addModelObjectType(IddObjectType::OS_SetpointManager_MultiZone_MaximumHumidity_Average,
-                                    "Setpoint Manager MultiZone MaximumHumidity Average");
-  libraryWidget->addModelObjectType(IddObjectType::OS_SetpointManager_MultiZone_MinimumHumidity_Average,
-                                    "Setpoint Manager MultiZone MinimumHumidity Average");
-  libraryWidget->addModelObjectType(IddObjectType::OS_SetpointManager_OutdoorAirPretreat, "Setpoint Manager Outdoor Air Pretreat");
-  libraryWidget->addModelObjectType(IddObjectType::OS_SetpointManager_OutdoorAirReset, "Setpoint Manager Outdoor Air Reset");
-  libraryWidget->addModelObjectType(IddObjectType::OS_SetpointManager_Scheduled, "Setpoint Manager Scheduled");
-  libraryWidget->addModelObjectType(IddObjectType::OS_SetpointManager_Scheduled_DualSetpoint, "Setpoint Manager Scheduled Dual Setpoint");
-  libraryWidget->addModelObjectType(IddObjectType::OS_SetpointManager_SingleZone_Cooling, "Setpoint Manager Single Zone Cooling");
-  libraryWidget->addModelObjectType(IddObjectType::OS_SetpointManager_SingleZone_Heating, "Setpoint Manager Single Zone Heating");
-  libraryWidget->addModelObjectType(IddObjectType::OS_SetpointManager_SingleZone_Humidity_Maximum, "Setpoint Manager Humidity Maximum");
-  libraryWidget->addModelObjectType(IddObjectType::OS_SetpointManager_SingleZone_Humidity_Minimum, "Setpoint Manager Humidity Minimum");
-  libraryWidget->addModelObjectType(IddObjectType::OS_SetpointManager_SingleZone_OneStageCooling, "Setpoint Manager One Stage Cooling");
-  libraryWidget->addModelObjectType(IddObjectType::OS_SetpointManager_SingleZone_OneStageHeating, "Setpoint Manager One Stage Heating");
-  libraryWidget->addModelObjectType(IddObjectType::OS_SetpointManager_SingleZone_Reheat, "Setpoint Manager Single Zone Reheat");
-  libraryWidget->addModelObjectType(IddObjectType::OS_SetpointManager_Warmest, "Setpoint Manager Warmest");
-  libraryWidget->addModelObjectType(IddObjectType::OS_SetpointManager_WarmestTemperatureFlow, "Setpoint Manager Warmest Temp and Flow");
-  libraryWidget->addModelObjectType(IddObjectType::OS_Refrigeration_WalkIn, "Refrigeration Walkin");
-  libraryWidget->addModelObjectType(IddObjectType::OS_Refrigeration_System, "Refrigeration System");
-  libraryWidget->addModelObjectType(IddObjectType::OS_Refrigeration_Subcooler_Mechanical, "Refrigeration Subcooler Mechanical");
-  libraryWidget->addModelObjectType(IddObjectType::OS_Refrigeration_Subcooler_LiquidSuction, "Refrigeration Subcooler Liquid Suction");
-  libraryWidget->addModelObjectType(IddObjectType::OS_Refrigeration_Compressor, "Refrigeration Compressor");
-  libraryWidget->addModelObjectType(IddObjectType::OS_Refrigeration_Condenser_Cascade, "Refrigeration Condenser Cascade");
-  libraryWidget->addModelObjectType(IddObjectType::OS_Refrigeration_Condenser_WaterCooled, "Refrigeration Condenser Water Cooled");
-  libraryWidget->addModelObjectType(IddObjectType::OS_Refrigeration_Condenser_EvaporativeCooled, "Refrigeration Condenser Evaporative Cooled");
-  libraryWidget->addModelObjectType(IddObjectType::OS_Refrigeration_Condenser_AirCooled, "Refrigeration Condenser Air Cooled");
-  libraryWidget->addModelObjectType(IddObjectType::OS_Refrigeration_Case, "Refrigeration Case");
-  libraryWidget->addModelObjectType(IddObjectType::OS_Pump_ConstantSpeed, "Pump Constant Speed");
-  libraryWidget->addModelObjectType(IddObjectType::OS_HeaderedPumps_ConstantSpeed, "Pump Constant Speed Headered");
-  libraryWidget->addModelObjectType(IddObjectType::OS_Pump_VariableSpeed, "Pump Variable Speed");
-  libraryWidget->addModelObjectType(IddObjectType::OS_HeaderedPumps_VariableSpeed, "Pump Variable Speed Headered");
-  libraryWidget->addModelObjectType(IddObjectType::OS_PlantComponent_TemperatureSource, "Plant Component - Temp Source");
-  libraryWidget->addModelObjectType(IddObjectType::OS_PlantComponent_UserDefined, "Plant Component - User Defined");
-  libraryWidget->addModelObjectType(IddObjectType::OS_Pipe_Outdoor, "Pipe - Outdoor");
-  libraryWidget->addModelObjectType(IddObjectType::OS_Pipe_Indoor, "Pipe - Indoor");
-  libraryWidget->addModelObjectType(IddObjectType::OS_Pipe_Adiabatic, "Pipe - Adiabatic");
-  libraryWidget->addModelObjectType(IddObjectType::OS_LoadProfile_Plant, "Load Profile - Plant");
-  libraryWidget->addModelObjectType(IddObjectType::OS_Humidifier_Steam_Electric, "Humidifier Steam Electric");
-  libraryWidget->addModelObjectType(IddObjectType::OS_Humidifier_Steam_Gas, "Humidifier Steam Gas");
-  libraryWidget->addModelObjectType(IddObjectType::OS_HeatPump_WaterToWater_EquationFit_Heating, "Heat Pump - Water to Water - Heating");
-  libraryWidget->addModelObjectType(IddObjectType::OS_HeatPump_WaterToWater_EquationFit_Cooling, "Heat Pump - Water to Water - Cooling");
-  libraryWidget->addModelObjectType(IddObjectType::OS_HeatExchanger_FluidToFluid, "Heat Exchanger Fluid To Fluid");
-  libraryWidget->addModelObjectType(IddObjectType::OS_HeatExchanger_AirToAir_SensibleAndLatent, "Heat Exchanger Air To Air Sensible and Latent");
-  libraryWidget->addModelObjectType(IddObjectType::OS_Generator_FuelCell_ExhaustGasToWaterHeatExchanger,
-                                    "Generator FuelCell - ExhaustGasToWaterHeatExchanger");
-  libraryWidget->addModelObjectType(IddObjectType::OS_Generator_MicroTurbine_HeatRecovery, "Generator MicroTurbine - Heat Recovery");
-  libraryWidget->addModelObjectType(IddObjectType::OS_GroundHeatExchanger_Vertical, "Ground Heat Exchanger - Vertical ");
-  libraryWidget->addModelObjectType(IddObjectType::OS_GroundHeatExchanger_HorizontalTrench, "Ground Heat Exchanger - Horizontal");
-  libraryWidget->addModelObjectType(IddObjectType::OS_FluidCooler_TwoSpeed, "Fluid Cooler Two Speed");
-  libraryWidget->addModelObjectType(IddObjectType::OS_FluidCooler_SingleSpeed, "Fluid Cooler Single Speed");
-  libraryWidget->addModelObjectType(IddObjectType::OS_ZoneHVAC_FourPipeFanCoil, "Four Pipe Fan Coil");
-  libraryWidget->addModelObjectType(IddObjectType::OS_ZoneHVAC_PackagedTerminalHeatPump, "PTHP");
-  libraryWidget->addModelObjectType(IddObjectType::OS_ZoneHVAC_WaterToAirHeatPump, "Water To Air HP");
-  libraryWidget->addModelObjectType(IddObjectType::OS_ZoneHVAC_PackagedTerminalAirConditioner, "PTAC");
-  libraryWidget->addModelObjectType(IddObjectType::OS_ZoneHVAC_UnitHeater, "Unit Heater");
-  libraryWidget->addModelObjectType(IddObjectType::OS_ZoneHVAC_UnitVentilator, "Unit Ventilator");
-  libraryWidget->addModelObjectType(IddObjectType::OS_Fan_ComponentModel, "Fan Component Model");
-  libraryWidget->addModelObjectType(IddObjectType::OS_Fan_SystemModel, "Fan System Model");
-  libraryWidget->addModelObjectType(IddObjectType::OS_Fan_VariableVolume, "Fan Variable Volume");
-  libraryWidget->addModelObjectType(IddObjectType::OS_Fan_ConstantVolume, "Fan Constant Volume");
-  libraryWidget->addModelObjectType(IddObjectType::OS_EvaporativeCooler_Direct_ResearchSpecial, "Evaporative Cooler Direct Research Special");
-  libraryWidget->addModelObjectType(IddObjectType::OS_EvaporativeCooler_Indirect_ResearchSpecial, "Evaporative Cooler Indirect Research Special");
-  libraryWidget->addModelObjectType(IddObjectType::OS_EvaporativeFluidCooler_TwoSpeed, "Evaporative Fluid Cooler Two Speed");
-  libraryWidget->addModelObjectType(IddObjectType::OS_EvaporativeFluidCooler_SingleSpeed, "Evaporative Fluid Cooler Single Speed");
-  libraryWidget->addModelObjectType(IddObjectType::OS_Duct, "Duct");
-  libraryWidget->addModelObjectType(IddObjectType::OS_DistrictCooling, "District Cooling");
-  libraryWidget->addModelObjectType(IddObjectType::OS_DistrictHeating, "District Heating");
-  libraryWidget->addModelObjectType(IddObjectType::OS_CoolingTower_TwoSpeed, "Cooling Tower Two Speed");
-  libraryWidget->addModelObjectType(IddObjectType::OS_CoolingTower_SingleSpeed, "Cooling Tower Single Speed");
-  libraryWidget->addModelObjectType(IddObjectType::OS_CoolingTower_VariableSpeed, "Cooling Tower Variable Speed");
-  libraryWidget->addModelObjectType(IddObjectType::OS_CentralHeatPumpSystem, "Central Heat Pump System");
-  libraryWidget->addModelObjectType(IddObjectType::OS_Chiller_Electric_EIR, "Chiller - Electric EIR");
-  libraryWidget->addModelObjectType(IddObjectType::OS_Chiller_Absorption_Indirect, "Chiller - Indirect Absorption");
-  libraryWidget->addModelObjectType(IddObjectType::OS_Chiller_Absorption, "Chiller - Absorption");
-  libraryWidget->addModelObjectType(IddObjectType::OS_Coil_Heating_Gas, "Coil Heating Gas");
-  libraryWidget->addModelObjectType(IddObjectType::OS_Coil_Heating_DX_SingleSpeed, "Coil Heating DX SingleSpeed");
-  libraryWidget->addModelObjectType(IddObjectType::OS_Coil_Heating_Electric, "Coil Heating Electric");
-  libraryWidget->addModelObjectType(IddObjectType::OS_Coil_Heating_Water, "Coil Heating Water");
-  libraryWidget->addModelObjectType(IddObjectType::OS_Coil_Cooling_Water, "Coil Cooling Water");
-  libraryWidget->addModelObjectType(IddObjectType::OS_Coil_Cooling_DX_VariableSpeed, "Coil Cooling DX VariableSpeed");
-  libraryWidget->addModelObjectType(IddObjectType::OS_Coil_Cooling_DX_TwoStageWithHumidityControlMode, "Coil Cooling DX TwoStage - Humidity Control");
-  libraryWidget->addModelObjectType(IddObjectType::OS_Coil_Cooling_DX_TwoSpeed, "Coil Cooling DX TwoSpeed");
-  libraryWidget->addModelObjectType(IddObjectType::OS_Coil_Cooling_DX_SingleSpeed, "Coil Cooling DX SingleSpeed");
-  libraryWidget->addModelObjectType(IddObjectType::OS_Boiler_HotWater, "Boiler Hot Water");
-  libraryWidget->addModelObjectType(IddObjectType::OS_AirTerminal_SingleDuct_ConstantVolume_FourPipeInduction, "Air Terminal Four Pipe Induction");
-  libraryWidget->addModelObjectType(IddObjectType::OS_AirTerminal_SingleDuct_ConstantVolume_CooledBeam, "Air Terminal Chilled Beam");
-  libraryWidget->addModelObjectType(IddObjectType::OS_AirTerminal_SingleDuct_ConstantVolume_FourPipeBeam, "Air Terminal Four Pipe Beam");
-  libraryWidget->addModelObjectType(IddObjectType::OS_AirTerminal_SingleDuct_ConstantVolume_Reheat, "AirTerminal Single Duct Constant Volume Reheat");
-  libraryWidget->addModelObjectType(IddObjectType::OS_AirTerminal_SingleDuct_VAV_Reheat, "AirTerminal Single Duct VAV Reheat");
-  libraryWidget->addModelObjectType(IddObjectType::OS_AirTerminal_SingleDuct_ParallelPIU_Reheat, "AirTerminal Single Duct Parallel PIU Reheat");
-  libraryWidget->addModelObjectType(IddObjectType::OS_AirTerminal_SingleDuct_SeriesPIU_Reheat, "AirTerminal Single Duct Series PIU Reheat");
-  libraryWidget->addModelObjectType(IddObjectType::OS_AirTerminal_SingleDuct_InletSideMixer, "AirTerminal Inlet Side Mixer");
-  libraryWidget->addModelObjectType(IddObjectType::OS_AirTerminal_SingleDuct_VAV_HeatAndCool_Reheat, "AirTerminal Heat and Cool Reheat");
-  libraryWidget->addModelObjectType(IddObjectType::OS_AirTerminal_SingleDuct_VAV_HeatAndCool_NoReheat, "AirTerminal Heat and Cool No Reheat");
-  libraryWidget->addModelObjectType(IddObjectType::OS_AirTerminal_SingleDuct_VAV_NoReheat, "AirTerminal Single Duct VAV NoReheat");
-  libraryWidget->addModelObjectType(IddObjectType::OS_AirTerminal_SingleDuct_ConstantVolume_NoReheat,
-                                    "AirTerminal Single Duct Constant Volume No Reheat");
-  libraryWidget->addModelObjectType(IddObjectType::OS_AirTerminal_DualDuct_ConstantVolume, "Air Terminal Dual Duct Constant Volume");
-  libraryWidget->addModelObjectType(IddObjectType::OS_AirTerminal_DualDuct_VAV, "Air Terminal Dual Duct VAV");
-  libraryWidget->addModelObjectType(IddObjectType::OS_AirTerminal_DualDuct_VAV_OutdoorAir, "Air Terminal Dual Duct VAV Outdoor Air");
-  libraryWidget->addModelObjectType(IddObjectType::OS_AirLoopHVAC_OutdoorAirSystem, "AirLoopHVAC Outdoor Air System");
-  libraryWidget->addModelObjectType(IddObjectType::OS_AirLoopHVAC_UnitaryHeatPump_AirToAir_MultiSpeed,
-                                    "AirLoopHVAC Unitary Heat Pump AirToAir MultiSpeed");
-  libraryWidget->addModelObjectType(IddObjectType::OS_AirLoopHVAC_UnitarySystem, "AirLoopHVAC Unitary System");
-  libraryWidget->addModelObjectType(IddObjectType::OS_AirLoopHVAC_UnitaryHeatCool_VAVChangeoverBypass, "AirLoopHVAC Unitary VAV Changeover Bypass");
-
-  libraryWidget->addModelObjectType(IddObjectType::OS_AvailabilityManager_Scheduled, "Availability Manager Scheduled");
-  libraryWidget->addModelObjectType(IddObjectType::OS_AvailabilityManager_ScheduledOn, "Availability Manager Scheduled On");
-  libraryWidget->addModelObjectType(IddObjectType::OS_AvailabilityManager_ScheduledOff, "Availability Manager Scheduled Off");
-
-  libraryWidget->addModelObjectType(IddObjectType::OS_AvailabilityManager_LowTemperatureTurnOn, "Availability Manager Low Temperature Turn On");
-  libraryWidget->addModelObjectType(IddObjectType::OS_AvailabilityManager_LowTemperatureTurnOff, "Availability Manager Low Temperature Turn Off");
-
-  libraryWidget->addModelObjectType(IddObjectType::OS_AvailabilityManager_HighTemperatureTurnOn, "Availability Manager High Temperature Turn On");
-  libraryWidget->addModelObjectType(IddObjectType::OS_AvailabilityManager_HighTemperatureTurnOff, "Availability Manager High Temperature Turn Off");
-
-  libraryWidget->addModelObjectType(IddObjectType::OS_AvailabilityManager_DifferentialThermostat, "Availability Manager Differential Thermostat");
-  libraryWidget->addModelObjectType(IddObjectType::OS_AvailabilityManager_OptimumStart, "Availability Manager Optimum Start");
-
-  libraryWidget->addModelObjectType(IddObjectType::OS_AvailabilityManager_NightCycle, "Availability Manager Night Cycle");
-  libraryWidget->addModelObjectType(IddObjectType::OS_AvailabilityManager_NightVentilation, "Availability Manager Night Ventilation");
-  libraryWidget->addModelObjectType(IddObjectType::OS_AvailabilityManager_HybridVentilation, "Availability Manager Hybrid Ventilation");
-
-  setLibraryView(libraryWidget);
+  if (!showCachedLibraryView("HVACSystems")) {
+    auto* libraryWidget = new ModelObjectTypeListView(lib, true, OSItemType::CollapsibleListHeader, true);
+    libraryWidget->setItemsDraggable(true);
+    libraryWidget->setItemsRemoveable(false);
+    libraryWidget->setItemsType(OSItemType::LibraryItem);
+
+    libraryWidget->addModelObjectType(IddObjectType::OS_SolarCollector_IntegralCollectorStorage, "Solar Collector Integral Collector Storage");
+    libraryWidget->addModelObjectType(IddObjectType::OS_SolarCollector_FlatPlate_Water, "Solar Collector Flat Plate Water");
+    //libraryWidget->addModelObjectType(IddObjectType::OS_SolarCollector_FlatPlate_PhotovoltaicThermal, "Solar Collector Flat Plate Photovoltaic Thermal");
+    libraryWidget->addModelObjectType(IddObjectType::OS_WaterUse_Equipment, "Water Use Equipment");
+    libraryWidget->addModelObjectType(IddObjectType::OS_WaterUse_Connections, "Water Use Connections");
+    libraryWidget->addModelObjectType(IddObjectType::OS_WaterHeater_HeatPump, "Water Heater - Heat Pump");
+    libraryWidget->addModelObjectType(IddObjectType::OS_WaterHeater_HeatPump_WrappedCondenser, "Water Heater - Heat Pump - Wrapped Condenser");
+    libraryWidget->addModelObjectType(IddObjectType::OS_WaterHeater_Mixed, "Water Heater Mixed");
+    libraryWidget->addModelObjectType(IddObjectType::OS_WaterHeater_Stratified, "Water Heater Stratified");
+    libraryWidget->addModelObjectType(IddObjectType::OS_AirConditioner_VariableRefrigerantFlow, "VRF System");
+    libraryWidget->addModelObjectType(IddObjectType::OS_ZoneHVAC_TerminalUnit_VariableRefrigerantFlow, "VRF Terminal");
+    libraryWidget->addModelObjectType(IddObjectType::OS_ThermalStorage_Ice_Detailed, "Thermal Storage - Ice Storage");
+    libraryWidget->addModelObjectType(IddObjectType::OS_ThermalStorage_ChilledWater_Stratified, "Thermal Storage - Chilled Water");
+    libraryWidget->addModelObjectType(IddObjectType::OS_TemperingValve, "Tempering Valve");
+    libraryWidget->addModelObjectType(IddObjectType::OS_SetpointManager_SystemNodeReset_Humidity, "Setpoint Manager System Node Reset Humidity");
+    libraryWidget->addModelObjectType(IddObjectType::OS_SetpointManager_SystemNodeReset_Temperature, "Setpoint Manager System Node Reset Temperature");
+    libraryWidget->addModelObjectType(IddObjectType::OS_SetpointManager_Coldest, "Setpoint Manager Coldest");
+    libraryWidget->addModelObjectType(IddObjectType::OS_SetpointManager_FollowGroundTemperature, "Setpoint Manager Follow Ground Temperature");
+    libraryWidget->addModelObjectType(IddObjectType::OS_SetpointManager_FollowOutdoorAirTemperature, "Setpoint Manager Follow Outdoor Air Temperature");
+    libraryWidget->addModelObjectType(IddObjectType::OS_SetpointManager_FollowSystemNodeTemperature, "Setpoint Manager Follow System Node Temperature");
+    libraryWidget->addModelObjectType(IddObjectType::OS_SetpointManager_MixedAir, "Setpoint Manager Mixed Air");
+    libraryWidget->addModelObjectType(IddObjectType::OS_SetpointManager_MultiZone_Cooling_Average, "Setpoint Manager MultiZone Cooling Average");
+    libraryWidget->addModelObjectType(IddObjectType::OS_SetpointManager_MultiZone_Heating_Average, "Setpoint Manager MultiZone Heating Average");
+    libraryWidget->addModelObjectType(IddObjectType::OS_SetpointManager_MultiZone_Humidity_Maximum, "Setpoint Manager MultiZone Humidity Maximum");
+    libraryWidget->addModelObjectType(IddObjectType::OS_SetpointManager_MultiZone_Humidity_Minimum, "Setpoint Manager MultiZone Humidity Minimum");
+    libraryWidget->addModelObjectType(IddObjectType::OS_SetpointManager_MultiZone_MaximumHumidity_Average,
+                                      "Setpoint Manager MultiZone MaximumHumidity Average");
+    libraryWidget->addModelObjectType(IddObjectType::OS_SetpointManager_MultiZone_MinimumHumidity_Average,
+                                      "Setpoint Manager MultiZone MinimumHumidity Average");
+    libraryWidget->addModelObjectType(IddObjectType::OS_SetpointManager_OutdoorAirPretreat, "Setpoint Manager Outdoor Air Pretreat");
+    libraryWidget->addModelObjectType(IddObjectType::OS_SetpointManager_OutdoorAirReset, "Setpoint Manager Outdoor Air Reset");
+    libraryWidget->addModelObjectType(IddObjectType::OS_SetpointManager_Scheduled, "Setpoint Manager Scheduled");
+    libraryWidget->addModelObjectType(IddObjectType::OS_SetpointManager_Scheduled_DualSetpoint, "Setpoint Manager Scheduled Dual Setpoint");
+    libraryWidget->addModelObjectType(IddObjectType::OS_SetpointManager_SingleZone_Cooling, "Setpoint Manager Single Zone Cooling");
+    libraryWidget->addModelObjectType(IddObjectType::OS_SetpointManager_SingleZone_Heating, "Setpoint Manager Single Zone Heating");
+    libraryWidget->addModelObjectType(IddObjectType::OS_SetpointManager_SingleZone_Humidity_Maximum, "Setpoint Manager Humidity Maximum");
+    libraryWidget->addModelObjectType(IddObjectType::OS_SetpointManager_SingleZone_Humidity_Minimum, "Setpoint Manager Humidity Minimum");
+    libraryWidget->addModelObjectType(IddObjectType::OS_SetpointManager_SingleZone_OneStageCooling, "Setpoint Manager One Stage Cooling");
+    libraryWidget->addModelObjectType(IddObjectType::OS_SetpointManager_SingleZone_OneStageHeating, "Setpoint Manager One Stage Heating");
+    libraryWidget->addModelObjectType(IddObjectType::OS_SetpointManager_SingleZone_Reheat, "Setpoint Manager Single Zone Reheat");
+    libraryWidget->addModelObjectType(IddObjectType::OS_SetpointManager_Warmest, "Setpoint Manager Warmest");
+    libraryWidget->addModelObjectType(IddObjectType::OS_SetpointManager_WarmestTemperatureFlow, "Setpoint Manager Warmest Temp and Flow");
+    libraryWidget->addModelObjectType(IddObjectType::OS_Refrigeration_WalkIn, "Refrigeration Walkin");
+    libraryWidget->addModelObjectType(IddObjectType::OS_Refrigeration_System, "Refrigeration System");
+    libraryWidget->addModelObjectType(IddObjectType::OS_Refrigeration_Subcooler_Mechanical, "Refrigeration Subcooler Mechanical");
+    libraryWidget->addModelObjectType(IddObjectType::OS_Refrigeration_Subcooler_LiquidSuction, "Refrigeration Subcooler Liquid Suction");
+    libraryWidget->addModelObjectType(IddObjectType::OS_Refrigeration_Compressor, "Refrigeration Compressor");
+    libraryWidget->addModelObjectType(IddObjectType::OS_Refrigeration_Condenser_Cascade, "Refrigeration Condenser Cascade");
+    libraryWidget->addModelObjectType(IddObjectType::OS_Refrigeration_Condenser_WaterCooled, "Refrigeration Condenser Water Cooled");
+    libraryWidget->addModelObjectType(IddObjectType::OS_Refrigeration_Condenser_EvaporativeCooled, "Refrigeration Condenser Evaporative Cooled");
+    libraryWidget->addModelObjectType(IddObjectType::OS_Refrigeration_Condenser_AirCooled, "Refrigeration Condenser Air Cooled");
+    libraryWidget->addModelObjectType(IddObjectType::OS_Refrigeration_Case, "Refrigeration Case");
+    libraryWidget->addModelObjectType(IddObjectType::OS_Pump_ConstantSpeed, "Pump Constant Speed");
+    libraryWidget->addModelObjectType(IddObjectType::OS_HeaderedPumps_ConstantSpeed, "Pump Constant Speed Headered");
+    libraryWidget->addModelObjectType(IddObjectType::OS_Pump_VariableSpeed, "Pump Variable Speed");
+    libraryWidget->addModelObjectType(IddObjectType::OS_HeaderedPumps_VariableSpeed, "Pump Variable Speed Headered");
+    libraryWidget->addModelObjectType(IddObjectType::OS_PlantComponent_TemperatureSource, "Plant Component - Temp Source");
+    libraryWidget->addModelObjectType(IddObjectType::OS_PlantComponent_UserDefined, "Plant Component - User Defined");
+    libraryWidget->addModelObjectType(IddObjectType::OS_Pipe_Outdoor, "Pipe - Outdoor");
+    libraryWidget->addModelObjectType(IddObjectType::OS_Pipe_Indoor, "Pipe - Indoor");
+    libraryWidget->addModelObjectType(IddObjectType::OS_Pipe_Adiabatic, "Pipe - Adiabatic");
+    libraryWidget->addModelObjectType(IddObjectType::OS_LoadProfile_Plant, "Load Profile - Plant");
+    libraryWidget->addModelObjectType(IddObjectType::OS_Humidifier_Steam_Electric, "Humidifier Steam Electric");
+    libraryWidget->addModelObjectType(IddObjectType::OS_Humidifier_Steam_Gas, "Humidifier Steam Gas");
+    libraryWidget->addModelObjectType(IddObjectType::OS_HeatPump_WaterToWater_EquationFit_Heating, "Heat Pump - Water to Water - Heating");
+    libraryWidget->addModelObjectType(IddObjectType::OS_HeatPump_WaterToWater_EquationFit_Cooling, "Heat Pump - Water to Water - Cooling");
+    libraryWidget->addModelObjectType(IddObjectType::OS_HeatExchanger_FluidToFluid, "Heat Exchanger Fluid To Fluid");
+    libraryWidget->addModelObjectType(IddObjectType::OS_HeatExchanger_AirToAir_SensibleAndLatent, "Heat Exchanger Air To Air Sensible and Latent");
+    libraryWidget->addModelObjectType(IddObjectType::OS_Generator_FuelCell_ExhaustGasToWaterHeatExchanger,
+                                      "Generator FuelCell - ExhaustGasToWaterHeatExchanger");
+    libraryWidget->addModelObjectType(IddObjectType::OS_Generator_MicroTurbine_HeatRecovery, "Generator MicroTurbine - Heat Recovery");
+    libraryWidget->addModelObjectType(IddObjectType::OS_GroundHeatExchanger_Vertical, "Ground Heat Exchanger - Vertical ");
+    libraryWidget->addModelObjectType(IddObjectType::OS_GroundHeatExchanger_HorizontalTrench, "Ground Heat Exchanger - Horizontal");
+    libraryWidget->addModelObjectType(IddObjectType::OS_FluidCooler_TwoSpeed, "Fluid Cooler Two Speed");
+    libraryWidget->addModelObjectType(IddObjectType::OS_FluidCooler_SingleSpeed, "Fluid Cooler Single Speed");
+    libraryWidget->addModelObjectType(IddObjectType::OS_ZoneHVAC_FourPipeFanCoil, "Four Pipe Fan Coil");
+    libraryWidget->addModelObjectType(IddObjectType::OS_ZoneHVAC_PackagedTerminalHeatPump, "PTHP");
+    libraryWidget->addModelObjectType(IddObjectType::OS_ZoneHVAC_WaterToAirHeatPump, "Water To Air HP");
+    libraryWidget->addModelObjectType(IddObjectType::OS_ZoneHVAC_PackagedTerminalAirConditioner, "PTAC");
+    libraryWidget->addModelObjectType(IddObjectType::OS_ZoneHVAC_UnitHeater, "Unit Heater");
+    libraryWidget->addModelObjectType(IddObjectType::OS_ZoneHVAC_UnitVentilator, "Unit Ventilator");
+    libraryWidget->addModelObjectType(IddObjectType::OS_Fan_ComponentModel, "Fan Component Model");
+    libraryWidget->addModelObjectType(IddObjectType::OS_Fan_SystemModel, "Fan System Model");
+    libraryWidget->addModelObjectType(IddObjectType::OS_Fan_VariableVolume, "Fan Variable Volume");
+    libraryWidget->addModelObjectType(IddObjectType::OS_Fan_ConstantVolume, "Fan Constant Volume");
+    libraryWidget->addModelObjectType(IddObjectType::OS_EvaporativeCooler_Direct_ResearchSpecial, "Evaporative Cooler Direct Research Special");
+    libraryWidget->addModelObjectType(IddObjectType::OS_EvaporativeCooler_Indirect_ResearchSpecial, "Evaporative Cooler Indirect Research Special");
+    libraryWidget->addModelObjectType(IddObjectType::OS_EvaporativeFluidCooler_TwoSpeed, "Evaporative Fluid Cooler Two Speed");
+    libraryWidget->addModelObjectType(IddObjectType::OS_EvaporativeFluidCooler_SingleSpeed, "Evaporative Fluid Cooler Single Speed");
+    libraryWidget->addModelObjectType(IddObjectType::OS_Duct, "Duct");
+    libraryWidget->addModelObjectType(IddObjectType::OS_DistrictCooling, "District Cooling");
+    libraryWidget->addModelObjectType(IddObjectType::OS_DistrictHeating, "District Heating");
+    libraryWidget->addModelObjectType(IddObjectType::OS_CoolingTower_TwoSpeed, "Cooling Tower Two Speed");
+    libraryWidget->addModelObjectType(IddObjectType::OS_CoolingTower_SingleSpeed, "Cooling Tower Single Speed");
+    libraryWidget->addModelObjectType(IddObjectType::OS_CoolingTower_VariableSpeed, "Cooling Tower Variable Speed");
+    libraryWidget->addModelObjectType(IddObjectType::OS_CentralHeatPumpSystem, "Central Heat Pump System");
+    libraryWidget->addModelObjectType(IddObjectType::OS_Chiller_Electric_EIR, "Chiller - Electric EIR");
+    libraryWidget->addModelObjectType(IddObjectType::OS_Chiller_Absorption_Indirect, "Chiller - Indirect Absorption");
+    libraryWidget->addModelObjectType(IddObjectType::OS_Chiller_Absorption, "Chiller - Absorption");
+    libraryWidget->addModelObjectType(IddObjectType::OS_Coil_Heating_Gas, "Coil Heating Gas");
+    libraryWidget->addModelObjectType(IddObjectType::OS_Coil_Heating_DX_SingleSpeed, "Coil Heating DX SingleSpeed");
+    libraryWidget->addModelObjectType(IddObjectType::OS_Coil_Heating_Electric, "Coil Heating Electric");
+    libraryWidget->addModelObjectType(IddObjectType::OS_Coil_Heating_Water, "Coil Heating Water");
+    libraryWidget->addModelObjectType(IddObjectType::OS_Coil_Cooling_Water, "Coil Cooling Water");
+    libraryWidget->addModelObjectType(IddObjectType::OS_Coil_Cooling_DX_VariableSpeed, "Coil Cooling DX VariableSpeed");
+    libraryWidget->addModelObjectType(IddObjectType::OS_Coil_Cooling_DX_TwoStageWithHumidityControlMode, "Coil Cooling DX TwoStage - Humidity Control");
+    libraryWidget->addModelObjectType(IddObjectType::OS_Coil_Cooling_DX_TwoSpeed, "Coil Cooling DX TwoSpeed");
+    libraryWidget->addModelObjectType(IddObjectType::OS_Coil_Cooling_DX_SingleSpeed, "Coil Cooling DX SingleSpeed");
+    libraryWidget->addModelObjectType(IddObjectType::OS_Boiler_HotWater, "Boiler Hot Water");
+    libraryWidget->addModelObjectType(IddObjectType::OS_AirTerminal_SingleDuct_ConstantVolume_FourPipeInduction, "Air Terminal Four Pipe Induction");
+    libraryWidget->addModelObjectType(IddObjectType::OS_AirTerminal_SingleDuct_ConstantVolume_CooledBeam, "Air Terminal Chilled Beam");
+    libraryWidget->addModelObjectType(IddObjectType::OS_AirTerminal_SingleDuct_ConstantVolume_FourPipeBeam, "Air Terminal Four Pipe Beam");
+    libraryWidget->addModelObjectType(IddObjectType::OS_AirTerminal_SingleDuct_ConstantVolume_Reheat, "AirTerminal Single Duct Constant Volume Reheat");
+    libraryWidget->addModelObjectType(IddObjectType::OS_AirTerminal_SingleDuct_VAV_Reheat, "AirTerminal Single Duct VAV Reheat");
+    libraryWidget->addModelObjectType(IddObjectType::OS_AirTerminal_SingleDuct_ParallelPIU_Reheat, "AirTerminal Single Duct Parallel PIU Reheat");
+    libraryWidget->addModelObjectType(IddObjectType::OS_AirTerminal_SingleDuct_SeriesPIU_Reheat, "AirTerminal Single Duct Series PIU Reheat");
+    libraryWidget->addModelObjectType(IddObjectType::OS_AirTerminal_SingleDuct_InletSideMixer, "AirTerminal Inlet Side Mixer");
+    libraryWidget->addModelObjectType(IddObjectType::OS_AirTerminal_SingleDuct_VAV_HeatAndCool_Reheat, "AirTerminal Heat and Cool Reheat");
+    libraryWidget->addModelObjectType(IddObjectType::OS_AirTerminal_SingleDuct_VAV_HeatAndCool_NoReheat, "AirTerminal Heat and Cool No Reheat");
+    libraryWidget->addModelObjectType(IddObjectType::OS_AirTerminal_SingleDuct_VAV_NoReheat, "AirTerminal Single Duct VAV NoReheat");
+    libraryWidget->addModelObjectType(IddObjectType::OS_AirTerminal_SingleDuct_ConstantVolume_NoReheat,
+                                      "AirTerminal Single Duct Constant Volume No Reheat");
+    libraryWidget->addModelObjectType(IddObjectType::OS_AirTerminal_DualDuct_ConstantVolume, "Air Terminal Dual Duct Constant Volume");
+    libraryWidget->addModelObjectType(IddObjectType::OS_AirTerminal_DualDuct_VAV, "Air Terminal Dual Duct VAV");
+    libraryWidget->addModelObjectType(IddObjectType::OS_AirTerminal_DualDuct_VAV_OutdoorAir, "Air Terminal Dual Duct VAV Outdoor Air");
+    libraryWidget->addModelObjectType(IddObjectType::OS_AirLoopHVAC_OutdoorAirSystem, "AirLoopHVAC Outdoor Air System");
+    libraryWidget->addModelObjectType(IddObjectType::OS_AirLoopHVAC_UnitaryHeatPump_AirToAir_MultiSpeed,
+                                      "AirLoopHVAC Unitary Heat Pump AirToAir MultiSpeed");
+    libraryWidget->addModelObjectType(IddObjectType::OS_AirLoopHVAC_UnitarySystem, "AirLoopHVAC Unitary System");
+    libraryWidget->addModelObjectType(IddObjectType::OS_AirLoopHVAC_UnitaryHeatCool_VAVChangeoverBypass, "AirLoopHVAC Unitary VAV Changeover Bypass");
+
+    libraryWidget->addModelObjectType(IddObjectType::OS_AvailabilityManager_Scheduled, "Availability Manager Scheduled");
+    libraryWidget->addModelObjectType(IddObjectType::OS_AvailabilityManager_ScheduledOn, "Availability Manager Scheduled On");
+    libraryWidget->addModelObjectType(IddObjectType::OS_AvailabilityManager_ScheduledOff, "Availability Manager Scheduled Off");
+
+    libraryWidget->addModelObjectType(IddObjectType::OS_AvailabilityManager_LowTemperatureTurnOn, "Availability Manager Low Temperature Turn On");
+    libraryWidget->addModelObjectType(IddObjectType::OS_AvailabilityManager_LowTemperatureTurnOff, "Availability Manager Low Temperature Turn Off");
+
+    libraryWidget->addModelObjectType(IddObjectType::OS_AvailabilityManager_HighTemperatureTurnOn, "Availability Manager High Temperature Turn On");
+    libraryWidget->addModelObjectType(IddObjectType::OS_AvailabilityManager_HighTemperatureTurnOff, "Availability Manager High Temperature Turn Off");
+
+    libraryWidget->addModelObjectType(IddObjectType::OS_AvailabilityManager_DifferentialThermostat, "Availability Manager Differential Thermostat");
+    libraryWidget->addModelObjectType(IddObjectType::OS_AvailabilityManager_OptimumStart, "Availability Manager Optimum Start");
+
+    libraryWidget->addModelObjectType(IddObjectType::OS_AvailabilityManager_NightCycle, "Availability Manager Night Cycle");
+    libraryWidget->addModelObjectType(IddObjectType::OS_AvailabilityManager_NightVentilation, "Availability Manager Night Ventilation");
+    libraryWidget->addModelObjectType(IddObjectType::OS_AvailabilityManager_HybridVentilation, "Availability Manager Hybrid Ventilation");
+
+    setCachedLibraryView("HVACSystems", libraryWidget);
+  }
 
   m_horizontalTabWidget->setCurrentId(LIBRARY);
 
@@ -35,6 +35,7 @@
 #include <openstudio/model/Model.hpp>
 #include "../shared_gui_components/EditController.hpp"
 #include "../shared_gui_components/LocalLibraryController.hpp"
+#include "SubTabPanelCache.hpp"
 
 #include <QSharedPointer>
 
@@ -142,6 +143,18 @@ class MainRightColumnController : public OSQObjectController
 
   void setLibraryView(QWidget* widget);
 
+  // The my model and library panels of a subtab are kept once built and reused when the subtab is shown again;
+  // these return false if the panel stored under key has not been built yet
+  bool showCachedMyModelView(const std::string& key);
+
+  bool showCachedLibraryView(const std::string& key);
+
+  void setCachedMyModelView(const std::string& key, QWidget* widget);
+
+  void setCachedLibraryView(const std::string& key, QWidget* widget);
+
+  bool isCachedView(QWidget* widget) const;
+
   void setEditView(QWidget* widget);
 
   HorizontalTabWidget* m_horizontalTabWidget;
@@ -168,6 +181,10 @@ class MainRightColumnController : public OSQObjectController
 
   OSItem* m_item = nullptr;
 
+  SubTabPanelCache m_cachedMyModelViews;
+
+  SubTabPanelCache m_cachedLibraryViews;
+
  private slots:
 
   void onItemRemoveClicked(OSItem*);
@@ -49,6 +49,7 @@
 #include <openstudio/utilities/idd/IddEnums.hpp>
 #include <openstudio/utilities/idd/IddEnums.hxx>
 
+#include <algorithm>
 #include <iostream>
 
 namespace openstudio {
@@ -70,22 +71,49 @@ IddObjectType ModelObjectListController::iddObjectType() const {
 void ModelObjectListController::objectAdded(std::shared_ptr<openstudio::detail::WorkspaceObject_Impl> impl,
                                             const openstudio::IddObjectType& iddObjectType, const openstudio::UUID& handle) {
   if (iddObjectType == m_iddObjectType) {
-    std::vector<OSItemId> ids = this->makeVector();
-    emit itemIds(ids);
+    if (!m_hasVector) {
+      // the first call to makeVector will pick it up
+      return;
+    }
 
-    for (const OSItemId& id : ids) {
-      if (id.itemId() == toQString(impl->handle())) {
-        emit selectedItemId(id);
-        break;
-      }
+    // the connection is queued, the object may be gone already
+    boost::optional<WorkspaceObject> workspaceObject = m_model.getObject(handle);
+    if (!workspaceObject || !isListed(workspaceObject->cast<model::ModelObject>())) {
+      return;
     }
+
+    // objects renamed since makeVector are not moved, so the mirror is not necessarily sorted anymore and cannot be
+    // bisected; insert before the first object that sorts after the new one, like upper_bound would on a sorted vector
+    WorkspaceObjectNameGreater greater;
+    auto it = std::find_if(m_workspaceObjects.begin(), m_workspaceObjects.end(),
+                           [&](const WorkspaceObject& other) { return greater(*workspaceObject, other); });
+    int index = static_cast<int>(it - m_workspaceObjects.begin()) + static_cast<int>(m_itemIds.size() - m_workspaceObjects.size());
+    OSItemId id = modelObjectToItemId(workspaceObject->cast<model::ModelObject>(), false);
+
+    m_workspaceObjects.insert(it, *workspaceObject);
+    m_itemIds.insert(m_itemIds.begin() + index, id);
+
+    emit itemIdInserted(index, id);
+    emit selectedItemId(id);
   }
 }
 
 void ModelObjectListController::objectRemoved(std::shared_ptr<openstudio::detail::WorkspaceObject_Impl> impl,
                                               const openstudio::IddObjectType& iddObjectType, const openstudio::UUID& handle) {
   if (iddObjectType == m_iddObjectType) {
-    emit itemIds(makeVector());
+    auto it = std::find_if(m_workspaceObjects.begin(), m_workspaceObjects.end(),
+                           [&handle](const WorkspaceObject& workspaceObject) { return workspaceObject.handle() == handle; });
+    if (it == m_workspaceObjects.end()) {
+      return;
+    }
+
+    int index = static_cast<int>(it - m_workspaceObjects.begin()) + static_cast<int>(m_itemIds.size() - m_workspaceObjects.size());
+    OSItemId id = m_itemIds[index];
+
+    m_workspaceObjects.erase(it);
+    m_itemIds.erase(m_itemIds.begin() + index);
+
+    emit itemIdRemoved(id);
   }
 }
 
@@ -113,41 +141,53 @@ std::vector<OSItemId> ModelObjectListController::makeVector() {
   // sort by name
   std::sort(workspaceObjects.begin(), workspaceObjects.end(), WorkspaceObjectNameGreater());
 
+  m_workspaceObjects.clear();
   for (const WorkspaceObject& workspaceObject : workspaceObjects) {
     if (!workspaceObject.handle().isNull()) {
       auto modelObject = workspaceObject.cast<openstudio::model::ModelObject>();
-      if (boost::optional<model::HVACComponent> hvacComponent = modelObject.optionalCast<model::HVACComponent>()) {
-        if ((!hvacComponent->containingHVACComponent()) && (!hvacComponent->containingZoneHVACComponent())) {
-          result.push_back(modelObjectToItemId(hvacComponent.get(), false));
-        }
-        // Special case when there is a containingZoneHVACComponent, it might be a tank for a HPWH that we DO want to be able
-        // to drag and drop...
-        else if (boost::optional<openstudio::model::ZoneHVACComponent> zComp = hvacComponent->containingZoneHVACComponent()) {
-
-          openstudio::IddObjectType zCompType = zComp->iddObjectType();
-
-          // Special case for a WaterHeaterMixed, can be part of a HeatPump(PumpedCondenser) or HeatPump:WrappedCondenser
-          if ((m_iddObjectType == openstudio::IddObjectType::OS_WaterHeater_Stratified)
-              && ((zCompType == openstudio::IddObjectType::OS_WaterHeater_HeatPump)
-                  || (zCompType == openstudio::IddObjectType::OS_WaterHeater_HeatPump_WrappedCondenser))) {
-            result.push_back(modelObjectToItemId(hvacComponent.get(), false));
-          }
-          // Special case for a WaterHeaterMixed, can be part of a HeatPump(PumpedCondenser) only
-          else if ((m_iddObjectType == openstudio::IddObjectType::OS_WaterHeater_Mixed)
-                   && (zCompType == openstudio::IddObjectType::OS_WaterHeater_HeatPump)) {
-            result.push_back(modelObjectToItemId(hvacComponent.get(), false));
-          }
-        }
-
-      } else {
+      if (isListed(modelObject)) {
         result.push_back(modelObjectToItemId(modelObject, false));
+        m_workspaceObjects.push_back(workspaceObject);
       }
     }
   }
 
+  m_hasVector = true;
+  m_itemIds = result;
+
   return result;
 }
 
+bool ModelObjectListController::isListed(const model::ModelObject& modelObject) const {
+  if (boost::optional<model::HVACComponent> hvacComponent = modelObject.optionalCast<model::HVACComponent>()) {
+    if ((!hvacComponent->containingHVACComponent()) && (!hvacComponent->containingZoneHVACComponent())) {
+      return true;
+    }
+    // Special case when there is a containingZoneHVACComponent, it might be a tank for a HPWH that we DO want to be able
+    // to drag and drop...
+    else if (boost::optional<openstudio::model::ZoneHVACComponent> zComp = hvacComponent->containingZoneHVACComponent()) {
+
+      openstudio::IddObjectType zCompType = zComp->iddObjectType();
+
+      // Special case for a WaterHeaterMixed, can be part of a HeatPump(PumpedCondenser) or HeatPump:WrappedCondenser
+      if ((m_iddObjectType == openstudio::IddObjectType::OS_WaterHeater_Stratified)
+          && ((zCompType == openstudio::IddObjectType::OS_WaterHeater_HeatPump)
+              || (zCompType == openstudio::IddObjectType::OS_WaterHeater_HeatPump_WrappedCondenser))) {
+        return true;
+      }
+      // Special case for a WaterHeaterMixed, can be part of a HeatPump(PumpedCondenser) only
+      else if ((m_iddObjectType == openstudio::IddObjectType::OS_WaterHeater_Mixed)
+               && (zCompType == openstudio::IddObjectType::OS_WaterHeater_HeatPump)) {
+        return true;
+      }
+    }
+
+    return false;
+  }
+
+  return true;
+}
+
 ModelObjectListView::ModelObjectListView(const openstudio::IddObjectType& iddObjectType, const model::Model& model, bool addScrollArea,
                                          bool showLocalBCL, QWidget* parent)
   : OSItemList(new ModelObjectListController(iddObjectType, model, showLocalBCL), addScrollArea, parent) {}
@@ -58,9 +58,17 @@ class ModelObjectListController : public OSVectorController
   virtual std::vector<OSItemId> makeVector() override;
 
  private:
+  bool isListed(const model::ModelObject& modelObject) const;
+
   openstudio::IddObjectType m_iddObjectType;
   model::Model m_model;
   bool m_showLocalBCL;
+
+  // Mirror of the vector last returned by makeVector, so added and removed objects can be reported
+  // as deltas; the local BCL components lead the vector and are only searched for again by makeVector
+  bool m_hasVector = false;
+  std::vector<OSItemId> m_itemIds;
+  std::vector<WorkspaceObject> m_workspaceObjects;
 };
 
 class ModelObjectListView : public OSItemList
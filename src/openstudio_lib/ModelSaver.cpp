@@ -0,0 +1,179 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) 2020-2022, OpenStudio Coalition and other contributors. All rights reserved.
+*
+*  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the
+*  following conditions are met:
+*
+*  (1) Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+*  disclaimer.
+*
+*  (2) Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following
+*  disclaimer in the documentation and/or other materials provided with the distribution.
+*
+*  (3) Neither the name of the copyright holder nor the names of any contributors may be used to endorse or promote products
+*  derived from this software without specific prior written permission from the respective party.
+*
+*  (4) Other than as required in clauses (1) and (2), distributions in any form of modifications or other derivative works
+*  may not use the "OpenStudio" trademark, "OS", "os", or any other confusingly similar designation without specific prior
+*  written permission from Alliance for Sustainable Energy, LLC.
+*
+*  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDER(S) AND ANY CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+*  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+*  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER(S), ANY CONTRIBUTORS, THE UNITED STATES GOVERNMENT, OR THE UNITED
+*  STATES DEPARTMENT OF ENERGY, NOR ANY OF THEIR EMPLOYEES, BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+*  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF
+*  USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+*  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+*  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+***********************************************************************************************************************/
+
+#include "ModelSaver.hpp"
+
+#include <openstudio/utilities/filetypes/WorkflowJSON.hpp>
+#include <openstudio/utilities/idf/IdfFile.hpp>
+
+#include <QtConcurrent>
+
+#include <set>
+
+namespace openstudio {
+
+namespace {
+
+openstudio::path temporarySibling(const openstudio::path& p) {
+  return p.parent_path() / toPath(p.filename().string() + ".saving");
+}
+
+}  // namespace
+
+QFuture<bool> ModelSaver::saveAsync(model::Model model, const openstudio::path& osmPath, const openstudio::path& modelTempDir) {
+  // the workflow is small, it is written here since it belongs to the model
+  WorkflowJSON workflowJSON = model.workflowJSON();
+  workflowJSON.setSeedFile(toPath("..") / osmPath.filename());
+  if (!workflowJSON.saveAs(modelTempDir / toPath("resources") / toPath("workflow.osw"))) {
+    LOG(Error, "Failed to save workflow for " << osmPath);
+    return QtFuture::makeReadyFuture(false);
+  }
+
+  // copying the objects is the only step which needs the model, formatting and disk access happen on the worker
+  IdfFile snapshot = model.toIdfFile();
+
+  return QtConcurrent::run(&ModelSaver::save, snapshot, osmPath, modelTempDir);
+}
+
+void ModelSaver::save(QPromise<bool>& promise, const IdfFile& snapshot, const openstudio::path& osmPath, const openstudio::path& modelTempDir) {
+  promise.setProgressRange(0, 100);
+
+  openstudio::path tempOsmPath = modelTempDir / osmPath.filename();
+  if (!writeAtomically(snapshot, tempOsmPath)) {
+    promise.addResult(false);
+    return;
+  }
+  promise.setProgressValue(40);
+
+  if (!copyAtomically(tempOsmPath, osmPath)) {
+    promise.addResult(false);
+    return;
+  }
+  promise.setProgressValue(50);
+
+  openstudio::path modelDir = osmPath.parent_path() / osmPath.stem();
+  bool result = syncDirectory(promise, modelTempDir / toPath("resources"), modelDir, 50, 100);
+
+  promise.setProgressValue(100);
+  promise.addResult(result);
+}
+
+bool ModelSaver::writeAtomically(const IdfFile& snapshot, const openstudio::path& dst) {
+  openstudio::path tmp = temporarySibling(dst);
+  if (!snapshot.save(tmp, true)) {
+    LOG(Error, "Failed to write " << tmp);
+    return false;
+  }
+
+  boost::system::error_code ec;
+  boost::filesystem::rename(tmp, dst, ec);
+  if (ec) {
+    LOG(Error, "Failed to rename " << tmp << " to " << dst << ": " << ec.message());
+    boost::filesystem::remove(tmp, ec);
+    return false;
+  }
+  return true;
+}
+
+bool ModelSaver::copyAtomically(const openstudio::path& src, const openstudio::path& dst) {
+  openstudio::path tmp = temporarySibling(dst);
+
+  boost::system::error_code ec;
+  boost::filesystem::copy_file(src, tmp, boost::filesystem::copy_options::overwrite_existing, ec);
+  if (!ec) {
+    boost::filesystem::rename(tmp, dst, ec);
+  }
+  if (ec) {
+    LOG(Error, "Failed to copy " << src << " to " << dst << ": " << ec.message());
+    boost::filesystem::remove(tmp, ec);
+    return false;
+  }
+  return true;
+}
+
+bool ModelSaver::syncDirectory(QPromise<bool>& promise, const openstudio::path& srcDir, const openstudio::path& dstDir, int progressBegin,
+                               int progressEnd) {
+  namespace fs = boost::filesystem;
+  boost::system::error_code ec;
+
+  std::set<openstudio::path> srcFiles;
+  if (fs::is_directory(srcDir, ec)) {
+    for (fs::recursive_directory_iterator it(srcDir, ec), end; !ec && it != end; it.increment(ec)) {
+      if (fs::is_regular_file(it->status())) {
+        srcFiles.insert(fs::relative(it->path(), srcDir));
+      }
+    }
+  }
+  if (ec) {
+    LOG(Error, "Failed to list " << srcDir << ": " << ec.message());
+    return false;
+  }
+
+  // remove files left over from resources deleted since the last save
+  if (fs::is_directory(dstDir, ec)) {
+    std::vector<openstudio::path> staleFiles;
+    for (fs::recursive_directory_iterator it(dstDir, ec), end; !ec && it != end; it.increment(ec)) {
+      if (fs::is_regular_file(it->status()) && (srcFiles.count(fs::relative(it->path(), dstDir)) == 0)) {
+        staleFiles.push_back(it->path());
+      }
+    }
+    for (const auto& staleFile : staleFiles) {
+      fs::remove(staleFile, ec);
+      if (ec) {
+        LOG(Warn, "Failed to remove " << staleFile << ": " << ec.message());
+      }
+    }
+  }
+
+  bool result = true;
+  int i = 0;
+  for (const auto& relativePath : srcFiles) {
+    openstudio::path src = srcDir / relativePath;
+    openstudio::path dst = dstDir / relativePath;
+
+    // copies keep the source modification time, so a file is unchanged if both size and time match
+    bool changed = !fs::exists(dst, ec) || (fs::file_size(src, ec) != fs::file_size(dst, ec))
+                   || (fs::last_write_time(src, ec) != fs::last_write_time(dst, ec));
+    if (changed) {
+      fs::create_directories(dst.parent_path(), ec);
+      if (copyAtomically(src, dst)) {
+        fs::last_write_time(dst, fs::last_write_time(src, ec), ec);
+      } else {
+        result = false;
+      }
+    }
+
+    ++i;
+    promise.setProgressValue(progressBegin + (progressEnd - progressBegin) * i / static_cast<int>(srcFiles.size()));
+  }
+
+  return result;
+}
+
+}  // namespace openstudio
@@ -0,0 +1,73 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) 2020-2022, OpenStudio Coalition and other contributors. All rights reserved.
+*
+*  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the
+*  following conditions are met:
+*
+*  (1) Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+*  disclaimer.
+*
+*  (2) Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following
+*  disclaimer in the documentation and/or other materials provided with the distribution.
+*
+*  (3) Neither the name of the copyright holder nor the names of any contributors may be used to endorse or promote products
+*  derived from this software without specific prior written permission from the respective party.
+*
+*  (4) Other than as required in clauses (1) and (2), distributions in any form of modifications or other derivative works
+*  may not use the "OpenStudio" trademark, "OS", "os", or any other confusingly similar designation without specific prior
+*  written permission from Alliance for Sustainable Energy, LLC.
+*
+*  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDER(S) AND ANY CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+*  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+*  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER(S), ANY CONTRIBUTORS, THE UNITED STATES GOVERNMENT, OR THE UNITED
+*  STATES DEPARTMENT OF ENERGY, NOR ANY OF THEIR EMPLOYEES, BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+*  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF
+*  USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+*  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+*  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+***********************************************************************************************************************/
+
+#ifndef OPENSTUDIO_MODELSAVER_HPP
+#define OPENSTUDIO_MODELSAVER_HPP
+
+#include "OpenStudioAPI.hpp"
+
+#include <openstudio/model/Model.hpp>
+#include <openstudio/utilities/core/Logger.hpp>
+#include <openstudio/utilities/core/Path.hpp>
+
+#include <QFuture>
+#include <QPromise>
+
+namespace openstudio {
+
+class IdfFile;
+
+// Background replacement for model::saveModel.
+// The model is snapshotted on the calling thread, the snapshot is then serialized to modelTempDir / osmPath.filename()
+// on a worker thread and copied to osmPath along with the files in modelTempDir / resources.
+// Files are written under a temporary name and renamed so an interrupted save never leaves a truncated osm behind,
+// and only resource files which changed since the last save are copied to the model's companion directory.
+class OPENSTUDIO_API ModelSaver
+{
+ public:
+  // Must be called on the thread owning the model, the returned future reports progress from 0 to 100
+  static QFuture<bool> saveAsync(model::Model model, const openstudio::path& osmPath, const openstudio::path& modelTempDir);
+
+ private:
+  REGISTER_LOGGER("openstudio.ModelSaver");
+
+  static void save(QPromise<bool>& promise, const IdfFile& snapshot, const openstudio::path& osmPath, const openstudio::path& modelTempDir);
+
+  // Writes to a sibling temporary file then renames it over dst
+  static bool writeAtomically(const IdfFile& snapshot, const openstudio::path& dst);
+  static bool copyAtomically(const openstudio::path& src, const openstudio::path& dst);
+
+  // Copies files which are new or differ by size or modification time, removes files which no longer exist in srcDir
+  static bool syncDirectory(QPromise<bool>& promise, const openstudio::path& srcDir, const openstudio::path& dstDir, int progressBegin,
+                            int progressEnd);
+};
+
+}  // namespace openstudio
+
+#endif  // OPENSTUDIO_MODELSAVER_HPP
@@ -45,6 +45,7 @@
 #include "MainWindow.hpp"
 #include "ModelObjectItem.hpp"
 #include "ModelObjectTypeListView.hpp"
+#include "ModelSaver.hpp"
 #include "OSAppBase.hpp"
 #include "ResultsTabController.hpp"
 #include "ResultsTabView.hpp"
@@ -60,6 +61,7 @@
 #include "SpaceTypesView.hpp"
 #include "SummaryTabController.hpp"
 #include "SummaryTabView.hpp"
+#include "TabControllerCache.hpp"
 #include "ThermalZonesTabController.hpp"
 #include "VariablesTabController.hpp"
 #include "VerticalTabWidget.hpp"
@@ -114,10 +116,13 @@
 #include <openstudio/gbxml/ForwardTranslator.hpp>
 #include <openstudio/sdd/ForwardTranslator.hpp>
 
+#include <QCoreApplication>
 #include <QDir>
+#include <QEventLoop>
 #include <QFileDialog>
 #include <QFileInfo>
 #include <QFileInfoList>
+#include <QFutureWatcher>
 #include <QMenuBar>
 #include <QMessageBox>
 #include <QString>
@@ -127,6 +132,7 @@
 #include <QInputDialog>
 #include <QSettings>
 
+#include <algorithm>
 #include <memory>
 
 #if (defined(_WIN32) || defined(_WIN64))
@@ -145,6 +151,10 @@ OSDocument::OSDocument(const openstudio::model::Model& library, const openstudio
     m_savePath(std::move(filePath)),
     m_isPlugin(isPlugin) {
 
+  QSettings settings(QCoreApplication::organizationName(), QCoreApplication::applicationName());
+  m_tabControllerCache = std::make_unique<TabControllerCache>(settings.value("tabControllerCacheSize", 4).toInt(),
+                                                              settings.value("tabControllerCacheMaxWidgets", 100000).toInt());
+
   QFile data(":openstudiolib.qss");
 
   static QString style;
@@ -162,6 +172,9 @@ OSDocument::OSDocument(const openstudio::model::Model& library, const openstudio
   m_mainWindow = new MainWindow(m_isPlugin);
   addQObject(m_mainWindow);
 
+  m_saveWatcher = new QFutureWatcher<bool>(this);
+  connect(m_saveWatcher, &QFutureWatcher<bool>::progressValueChanged, this, &OSDocument::modelSaveProgress);
+
   bool initalizeWorkflow = false;
   if (!model) {
     model = openstudio::model::Model();
@@ -213,7 +226,7 @@ OSDocument::OSDocument(const openstudio::model::Model& library, const openstudio
   connect(m_mainWindow, &MainWindow::exportgbXMLClicked, this, &OSDocument::exportgbXML);
   connect(m_mainWindow, &MainWindow::exportSDDClicked, this, &OSDocument::exportSDD);
   connect(m_mainWindow, &MainWindow::saveAsFileClicked, this, &OSDocument::saveAs);
-  connect(m_mainWindow, &MainWindow::saveFileClicked, this, &OSDocument::save);
+  connect(m_mainWindow, &MainWindow::saveFileClicked, this, &OSDocument::saveInBackground);
   // Using old-style connect here to avoid including OpenStudioApp files
   auto isConnected = connect(m_mainWindow, SIGNAL(revertFileClicked()), OSAppBase::instance(), SLOT(revertToSaved()));
   OS_ASSERT(isConnected);
@@ -258,7 +271,11 @@ OSDocument::~OSDocument() {
 
   disconnect();
 
+  // the worker writes into the model temp dir, m_saveFuture is not waited on since its continuation needs the event loop
+  m_saveWatcher->waitForFinished();
+
   // release the file watchers so can remove model temp dir
+  m_tabControllerCache->clear();
   m_mainTabController.reset();
   m_mainRightColumnController.reset();
 
@@ -295,6 +312,9 @@ void OSDocument::setModel(const model::Model& model, bool modified, bool /*saveC
     Application::instance().processEvents();
   }
 
+  // the cached tabs are views of the previous model
+  clearTabControllerCache();
+
   m_model = model;
 
   // convert absolute weather file paths to relative in the model, also copy the epw file to the temp dir
@@ -313,6 +333,8 @@ void OSDocument::setModel(const model::Model& model, bool modified, bool /*saveC
     OSAppBase::instance());
   m_model.getImpl<model::detail::Model_Impl>()->addWorkspaceObject.connect<OSAppBase, &OSAppBase::addWorkspaceObject>(OSAppBase::instance());
   m_model.getImpl<model::detail::Model_Impl>()->removeWorkspaceObject.connect<OSAppBase, &OSAppBase::removeWorkspaceObject>(OSAppBase::instance());
+  m_model.getImpl<model::detail::Model_Impl>()->addWorkspaceObject.connect<OSDocument, &OSDocument::markCachedTabControllersDirty>(this);
+  m_model.getImpl<model::detail::Model_Impl>()->removeWorkspaceObject.connect<OSDocument, &OSDocument::markCachedTabControllersDirty>(this);
   m_model.getImpl<model::detail::Model_Impl>()->onChange.connect<OSDocument, &OSDocument::markAsModified>(this);
   m_model.workflowJSON().getImpl<detail::WorkflowJSON_Impl>()->onChange.connect<OSDocument, &OSDocument::markAsModified>(this);
 
@@ -429,10 +451,16 @@ void OSDocument::createTabButtons() {
 }
 
 void OSDocument::createTab(int verticalId) {
-  m_mainTabController.reset();
+  cacheMainTabController();
 
   m_verticalId = verticalId;
 
+  m_mainTabController = m_tabControllerCache->take(verticalId);
+  if (m_mainTabController) {
+    m_mainWindow->setView(m_mainTabController->mainContentWidget(), verticalId);
+    return;
+  }
+
   bool isIP = m_mainWindow->displayIP();
 
   switch (verticalId) {
@@ -743,7 +771,34 @@ void OSDocument::createTab(int verticalId) {
   }
 }
 
+void OSDocument::cacheMainTabController() {
+  if (!m_mainTabController) {
+    return;
+  }
+
+  // the run tab holds on to the save path and temp dir, always rebuild it
+  if (m_verticalId == RUN_SIMULATION) {
+    m_mainTabController.reset();
+    return;
+  }
+
+  m_tabControllerCache->put(m_verticalId, std::move(m_mainTabController));
+  m_mainTabController.reset();
+}
+
+void OSDocument::clearTabControllerCache() {
+  m_tabControllerCache->clear();
+  m_mainTabController.reset();
+}
+
+void OSDocument::markCachedTabControllersDirty(const WorkspaceObject& /*object*/, const openstudio::IddObjectType& /*iddObjectType*/,
+                                               const openstudio::UUID& /*handle*/) {
+  m_tabControllerCache->markAllDirty();
+}
+
 void OSDocument::markAsModified() {
+  ++m_modificationCount;
+
   m_mainWindow->setWindowModified(true);
 
   if (m_savePath.isEmpty()) {
@@ -1372,30 +1427,70 @@ bool OSDocument::save() {
     // DLM: should not happen unless user sets an absolute path to epw file in a measure
     fixWeatherFileInTemp(false);
 
-    openstudio::path modelPath = toPath(m_savePath);
+    fileSaved = waitForSave(startSave(toPath(m_savePath)));
+  } else {
+    fileSaved = saveAs();
+  }
+
+  return fileSaved;
+}
+
+void OSDocument::saveInBackground() {
+  LOG(Debug, "OSDocument::saveInBackground");
+
+  if (!m_savePath.isEmpty()) {
+    fixWeatherFileInTemp(false);
+
+    startSave(toPath(m_savePath));
+  } else {
+    saveAs();
+  }
+}
 
-    emit modelSaving(modelPath);
+QFuture<bool> OSDocument::startSave(const openstudio::path& modelPath) {
+  // saves are serialized, the pending one may still be copying to the user location
+  waitForSave(m_saveFuture);
 
-    // saves the model to modelTempDir / m_savePath.filename()
-    // also copies the temp files to user location
-    LOG(Debug, "Saving " << modelPath << " starting");
-    bool saved = saveModel(this->model(), modelPath, toPath(m_modelTempDir));
+  emit modelSaving(modelPath);
+
+  // saves the model to modelTempDir / modelPath.filename()
+  // also copies the temp files to user location
+  LOG(Debug, "Saving " << modelPath << " starting");
+  QFuture<bool> future = ModelSaver::saveAsync(this->model(), modelPath, toPath(m_modelTempDir));
+  m_saveWatcher->setFuture(future);
+
+  unsigned modificationCount = m_modificationCount;
+
+  m_saveFuture = future.then(this, [this, modelPath, modificationCount](bool saved) {
     if (saved) {
       LOG(Debug, "Saving " << modelPath << " complete");
       this->setSavePath(toQString(modelPath));
-      this->markAsUnmodified();
-      fileSaved = true;
+      if (modificationCount == m_modificationCount) {
+        this->markAsUnmodified();
+      }
     } else {
       LOG(Debug, "Saving " << modelPath << " failed");
       QMessageBox::warning(this->mainWindow(), tr("Failed to save model"),
                            tr("Failed to save model, make sure that you do not have the location open and that you have correct write access."));
     }
+    return saved;
+  });
 
-  } else {
-    fileSaved = saveAs();
-  }
+  return m_saveFuture;
+}
 
-  return fileSaved;
+bool OSDocument::waitForSave(QFuture<bool> future) {
+  if (!future.isFinished()) {
+    // keep painting while the worker writes, the continuation setting the save path also runs in this loop
+    QEventLoop loop;
+    QFutureWatcher<bool> watcher;
+    connect(&watcher, &QFutureWatcher<bool>::finished, &loop, &QEventLoop::quit);
+    watcher.setFuture(future);
+    if (!future.isFinished()) {
+      loop.exec(QEventLoop::ExcludeUserInputEvents);
+    }
+  }
+  return future.isValid() && future.resultCount() > 0 && future.result();
 }
 
 void OSDocument::scanForTools() {
@@ -1434,6 +1529,9 @@ bool OSDocument::saveAs() {
   QString filePath = QFileDialog::getSaveFileName(this->mainWindow(), tr("Save"), defaultDir, tr("(*.osm)"));
 
   if (!filePath.isEmpty()) {
+    // the pending save may still be writing the old model
+    waitForSave(m_saveFuture);
+
     // remove old model
     if (!m_savePath.isEmpty()) {
       openstudio::path oldModelPath = toPath(m_modelTempDir) / toPath(m_savePath).filename();
@@ -1449,22 +1547,7 @@ bool OSDocument::saveAs() {
       modelPath = setFileExtension(modelPath, modelFileExtension(), false, true);
     }
 
-    emit modelSaving(modelPath);
-
-    // saves the model to modelTempDir / filePath.filename()
-    // also copies the temp files to user location
-    LOG(Debug, "Saving " << modelPath << " starting");
-    bool saved = saveModel(this->model(), modelPath, toPath(m_modelTempDir));
-    if (saved) {
-      LOG(Debug, "Saving " << modelPath << " complete");
-      this->setSavePath(toQString(modelPath));
-      this->markAsUnmodified();
-      fileSaved = true;
-    } else {
-      LOG(Debug, "Saving " << modelPath << " failed");
-      QMessageBox::warning(this->mainWindow(), tr("Failed to save model"),
-                           tr("Failed to save model, make sure that you do not have the location open and that you have correct write access."));
-    }
+    fileSaved = waitForSave(startSave(modelPath));
   }
 
   return fileSaved;
@@ -1477,6 +1560,8 @@ openstudio::model::Model OSDocument::componentLibrary() const {
 void OSDocument::setComponentLibrary(const openstudio::model::Model& model) {
   m_compLibrary = model;
 
+  // every tab was built against the previous library
+  clearTabControllerCache();
   onVerticalTabSelected(m_mainTabId);
 }
 
@@ -1692,6 +1777,8 @@ void OSDocument::openBclDlg() {
 
 void OSDocument::on_closeBclDlg() {
   if (m_onlineBclDialog->showNewComponents()) {
+    // the downloaded components were added to the library every tab was built against
+    clearTabControllerCache();
     onVerticalTabSelected(m_mainTabId);
     m_onlineBclDialog->setShowNewComponents(false);
   }
@@ -38,13 +38,19 @@
 #include <openstudio/model/Model.hpp>
 #include <openstudio/model/ModelObject.hpp>
 
+#include <QFuture>
 #include <QObject>
 #include <QString>
 
+#include <memory>
+
 #include <boost/smart_ptr.hpp>
 
 class QDir;
 
+template <typename T>
+class QFutureWatcher;
+
 namespace openstudio {
 
 namespace runmanager {
@@ -54,6 +60,8 @@ class MainTabController;
 
 class MainRightColumnController;
 
+class TabControllerCache;
+
 class InspectorController;
 
 class MainWindow;
@@ -209,6 +217,9 @@ class OPENSTUDIO_API OSDocument : public OSQObjectController
   // called before actual save (copy from temp to user location) occurs
   void modelSaving(const openstudio::path& t_path);
 
+  // progress of the background save, from 0 to 100
+  void modelSaveProgress(int percent);
+
   void downloadComponentsClicked();
 
   void openLibDlgClicked();
@@ -233,9 +244,12 @@ class OPENSTUDIO_API OSDocument : public OSQObjectController
 
   void exportSDD();
 
-  // returns if a file was saved
+  // returns if a file was saved, the GUI keeps processing events while the model is written
   bool save();
 
+  // same as save but returns as soon as the model has been snapshotted, used by the File menu
+  void saveInBackground();
+
   // returns if a file was saved
   bool saveAs();
 
@@ -310,6 +324,12 @@ class OPENSTUDIO_API OSDocument : public OSQObjectController
   // Used by save and saveAs.
   void setSavePath(const QString& savePath);
 
+  // Snapshots the model and writes it to modelPath on a worker thread, waits for a pending save first.
+  // The document is marked as unmodified on success unless the model changed in the meantime
+  QFuture<bool> startSave(const openstudio::path& modelPath);
+
+  bool waitForSave(QFuture<bool> future);
+
   // When opening an OSM, check the model for a weather file, if a weather file is listed
   // copy it into the temp directory.  If the listed weather file cannot be found, remove the
   // weather file object.  Returns false if the user's weather file is reset, returns true otherwise.
@@ -319,6 +339,15 @@ class OPENSTUDIO_API OSDocument : public OSQObjectController
 
   void createTabButtons();
 
+  // Detach the current tab controller and keep it for later reuse, evicting the least recently used ones
+  void cacheMainTabController();
+
+  // Drops the current and cached tab controllers, the current tab is rebuilt the next time it is selected
+  void clearTabControllerCache();
+
+  // Objects added or removed while a tab is detached may not be reflected by its views, rebuild it next time
+  void markCachedTabControllersDirty(const WorkspaceObject& object, const openstudio::IddObjectType& iddObjectType, const openstudio::UUID& handle);
+
   openstudio::model::Model m_model;
 
   openstudio::model::Model m_compLibrary;
@@ -337,11 +366,21 @@ class OPENSTUDIO_API OSDocument : public OSQObjectController
 
   std::shared_ptr<MainTabController> m_mainTabController;
 
+  // Detached tab controllers, sized by the tabControllerCacheSize and tabControllerCacheMaxWidgets settings
+  std::unique_ptr<TabControllerCache> m_tabControllerCache;
+
   std::shared_ptr<MainRightColumnController> m_mainRightColumnController;
 
   QString m_savePath = QString();
   QString m_modelTempDir = QString();
 
+  QFuture<bool> m_saveFuture;
+
+  QFutureWatcher<bool>* m_saveWatcher;
+
+  // incremented by markAsModified, lets a background save know whether the model changed after its snapshot
+  unsigned m_modificationCount = 0;
+
   int m_mainTabId = 0;
   int m_subTabId = 0;
   bool m_isPlugin;
@@ -36,9 +36,12 @@
 #include <QScrollArea>
 #include <QStyleOption>
 #include <QPaintEvent>
+#include <QShowEvent>
 #include <QPainter>
 #include <QTimer>
 
+#include <algorithm>
+
 namespace openstudio {
 
 OSItemList::OSItemList(OSVectorController* vectorController, bool addScrollArea, QWidget* parent)
@@ -49,7 +52,8 @@ OSItemList::OSItemList(OSVectorController* vectorController, bool addScrollArea,
     m_itemsDraggable(false),
     m_itemsRemoveable(false),
     m_type(OSItemType::ListItem),
-    m_dirty(false) {
+    m_dirty(false),
+    m_initialItemsRequested(false) {
   // for now we will allow this item list to manage memory of
   OS_ASSERT(!m_vectorController->parent());
   m_vectorController->setParent(this);
@@ -98,10 +102,14 @@ OSItemList::OSItemList(OSVectorController* vectorController, bool addScrollArea,
 
   connect(vectorController, &OSVectorController::itemIds, this, &OSItemList::setItemIds);
 
+  connect(vectorController, &OSVectorController::itemIdInserted, this, &OSItemList::insertItemId);
+
+  connect(vectorController, &OSVectorController::itemIdRemoved, this, &OSItemList::removeItemId);
+
   connect(vectorController, &OSVectorController::selectedItemId, this, &OSItemList::selectItemId);
 
   // allow time for OSDocument to finish constructing
-  QTimer::singleShot(0, vectorController, &OSVectorController::reportItems);
+  QTimer::singleShot(0, this, &OSItemList::requestInitialItems);
 }
 
 OSItem* OSItemList::selectedItem() const {
@@ -208,6 +216,56 @@ void OSItemList::setItemIds(const std::vector<OSItemId>& itemIds) {
   QTimer::singleShot(0, this, &OSItemList::refresh);
 }
 
+void OSItemList::insertItemId(int index, const OSItemId& itemId) {
+  OSItem* item = OSItem::makeItem(itemId, OSItemType::ListItem);
+  if (!item) {
+    return;
+  }
+
+  insertItemAtIndex(index, item);
+}
+
+void OSItemList::insertItemAtIndex(int index, OSItem* item) {
+  // addItem inserts at the top, so the layout shows the vector in reverse order, followed by the stretch
+  int numItems = m_vLayout->count() - 1;
+  int position = std::max(0, std::min(numItems, numItems - index));
+
+  insertItem(position, item, false);
+}
+
+void OSItemList::removeItemId(const OSItemId& itemId) {
+  for (int i = 0; i < m_vLayout->count(); ++i) {
+    auto* item = qobject_cast<OSItem*>(m_vLayout->itemAt(i)->widget());
+
+    if (item && item->itemId() == itemId) {
+      bool wasSelected = (item == m_selectedItem);
+      if (wasSelected) {
+        m_selectedItem = nullptr;
+      }
+
+      m_vLayout->removeWidget(item);
+      delete item;
+
+      if (wasSelected) {
+        selectItem(firstItem());
+      }
+
+      m_dirty = true;
+      QTimer::singleShot(0, this, &OSItemList::refresh);
+      return;
+    }
+  }
+}
+
+void OSItemList::requestInitialItems() {
+  // Lists that start out hidden, like the ones of collapsed OSCollapsibleItems in the library panels,
+  // only build their items once they are first shown
+  if (!m_initialItemsRequested && !isHidden()) {
+    m_initialItemsRequested = true;
+    m_vectorController->reportItems();
+  }
+}
+
 void OSItemList::refresh() {
   if (m_dirty) {
     m_dirty = false;
@@ -215,6 +273,10 @@ void OSItemList::refresh() {
 }
 
 void OSItemList::addItem(OSItem* item, bool selectItem) {
+  insertItem(0, item, selectItem);
+}
+
+void OSItemList::insertItem(int position, OSItem* item, bool selectItem) {
   OS_ASSERT(item);
 
   item->setDraggable(m_itemsDraggable);
@@ -229,7 +291,7 @@ void OSItemList::addItem(OSItem* item, bool selectItem) {
 
   connect(item, &OSItem::itemReplacementDropped, this, &OSItemList::itemReplacementDropped);
 
-  m_vLayout->insertWidget(0, item);
+  m_vLayout->insertWidget(position, item);
 
   if (selectItem) {
     this->selectItem(item);
@@ -320,6 +382,14 @@ void OSItemList::paintEvent(QPaintEvent* /*event*/) {
   style()->drawPrimitive(QStyle::PE_Widget, &opt, &p, this);
 }
 
+void OSItemList::showEvent(QShowEvent* event) {
+  OSItemSelector::showEvent(event);
+
+  if (!m_initialItemsRequested) {
+    QTimer::singleShot(0, this, &OSItemList::requestInitialItems);
+  }
+}
+
 OSItemType OSItemList::itemsType() const {
   return m_type;
 }
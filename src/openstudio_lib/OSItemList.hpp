@@ -35,6 +35,8 @@
 
 class QVBoxLayout;
 
+class OpenStudioLibFixture;
+
 namespace openstudio {
 
 class OSItem;
@@ -89,6 +91,12 @@ class OSItemList : public OSItemSelector
 
   void setItemIds(const std::vector<OSItemId>& itemIds);
 
+  void insertItemId(int index, const OSItemId& itemId);
+
+  void removeItemId(const OSItemId& itemId);
+
+  void requestInitialItems();
+
   void refresh();
 
  signals:
@@ -98,7 +106,16 @@ class OSItemList : public OSItemSelector
  protected:
   void paintEvent(QPaintEvent* event) override;
 
+  void showEvent(QShowEvent* event) override;
+
  private:
+  friend class ::OpenStudioLibFixture;
+
+  void insertItem(int position, OSItem* item, bool selectItem);
+
+  // Inserts item where index of the vector reported through itemIds ends up in the layout, does not select it
+  void insertItemAtIndex(int index, OSItem* item);
+
   OSVectorController* m_vectorController;
   QVBoxLayout* m_vLayout;
   OSItem* m_selectedItem;
@@ -106,6 +123,7 @@ class OSItemList : public OSItemSelector
   bool m_itemsRemoveable;
   OSItemType m_type;
   bool m_dirty;
+  bool m_initialItemsRequested;
 };
 
 }  // namespace openstudio
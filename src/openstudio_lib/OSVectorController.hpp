@@ -70,6 +70,12 @@ class OSVectorController
 
   void itemIds(const std::vector<OSItemId>& itemIds);
 
+  // itemId was inserted at index of the vector last reported through itemIds
+  void itemIdInserted(int index, const OSItemId& itemId);
+
+  // itemId was removed from the vector last reported through itemIds
+  void itemIdRemoved(const OSItemId& itemId);
+
   void selectedItemId(const OSItemId& itemId);
 
  protected:
@@ -159,8 +159,8 @@ void RefrigerationSystemMiniView::paint(QPainter* painter, const QStyleOptionGra
 
   painter->drawRect(_headerRect);
 
-  painter->drawText(QRectF(_headerRect.x() + 5, _headerRect.y() + 5, _headerRect.width() - 10, _headerRect.height() - 10),
-                    Qt::AlignVCenter | Qt::AlignLeft, m_name);
+  drawDetailedText(painter, QRectF(_headerRect.x() + 5, _headerRect.y() + 5, _headerRect.width() - 10, _headerRect.height() - 10),
+                   Qt::AlignVCenter | Qt::AlignLeft, m_name);
 }
 
 RefrigerationSystemView::RefrigerationSystemView() : QGraphicsObject() {
@@ -441,21 +441,25 @@ void RefrigerationCasesView::paint(QPainter* painter, const QStyleOptionGraphics
 
   painter->drawRect(_displayCasesRect);
 
-  painter->drawPixmap(_displayCasesRect.x(), _displayCasesRect.y(), m_displayCasesPixmap);
+  drawDetailedPixmap(painter,
+                     QRectF(_displayCasesRect.x(), _displayCasesRect.y(), m_displayCasesPixmap.width(), m_displayCasesPixmap.height()),
+                     m_displayCasesPixmap);
 
-  painter->drawText(QRectF(_displayCasesRect.x() + m_displayCasesPixmap.width(), _displayCasesRect.y(),
-                           _displayCasesRect.width() - m_displayCasesPixmap.width(), _displayCasesRect.height()),
-                    Qt::AlignCenter | Qt::TextWordWrap, QString::number(m_numberOfDisplayCases) + "\n Display Cases");
+  drawDetailedText(painter,
+                   QRectF(_displayCasesRect.x() + m_displayCasesPixmap.width(), _displayCasesRect.y(),
+                          _displayCasesRect.width() - m_displayCasesPixmap.width(), _displayCasesRect.height()),
+                   Qt::AlignCenter | Qt::TextWordWrap, QString::number(m_numberOfDisplayCases) + "\n Display Cases");
 
   QRectF _walkinRect = walkinCasesRect();
 
   painter->drawRect(_walkinRect);
 
-  painter->drawPixmap(_walkinRect.x(), _walkinRect.y(), m_walkinPixmap);
+  drawDetailedPixmap(painter, QRectF(_walkinRect.x(), _walkinRect.y(), m_walkinPixmap.width(), m_walkinPixmap.height()), m_walkinPixmap);
 
-  painter->drawText(
-    QRectF(_walkinRect.x() + m_walkinPixmap.width(), _walkinRect.y(), _walkinRect.width() - m_walkinPixmap.width(), _walkinRect.height()),
-    Qt::AlignCenter | Qt::TextWordWrap, QString::number(m_numberOfWalkinCases) + "\n Walkin Cases");
+  drawDetailedText(painter,
+                   QRectF(_walkinRect.x() + m_walkinPixmap.width(), _walkinRect.y(), _walkinRect.width() - m_walkinPixmap.width(),
+                          _walkinRect.height()),
+                   Qt::AlignCenter | Qt::TextWordWrap, QString::number(m_numberOfWalkinCases) + "\n Walkin Cases");
 }
 
 QRectF RefrigerationCasesView::displayCasesRect() {
@@ -653,11 +657,11 @@ void RefrigerationCaseDetailView::paint(QPainter* painter, const QStyleOptionGra
 
   painter->drawRect(_iconRect);
 
-  painter->drawPixmap(_iconRect.toRect(), m_displayCasesPixmap);
+  drawDetailedPixmap(painter, _iconRect.toRect(), m_displayCasesPixmap);
 
   painter->drawRect(boundingRect());
 
-  painter->drawText(nameRect(), Qt::AlignCenter | Qt::TextWordWrap, m_name);
+  drawDetailedText(painter, nameRect(), Qt::AlignCenter | Qt::TextWordWrap, m_name);
 }
 
 RefrigerationCondenserView::RefrigerationCondenserView() {
@@ -738,7 +742,7 @@ void RefrigerationCondenserView::paint(QPainter* painter, const QStyleOptionGrap
   QRectF _boudingRect = boundingRect();
 
   if (m_id.itemId().isEmpty()) {
-    painter->drawText(_boudingRect, Qt::AlignCenter | Qt::TextWordWrap, "Drop Condenser");
+    drawDetailedText(painter, _boudingRect, Qt::AlignCenter | Qt::TextWordWrap, "Drop Condenser");
 
     painter->drawRoundedRect(_boudingRect, 5, 5);
   } else {
@@ -746,8 +750,9 @@ void RefrigerationCondenserView::paint(QPainter* painter, const QStyleOptionGrap
 
     painter->drawRoundedRect(_boudingRect, 5, 5);
 
-    painter->drawPixmap(_boudingRect.width() / 2.0 - m_pixmap.rect().width() / 2.0, _boudingRect.height() / 2.0 - m_pixmap.rect().height() / 2.0,
-                        m_pixmap);
+    QRectF pixmapRect(m_pixmap.rect());
+    pixmapRect.moveCenter(_boudingRect.center());
+    drawDetailedPixmap(painter, pixmapRect, m_pixmap);
   }
 }
 
@@ -829,10 +834,11 @@ void RefrigerationCompressorDetailView::paint(QPainter* painter, const QStyleOpt
 
   QRectF _boudingRect = boundingRect();
 
-  painter->drawPixmap(_boudingRect.width() / 2.0 - m_pixmap.rect().width() / 2.0, _boudingRect.height() / 2.0 - m_pixmap.rect().height() / 2.0,
-                      m_pixmap);
+  QRectF pixmapRect(m_pixmap.rect());
+  pixmapRect.moveCenter(_boudingRect.center());
+  drawDetailedPixmap(painter, pixmapRect, m_pixmap);
 
-  painter->drawText(boundingRect(), Qt::AlignCenter | Qt::TextWordWrap, m_label);
+  drawDetailedText(painter, boundingRect(), Qt::AlignCenter | Qt::TextWordWrap, m_label);
 }
 
 RefrigerationCompressorDropZoneView::RefrigerationCompressorDropZoneView() = default;
@@ -852,7 +858,7 @@ void RefrigerationCompressorDropZoneView::paint(QPainter* painter, const QStyleO
 
   painter->drawRoundedRect(boundingRect(), 5, 5);
 
-  painter->drawText(boundingRect(), Qt::AlignCenter | Qt::TextWordWrap, "Drag and Drop\nCompressor");
+  drawDetailedText(painter, boundingRect(), Qt::AlignCenter | Qt::TextWordWrap, "Drag and Drop\nCompressor");
 }
 
 double RefrigerationCompressorView::height() {
@@ -939,7 +945,7 @@ void RefrigerationCasesDropZoneView::paint(QPainter* painter, const QStyleOption
 
   painter->drawRoundedRect(boundingRect(), 5, 5);
 
-  painter->drawText(boundingRect(), Qt::AlignCenter | Qt::TextWordWrap, "Drag and Drop\nCases");
+  drawDetailedText(painter, boundingRect(), Qt::AlignCenter | Qt::TextWordWrap, "Drag and Drop\nCases");
 }
 
 RefrigerationSubCoolerView::RefrigerationSubCoolerView()
@@ -970,7 +976,7 @@ void RefrigerationSubCoolerView::paint(QPainter* painter, const QStyleOptionGrap
   QRectF _boudingRect = boundingRect();
 
   if (m_id.itemId().isEmpty()) {
-    painter->drawText(_boudingRect, Qt::AlignCenter | Qt::TextWordWrap, " Drop Mechanical Sub Cooler ");
+    drawDetailedText(painter, _boudingRect, Qt::AlignCenter | Qt::TextWordWrap, " Drop Mechanical Sub Cooler ");
 
     painter->drawRoundedRect(_boudingRect, 5, 5);
   } else {
@@ -978,8 +984,9 @@ void RefrigerationSubCoolerView::paint(QPainter* painter, const QStyleOptionGrap
 
     painter->drawRoundedRect(_boudingRect, 5, 5);
 
-    painter->drawPixmap(_boudingRect.width() / 2.0 - m_pixmap.rect().width() / 2.0, _boudingRect.height() / 2.0 - m_pixmap.rect().height() / 2.0,
-                        m_pixmap);
+    QRectF pixmapRect(m_pixmap.rect());
+    pixmapRect.moveCenter(_boudingRect.center());
+    drawDetailedPixmap(painter, pixmapRect, m_pixmap);
   }
 }
 
@@ -1046,7 +1053,7 @@ void RefrigerationHeatReclaimView::paint(QPainter* painter, const QStyleOptionGr
 
   painter->drawRect(boundingRect());
 
-  painter->drawText(boundingRect(), Qt::AlignCenter, "Heat Reclaim");
+  drawDetailedText(painter, boundingRect(), Qt::AlignCenter, "Heat Reclaim");
 }
 
 QRectF RefrigerationHeatReclaimView::boundingRect() const {
@@ -1065,7 +1072,7 @@ void RefrigerationSHXView::paint(QPainter* painter, const QStyleOptionGraphicsIt
   QRectF _boudingRect = boundingRect();
 
   if (m_id.itemId().isEmpty()) {
-    painter->drawText(_boudingRect, Qt::AlignCenter | Qt::TextWordWrap, " Drop Liquid Suction HX ");
+    drawDetailedText(painter, _boudingRect, Qt::AlignCenter | Qt::TextWordWrap, " Drop Liquid Suction HX ");
 
     painter->drawRoundedRect(_boudingRect, 5, 5);
   } else {
@@ -1073,8 +1080,9 @@ void RefrigerationSHXView::paint(QPainter* painter, const QStyleOptionGraphicsIt
 
     painter->drawRoundedRect(_boudingRect, 5, 5);
 
-    painter->drawPixmap(_boudingRect.width() / 2.0 - m_pixmap.rect().width() / 2.0, _boudingRect.height() / 2.0 - m_pixmap.rect().height() / 2.0,
-                        m_pixmap);
+    QRectF pixmapRect(m_pixmap.rect());
+    pixmapRect.moveCenter(_boudingRect.center());
+    drawDetailedPixmap(painter, pixmapRect, m_pixmap);
   }
 }
 
@@ -1161,7 +1169,7 @@ void SecondaryDropZoneView::paint(QPainter* painter, const QStyleOptionGraphicsI
 
   painter->drawRoundedRect(boundingRect(), 5, 5);
 
-  painter->drawText(boundingRect(), Qt::AlignCenter | Qt::TextWordWrap, "Add Cascade or Secondary System");
+  drawDetailedText(painter, boundingRect(), Qt::AlignCenter | Qt::TextWordWrap, "Add Cascade or Secondary System");
 }
 
 SecondaryDetailView::SecondaryDetailView() : QGraphicsObject() {
@@ -1222,7 +1230,7 @@ void SecondaryDetailView::paint(QPainter* painter, const QStyleOptionGraphicsIte
   painter->setPen(QPen(Qt::black, 2, Qt::SolidLine, Qt::RoundCap));
 
   painter->drawRect(boundingRect());
-  painter->drawText(nameRect(), Qt::AlignCenter | Qt::TextWordWrap, m_name);
+  drawDetailedText(painter, nameRect(), Qt::AlignCenter | Qt::TextWordWrap, m_name);
 }
 
 RefrigerationSecondaryView::RefrigerationSecondaryView() : QGraphicsObject() {
@@ -1294,7 +1302,7 @@ void RefrigerationSystemDropZoneView::paint(QPainter* painter, const QStyleOptio
   font.setPixelSize(24);
   painter->setFont(font);
   painter->setPen(QPen(QColor(109, 109, 109), 2, Qt::DashLine, Qt::RoundCap));
-  painter->drawText(boundingRect(), Qt::AlignCenter | Qt::TextWordWrap, "Drop Refrigeration System");
+  drawDetailedText(painter, boundingRect(), Qt::AlignCenter | Qt::TextWordWrap, "Drop Refrigeration System");
 }
 
 RefrigerationSystemDetailView::RefrigerationSystemDetailView() : QGraphicsObject() {
@@ -1331,9 +1339,9 @@ void CaseViewExpandButton::paint(QPainter* painter, const QStyleOptionGraphicsIt
   QRect rect(0, 0, size().width(), size().height());
 
   if (m_checked) {
-    painter->drawPixmap(rect, m_closeImage);
+    drawDetailedPixmap(painter, rect, m_closeImage);
   } else {
-    painter->drawPixmap(rect, m_openImage);
+    drawDetailedPixmap(painter, rect, m_openImage);
   }
 }
 
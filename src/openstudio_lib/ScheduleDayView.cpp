@@ -51,7 +51,6 @@
 #include <openstudio/utilities/units/QuantityConverter.hpp>
 #include <openstudio/utilities/units/Quantity.hpp>
 #include <openstudio/utilities/units/OSOptionalQuantity.hpp>
-#include <openstudio/utilities/units/OSQuantityVector.hpp>
 
 #include <openstudio/utilities/core/Assert.hpp>
 
@@ -887,13 +886,9 @@ void CalendarSegmentItem::splitSegment(double splitTime) {
 
   VCalendarSegmentItem* oldNextVCalendarItem = this->nextVCalendarItem();
 
-  auto* item = new CalendarSegmentItem;
+  CalendarSegmentItem* item = scene()->acquireSegmentItem();
 
-  scene()->addItem(item);
-
-  auto* vitem = new VCalendarSegmentItem;
-
-  scene()->addItem(vitem);
+  VCalendarSegmentItem* vitem = scene()->acquireVSegmentItem();
 
   vitem->setPreviousCalendarItem(this);
 
@@ -994,7 +989,13 @@ void CalendarSegmentItem::setValue(double value) {
   setToolTip(tooltip);
 }
 
-VCalendarSegmentItem::VCalendarSegmentItem(QGraphicsItem* parent) : QGraphicsItem(parent), m_isHovering(false) {
+VCalendarSegmentItem::VCalendarSegmentItem(QGraphicsItem* parent)
+  : QGraphicsItem(parent),
+    m_mouseDown(false),
+    m_isHovering(false),
+    m_length(0.0),
+    m_nextCalendarItem(nullptr),
+    m_previousCalendarItem(nullptr) {
   setAcceptHoverEvents(true);
 
   setToolTip("Double click to delete segment");
@@ -1149,9 +1150,11 @@ void VCalendarSegmentItem::remove() {
 
   item->setEndTime(oldNextItem->endTime());
 
-  delete oldNextItem;
+  DayScheduleScene* scene_ = scene();
 
-  delete this;
+  scene_->recycleSegmentItem(oldNextItem);
+
+  scene_->recycleVSegmentItem(this);
 }
 
 double VCalendarSegmentItem::time() const {
@@ -1734,7 +1737,10 @@ DayScheduleScene::DayScheduleScene(ScheduleDayView* scheduleDayView, const model
     m_lowerScheduleTypeLimitItem(nullptr),
     m_scheduleDayView(scheduleDayView),
     m_scheduleDay(scheduleDay),
-    m_dirty(true) {
+    m_dirty(true),
+    m_tooltipLowerViewLimit(0.0),
+    m_tooltipUpperViewLimit(0.0),
+    m_tooltipIsIP(false) {
   setSceneRect(0, 0, SCENEWIDTH, SCENEHEIGHT);
 
   m_scheduleDay.getImpl<model::detail::ScheduleDay_Impl>()->onChange.connect<DayScheduleScene, &DayScheduleScene::scheduleRefresh>(this);
@@ -1755,34 +1761,36 @@ void DayScheduleScene::scheduleRefresh() {
 
 void DayScheduleScene::refresh() {
   if (m_dirty) {
-    clearSegments();
-
     std::vector<openstudio::Time> times = m_scheduleDay.times();
 
     // Get the values as is
     std::vector<double> realvalues = m_scheduleDay.values();
 
+    bool isIP = m_scheduleDayView->schedulesView()->isIP();
+
     // Now, if we need and can convert, we do it
     if (boost::optional<model::ScheduleTypeLimits> _scheduleTypeLimits = m_scheduleDay.scheduleTypeLimits()) {
 
       // Get as SI units for potential conversion
       boost::optional<Unit> _siUnits = _scheduleTypeLimits->units(false);
 
-      bool isIP = m_scheduleDayView->schedulesView()->isIP();
       // Get as target units (depends on m_isIP)
       boost::optional<Unit> _toUnits = _scheduleTypeLimits->units(isIP);
 
       if (isIP && (_siUnits.get() != _toUnits.get())) {
-        OSQuantityVector quantities(_toUnits.get());
-        for (const auto& value : m_scheduleDay.values()) {
-          // Do conversion:
-          Quantity q = openstudio::Quantity(value, _siUnits.get());
-          OptionalQuantity result = openstudio::convert(q, _toUnits.get());
+        // Unit conversions are affine (a scale, plus an offset for temperatures), so two conversions give the factor for every value
+        auto convertValue = [&](double value) {
+          OptionalQuantity result = openstudio::convert(openstudio::Quantity(value, _siUnits.get()), _toUnits.get());
           OS_ASSERT(result);
-          quantities.push_back(result.get());
-        }
+          return result->value();
+        };
+
+        const double offset = convertValue(0.0);
+        const double factor = convertValue(1.0) - offset;
 
-        realvalues = quantities.values();
+        for (auto& value : realvalues) {
+          value = offset + factor * value;
+        }
       }
     }
 
@@ -1801,6 +1809,13 @@ void DayScheduleScene::refresh() {
     double upperViewLimit = m_scheduleDayView->upperViewLimit();
     double lowerViewLimit = m_scheduleDayView->lowerViewLimit();
 
+    // Segment tooltips are built from the view limits and units, when those move every segment has to be refreshed
+    bool tooltipsChanged =
+      (m_tooltipLowerViewLimit != lowerViewLimit) || (m_tooltipUpperViewLimit != upperViewLimit) || (m_tooltipIsIP != isIP);
+    m_tooltipLowerViewLimit = lowerViewLimit;
+    m_tooltipUpperViewLimit = upperViewLimit;
+    m_tooltipIsIP = isIP;
+
     // if maxvalue > upperViewLimit then upperViewLimit will be reset
     if (maxvalue > upperViewLimit) {
       upperViewLimit = maxvalue;  // + 0.05 * (maxvalue - minvalue);
@@ -1811,62 +1826,88 @@ void DayScheduleScene::refresh() {
       lowerViewLimit = minvalue;  // - 0.05 * (maxvalue - minvalue);
     }
 
-    if (upperTypeLimit) {
-      double scaledValue = (*upperTypeLimit - lowerViewLimit) / (upperViewLimit - lowerViewLimit);
-      if (scaledValue > 0.0 && scaledValue < 1.0) {
-        m_upperScheduleTypeLimitItem = new ScheduleTypeLimitItem(true);
-        addItem(m_upperScheduleTypeLimitItem);
-        m_upperScheduleTypeLimitItem->setValue(scaledValue);
-      }
+    updateTypeLimitItem(m_upperScheduleTypeLimitItem, true, upperTypeLimit, lowerViewLimit, upperViewLimit);
+    updateTypeLimitItem(m_lowerScheduleTypeLimitItem, false, lowerTypeLimit, lowerViewLimit, upperViewLimit);
+
+    // Reconcile the existing chain of segments with the schedule, only touching the segments whose times or values changed
+    std::vector<CalendarSegmentItem*> currentSegments = segments();
+
+    for (size_t i = times.size(); i < currentSegments.size(); ++i) {
+      recycleVSegmentItem(currentSegments[i]->previousVCalendarItem());
+      recycleSegmentItem(currentSegments[i]);
     }
 
-    if (lowerTypeLimit) {
-      double scaledValue = (*lowerTypeLimit - lowerViewLimit) / (upperViewLimit - lowerViewLimit);
-      if (scaledValue > 0.0 && scaledValue < 1.0) {
-        m_lowerScheduleTypeLimitItem = new ScheduleTypeLimitItem(false);
-        addItem(m_lowerScheduleTypeLimitItem);
-        m_lowerScheduleTypeLimitItem->setValue(scaledValue);
+    if (currentSegments.size() > times.size()) {
+      currentSegments.resize(times.size());
+      if (!currentSegments.empty()) {
+        currentSegments.back()->setNextVCalendarItem(nullptr);
       }
     }
 
-    int i = 0;
     double lastTime = 0.0;
+    bool previousSegmentMoved = false;
     CalendarSegmentItem* previousSegment = nullptr;
 
-    for (auto it = times.begin(); it < times.end(); ++it) {
+    for (size_t i = 0; i < times.size(); ++i) {
       bool isOutOfTypeLimits = (upperTypeLimit && (realvalues[i] > *upperTypeLimit)) || (lowerTypeLimit && (realvalues[i] < *lowerTypeLimit));
 
       double scaledValue = (realvalues[i] - lowerViewLimit) / (upperViewLimit - lowerViewLimit);
 
-      auto* segment = new CalendarSegmentItem();
-      addItem(segment);
-      segment->setValue(scaledValue);
-      segment->setIsOutOfTypeLimits(isOutOfTypeLimits);
-      segment->setStartTime(lastTime);
-      double time = it->totalSeconds();
-      segment->setEndTime(time);
+      double time = times[i].totalSeconds();
 
-      if (previousSegment) {
-        auto* vSegment = new VCalendarSegmentItem();
-        addItem(vSegment);
+      bool isNew = i >= currentSegments.size();
 
-        segment->setPreviousVCalendarItem(vSegment);
-        vSegment->setNextCalendarItem(segment);
-        vSegment->setPreviousCalendarItem(previousSegment);
-        previousSegment->setNextVCalendarItem(vSegment);
+      CalendarSegmentItem* segment = nullptr;
 
-        vSegment->setTime(lastTime);
+      if (isNew) {
+        segment = acquireSegmentItem();
 
-        vSegment->updateLength();
+        if (previousSegment) {
+          VCalendarSegmentItem* vSegment = acquireVSegmentItem();
+
+          segment->setPreviousVCalendarItem(vSegment);
+          vSegment->setNextCalendarItem(segment);
+          vSegment->setPreviousCalendarItem(previousSegment);
+          previousSegment->setNextVCalendarItem(vSegment);
+        } else {
+          m_firstSegment = segment;
+        }
       } else {
-        m_firstSegment = segment;
+        segment = currentSegments[i];
+      }
+
+      bool startTimeChanged = isNew || (segment->startTime() != lastTime);
+      if (startTimeChanged) {
+        segment->setStartTime(lastTime);
+      }
+
+      if (isNew || (segment->endTime() != time)) {
+        segment->setEndTime(time);
+      }
+
+      bool segmentMoved = isNew || tooltipsChanged || (std::abs(segment->value() - scaledValue) > 1.0e-9);
+      if (segmentMoved) {
+        segment->setValue(scaledValue);
+      }
+
+      if (isNew || (segment->isOutOfTypeLimits() != isOutOfTypeLimits)) {
+        segment->setIsOutOfTypeLimits(isOutOfTypeLimits);
+        segment->update();
+      }
+
+      if (VCalendarSegmentItem* vSegment = segment->previousVCalendarItem()) {
+        if (startTimeChanged || segmentMoved || previousSegmentMoved) {
+          vSegment->setTime(lastTime);
+
+          vSegment->updateLength();
+        }
       }
 
       previousSegment = segment;
 
-      lastTime = time;
+      previousSegmentMoved = segmentMoved;
 
-      i++;
+      lastTime = time;
     }
 
     m_scheduleDayView->update();
@@ -1875,6 +1916,26 @@ void DayScheduleScene::refresh() {
   }
 }
 
+void DayScheduleScene::updateTypeLimitItem(ScheduleTypeLimitItem*& item, bool isUpperLimit, const boost::optional<double>& typeLimit,
+                                           double lowerViewLimit, double upperViewLimit) {
+  if (typeLimit) {
+    double scaledValue = (*typeLimit - lowerViewLimit) / (upperViewLimit - lowerViewLimit);
+    if (scaledValue > 0.0 && scaledValue < 1.0) {
+      if (!item) {
+        item = new ScheduleTypeLimitItem(isUpperLimit);
+        addItem(item);
+      }
+      item->setValue(scaledValue);
+      item->show();
+      return;
+    }
+  }
+
+  if (item) {
+    item->hide();
+  }
+}
+
 ScheduleDayView* DayScheduleScene::scheduleDayView() const {
   return m_scheduleDayView;
 }
@@ -1914,13 +1975,9 @@ CalendarSegmentItem* DayScheduleScene::addSegment(double untilTime) {
 
   VCalendarSegmentItem* prevVCalendarItem = segment->previousVCalendarItem();
 
-  auto* item = new CalendarSegmentItem;
+  CalendarSegmentItem* item = acquireSegmentItem();
 
-  addItem(item);
-
-  auto* vitem = new VCalendarSegmentItem;
-
-  addItem(vitem);
+  VCalendarSegmentItem* vitem = acquireVSegmentItem();
 
   vitem->setPreviousCalendarItem(item);
 
@@ -1955,17 +2012,81 @@ CalendarSegmentItem* DayScheduleScene::addSegment(double untilTime) {
 
 void DayScheduleScene::clearSegments() {
   for (auto* const segment : segments()) {
-    delete segment->nextVCalendarItem();
-    delete segment;
+    if (VCalendarSegmentItem* vSegment = segment->nextVCalendarItem()) {
+      recycleVSegmentItem(vSegment);
+    }
+    recycleSegmentItem(segment);
   }
 
   m_firstSegment = nullptr;
 
-  delete m_upperScheduleTypeLimitItem;
-  m_upperScheduleTypeLimitItem = nullptr;
+  if (m_upperScheduleTypeLimitItem) {
+    m_upperScheduleTypeLimitItem->hide();
+  }
+
+  if (m_lowerScheduleTypeLimitItem) {
+    m_lowerScheduleTypeLimitItem->hide();
+  }
+}
+
+CalendarSegmentItem* DayScheduleScene::acquireSegmentItem() {
+  CalendarSegmentItem* item = nullptr;
+
+  if (m_segmentPool.empty()) {
+    item = new CalendarSegmentItem();
+    addItem(item);
+  } else {
+    item = m_segmentPool.back();
+    m_segmentPool.pop_back();
+    item->show();
+  }
+
+  return item;
+}
+
+VCalendarSegmentItem* DayScheduleScene::acquireVSegmentItem() {
+  VCalendarSegmentItem* item = nullptr;
+
+  if (m_vSegmentPool.empty()) {
+    item = new VCalendarSegmentItem();
+    addItem(item);
+  } else {
+    item = m_vSegmentPool.back();
+    m_vSegmentPool.pop_back();
+    item->show();
+  }
+
+  return item;
+}
+
+void DayScheduleScene::recycleSegmentItem(CalendarSegmentItem* item) {
+  OS_ASSERT(item);
+
+  // The item stays owned by the scene, it is only hidden and unlinked until acquireSegmentItem hands it out again
+  item->hide();
+  item->setPreviousVCalendarItem(nullptr);
+  item->setNextVCalendarItem(nullptr);
+  item->m_isHovering = false;
+  item->m_mouseDown = false;
+  item->m_isOutOfTypeLimits = false;
+
+  if (item == m_firstSegment) {
+    m_firstSegment = nullptr;
+  }
+
+  m_segmentPool.push_back(item);
+}
+
+void DayScheduleScene::recycleVSegmentItem(VCalendarSegmentItem* item) {
+  OS_ASSERT(item);
+
+  item->hide();
+  item->setPreviousCalendarItem(nullptr);
+  item->setNextCalendarItem(nullptr);
+  item->m_isHovering = false;
+  item->m_mouseDown = false;
 
-  delete m_lowerScheduleTypeLimitItem;
-  m_lowerScheduleTypeLimitItem = nullptr;
+  m_vSegmentPool.push_back(item);
 }
 
 std::vector<CalendarSegmentItem*> DayScheduleScene::segments() const {
@@ -323,6 +323,15 @@ class DayScheduleScene
 
   QGraphicsItem* segmentAt(double x, double y, double zoom) const;
 
+  // Segment items are pooled by the scene, take new ones here and hand unlinked ones back instead of deleting them
+  CalendarSegmentItem* acquireSegmentItem();
+
+  VCalendarSegmentItem* acquireVSegmentItem();
+
+  void recycleSegmentItem(CalendarSegmentItem* item);
+
+  void recycleVSegmentItem(VCalendarSegmentItem* item);
+
  public slots:
 
   void scheduleRefresh();
@@ -332,8 +341,15 @@ class DayScheduleScene
   void refresh();
 
  private:
+  void updateTypeLimitItem(ScheduleTypeLimitItem*& item, bool isUpperLimit, const boost::optional<double>& typeLimit, double lowerViewLimit,
+                           double upperViewLimit);
+
   CalendarSegmentItem* m_firstSegment;
 
+  std::vector<CalendarSegmentItem*> m_segmentPool;
+
+  std::vector<VCalendarSegmentItem*> m_vSegmentPool;
+
   ScheduleTypeLimitItem* m_upperScheduleTypeLimitItem;
 
   ScheduleTypeLimitItem* m_lowerScheduleTypeLimitItem;
@@ -343,6 +359,13 @@ class DayScheduleScene
   model::ScheduleDay m_scheduleDay;
 
   bool m_dirty;
+
+  // View state the segment tooltips were last built against, a change forces every segment to be refreshed
+  double m_tooltipLowerViewLimit;
+
+  double m_tooltipUpperViewLimit;
+
+  bool m_tooltipIsIP;
 };
 
 class DaySchedulePlotArea : public QGraphicsView
@@ -493,6 +516,8 @@ class VCalendarSegmentItem : public QGraphicsItem
   CalendarSegmentItem* m_previousCalendarItem;
 
   friend class DaySchedulePlotArea;
+
+  friend class DayScheduleScene;
 };
 
 class CalendarSegmentItem : public QGraphicsItem
@@ -563,6 +588,8 @@ class CalendarSegmentItem : public QGraphicsItem
   bool m_isOutOfTypeLimits;
 
   friend class DaySchedulePlotArea;
+
+  friend class DayScheduleScene;
 };
 
 class ScheduleTypeLimitItem : public QGraphicsItem
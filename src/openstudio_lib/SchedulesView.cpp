@@ -70,8 +70,10 @@
 #include <QPainter>
 #include <QPushButton>
 #include <QRadioButton>
+#include <QListView>
 #include <QResizeEvent>
 #include <QScrollArea>
+#include <QScrollBar>
 #include <QStackedWidget>
 #include <QString>
 #include <QStyleOption>
@@ -111,7 +113,13 @@ std::vector<QColor> SchedulesView::initializeColors() {
 }
 
 SchedulesView::SchedulesView(bool isIP, const model::Model& model)
-  : m_model(model), m_leftVLayout(new QVBoxLayout()), m_contentLayout(new QHBoxLayout()), m_isIP(isIP) {
+  : m_model(model),
+    m_scheduleListModel(new ScheduleListModel(this)),
+    m_scheduleTabDelegate(nullptr),
+    m_scheduleListView(new QListView()),
+    m_contentLayout(new QHBoxLayout()),
+    m_isIP(isIP),
+    m_visibleTabsDirty(false) {
   setObjectName("GrayWidgetWithLeftTopBorders");
 
   auto* mainHLayout = new QHBoxLayout();
@@ -119,12 +127,27 @@ SchedulesView::SchedulesView(bool isIP, const model::Model& model)
   mainHLayout->setSpacing(0);
   setLayout(mainHLayout);
 
-  auto* leftScrollArea = new QScrollArea();
-  leftScrollArea->setFrameStyle(QFrame::NoFrame);
+  m_scheduleTabDelegate = new ScheduleTabDelegate(m_scheduleListView);
+  m_scheduleListView->setModel(m_scheduleListModel);
+  m_scheduleListView->setItemDelegate(m_scheduleTabDelegate);
+  m_scheduleListView->setFrameStyle(QFrame::NoFrame);
+  m_scheduleListView->setObjectName("GrayWidget");
+  m_scheduleListView->setSelectionMode(QAbstractItemView::NoSelection);
+  m_scheduleListView->setVerticalScrollMode(QAbstractItemView::ScrollPerPixel);
+  m_scheduleListView->setHorizontalScrollBarPolicy(Qt::ScrollBarAlwaysOff);
+
+  // Clicks only reach the view for rows whose ScheduleTab has not been created yet
+  connect(m_scheduleListView, &QListView::clicked, this,
+          [this](const QModelIndex& index) { setCurrentSchedule(m_scheduleListModel->schedule(index.row())); });
+
+  connect(m_scheduleListView->verticalScrollBar(), &QScrollBar::valueChanged, this, &SchedulesView::scheduleVisibleTabsUpdate);
+  connect(m_scheduleListModel, &ScheduleListModel::rowsInserted, this, &SchedulesView::scheduleVisibleTabsUpdate);
+  connect(m_scheduleListModel, &ScheduleListModel::rowsRemoved, this, &SchedulesView::scheduleVisibleTabsUpdate);
+  connect(m_scheduleListModel, &ScheduleListModel::modelReset, this, &SchedulesView::scheduleVisibleTabsUpdate);
 
   auto* outerLeftVLayout = new QVBoxLayout();
   outerLeftVLayout->setContentsMargins(0, 0, 0, 0);
-  outerLeftVLayout->addWidget(leftScrollArea, 10);
+  outerLeftVLayout->addWidget(m_scheduleListView, 10);
   outerLeftVLayout->addStretch();
 
   auto* selectorButtons = new OSItemSelectorButtons();
@@ -156,16 +179,6 @@ SchedulesView::SchedulesView(bool isIP, const model::Model& model)
   vLine->setFixedWidth(2);
   mainHLayout->addWidget(vLine);
 
-  auto* leftScrollWidget = new QWidget();
-  leftScrollArea->setWidget(leftScrollWidget);
-  leftScrollArea->setWidgetResizable(true);
-  leftScrollWidget->setObjectName("GrayWidget");
-
-  m_leftVLayout->setContentsMargins(0, 0, 0, 0);
-  m_leftVLayout->setSpacing(0);
-  m_leftVLayout->addStretch();
-  leftScrollWidget->setLayout(m_leftVLayout);
-
   m_contentLayout->setContentsMargins(0, 0, 0, 0);
   mainHLayout->addLayout(m_contentLayout, 100);
 
@@ -183,73 +196,134 @@ SchedulesView::SchedulesView(bool isIP, const model::Model& model)
 
   showEmptyPage();
 
-  for (auto it = schedules.begin(); it < schedules.end(); ++it) {
-    addSchedule(*it);
+  // Schedules used to be inserted one by one at the top, so the list shows them in reverse
+  m_scheduleListModel->setSchedules(std::vector<model::ScheduleRuleset>(schedules.rbegin(), schedules.rend()));
 
-    std::vector<model::ScheduleRule> rules = it->scheduleRules();
+  if (!schedules.empty()) {
+    setCurrentSchedule(schedules.back());
+  }
+}
 
-    for (auto ruleIt = rules.begin(); ruleIt < rules.end(); ++ruleIt) {
-      addScheduleRule(*ruleIt);
+void SchedulesView::closeAllTabs() const {
+  for (const auto& index : m_materializedIndexes) {
+    if (auto* scheduleTab = qobject_cast<ScheduleTab*>(m_scheduleListView->indexWidget(index))) {
+      scheduleTab->scheduleTabContent()->hide();
     }
   }
+}
 
-  updateRowColors();
+ScheduleTab* SchedulesView::tabForSchedule(const model::ScheduleRuleset& schedule) const {
+  int row = m_scheduleListModel->rowForHandle(schedule.handle());
 
-  if (!schedules.empty()) {
-    setCurrentSchedule(schedules.back());
+  if (row > -1) {
+    return qobject_cast<ScheduleTab*>(m_scheduleListView->indexWidget(m_scheduleListModel->index(row)));
   }
+
+  return nullptr;
 }
 
-void SchedulesView::closeAllTabs() const {
-  for (int i = 0; i < m_leftVLayout->count() - 1; i++) {
-    auto* scheduleTab = qobject_cast<ScheduleTab*>(m_leftVLayout->itemAt(i)->widget());
+std::shared_ptr<ScheduleRuleActivity> SchedulesView::ruleActivity(const model::ScheduleRuleset& schedule) {
+  std::shared_ptr<ScheduleRuleActivity>& result = m_ruleActivities[schedule.handle()];
 
-    scheduleTab->scheduleTabContent()->hide();
+  if (!result) {
+    result = std::make_shared<ScheduleRuleActivity>(schedule);
   }
+
+  return result;
 }
 
-ScheduleTab* SchedulesView::tabForSchedule(const model::ScheduleRuleset& schedule) const {
-  for (int i = 0; i < m_leftVLayout->count() - 1; i++) {
-    auto* scheduleTab = qobject_cast<ScheduleTab*>(m_leftVLayout->itemAt(i)->widget());
+ScheduleTab* SchedulesView::materializeTab(const QModelIndex& index) {
+  if (auto* scheduleTab = qobject_cast<ScheduleTab*>(m_scheduleListView->indexWidget(index))) {
+    return scheduleTab;
+  }
 
-    if (scheduleTab->schedule().handle() == schedule.handle()) {
-      return scheduleTab;
+  model::ScheduleRuleset schedule = m_scheduleListModel->schedule(index.row());
+
+  auto* scheduleTab = new ScheduleTab(schedule, this);
+  connect(scheduleTab, &ScheduleTab::scheduleClicked, this, &SchedulesView::setCurrentSchedule);
+
+  QPersistentModelIndex persistentIndex(index);
+  connect(scheduleTab, &ScheduleTab::layoutChanged, this, [this, scheduleTab, persistentIndex, lastHeight = -1]() mutable {
+    int height = scheduleTab->sizeHint().height();
+    if (persistentIndex.isValid() && (height != lastHeight)) {
+      lastHeight = height;
+      emit m_scheduleTabDelegate->sizeHintChanged(persistentIndex);
     }
+  });
+
+  // Rules added after this point are routed to the tab by addScheduleRule
+  for (auto& rule : schedule.scheduleRules()) {
+    rule.getImpl<model::detail::ScheduleRule_Impl>()->onRemoveFromWorkspace.connect<ScheduleTabContent, &ScheduleTabContent::scheduleRefresh>(
+      scheduleTab->scheduleTabContent());
   }
+  scheduleTab->scheduleTabContent()->scheduleRefresh(schedule.handle());  // Handle as dummy
 
-  return nullptr;
+  m_scheduleListView->setIndexWidget(index, scheduleTab);
+  m_materializedIndexes.push_back(persistentIndex);
+
+  return scheduleTab;
 }
 
-void SchedulesView::updateRowColors() {
-  QString evenStyle;
-  evenStyle.append("QWidget#ThermalZoneTab {");
-  evenStyle.append("background: #F2F2F2; ");
-  evenStyle.append("border-bottom: 1px solid black; ");
-  evenStyle.append("}");
-  evenStyle.append("QWidget#SideBar {background: #DEDEDE;}");
+void SchedulesView::scheduleVisibleTabsUpdate() {
+  if (!m_visibleTabsDirty) {
+    m_visibleTabsDirty = true;
 
-  QString oddStyle;
-  oddStyle.append("QWidget#ThermalZoneTab {");
-  oddStyle.append("background: #E6E6E6; ");
-  oddStyle.append("border-bottom: 1px solid black; ");
-  oddStyle.append("}");
-  oddStyle.append("QWidget#SideBar {background: #CECECE;}");
+    QTimer::singleShot(0, this, &SchedulesView::updateVisibleTabs);
+  }
+}
 
-  for (int i = 0; i < m_leftVLayout->count() - 1; i++) {
-    auto* scheduleTab = qobject_cast<ScheduleTab*>(m_leftVLayout->itemAt(i)->widget());
+void SchedulesView::updateVisibleTabs() {
+  if (!m_visibleTabsDirty) {
+    return;
+  }
 
-    if (i % 2 == 0) {
-      scheduleTab->setStyleSheet(evenStyle);
+  m_visibleTabsDirty = false;
+
+  const QRect viewportRect = m_scheduleListView->viewport()->rect();
+
+  // Keep a viewport worth of tabs on either side so small scrolls do not recreate widgets
+  const QRect keepRect = viewportRect.adjusted(0, -viewportRect.height(), 0, viewportRect.height());
+
+  std::vector<QPersistentModelIndex> keptIndexes;
+  for (const auto& index : m_materializedIndexes) {
+    if (!index.isValid()) {
+      continue;
+    }
+
+    // The selected tab is never released, it holds the expanded state
+    bool isCurrent = m_currentScheduleHandle && (m_scheduleListModel->schedule(index.row()).handle() == *m_currentScheduleHandle);
+
+    if (isCurrent || m_scheduleListView->visualRect(index).intersects(keepRect)) {
+      keptIndexes.push_back(index);
+    } else {
+      m_scheduleListView->setIndexWidget(index, nullptr);
+    }
+  }
+  m_materializedIndexes = keptIndexes;
+
+  // Rows are laid out top to bottom, find the first one reaching into the viewport
+  int first = 0;
+  int last = m_scheduleListModel->rowCount();
+  while (first < last) {
+    int middle = first + (last - first) / 2;
+    if (m_scheduleListView->visualRect(m_scheduleListModel->index(middle)).bottom() < viewportRect.top()) {
+      first = middle + 1;
     } else {
-      scheduleTab->setStyleSheet(oddStyle);
+      last = middle;
     }
   }
+
+  for (int row = first; row < m_scheduleListModel->rowCount(); ++row) {
+    QModelIndex index = m_scheduleListModel->index(row);
+    if (m_scheduleListView->visualRect(index).top() > viewportRect.bottom()) {
+      break;
+    }
+    materializeTab(index);
+  }
 }
 
 void SchedulesView::addSchedule(const model::ScheduleRuleset& schedule) {
-  auto* scheduleTab = new ScheduleTab(schedule, this);
-  connect(scheduleTab, &ScheduleTab::scheduleClicked, this, &SchedulesView::setCurrentSchedule);
-  m_leftVLayout->insertWidget(0, scheduleTab);
+  m_scheduleListModel->insertSchedule(0, schedule);
 }
 
 void SchedulesView::addScheduleRule(model::ScheduleRule& scheduleRule) {
@@ -287,38 +361,36 @@ void SchedulesView::onModelObjectAdded(std::shared_ptr<openstudio::detail::Works
 void SchedulesView::onModelObjectRemoved(std::shared_ptr<openstudio::detail::WorkspaceObject_Impl> /*workspaceObjectImpl*/,
                                          const openstudio::IddObjectType& iddObjectType, const openstudio::UUID& uuid) {
   if (iddObjectType == IddObjectType::OS_Schedule_Ruleset) {
-    int removedIndex = -1;
+    m_ruleActivities.erase(uuid);
+
+    int removedIndex = m_scheduleListModel->rowForHandle(uuid);
 
     bool wasSelected = false;
 
-    ScheduleTab* scheduleTab = nullptr;
+    if (removedIndex > -1) {
+      wasSelected = m_currentScheduleHandle && (*m_currentScheduleHandle == uuid);
 
-    for (int i = 0; i < m_leftVLayout->count() - 1; i++) {
-      scheduleTab = qobject_cast<ScheduleTab*>(m_leftVLayout->itemAt(i)->widget());
-      if (scheduleTab->schedule().handle() == uuid) {
-        m_leftVLayout->removeWidget(scheduleTab);
-        wasSelected = scheduleTab->selected();
-        removedIndex = i;
-        delete scheduleTab;
-        break;
-      }
+      // The view releases the row's ScheduleTab, if any
+      m_scheduleListModel->removeSchedule(removedIndex);
     }
 
     if (wasSelected) {
+      m_currentScheduleHandle = boost::none;
+
       int newIndex = -1;
       if (removedIndex > 0) {
         newIndex = removedIndex - 1;
       } else if (removedIndex == 0) {
-        if (m_leftVLayout->count() > 1) {
+        if (m_scheduleListModel->rowCount() > 0) {
           newIndex = 0;
         }
       }
 
       if (newIndex > -1) {
-        scheduleTab = qobject_cast<ScheduleTab*>(m_leftVLayout->itemAt(newIndex)->widget());
+        model::ScheduleRuleset schedule = m_scheduleListModel->schedule(newIndex);
 
-        if (!scheduleTab->schedule().handle().isNull()) {
-          this->setCurrentSchedule(scheduleTab->schedule());
+        if (!schedule.handle().isNull()) {
+          this->setCurrentSchedule(schedule);
         } else {
           this->showEmptyPage();
         }
@@ -330,10 +402,18 @@ void SchedulesView::onModelObjectRemoved(std::shared_ptr<openstudio::detail::Wor
 }
 
 void SchedulesView::setCurrentSchedule(const model::ScheduleRuleset& schedule) {
-  this->updateRowColors();
+  m_currentScheduleHandle = schedule.handle();
 
-  for (int i = 0; i < m_leftVLayout->count() - 1; i++) {
-    auto* scheduleTab = qobject_cast<ScheduleTab*>(m_leftVLayout->itemAt(i)->widget());
+  int row = m_scheduleListModel->rowForHandle(schedule.handle());
+  if (row > -1) {
+    materializeTab(m_scheduleListModel->index(row));
+  }
+
+  for (const auto& index : m_materializedIndexes) {
+    auto* scheduleTab = qobject_cast<ScheduleTab*>(m_scheduleListView->indexWidget(index));
+    if (!scheduleTab) {
+      continue;
+    }
 
     if (scheduleTab->schedule() == schedule) {
       if (!scheduleTab->selected()) {
@@ -352,6 +432,9 @@ void SchedulesView::setCurrentSchedule(const model::ScheduleRuleset& schedule) {
     scheduleTab->update();
   }
 
+  // The previously selected tab may now be out of view
+  scheduleVisibleTabsUpdate();
+
   //showScheduleRuleset(schedule);
 
   // DLM: I don't think that the code below works because it gets called when the scene is not visible
@@ -570,14 +653,13 @@ void SchedulesView::showEmptyPage() {
 }
 
 boost::optional<model::ScheduleRuleset> SchedulesView::currentSchedule() {
-  for (int i = 0; i < m_leftVLayout->count() - 1; i++) {
-    auto* scheduleTab = qobject_cast<ScheduleTab*>(m_leftVLayout->itemAt(i)->widget());
+  if (m_currentScheduleHandle) {
+    int row = m_scheduleListModel->rowForHandle(*m_currentScheduleHandle);
 
-    if (scheduleTab->selected()) {
-      if (boost::optional<model::ScheduleRuleset> schedule = scheduleTab->schedule()) {
-        if (!schedule->handle().isNull()) {
-          return schedule;
-        }
+    if (row > -1) {
+      model::ScheduleRuleset schedule = m_scheduleListModel->schedule(row);
+      if (!schedule.handle().isNull()) {
+        return schedule;
       }
     }
   }
@@ -592,6 +674,12 @@ void SchedulesView::paintEvent(QPaintEvent* /*event*/) {
   style()->drawPrimitive(QStyle::PE_Widget, &opt, &p, this);
 }
 
+void SchedulesView::resizeEvent(QResizeEvent* event) {
+  QWidget::resizeEvent(event);
+
+  scheduleVisibleTabsUpdate();
+}
+
 // ***** SLOTS *****
 
 void SchedulesView::toggleUnits(bool displayIP) {
@@ -602,6 +690,112 @@ bool SchedulesView::isIP() const {
   return m_isIP;
 }
 
+/******************************************************************************/
+// ScheduleListModel
+/******************************************************************************/
+
+ScheduleListModel::ScheduleListModel(QObject* parent) : QAbstractListModel(parent) {}
+
+int ScheduleListModel::rowCount(const QModelIndex& parent) const {
+  if (parent.isValid()) {
+    return 0;
+  }
+
+  return static_cast<int>(m_schedules.size());
+}
+
+QVariant ScheduleListModel::data(const QModelIndex& index, int role) const {
+  if (!index.isValid() || index.row() >= rowCount()) {
+    return {};
+  }
+
+  if (role == Qt::DisplayRole) {
+    return QString::fromStdString(m_schedules[index.row()].nameString());
+  }
+
+  return {};
+}
+
+void ScheduleListModel::setSchedules(const std::vector<model::ScheduleRuleset>& schedules) {
+  beginResetModel();
+  m_schedules = schedules;
+  endResetModel();
+}
+
+void ScheduleListModel::insertSchedule(int row, const model::ScheduleRuleset& schedule) {
+  OS_ASSERT(row >= 0 && row <= rowCount());
+
+  beginInsertRows(QModelIndex(), row, row);
+  m_schedules.insert(m_schedules.begin() + row, schedule);
+  endInsertRows();
+}
+
+void ScheduleListModel::removeSchedule(int row) {
+  OS_ASSERT(row >= 0 && row < rowCount());
+
+  beginRemoveRows(QModelIndex(), row, row);
+  m_schedules.erase(m_schedules.begin() + row);
+  endRemoveRows();
+}
+
+model::ScheduleRuleset ScheduleListModel::schedule(int row) const {
+  OS_ASSERT(row >= 0 && row < rowCount());
+
+  return m_schedules[row];
+}
+
+int ScheduleListModel::rowForHandle(const Handle& handle) const {
+  auto it = std::find_if(m_schedules.begin(), m_schedules.end(),
+                         [&handle](const model::ScheduleRuleset& schedule) { return schedule.handle() == handle; });
+
+  if (it == m_schedules.end()) {
+    return -1;
+  }
+
+  return static_cast<int>(std::distance(m_schedules.begin(), it));
+}
+
+/******************************************************************************/
+// ScheduleTabDelegate
+/******************************************************************************/
+
+// ScheduleTabHeader is fixed at 50px, plus the two 1px separator lines of a collapsed ScheduleTab
+static constexpr int collapsedScheduleTabHeight = 52;
+
+ScheduleTabDelegate::ScheduleTabDelegate(QAbstractItemView* view) : QStyledItemDelegate(view), m_view(view) {}
+
+void ScheduleTabDelegate::paint(QPainter* painter, const QStyleOptionViewItem& option, const QModelIndex& index) const {
+  painter->save();
+
+  // Alternating row and side bar colors, as the per tab stylesheets used to set them
+  const bool even = (index.row() % 2 == 0);
+  const QColor rowColor = even ? QColor(0xF2, 0xF2, 0xF2) : QColor(0xE6, 0xE6, 0xE6);
+  const QColor sideBarColor = even ? QColor(0xDE, 0xDE, 0xDE) : QColor(0xCE, 0xCE, 0xCE);
+
+  painter->fillRect(option.rect, rowColor);
+
+  // ScheduleTabHeader does not fill its background, the side bar color shows through it
+  QRect headerRect(option.rect.left(), option.rect.top(), option.rect.width(), collapsedScheduleTabHeight - 2);
+  painter->fillRect(headerRect, sideBarColor);
+
+  // Stand in for the header until the row's ScheduleTab is created
+  if (!m_view->indexWidget(index)) {
+    painter->setPen(Qt::black);
+    painter->drawText(headerRect.adjusted(5, 5, -21, -5), Qt::AlignLeft | Qt::AlignVCenter | Qt::TextWordWrap, index.data().toString());
+    painter->drawLine(option.rect.left(), option.rect.bottom(), option.rect.right(), option.rect.bottom());
+  }
+
+  painter->restore();
+}
+
+QSize ScheduleTabDelegate::sizeHint(const QStyleOptionViewItem& /*option*/, const QModelIndex& index) const {
+  if (QWidget* widget = m_view->indexWidget(index)) {
+    return {0, widget->sizeHint().height()};
+  }
+
+  return {0, collapsedScheduleTabHeight};
+}
+
 /******************************************************************************/
 // ScheduleTab
 /******************************************************************************/
@@ -680,6 +874,16 @@ bool ScheduleTab::selected() const {
   return m_selected;
 }
 
+bool ScheduleTab::event(QEvent* event) {
+  bool result = QWidget::event(event);
+
+  if (event->type() == QEvent::LayoutRequest) {
+    emit layoutChanged();
+  }
+
+  return result;
+}
+
 //void ScheduleTab::paintEvent ( QPaintEvent * event )
 //{
 //  QStyleOption opt;
@@ -730,13 +934,9 @@ ScheduleTabHeader::ScheduleTabHeader(ScheduleTab* scheduleTab, QWidget* parent)
   mainHLayout->setSpacing(5);
   setLayout(mainHLayout);
 
+  // The background is painted by ScheduleTabDelegate, which alternates it by row
   QString style;
 
-  style.append("QWidget#ScheduleTabHeader { ");
-  style.append("background-color: #CECECE;");
-  style.append("}");
-  setStyleSheet(style);
-
   mainHLayout->addWidget(m_mainLabel, 10);
   m_mainLabel->setWordWrap(true);
   //m_mainLabel->setFixedWidth(120);
@@ -1425,7 +1625,7 @@ DefaultScheduleDayView::DefaultScheduleDayView(bool isIP, const model::ScheduleR
   vLine2->setFixedWidth(2);
   mainHLayout->addWidget(vLine2);
 
-  auto* yearOverview = new YearOverview(scheduleRuleset);
+  auto* yearOverview = new YearOverview(scheduleRuleset, schedulesView->ruleActivity(scheduleRuleset));
   mainHLayout->addWidget(yearOverview);
 }
 
@@ -1705,7 +1905,7 @@ ScheduleRuleView::ScheduleRuleView(bool isIP, const model::ScheduleRule& schedul
   vLine2->setFixedWidth(2);
   mainHLayout->addWidget(vLine2);
 
-  auto* yearOverview = new YearOverview(m_scheduleRule.scheduleRuleset());
+  auto* yearOverview = new YearOverview(m_scheduleRule.scheduleRuleset(), m_schedulesView->ruleActivity(m_scheduleRule.scheduleRuleset()));
   mainHLayout->addWidget(yearOverview);
 
   // Connect
@@ -1849,11 +2049,92 @@ ScheduleRulesetNameWidget::ScheduleRulesetNameWidget(const model::ScheduleRulese
   mainVLayout->addWidget(line);
 }
 
+/******************************************************************************/
+// ScheduleRuleActivity
+/******************************************************************************/
+
+ScheduleRuleActivity::ScheduleRuleActivity(const model::ScheduleRuleset& scheduleRuleset) : m_scheduleRuleset(scheduleRuleset), m_year(0) {}
+
+ScheduleRuleActivity::RuleState ScheduleRuleActivity::ruleState(const model::ScheduleRule& scheduleRule) {
+  RuleState result;
+
+  result.startDate = scheduleRule.startDate();
+  result.endDate = scheduleRule.endDate();
+
+  result.fields.reserve(scheduleRule.numFields());
+  for (unsigned i = 0, n = scheduleRule.numFields(); i < n; ++i) {
+    result.fields.push_back(scheduleRule.getString(i, true).get_value_or(""));
+  }
+
+  return result;
+}
+
+void ScheduleRuleActivity::refresh() {
+  int year = m_scheduleRuleset.model().getUniqueModelObject<model::YearDescription>().assumedYear();
+
+  std::map<Handle, RuleState> ruleStates;
+  for (const auto& scheduleRule : m_scheduleRuleset.scheduleRules()) {
+    ruleStates.emplace(scheduleRule.handle(), ruleState(scheduleRule));
+  }
+
+  const Date firstDay(1, 1, year);
+  const Date lastDay(12, 31, year);
+
+  // Adding or removing a rule shifts the priority of the others, recompute everything in that case
+  bool fullRefresh = (year != m_year) || m_activeRuleIndices.empty() || (ruleStates.size() != m_ruleStates.size());
+
+  std::vector<std::pair<Date, Date>> dirtyRanges;
+
+  for (auto it = ruleStates.begin(); !fullRefresh && it != ruleStates.end(); ++it) {
+    auto oldIt = m_ruleStates.find(it->first);
+    if (oldIt == m_ruleStates.end()) {
+      fullRefresh = true;
+    } else if (oldIt->second.fields != it->second.fields) {
+      // Days outside both the previous and the new date range of the rule cannot have changed
+      for (const RuleState* state : {&oldIt->second, &it->second}) {
+        if (!state->startDate || !state->endDate || (*state->startDate < firstDay) || (*state->endDate > lastDay)
+            || (*state->endDate < *state->startDate)) {
+          // Specific dates, or a range we cannot map onto the assumed year
+          fullRefresh = true;
+        } else {
+          dirtyRanges.emplace_back(*state->startDate, *state->endDate);
+        }
+      }
+    }
+  }
+
+  if (fullRefresh) {
+    m_activeRuleIndices = m_scheduleRuleset.getActiveRuleIndices(firstDay, lastDay);
+  } else {
+    for (const auto& range : dirtyRanges) {
+      refreshRange(range.first, range.second);
+    }
+  }
+
+  m_year = year;
+  m_ruleStates = std::move(ruleStates);
+}
+
+void ScheduleRuleActivity::refreshRange(const Date& startDate, const Date& endDate) {
+  std::vector<int> indices = m_scheduleRuleset.getActiveRuleIndices(startDate, endDate);
+
+  auto offset = static_cast<size_t>(startDate.dayOfYear() - 1);
+
+  OS_ASSERT(offset + indices.size() <= m_activeRuleIndices.size());
+
+  std::copy(indices.begin(), indices.end(), m_activeRuleIndices.begin() + offset);
+}
+
+const std::vector<int>& ScheduleRuleActivity::activeRuleIndices() const {
+  return m_activeRuleIndices;
+}
+
 /******************************************************************************/
 // YearOverview
 /******************************************************************************/
 
-YearOverview::YearOverview(const model::ScheduleRuleset& scheduleRuleset, QWidget* parent)
+YearOverview::YearOverview(const model::ScheduleRuleset& scheduleRuleset, std::shared_ptr<ScheduleRuleActivity> ruleActivity,
+                           QWidget* parent)
   : QWidget(parent),
     m_januaryView(new MonthView(this)),
     m_februaryView(new MonthView(this)),
@@ -1868,7 +2149,12 @@ YearOverview::YearOverview(const model::ScheduleRuleset& scheduleRuleset, QWidge
     m_novemberView(new MonthView(this)),
     m_decemberView(new MonthView(this)),
     m_scheduleRuleset(scheduleRuleset),
+    m_ruleActivity(std::move(ruleActivity)),
     m_dirty(false) {
+  if (!m_ruleActivity) {
+    m_ruleActivity = std::make_shared<ScheduleRuleActivity>(m_scheduleRuleset);
+  }
+
   refreshActiveRuleIndices();
 
   auto* mainScrollLayout = new QVBoxLayout();
@@ -1955,12 +2241,7 @@ YearOverview::YearOverview(const model::ScheduleRuleset& scheduleRuleset, QWidge
 }
 
 void YearOverview::refreshActiveRuleIndices() {
-  int year = m_scheduleRuleset.model().getUniqueModelObject<model::YearDescription>().assumedYear();
-
-  Date startDate(1, 1, year);
-  Date endDate(12, 31, year);
-
-  m_activeRuleIndices = m_scheduleRuleset.getActiveRuleIndices(startDate, endDate);
+  m_ruleActivity->refresh();
 
   m_dirty = false;
 }
@@ -1976,8 +2257,8 @@ void YearOverview::onModelAdd(std::shared_ptr<openstudio::detail::WorkspaceObjec
   }
 }
 
-std::vector<int> YearOverview::activeRuleIndices() const {
-  return m_activeRuleIndices;
+const std::vector<int>& YearOverview::activeRuleIndices() const {
+  return m_ruleActivity->activeRuleIndices();
 }
 
 void YearOverview::scheduleRefresh() {
@@ -30,6 +30,8 @@
 #ifndef OPENSTUDIO_SCHEDULESVIEW_HPP
 #define OPENSTUDIO_SCHEDULESVIEW_HPP
 
+#include "OpenStudioAPI.hpp"
+
 #include "../model_editor/QMetaTypes.hpp"
 
 #include <openstudio/model/Model.hpp>
@@ -42,17 +44,23 @@
 #include <openstudio/model/YearDescription.hpp>
 #include <openstudio/model/YearDescription_Impl.hpp>
 
+#include <openstudio/utilities/time/Date.hpp>
+
 #include <boost/optional.hpp>
 #include <boost/smart_ptr.hpp>
 
 #include <map>
+#include <memory>
 
+#include <QAbstractListModel>
 #include <QCalendarWidget>
 #include <QColor>
 #include <QComboBox>
 #include <QDialog>
 #include <QGraphicsItem>
 #include <QGraphicsView>
+#include <QPersistentModelIndex>
+#include <QStyledItemDelegate>
 #include <openstudio/nano/nano_signal_slot.hpp>  // Signal-Slot replacement
 #include <QWidget>
 
@@ -78,6 +86,8 @@ class QLineEdit;
 
 class QDoubleSpinBox;
 
+class QListView;
+
 namespace openstudio {
 
 namespace model {
@@ -100,12 +110,18 @@ class DayScheduleOverview;
 
 class YearOverview;
 
+class ScheduleRuleActivity;
+
 class ScheduleTab;
 
 class ScheduleTabHeader;
 
 class ScheduleTabContent;
 
+class ScheduleListModel;
+
+class ScheduleTabDelegate;
+
 class OSCheckBox;
 
 class OSCheckBox2;
@@ -144,6 +160,9 @@ class SchedulesView
 
   ScheduleTab* tabForSchedule(const model::ScheduleRuleset& schedule) const;
 
+  // Shared by the YearOverviews of a ruleset, so switching between its rules does not recompute the whole year
+  std::shared_ptr<ScheduleRuleActivity> ruleActivity(const model::ScheduleRuleset& schedule);
+
   void closeAllTabs() const;
 
  public slots:
@@ -212,6 +231,8 @@ class SchedulesView
  protected:
   void paintEvent(QPaintEvent* event) override;
 
+  void resizeEvent(QResizeEvent* event) override;
+
  private slots:
 
   void addSchedule(const model::ScheduleRuleset& schedule);
@@ -224,22 +245,87 @@ class SchedulesView
 
   void onScheduleRuleRemoved(const Handle& handle);
 
+  void scheduleVisibleTabsUpdate();
+
+  void updateVisibleTabs();
+
  private:
-  void updateRowColors();
+  // Creates the ScheduleTab widget for a row of the left column if it does not exist yet
+  ScheduleTab* materializeTab(const QModelIndex& index);
 
   model::Model m_model;
 
-  QVBoxLayout* m_leftVLayout;
+  ScheduleListModel* m_scheduleListModel;
+
+  ScheduleTabDelegate* m_scheduleTabDelegate;
+
+  QListView* m_scheduleListView;
+
+  // Rows which currently have a ScheduleTab, only those in or near the viewport plus the selected one
+  std::vector<QPersistentModelIndex> m_materializedIndexes;
+
+  boost::optional<Handle> m_currentScheduleHandle;
+
+  std::map<Handle, std::shared_ptr<ScheduleRuleActivity>> m_ruleActivities;
 
   QHBoxLayout* m_contentLayout;
 
   bool m_isIP;
+
+  bool m_visibleTabsDirty;
 };
 
 /******************************************************************************/
 // Left column selector classes
 /******************************************************************************/
 
+// One row per ScheduleRuleset in the left column selector, ScheduleTab widgets are only created for the rows in view
+class ScheduleListModel : public QAbstractListModel
+{
+  Q_OBJECT
+
+ public:
+  explicit ScheduleListModel(QObject* parent = nullptr);
+
+  virtual ~ScheduleListModel() = default;
+
+  int rowCount(const QModelIndex& parent = QModelIndex()) const override;
+
+  QVariant data(const QModelIndex& index, int role = Qt::DisplayRole) const override;
+
+  void setSchedules(const std::vector<model::ScheduleRuleset>& schedules);
+
+  void insertSchedule(int row, const model::ScheduleRuleset& schedule);
+
+  void removeSchedule(int row);
+
+  model::ScheduleRuleset schedule(int row) const;
+
+  // Returns -1 if the schedule is not in the list
+  int rowForHandle(const Handle& handle) const;
+
+ private:
+  std::vector<model::ScheduleRuleset> m_schedules;
+};
+
+// Paints the alternating row colors of the left column selector, and a stand in header for rows without a ScheduleTab yet
+class ScheduleTabDelegate : public QStyledItemDelegate
+{
+  Q_OBJECT
+
+ public:
+  explicit ScheduleTabDelegate(QAbstractItemView* view);
+
+  virtual ~ScheduleTabDelegate() = default;
+
+  void paint(QPainter* painter, const QStyleOptionViewItem& option, const QModelIndex& index) const override;
+
+  QSize sizeHint(const QStyleOptionViewItem& option, const QModelIndex& index) const override;
+
+ private:
+  QAbstractItemView* m_view;
+};
+
 // Overall item in left column selector, includes collapsible header and content
 class ScheduleTab
   : public QWidget
@@ -276,7 +362,12 @@ class ScheduleTab
   // DLM: not sure if this is wired to anything?
   void removeScheduleClicked(const model::ScheduleRuleset& schedule);
 
+  // Emitted when the layout is invalidated, e.g. on expand / collapse or when rules are added
+  void layoutChanged();
+
  protected:
+  bool event(QEvent* event) override;
+
   //void paintEvent(QPaintEvent * event);
 
   //void mouseReleaseEvent( QMouseEvent * event );
@@ -712,6 +803,41 @@ class ScheduleRulesetNameWidget
   boost::optional<model::ScheduleRuleset> opt_scheduleRuleset;
 };
 
+// Active rule index for each day of the assumed year, for one ScheduleRuleset
+// Only the dates covered by rules which changed since the last refresh are recomputed
+class OPENSTUDIO_API ScheduleRuleActivity
+{
+ public:
+  explicit ScheduleRuleActivity(const model::ScheduleRuleset& scheduleRuleset);
+
+  // Brings the day to rule vector up to date with the model
+  void refresh();
+
+  const std::vector<int>& activeRuleIndices() const;
+
+ private:
+  struct RuleState
+  {
+    boost::optional<Date> startDate;
+
+    boost::optional<Date> endDate;
+
+    std::vector<std::string> fields;
+  };
+
+  static RuleState ruleState(const model::ScheduleRule& scheduleRule);
+
+  void refreshRange(const Date& startDate, const Date& endDate);
+
+  model::ScheduleRuleset m_scheduleRuleset;
+
+  int m_year;
+
+  std::map<Handle, RuleState> m_ruleStates;
+
+  std::vector<int> m_activeRuleIndices;
+};
+
 // Overview of the year, held by ScheduleRuleView
 class YearOverview
   : public QWidget
@@ -720,13 +846,14 @@ class YearOverview
   Q_OBJECT
 
  public:
-  explicit YearOverview(const model::ScheduleRuleset& scheduleRuleset, QWidget* parent = nullptr);
+  explicit YearOverview(const model::ScheduleRuleset& scheduleRuleset, std::shared_ptr<ScheduleRuleActivity> ruleActivity = nullptr,
+                        QWidget* parent = nullptr);
 
   virtual ~YearOverview() = default;
 
   model::ScheduleRuleset scheduleRuleset() const;
 
-  std::vector<int> activeRuleIndices() const;
+  const std::vector<int>& activeRuleIndices() const;
 
  private slots:
 
@@ -765,7 +892,7 @@ class YearOverview
 
   model::ScheduleRuleset m_scheduleRuleset;
 
-  std::vector<int> m_activeRuleIndices;
+  std::shared_ptr<ScheduleRuleActivity> m_ruleActivity;
 
   bool m_dirty;
 };
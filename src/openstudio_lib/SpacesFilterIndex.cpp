@@ -0,0 +1,294 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) 2020-2022, OpenStudio Coalition and other contributors. All rights reserved.
+*
+*  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the
+*  following conditions are met:
+*
+*  (1) Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+*  disclaimer.
+*
+*  (2) Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following
+*  disclaimer in the documentation and/or other materials provided with the distribution.
+*
+*  (3) Neither the name of the copyright holder nor the names of any contributors may be used to endorse or promote products
+*  derived from this software without specific prior written permission from the respective party.
+*
+*  (4) Other than as required in clauses (1) and (2), distributions in any form of modifications or other derivative works
+*  may not use the "OpenStudio" trademark, "OS", "os", or any other confusingly similar designation without specific prior
+*  written permission from Alliance for Sustainable Energy, LLC.
+*
+*  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDER(S) AND ANY CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+*  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+*  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER(S), ANY CONTRIBUTORS, THE UNITED STATES GOVERNMENT, OR THE UNITED
+*  STATES DEPARTMENT OF ENERGY, NOR ANY OF THEIR EMPLOYEES, BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+*  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF
+*  USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+*  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+*  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+***********************************************************************************************************************/
+
+#include "SpacesFilterIndex.hpp"
+
+#include <openstudio/model/BuildingStory.hpp>
+#include <openstudio/model/InteriorPartitionSurfaceGroup.hpp>
+#include <openstudio/model/InteriorPartitionSurfaceGroup_Impl.hpp>
+#include <openstudio/model/ModelObject_Impl.hpp>
+#include <openstudio/model/Space.hpp>
+#include <openstudio/model/Space_Impl.hpp>
+#include <openstudio/model/SpaceLoad.hpp>
+#include <openstudio/model/SpaceLoad_Impl.hpp>
+#include <openstudio/model/SpaceType.hpp>
+#include <openstudio/model/SubSurface.hpp>
+#include <openstudio/model/SubSurface_Impl.hpp>
+#include <openstudio/model/Surface.hpp>
+#include <openstudio/model/Surface_Impl.hpp>
+#include <openstudio/model/ThermalZone.hpp>
+
+#include "../model_editor/Utilities.hpp"
+
+#include <openstudio/utilities/core/Assert.hpp>
+#include <openstudio/utilities/idd/IddEnums.hxx>
+
+#include <boost/algorithm/string/case_conv.hpp>
+
+#include <algorithm>
+
+namespace openstudio {
+
+void SpacesFilterIndex::EntryObserver::onChange() {
+  index->m_dirty.set(entry);
+}
+
+SpacesFilterIndex::SpacesFilterIndex(const model::Model& model) : m_model(model) {}
+
+void SpacesFilterIndex::clearFilter(Filter filter) {
+  m_active[filter] = false;
+  m_targets[filter].clear();
+  if (filter == SpaceName) {
+    m_spaceNameFilter.clear();
+  }
+
+  updateFilterBits(filter);
+}
+
+void SpacesFilterIndex::setUnassignedFilter(Filter filter) {
+  OS_ASSERT(filter == Story || filter == ThermalZone || filter == SpaceType);
+
+  m_active[filter] = true;
+  m_targets[filter] = {UNSET};
+
+  updateFilterBits(filter);
+}
+
+void SpacesFilterIndex::setFilter(Filter filter, const std::string& value) {
+  std::vector<int> targets;
+  switch (filter) {
+    case Story:
+      targets = namedObjectIds(IddObjectType::OS_BuildingStory, value);
+      break;
+    case ThermalZone:
+      targets = namedObjectIds(IddObjectType::OS_ThermalZone, value);
+      break;
+    case SpaceType:
+      targets = namedObjectIds(IddObjectType::OS_SpaceType, value);
+      break;
+    case InteriorPartitionGroup:
+      targets = namedObjectIds(IddObjectType::OS_InteriorPartitionSurfaceGroup, value);
+      break;
+    case SpaceName:
+      m_spaceNameFilter = toQString(value);
+      break;
+    case LoadType:
+      setLoadTypeFilter(IddObjectType(value));
+      return;
+    default:
+      targets.push_back(stringId(value));
+      break;
+  }
+  std::sort(targets.begin(), targets.end());
+
+  m_active[filter] = true;
+  m_targets[filter] = std::move(targets);
+
+  updateFilterBits(filter);
+}
+
+void SpacesFilterIndex::setLoadTypeFilter(const IddObjectType& iddObjectType) {
+  m_active[LoadType] = true;
+  m_targets[LoadType] = {iddObjectType.value() + 1};
+
+  updateFilterBits(LoadType);
+}
+
+bool SpacesFilterIndex::accepts(const model::ModelObject& modelObject) {
+  std::size_t entry = 0;
+
+  auto it = m_entries.find(modelObject.handle());
+  if (it == m_entries.end()) {
+    entry = addEntry(modelObject);
+  } else {
+    entry = it->second;
+    if (m_dirty.test(entry)) {
+      readEntry(entry, modelObject);
+      updateEntryBits(entry);
+      m_dirty.reset(entry);
+    }
+  }
+
+  return m_accepted.test(entry);
+}
+
+bool SpacesFilterIndex::isActive(Filter filter) const {
+  return m_active[filter];
+}
+
+std::size_t SpacesFilterIndex::numEntries() const {
+  return m_handles.size();
+}
+
+std::size_t SpacesFilterIndex::addEntry(const model::ModelObject& modelObject) {
+  std::size_t entry = m_handles.size();
+
+  m_entries.emplace(modelObject.handle(), entry);
+  m_handles.push_back(modelObject.handle());
+  for (auto& values : m_values) {
+    values.push_back(NOT_APPLICABLE);
+  }
+  m_spaceNames.emplace_back();
+  for (auto& passes : m_passes) {
+    passes.push_back(true);
+  }
+  m_accepted.push_back(true);
+  m_dirty.push_back(false);
+
+  auto observer = std::make_unique<EntryObserver>();
+  observer->index = this;
+  observer->entry = entry;
+  modelObject.getImpl<model::detail::ModelObject_Impl>()->onChange.connect<EntryObserver, &EntryObserver::onChange>(observer.get());
+  // the boundary condition of a subsurface is the one of its base surface
+  if (auto subSurface = modelObject.optionalCast<model::SubSurface>()) {
+    if (auto surface = subSurface->surface()) {
+      surface->getImpl<model::detail::ModelObject_Impl>()->onChange.connect<EntryObserver, &EntryObserver::onChange>(observer.get());
+    }
+  }
+  m_observers.push_back(std::move(observer));
+
+  readEntry(entry, modelObject);
+  updateEntryBits(entry);
+
+  return entry;
+}
+
+void SpacesFilterIndex::readEntry(std::size_t entry, const model::ModelObject& modelObject) {
+  for (auto& values : m_values) {
+    values[entry] = NOT_APPLICABLE;
+  }
+  m_spaceNames[entry].clear();
+
+  if (auto space = modelObject.optionalCast<model::Space>()) {
+    auto buildingStory = space->buildingStory();
+    m_values[Story][entry] = buildingStory ? handleId(buildingStory->handle()) : UNSET;
+    auto thermalZone = space->thermalZone();
+    m_values[ThermalZone][entry] = thermalZone ? handleId(thermalZone->handle()) : UNSET;
+    auto spaceType = space->spaceType();
+    m_values[SpaceType][entry] = spaceType ? handleId(spaceType->handle()) : UNSET;
+    m_values[SpaceName][entry] = UNSET;
+    m_spaceNames[entry] = toQString(space->nameString());
+  } else if (auto surface = modelObject.optionalCast<model::Surface>()) {
+    m_values[SurfaceType][entry] = stringId(surface->surfaceType());
+    m_values[WindExposure][entry] = stringId(surface->windExposure());
+    m_values[SunExposure][entry] = stringId(surface->sunExposure());
+    m_values[OutsideBoundaryCondition][entry] = stringId(surface->outsideBoundaryCondition());
+  } else if (auto subSurface = modelObject.optionalCast<model::SubSurface>()) {
+    m_values[SubSurfaceType][entry] = stringId(subSurface->subSurfaceType());
+    m_values[OutsideBoundaryCondition][entry] = stringId(subSurface->outsideBoundaryCondition());
+  } else if (modelObject.optionalCast<model::SpaceLoad>()) {
+    m_values[LoadType][entry] = modelObject.iddObjectType().value() + 1;
+  } else if (modelObject.optionalCast<model::InteriorPartitionSurfaceGroup>()) {
+    m_values[InteriorPartitionGroup][entry] = handleId(modelObject.handle());
+  }
+}
+
+void SpacesFilterIndex::refreshDirtyEntries() {
+  for (auto entry = m_dirty.find_first(); entry != boost::dynamic_bitset<>::npos; entry = m_dirty.find_next(entry)) {
+    // removed objects are never probed again
+    if (auto modelObject = m_model.getModelObject<model::ModelObject>(m_handles[entry])) {
+      readEntry(entry, *modelObject);
+      updateEntryBits(entry);
+    }
+  }
+  m_dirty.reset();
+}
+
+bool SpacesFilterIndex::passes(Filter filter, std::size_t entry) const {
+  int value = m_values[filter][entry];
+  if (value == NOT_APPLICABLE) {
+    return true;
+  }
+  if (filter == SpaceName) {
+    return m_spaceNames[entry].contains(m_spaceNameFilter, Qt::CaseInsensitive);
+  }
+  return std::binary_search(m_targets[filter].begin(), m_targets[filter].end(), value);
+}
+
+void SpacesFilterIndex::updateEntryBits(std::size_t entry) {
+  bool accepted = true;
+  for (int filter = 0; filter < NumFilters; ++filter) {
+    bool passed = !m_active[filter] || passes(static_cast<Filter>(filter), entry);
+    m_passes[filter][entry] = passed;
+    accepted = accepted && passed;
+  }
+  m_accepted[entry] = accepted;
+}
+
+void SpacesFilterIndex::updateFilterBits(Filter filter) {
+  refreshDirtyEntries();
+
+  auto& filterPasses = m_passes[filter];
+  if (m_active[filter]) {
+    for (std::size_t entry = 0; entry < m_handles.size(); ++entry) {
+      filterPasses[entry] = passes(filter, entry);
+    }
+  } else {
+    filterPasses.set();
+  }
+
+  m_accepted.set();
+  for (int i = 0; i < NumFilters; ++i) {
+    if (m_active[i]) {
+      m_accepted &= m_passes[i];
+    }
+  }
+}
+
+int SpacesFilterIndex::handleId(const Handle& handle) {
+  auto [it, inserted] = m_handleIds.emplace(handle, m_nextId);
+  if (inserted) {
+    ++m_nextId;
+  }
+  return it->second;
+}
+
+int SpacesFilterIndex::stringId(const std::string& value) {
+  if (value.empty()) {
+    return UNSET;
+  }
+  auto [it, inserted] = m_stringIds.emplace(boost::algorithm::to_lower_copy(value), m_nextId);
+  if (inserted) {
+    ++m_nextId;
+  }
+  return it->second;
+}
+
+std::vector<int> SpacesFilterIndex::namedObjectIds(const IddObjectType& iddObjectType, const std::string& name) {
+  std::vector<int> result;
+  for (const auto& object : m_model.getObjectsByTypeAndName(iddObjectType, name)) {
+    // lookup by name is case insensitive
+    if (object.nameString() == name) {
+      result.push_back(handleId(object.handle()));
+    }
+  }
+  return result;
+}
+
+}  // namespace openstudio
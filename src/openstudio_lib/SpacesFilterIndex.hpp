@@ -0,0 +1,168 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) 2020-2022, OpenStudio Coalition and other contributors. All rights reserved.
+*
+*  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the
+*  following conditions are met:
+*
+*  (1) Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+*  disclaimer.
+*
+*  (2) Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following
+*  disclaimer in the documentation and/or other materials provided with the distribution.
+*
+*  (3) Neither the name of the copyright holder nor the names of any contributors may be used to endorse or promote products
+*  derived from this software without specific prior written permission from the respective party.
+*
+*  (4) Other than as required in clauses (1) and (2), distributions in any form of modifications or other derivative works
+*  may not use the "OpenStudio" trademark, "OS", "os", or any other confusingly similar designation without specific prior
+*  written permission from Alliance for Sustainable Energy, LLC.
+*
+*  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDER(S) AND ANY CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+*  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+*  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER(S), ANY CONTRIBUTORS, THE UNITED STATES GOVERNMENT, OR THE UNITED
+*  STATES DEPARTMENT OF ENERGY, NOR ANY OF THEIR EMPLOYEES, BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+*  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF
+*  USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+*  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+*  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+***********************************************************************************************************************/
+
+#ifndef OPENSTUDIO_SPACESFILTERINDEX_HPP
+#define OPENSTUDIO_SPACESFILTERINDEX_HPP
+
+#include <openstudio/model/Model.hpp>
+#include <openstudio/model/ModelObject.hpp>
+#include <openstudio/nano/nano_signal_slot.hpp>  // Signal-Slot replacement
+#include <openstudio/utilities/core/Logger.hpp>
+#include <openstudio/utilities/idd/IddEnums.hxx>
+
+#include <QString>
+
+#include <boost/dynamic_bitset.hpp>
+
+#include <array>
+#include <map>
+#include <memory>
+#include <vector>
+
+namespace openstudio {
+
+// Evaluates the filters of the Spaces subtabs.
+// Each object probed by the grid gets an entry holding the attributes the filters look at (story, thermal zone, space type,
+// name, surface and subsurface type, exposures, boundary condition, load type, partition group), and each filter keeps a bitset
+// of the entries it accepts. Changing a filter only rescans its own column, combining filters is a bitwise AND.
+// Entries are re-read lazily after their object (or the base surface of a subsurface) changes.
+// A filter only applies to the objects carrying its attribute, e.g. the story filter never hides a surface by itself.
+class SpacesFilterIndex
+{
+ public:
+  enum Filter
+  {
+    Story,
+    ThermalZone,
+    SpaceType,
+    SpaceName,
+    SubSurfaceType,
+    LoadType,
+    WindExposure,
+    SunExposure,
+    OutsideBoundaryCondition,
+    SurfaceType,
+    InteriorPartitionGroup,
+    NumFilters
+  };
+
+  explicit SpacesFilterIndex(const model::Model& model);
+
+  // Accept all objects again
+  void clearFilter(Filter filter);
+
+  // Story, ThermalZone and SpaceType: accept spaces without one
+  void setUnassignedFilter(Filter filter);
+
+  // Story, ThermalZone, SpaceType and InteriorPartitionGroup: accept objects referencing an object with this exact name.
+  // SpaceName: accept spaces whose name contains value, case insensitive.
+  // Other filters: accept objects whose attribute equals value, case insensitive
+  void setFilter(Filter filter, const std::string& value);
+
+  // LoadType: accept loads of this type
+  void setLoadTypeFilter(const IddObjectType& iddObjectType);
+
+  // True if no active filter rejects this object
+  bool accepts(const model::ModelObject& modelObject);
+
+  bool isActive(Filter filter) const;
+
+  std::size_t numEntries() const;
+
+ private:
+  REGISTER_LOGGER("openstudio.SpacesFilterIndex");
+
+  struct EntryObserver : public Nano::Observer
+  {
+    SpacesFilterIndex* index;
+    std::size_t entry;
+
+    void onChange();
+  };
+
+  static constexpr int NOT_APPLICABLE = -1;
+  static constexpr int UNSET = 0;
+
+  std::size_t addEntry(const model::ModelObject& modelObject);
+
+  void readEntry(std::size_t entry, const model::ModelObject& modelObject);
+
+  void refreshDirtyEntries();
+
+  bool passes(Filter filter, std::size_t entry) const;
+
+  // Recomputes the bits of one entry in every filter
+  void updateEntryBits(std::size_t entry);
+
+  // Recomputes one filter for every entry, then the combined bitset
+  void updateFilterBits(Filter filter);
+
+  int handleId(const Handle& handle);
+
+  int stringId(const std::string& value);
+
+  // ids of the objects of this type with this exact name
+  std::vector<int> namedObjectIds(const IddObjectType& iddObjectType, const std::string& name);
+
+  model::Model m_model;
+
+  std::map<Handle, std::size_t> m_entries;
+
+  std::vector<Handle> m_handles;
+
+  std::vector<std::unique_ptr<EntryObserver>> m_observers;
+
+  // attribute of each entry per filter, NOT_APPLICABLE if the filter does not look at this object
+  std::array<std::vector<int>, NumFilters> m_values;
+
+  std::vector<QString> m_spaceNames;
+
+  std::map<Handle, int> m_handleIds;
+
+  std::map<std::string, int> m_stringIds;
+
+  int m_nextId = UNSET + 1;
+
+  // sorted ids accepted by each active filter
+  std::array<std::vector<int>, NumFilters> m_targets;
+
+  QString m_spaceNameFilter;
+
+  std::array<bool, NumFilters> m_active{};
+
+  std::array<boost::dynamic_bitset<>, NumFilters> m_passes;
+
+  boost::dynamic_bitset<> m_accepted;
+
+  boost::dynamic_bitset<> m_dirty;
+};
+
+}  // namespace openstudio
+
+#endif  // OPENSTUDIO_SPACESFILTERINDEX_HPP
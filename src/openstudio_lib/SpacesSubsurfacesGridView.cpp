@@ -146,6 +146,8 @@ SpacesSubsurfacesGridView::SpacesSubsurfacesGridView(bool isIP, const model::Mod
 
   m_gridController = new SpacesSubsurfacesGridController(isIP, "Space", IddObjectType::OS_Space, model, m_spacesModelObjects);
   m_gridView = new OSGridView(m_gridController, "Space", "Drop\nSpace", false, parent);
+  // one row per space with one subrow per sub surface, only create widgets for the rows in view
+  m_gridView->setVirtualized(true);
 
   setGridController(m_gridController);
   setGridView(m_gridView);
@@ -123,7 +123,9 @@
 namespace openstudio {
 
 SpacesSubtabGridView::SpacesSubtabGridView(bool isIP, const model::Model& model, QWidget* parent)
-  : GridViewSubTab(isIP, model, parent), m_spacesModelObjects(subsetCastVector<model::ModelObject>(model.getConcreteModelObjects<model::Space>())) {
+  : GridViewSubTab(isIP, model, parent),
+    m_filterIndex(std::make_shared<SpacesFilterIndex>(model)),
+    m_spacesModelObjects(subsetCastVector<model::ModelObject>(model.getConcreteModelObjects<model::Space>())) {
 
   // Filters
 
@@ -512,319 +514,141 @@ void SpacesSubtabGridView::initializeInteriorPartitionGroupFilter() {
 }
 
 void SpacesSubtabGridView::storyFilterChanged(const QString& text) {
-  m_objectsFilteredByStory.clear();
-
   if (text == ALL) {
-    // nothing to filter
+    m_filterIndex->clearFilter(SpacesFilterIndex::Story);
   } else if (text == UNASSIGNED) {
-    for (const auto& obj : this->m_gridController->modelObjects()) {
-      if (obj.cast<model::Space>().buildingStory()) {
-        m_objectsFilteredByStory.insert(obj);
-      }
-    }
+    m_filterIndex->setUnassignedFilter(SpacesFilterIndex::Story);
   } else {
-    // OSGridController::m_modelObjects returns the Spaces
-    for (const auto& obj : this->m_gridController->modelObjects()) {
-      auto buildingStory = obj.cast<model::Space>().buildingStory();
-      if (!buildingStory || !buildingStory->name() || (buildingStory && buildingStory->name() && buildingStory->name().get().c_str() != text)) {
-        m_objectsFilteredByStory.insert(obj);
-      }
-    }
+    m_filterIndex->setFilter(SpacesFilterIndex::Story, openstudio::toString(text));
   }
 
   filterChanged();
 }
 
 void SpacesSubtabGridView::thermalZoneFilterChanged(const QString& text) {
-  m_objectsFilteredByThermalZone.clear();
-
   if (text == ALL) {
-    // nothing to filter
+    m_filterIndex->clearFilter(SpacesFilterIndex::ThermalZone);
   } else if (text == UNASSIGNED) {
-    for (const auto& obj : this->m_gridController->modelObjects()) {
-      if (obj.cast<model::Space>().thermalZone()) {
-        m_objectsFilteredByThermalZone.insert(obj);
-      }
-    }
+    m_filterIndex->setUnassignedFilter(SpacesFilterIndex::ThermalZone);
   } else {
-    // OSGridController::m_modelObjects returns the Spaces
-    for (const auto& obj : this->m_gridController->modelObjects()) {
-      auto thermalZone = obj.cast<model::Space>().thermalZone();
-      if (!thermalZone || !thermalZone->name() || (thermalZone && thermalZone->name() && thermalZone->name().get().c_str() != text)) {
-        m_objectsFilteredByThermalZone.insert(obj);
-      }
-    }
+    m_filterIndex->setFilter(SpacesFilterIndex::ThermalZone, openstudio::toString(text));
   }
 
   filterChanged();
 }
 
 void SpacesSubtabGridView::spaceTypeFilterChanged(const QString& text) {
-  m_objectsFilteredBySpaceType.clear();
-
   if (text == ALL) {
-    // nothing to filter
+    m_filterIndex->clearFilter(SpacesFilterIndex::SpaceType);
   } else if (text == UNASSIGNED) {
-    for (const auto& obj : this->m_gridController->modelObjects()) {
-      if (obj.cast<model::Space>().spaceType()) {
-        m_objectsFilteredBySpaceType.insert(obj);
-      }
-    }
+    m_filterIndex->setUnassignedFilter(SpacesFilterIndex::SpaceType);
   } else {
-    // OSGridController::m_modelObjects returns the Spaces
-    for (const auto& obj : this->m_gridController->modelObjects()) {
-      // LOG(Debug, "spaceTypeFilterChanged, obj=" << obj.briefDescription());
-      auto spaceType = obj.cast<model::Space>().spaceType();
-      if (!spaceType || !spaceType->name() || (spaceType && spaceType->name() && spaceType->name().get().c_str() != text)) {
-        m_objectsFilteredBySpaceType.insert(obj);
-      }
-    }
+    m_filterIndex->setFilter(SpacesFilterIndex::SpaceType, openstudio::toString(text));
   }
 
   filterChanged();
 }
 
 void SpacesSubtabGridView::subSurfaceTypeFilterChanged(const QString& text) {
-  m_objectsFilteredBySubSurfaceType.clear();
-
   if (text == ALL) {
-    // nothing to filter
+    m_filterIndex->clearFilter(SpacesFilterIndex::SubSurfaceType);
   } else {
-
     // It's possible that "fixedwindow" might be returned when querying later, instead of "FixedWindow" returned
-    // by SubSurface::validSubSurfaceTypes(), so we'll do a case-insensitive string comparison later
-    std::string subSurfaceTypeToKeep = openstudio::toString(text);
-
-    // ObjectSelector::m_selectableObjects returns SubSurfaces directly
-    for (const auto& obj : this->m_gridController->selectorObjects()) {
-      // LOG(Debug, "subSurfaceTypeFilterChanged, obj=" << obj.briefDescription());
-      const auto& subsurface = obj.optionalCast<model::SubSurface>();
-      if (subsurface) {
-        const auto& subsurfaceType = subsurface->subSurfaceType();
-        // Case insensitive
-        if (!openstudio::istringEqual(subsurfaceType, subSurfaceTypeToKeep)) {
-          // LOG(Debug, "Adding obj=" << obj.briefDescription());
-          m_objectsFilteredBySubSurfaceType.insert(obj);
-        }
-      }
-    }
-
-    // Alternatively, we could have done this:
-    //for (auto obj : this->m_gridController->m_modelObjects) {
-    //LOG(Debug, "subSurfaceTypeFilterChanged, obj=" << obj.briefDescription());
-    //auto surfaces = obj.cast<model::Space>().surfaces();
-    //for (auto surface : surfaces) {
-    //auto subsurfaces = surface.subSurfaces();
-    //for (auto subsurface : subsurfaces) {
-    //auto subsurfaceType = subsurface.subSurfaceType();
-    //if (!openstudio::istringEqual(subsurfaceType, subSurfaceTypeToKeep)) {
-    //LOG(Debug, "Adding obj=" << obj.briefDescription());
-    //m_objectsFilteredBySubSurfaceType.insert(obj);
-    //}
-    //}
-    //}
-    //}
+    // by SubSurface::validSubSurfaceTypes(), the index compares case-insensitively
+    m_filterIndex->setFilter(SpacesFilterIndex::SubSurfaceType, openstudio::toString(text));
   }
 
   filterChanged();
 }
 
 void SpacesSubtabGridView::spaceNameFilterChanged() {
-  m_objectsFilteredBySpaceName.clear();
-
   if (m_spaceNameFilter->text().isEmpty()) {
-    // nothing to filter
+    m_filterIndex->clearFilter(SpacesFilterIndex::SpaceName);
   } else {
-    for (const auto& obj : this->m_gridController->modelObjects()) {
-      QString objName(obj.name().get().c_str());
-      if (!objName.contains(m_spaceNameFilter->text(), Qt::CaseInsensitive)) {
-        m_objectsFilteredBySpaceName.insert(obj);
-      }
-    }
+    m_filterIndex->setFilter(SpacesFilterIndex::SpaceName, openstudio::toString(m_spaceNameFilter->text()));
   }
 
   filterChanged();
 }
 
 void SpacesSubtabGridView::loadTypeFilterChanged(const QString& text) {
-  m_objectsFilteredByLoadType.clear();
-
   if (text == ALL) {
-    // nothing to filter
+    m_filterIndex->clearFilter(SpacesFilterIndex::LoadType);
+  } else if (text == INTERNALMASS) {
+    m_filterIndex->setLoadTypeFilter(model::InternalMass::iddObjectType());
+  } else if (text == PEOPLE) {
+    m_filterIndex->setLoadTypeFilter(model::People::iddObjectType());
+  } else if (text == LIGHTS) {
+    m_filterIndex->setLoadTypeFilter(model::Lights::iddObjectType());
+  } else if (text == LUMINAIRE) {
+    m_filterIndex->setLoadTypeFilter(model::Luminaire::iddObjectType());
+  } else if (text == ELECTRICEQUIPMENT) {
+    m_filterIndex->setLoadTypeFilter(model::ElectricEquipment::iddObjectType());
+  } else if (text == GASEQUIPMENT) {
+    m_filterIndex->setLoadTypeFilter(model::GasEquipment::iddObjectType());
+  } else if (text == HOTWATEREQUIPMENT) {
+    m_filterIndex->setLoadTypeFilter(model::HotWaterEquipment::iddObjectType());
+  } else if (text == STEAMEQUIPMENT) {
+    m_filterIndex->setLoadTypeFilter(model::SteamEquipment::iddObjectType());
+  } else if (text == OTHEREQUIPMENT) {
+    m_filterIndex->setLoadTypeFilter(model::OtherEquipment::iddObjectType());
+  } else if (text == SPACEINFILTRATIONDESIGNFLOWRATE) {
+    m_filterIndex->setLoadTypeFilter(model::SpaceInfiltrationDesignFlowRate::iddObjectType());
+  } else if (text == SPACEINFILTRATIONEFFECTIVELEAKAGEAREA) {
+    m_filterIndex->setLoadTypeFilter(model::SpaceInfiltrationEffectiveLeakageArea::iddObjectType());
   } else {
-
-    // ObjectSelector::m_selectableObjects returns Load objects directly
-    for (const auto& obj : this->m_gridController->selectorObjects()) {
-      if (text == INTERNALMASS) {
-        if (!obj.optionalCast<model::InternalMass>()) {
-          m_objectsFilteredByLoadType.insert(obj);
-        }
-      } else if (text == PEOPLE) {
-        if (!obj.optionalCast<model::People>()) {
-          m_objectsFilteredByLoadType.insert(obj);
-        }
-      } else if (text == LIGHTS) {
-        if (!obj.optionalCast<model::Lights>()) {
-          m_objectsFilteredByLoadType.insert(obj);
-        }
-      } else if (text == LUMINAIRE) {
-        if (!obj.optionalCast<model::Luminaire>()) {
-          m_objectsFilteredByLoadType.insert(obj);
-        }
-      } else if (text == ELECTRICEQUIPMENT) {
-        if (!obj.optionalCast<model::ElectricEquipment>()) {
-          m_objectsFilteredByLoadType.insert(obj);
-        }
-      } else if (text == GASEQUIPMENT) {
-        if (!obj.optionalCast<model::GasEquipment>()) {
-          m_objectsFilteredByLoadType.insert(obj);
-        }
-      } else if (text == HOTWATEREQUIPMENT) {
-        if (!obj.optionalCast<model::HotWaterEquipment>()) {
-          m_objectsFilteredByLoadType.insert(obj);
-        }
-      } else if (text == STEAMEQUIPMENT) {
-        if (!obj.optionalCast<model::SteamEquipment>()) {
-          m_objectsFilteredByLoadType.insert(obj);
-        }
-      } else if (text == OTHEREQUIPMENT) {
-        if (!obj.optionalCast<model::OtherEquipment>()) {
-          m_objectsFilteredByLoadType.insert(obj);
-        }
-      } else if (text == SPACEINFILTRATIONDESIGNFLOWRATE) {
-        if (!obj.optionalCast<model::SpaceInfiltrationDesignFlowRate>()) {
-          m_objectsFilteredByLoadType.insert(obj);
-        }
-      } else if (text == SPACEINFILTRATIONEFFECTIVELEAKAGEAREA) {
-        if (!obj.optionalCast<model::SpaceInfiltrationEffectiveLeakageArea>()) {
-          m_objectsFilteredByLoadType.insert(obj);
-        }
-      } else {
-        // Should never get here
-        OS_ASSERT(false);
-      }
-    }
+    // Should never get here
+    OS_ASSERT(false);
   }
 
   filterChanged();
 }
 
 void SpacesSubtabGridView::windExposureFilterChanged(const QString& text) {
-  m_objectsFilteredByWindExposure.clear();
-
   if (text == ALL) {
-    // nothing to filter
+    m_filterIndex->clearFilter(SpacesFilterIndex::WindExposure);
   } else {
-    // For a case-insensitive comparison later
-    std::string windExposureToKeep = openstudio::toString(text);
-
-    // ObjectSelector::m_selectableObjects returns Surfaces directly
-    for (const auto& obj : this->m_gridController->selectorObjects()) {
-      // LOG(Debug, "windExposureFilterChanged, obj=" << obj.briefDescription());
-      const auto& surface = obj.optionalCast<model::Surface>();
-      if (surface) {
-        const auto& windExposure = surface->windExposure();
-        if (windExposure.empty() || !openstudio::istringEqual(windExposure, windExposureToKeep)) {
-          m_objectsFilteredByWindExposure.insert(obj);
-        }
-      }
-    }
+    m_filterIndex->setFilter(SpacesFilterIndex::WindExposure, openstudio::toString(text));
   }
 
   filterChanged();
 }
 
 void SpacesSubtabGridView::sunExposureFilterChanged(const QString& text) {
-  m_objectsFilteredBySunExposure.clear();
-
   if (text == ALL) {
-    // nothing to filter
+    m_filterIndex->clearFilter(SpacesFilterIndex::SunExposure);
   } else {
-    // For a case-insensitive comparison later
-    std::string sunExposureToKeep = openstudio::toString(text);
-
-    // ObjectSelector::m_selectableObjects returns Surfaces directly
-    for (const auto& obj : this->m_gridController->selectorObjects()) {
-      // LOG(Debug, "sunExposureFilterChanged, obj=" << obj.briefDescription());
-      const auto& surface = obj.optionalCast<model::Surface>();
-      if (surface) {
-        const auto& sunExposure = surface->sunExposure();
-        if (sunExposure.empty() || !openstudio::istringEqual(sunExposure, sunExposureToKeep)) {
-          m_objectsFilteredBySunExposure.insert(obj);
-        }
-      }
-    }
+    m_filterIndex->setFilter(SpacesFilterIndex::SunExposure, openstudio::toString(text));
   }
 
   filterChanged();
 }
 
 void SpacesSubtabGridView::outsideBoundaryConditionFilterChanged(const QString& text) {
-  m_objectsFilteredByOutsideBoundaryCondition.clear();
-
   if (text == ALL) {
-    // nothing to filter
+    m_filterIndex->clearFilter(SpacesFilterIndex::OutsideBoundaryCondition);
   } else {
-    // For a case-insensitive comparison later
-    std::string outsideBoundCondToKeep = openstudio::toString(text);
-
-    // ObjectSelector::m_selectableObjects returns either Surfaces or SubSurfaces directly, depending on the subtab it's on
-    for (const auto& obj : this->m_gridController->selectorObjects()) {
-      // LOG(Debug, "outsideBoundaryConditionFilterChanged, obj=" << obj.briefDescription());
-      std::string outsideBoundaryCondition;
-      if (const auto& surface = obj.optionalCast<model::Surface>()) {
-        outsideBoundaryCondition = surface->outsideBoundaryCondition();
-      } else if (const auto& subSurface = obj.optionalCast<model::SubSurface>()) {
-        outsideBoundaryCondition = subSurface->outsideBoundaryCondition();
-      }
-      if (outsideBoundaryCondition.empty() || !openstudio::istringEqual(outsideBoundaryCondition, outsideBoundCondToKeep)) {
-        m_objectsFilteredByOutsideBoundaryCondition.insert(obj);
-      }
-    }
+    m_filterIndex->setFilter(SpacesFilterIndex::OutsideBoundaryCondition, openstudio::toString(text));
   }
 
   filterChanged();
 }
 
 void SpacesSubtabGridView::surfaceTypeFilterChanged(const QString& text) {
-  m_objectsFilteredBySurfaceType.clear();
-
   if (text == ALL) {
-    // nothing to filter
+    m_filterIndex->clearFilter(SpacesFilterIndex::SurfaceType);
   } else {
-    // For a case-insensitive comparison later
-    std::string surfaceTypeToKeep = openstudio::toString(text);
-
-    // ObjectSelector::m_selectableObjects Surfaces directly
-    for (const auto& obj : this->m_gridController->selectorObjects()) {
-      // LOG(Debug, "surfaceTypeFilterChanged, obj=" << obj.briefDescription());
-      const auto& surface = obj.optionalCast<model::Surface>();
-      if (surface) {
-        const auto& surfaceType = surface->surfaceType();
-        if (!openstudio::istringEqual(surfaceType, surfaceTypeToKeep)) {
-          m_objectsFilteredBySurfaceType.insert(obj);
-        }
-      }
-    }
+    m_filterIndex->setFilter(SpacesFilterIndex::SurfaceType, openstudio::toString(text));
   }
 
   filterChanged();
 }
 
 void SpacesSubtabGridView::interiorPartitionGroupFilterChanged(const QString& text) {
-  m_objectsFilteredByInteriorPartitionGroup.clear();
-
-  if (m_interiorPartitionGroupFilter->currentText() == ALL) {
-    // nothing to filter
+  if (text == ALL) {
+    m_filterIndex->clearFilter(SpacesFilterIndex::InteriorPartitionGroup);
   } else {
-    for (const auto& obj : this->m_gridController->selectorObjects()) {
-      const auto& interiorPartitionSurfaceGroup = obj.optionalCast<model::InteriorPartitionSurfaceGroup>();
-      if (interiorPartitionSurfaceGroup) {
-        if (!interiorPartitionSurfaceGroup->name() || (interiorPartitionSurfaceGroup->name().get().c_str() != text)) {
-          m_objectsFilteredByInteriorPartitionGroup.insert(obj);
-        }
-      }
-    }
+    m_filterIndex->setFilter(SpacesFilterIndex::InteriorPartitionGroup, openstudio::toString(text));
   }
 
   filterChanged();
@@ -832,38 +656,11 @@ void SpacesSubtabGridView::interiorPartitionGroupFilterChanged(const QString& te
 
 void SpacesSubtabGridView::filterChanged() {
   // Note: JM 2018-08-21
-  // The distinction between these two is especially needed for the "Loads" Subtab
-  // because it can't match SpaceLoadInstances to a Space if the load is inherited from a SpaceType rather than the space
-
-  /****************************************************************************
-     * Filters that should apply at the ROW level because they are Space-related
-     ***************************************************************************/
-  std::set<openstudio::model::ModelObject> spaceFilteredObjects = m_objectsFilteredByStory;
-
-  spaceFilteredObjects.insert(m_objectsFilteredByThermalZone.begin(), m_objectsFilteredByThermalZone.end());
-  spaceFilteredObjects.insert(m_objectsFilteredBySpaceType.begin(), m_objectsFilteredBySpaceType.end());
-  spaceFilteredObjects.insert(m_objectsFilteredBySpaceName.begin(), m_objectsFilteredBySpaceName.end());
-
-  /***********************************************************************************
-     * Filters that should apply at the SUBROW level because they are DataObject-related
-     ***********************************************************************************/
-  std::set<openstudio::model::ModelObject> allFilteredObjects;
-
-  allFilteredObjects.insert(m_objectsFilteredBySubSurfaceType.begin(), m_objectsFilteredBySubSurfaceType.end());
-  allFilteredObjects.insert(m_objectsFilteredByWindExposure.begin(), m_objectsFilteredByWindExposure.end());
-  allFilteredObjects.insert(m_objectsFilteredBySunExposure.begin(), m_objectsFilteredBySunExposure.end());
-  allFilteredObjects.insert(m_objectsFilteredByOutsideBoundaryCondition.begin(), m_objectsFilteredByOutsideBoundaryCondition.end());
-  allFilteredObjects.insert(m_objectsFilteredBySurfaceType.begin(), m_objectsFilteredBySurfaceType.end());
-  allFilteredObjects.insert(m_objectsFilteredByInteriorPartitionGroup.begin(), m_objectsFilteredByInteriorPartitionGroup.end());
-  allFilteredObjects.insert(m_objectsFilteredByLoadType.begin(), m_objectsFilteredByLoadType.end());
-
-  // add space filters to all filters
-  allFilteredObjects.insert(spaceFilteredObjects.begin(), spaceFilteredObjects.end());
-
-  this->m_gridController->setObjectFilter([allFilteredObjects](const model::ModelObject& obj) -> bool {
-    // return false if object in allFilteredObjects
-    return allFilteredObjects.count(obj) == 0;
-  });
+  // The distinction between Space-related filters (applying at the ROW level) and DataObject-related ones (applying at the SUBROW level)
+  // is especially needed for the "Loads" Subtab because it can't match SpaceLoadInstances to a Space if the load is inherited
+  // from a SpaceType rather than the space. The index keeps it by only applying a filter to the objects carrying its attribute.
+  std::shared_ptr<SpacesFilterIndex> filterIndex = m_filterIndex;
+  this->m_gridController->setObjectFilter([filterIndex](const model::ModelObject& obj) -> bool { return filterIndex->accepts(obj); });
 }
 
 void SpacesSubtabGridView::addObject(const IddObjectType& iddObjectType) {
@@ -34,9 +34,12 @@
 
 #include "GridViewSubTab.hpp"
 #include "OSItem.hpp"
+#include "SpacesFilterIndex.hpp"
 
 #include <openstudio/model/Model.hpp>
 
+#include <memory>
+
 class QComboBox;
 class QLineEdit;
 
@@ -128,30 +131,8 @@ class SpacesSubtabGridView : public GridViewSubTab
 
   void filterChanged();
 
-  // All these sets will store the objects that DO NEED to be hidden
-  // These objects should be the selector type objects
-  // So if the set is empty -> show all
-  std::set<openstudio::model::ModelObject> m_objectsFilteredByStory;
-
-  std::set<openstudio::model::ModelObject> m_objectsFilteredByThermalZone;
-
-  std::set<openstudio::model::ModelObject> m_objectsFilteredBySpaceType;
-
-  std::set<openstudio::model::ModelObject> m_objectsFilteredBySubSurfaceType;
-
-  std::set<openstudio::model::ModelObject> m_objectsFilteredBySpaceName;
-
-  std::set<openstudio::model::ModelObject> m_objectsFilteredByWindExposure;
-
-  std::set<openstudio::model::ModelObject> m_objectsFilteredBySunExposure;
-
-  std::set<openstudio::model::ModelObject> m_objectsFilteredByOutsideBoundaryCondition;
-
-  std::set<openstudio::model::ModelObject> m_objectsFilteredBySurfaceType;
-
-  std::set<openstudio::model::ModelObject> m_objectsFilteredByInteriorPartitionGroup;
-
-  std::set<openstudio::model::ModelObject> m_objectsFilteredByLoadType;
+  // Evaluates the filters above, shared with the object filter installed on the grid controller
+  std::shared_ptr<SpacesFilterIndex> m_filterIndex;
 
   QGridLayout* m_filterGridLayout = nullptr;
 
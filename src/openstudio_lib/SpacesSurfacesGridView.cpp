@@ -85,6 +85,8 @@ SpacesSurfacesGridView::SpacesSurfacesGridView(bool isIP, const model::Model& mo
 
   m_gridController = new SpacesSurfacesGridController(isIP, "Space", IddObjectType::OS_Space, model, m_spacesModelObjects);
   m_gridView = new OSGridView(m_gridController, "Space", "Drop\nSpace", false, parent);
+  // one row per space with one subrow per surface, only create widgets for the rows in view
+  m_gridView->setVirtualized(true);
 
   setGridController(m_gridController);
   setGridView(m_gridView);
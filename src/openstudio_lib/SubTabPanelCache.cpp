@@ -0,0 +1,75 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) 2020-2022, OpenStudio Coalition and other contributors. All rights reserved.
+*
+*  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the
+*  following conditions are met:
+*
+*  (1) Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+*  disclaimer.
+*
+*  (2) Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following
+*  disclaimer in the documentation and/or other materials provided with the distribution.
+*
+*  (3) Neither the name of the copyright holder nor the names of any contributors may be used to endorse or promote products
+*  derived from this software without specific prior written permission from the respective party.
+*
+*  (4) Other than as required in clauses (1) and (2), distributions in any form of modifications or other derivative works
+*  may not use the "OpenStudio" trademark, "OS", "os", or any other confusingly similar designation without specific prior
+*  written permission from Alliance for Sustainable Energy, LLC.
+*
+*  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDER(S) AND ANY CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+*  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+*  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER(S), ANY CONTRIBUTORS, THE UNITED STATES GOVERNMENT, OR THE UNITED
+*  STATES DEPARTMENT OF ENERGY, NOR ANY OF THEIR EMPLOYEES, BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+*  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF
+*  USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+*  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+*  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+***********************************************************************************************************************/
+
+#include "SubTabPanelCache.hpp"
+
+#include <openstudio/model/Model_Impl.hpp>
+
+namespace openstudio {
+
+QWidget* SubTabPanelCache::find(const std::string& key) const {
+  auto it = m_panels.find(key);
+  if (it == m_panels.end()) {
+    return nullptr;
+  }
+  return it->second.data();
+}
+
+void SubTabPanelCache::insert(const std::string& key, QWidget* widget) {
+  m_panels[key] = widget;
+}
+
+bool SubTabPanelCache::contains(const QWidget* widget) const {
+  for (const auto& panel : m_panels) {
+    if (panel.second == widget) {
+      return true;
+    }
+  }
+  return false;
+}
+
+bool SubTabPanelCache::resetForLibrary(const model::Model& library) {
+  if (m_library && m_library->getImpl<model::detail::Model_Impl>() == library.getImpl<model::detail::Model_Impl>()) {
+    return false;
+  }
+
+  reset();
+  m_library = library;
+  return true;
+}
+
+void SubTabPanelCache::reset() {
+  for (auto& panel : m_panels) {
+    // deleting the panel also takes it out of its stacked widget
+    delete panel.second;
+  }
+  m_panels.clear();
+}
+
+}  // namespace openstudio
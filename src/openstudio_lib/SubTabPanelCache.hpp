@@ -0,0 +1,72 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) 2020-2022, OpenStudio Coalition and other contributors. All rights reserved.
+*
+*  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the
+*  following conditions are met:
+*
+*  (1) Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+*  disclaimer.
+*
+*  (2) Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following
+*  disclaimer in the documentation and/or other materials provided with the distribution.
+*
+*  (3) Neither the name of the copyright holder nor the names of any contributors may be used to endorse or promote products
+*  derived from this software without specific prior written permission from the respective party.
+*
+*  (4) Other than as required in clauses (1) and (2), distributions in any form of modifications or other derivative works
+*  may not use the "OpenStudio" trademark, "OS", "os", or any other confusingly similar designation without specific prior
+*  written permission from Alliance for Sustainable Energy, LLC.
+*
+*  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDER(S) AND ANY CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+*  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+*  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER(S), ANY CONTRIBUTORS, THE UNITED STATES GOVERNMENT, OR THE UNITED
+*  STATES DEPARTMENT OF ENERGY, NOR ANY OF THEIR EMPLOYEES, BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+*  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF
+*  USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+*  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+*  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+***********************************************************************************************************************/
+
+#ifndef OPENSTUDIO_SUBTABPANELCACHE_HPP
+#define OPENSTUDIO_SUBTABPANELCACHE_HPP
+
+#include "OpenStudioAPI.hpp"
+
+#include <openstudio/model/Model.hpp>
+
+#include <QPointer>
+#include <QWidget>
+
+#include <map>
+#include <string>
+
+namespace openstudio {
+
+// My model or library panels built by MainRightColumnController for its subtabs, kept so that going back to a subtab
+// shows the same widget again. The panels are owned by the stacked widget they are shown in until reset deletes them.
+class OPENSTUDIO_API SubTabPanelCache
+{
+ public:
+  // Returns the panel stored under key, or nullptr if it has not been built yet or was deleted since
+  QWidget* find(const std::string& key) const;
+
+  void insert(const std::string& key, QWidget* widget);
+
+  bool contains(const QWidget* widget) const;
+
+  // Library panels are only valid for the component library they were built from, if library is not that one
+  // every stored panel is deleted and true is returned
+  bool resetForLibrary(const model::Model& library);
+
+  // Deletes every stored panel
+  void reset();
+
+ private:
+  std::map<std::string, QPointer<QWidget>> m_panels;
+
+  boost::optional<model::Model> m_library;
+};
+
+}  // namespace openstudio
+
+#endif  // OPENSTUDIO_SUBTABPANELCACHE_HPP
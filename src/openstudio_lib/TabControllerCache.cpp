@@ -0,0 +1,92 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) 2020-2022, OpenStudio Coalition and other contributors. All rights reserved.
+*
+*  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the
+*  following conditions are met:
+*
+*  (1) Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+*  disclaimer.
+*
+*  (2) Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following
+*  disclaimer in the documentation and/or other materials provided with the distribution.
+*
+*  (3) Neither the name of the copyright holder nor the names of any contributors may be used to endorse or promote products
+*  derived from this software without specific prior written permission from the respective party.
+*
+*  (4) Other than as required in clauses (1) and (2), distributions in any form of modifications or other derivative works
+*  may not use the "OpenStudio" trademark, "OS", "os", or any other confusingly similar designation without specific prior
+*  written permission from Alliance for Sustainable Energy, LLC.
+*
+*  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDER(S) AND ANY CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+*  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+*  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER(S), ANY CONTRIBUTORS, THE UNITED STATES GOVERNMENT, OR THE UNITED
+*  STATES DEPARTMENT OF ENERGY, NOR ANY OF THEIR EMPLOYEES, BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+*  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF
+*  USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+*  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+*  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+***********************************************************************************************************************/
+
+#include "TabControllerCache.hpp"
+
+#include "MainTabController.hpp"
+#include "MainTabView.hpp"
+
+#include <algorithm>
+
+namespace openstudio {
+
+TabControllerCache::TabControllerCache(int maxSize, int maxWidgets) : m_maxSize(maxSize), m_maxWidgets(maxWidgets) {}
+
+void TabControllerCache::put(int verticalId, std::shared_ptr<MainTabController> controller) {
+  if (!controller || m_maxSize <= 0) {
+    return;
+  }
+
+  // an older entry for the same tab is replaced
+  m_entries.remove_if([verticalId](const Entry& entry) { return entry.verticalId == verticalId; });
+
+  auto numWidgets = controller->mainContentWidget()->findChildren<QWidget*>().size();
+  m_entries.push_front({verticalId, std::move(controller), static_cast<int>(numWidgets), false});
+
+  int totalWidgets = 0;
+  for (const auto& entry : m_entries) {
+    totalWidgets += entry.numWidgets;
+  }
+
+  while (static_cast<int>(m_entries.size()) > m_maxSize || (totalWidgets > m_maxWidgets && !m_entries.empty())) {
+    totalWidgets -= m_entries.back().numWidgets;
+    m_entries.pop_back();
+  }
+}
+
+std::shared_ptr<MainTabController> TabControllerCache::take(int verticalId) {
+  std::shared_ptr<MainTabController> result;
+
+  auto it = std::find_if(m_entries.begin(), m_entries.end(), [verticalId](const Entry& entry) { return entry.verticalId == verticalId; });
+  if (it != m_entries.end()) {
+    if (!it->dirty) {
+      result = std::move(it->controller);
+    }
+    // a dirty controller is destroyed here, before its replacement is built
+    m_entries.erase(it);
+  }
+
+  return result;
+}
+
+void TabControllerCache::markAllDirty() {
+  for (auto& entry : m_entries) {
+    entry.dirty = true;
+  }
+}
+
+void TabControllerCache::clear() {
+  m_entries.clear();
+}
+
+int TabControllerCache::size() const {
+  return static_cast<int>(m_entries.size());
+}
+
+}  // namespace openstudio
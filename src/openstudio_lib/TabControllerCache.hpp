@@ -0,0 +1,82 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) 2020-2022, OpenStudio Coalition and other contributors. All rights reserved.
+*
+*  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the
+*  following conditions are met:
+*
+*  (1) Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+*  disclaimer.
+*
+*  (2) Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following
+*  disclaimer in the documentation and/or other materials provided with the distribution.
+*
+*  (3) Neither the name of the copyright holder nor the names of any contributors may be used to endorse or promote products
+*  derived from this software without specific prior written permission from the respective party.
+*
+*  (4) Other than as required in clauses (1) and (2), distributions in any form of modifications or other derivative works
+*  may not use the "OpenStudio" trademark, "OS", "os", or any other confusingly similar designation without specific prior
+*  written permission from Alliance for Sustainable Energy, LLC.
+*
+*  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDER(S) AND ANY CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+*  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+*  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER(S), ANY CONTRIBUTORS, THE UNITED STATES GOVERNMENT, OR THE UNITED
+*  STATES DEPARTMENT OF ENERGY, NOR ANY OF THEIR EMPLOYEES, BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+*  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF
+*  USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+*  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+*  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+***********************************************************************************************************************/
+
+#ifndef OPENSTUDIO_TABCONTROLLERCACHE_HPP
+#define OPENSTUDIO_TABCONTROLLERCACHE_HPP
+
+#include "OpenStudioAPI.hpp"
+
+#include <list>
+#include <memory>
+
+namespace openstudio {
+
+class MainTabController;
+
+// Detached tab controllers kept by OSDocument for reuse when the user comes back to their vertical tab.
+// Entries are evicted least recently used first, once there are more than maxSize of them or once their views
+// hold more than maxWidgets widgets, which is used as an estimate of their memory.
+class OPENSTUDIO_API TabControllerCache
+{
+ public:
+  TabControllerCache(int maxSize, int maxWidgets);
+
+  // Keeps the controller of this tab, a maxSize of 0 disables the cache
+  void put(int verticalId, std::shared_ptr<MainTabController> controller);
+
+  // Returns the cached controller for this tab if it is still up to date, the entry is removed either way
+  std::shared_ptr<MainTabController> take(int verticalId);
+
+  // Every cached controller will be rebuilt rather than returned by take
+  void markAllDirty();
+
+  void clear();
+
+  int size() const;
+
+ private:
+  struct Entry
+  {
+    int verticalId;
+    std::shared_ptr<MainTabController> controller;
+    int numWidgets;
+    bool dirty;
+  };
+
+  // most recently used first
+  std::list<Entry> m_entries;
+
+  int m_maxSize;
+
+  int m_maxWidgets;
+};
+
+}  // namespace openstudio
+
+#endif  // OPENSTUDIO_TABCONTROLLERCACHE_HPP
@@ -297,9 +297,9 @@ void VRFThermalZoneDropZoneView::paint(QPainter* painter, const QStyleOptionGrap
     QFontMetrics m(font);
     QRectF t_textRec = m.boundingRect(m_text);
     if (t_textRec.width() > (t_rec.width() - 10)) {
-      painter->drawText(QRectF(5, 5, t_rec.width() - 10, t_rec.height() - 10), Qt::AlignLeft | Qt::AlignVCenter, m_text);
+      drawDetailedText(painter, QRectF(5, 5, t_rec.width() - 10, t_rec.height() - 10), Qt::AlignLeft | Qt::AlignVCenter, m_text);
     } else {
-      painter->drawText(QRectF(5, 5, t_rec.width() - 10, t_rec.height() - 10), Qt::AlignCenter, m_text);
+      drawDetailedText(painter, QRectF(5, 5, t_rec.width() - 10, t_rec.height() - 10), Qt::AlignCenter, m_text);
     }
   } else {
     OSDropZoneItem::paint(painter, option, widget);
@@ -379,45 +379,45 @@ void VRFSystemMiniView::paint(QPainter* painter, const QStyleOptionGraphicsItem*
 
   QRectF _headerRect = headerRect();
   painter->drawRect(_headerRect);
-  painter->drawText(QRectF(_headerRect.x() + 5, _headerRect.y() + 5, _headerRect.width() - 10, _headerRect.height() - 10),
-                    Qt::AlignVCenter | Qt::AlignLeft, m_name);
+  drawDetailedText(painter, QRectF(_headerRect.x() + 5, _headerRect.y() + 5, _headerRect.width() - 10, _headerRect.height() - 10),
+                   Qt::AlignVCenter | Qt::AlignLeft, m_name);
 
   QRectF _contentRect = contentRect();
   double x = _contentRect.x() + 5;
   double y = _contentRect.y() + 12;
 
-  painter->drawPixmap(x, y, m_vrfOutdoorPix);
+  drawDetailedPixmap(painter, QRectF(x, y, m_vrfOutdoorPix.width(), m_vrfOutdoorPix.height()), m_vrfOutdoorPix);
   x = x + m_vrfOutdoorPix.width() + 2;
 
-  painter->drawPixmap(x, y, m_vrfTransferPix);
+  drawDetailedPixmap(painter, QRectF(x, y, m_vrfTransferPix.width(), m_vrfTransferPix.height()), m_vrfTransferPix);
   x = x + m_vrfTerminalPix.width() + 2;
 
-  painter->drawPixmap(x, y, m_vrfTerminalPix);
+  drawDetailedPixmap(painter, QRectF(x, y, m_vrfTerminalPix.width(), m_vrfTerminalPix.height()), m_vrfTerminalPix);
   x = x + m_vrfTerminalPix.width() + 2;
 
   font.setPixelSize(12);
   font.setWeight(QFont::Bold);
   painter->setFont(font);
-  painter->drawText(QRectF(x, y, m_length, m_length / 2.0), Qt::AlignCenter, QString::number(m_terminals));
+  drawDetailedText(painter, QRectF(x, y, m_length, m_length / 2.0), Qt::AlignCenter, QString::number(m_terminals));
 
   font.setPixelSize(12);
   font.setWeight(QFont::Normal);
   painter->setFont(font);
-  painter->drawText(QRectF(x, y + m_length / 2.0, m_length, m_length / 2.0), Qt::AlignCenter, QString("Terminals"));
+  drawDetailedText(painter, QRectF(x, y + m_length / 2.0, m_length, m_length / 2.0), Qt::AlignCenter, QString("Terminals"));
   x = x + m_length;
 
-  painter->drawPixmap(x, y, m_vrfZonePix);
+  drawDetailedPixmap(painter, QRectF(x, y, m_vrfZonePix.width(), m_vrfZonePix.height()), m_vrfZonePix);
   x = x + m_vrfZonePix.width();
 
   font.setPixelSize(12);
   font.setWeight(QFont::Bold);
   painter->setFont(font);
-  painter->drawText(QRectF(x, y, m_length, m_length / 2.0), Qt::AlignCenter, QString::number(m_zones));
+  drawDetailedText(painter, QRectF(x, y, m_length, m_length / 2.0), Qt::AlignCenter, QString::number(m_zones));
 
   font.setPixelSize(12);
   font.setWeight(QFont::Normal);
   painter->setFont(font);
-  painter->drawText(QRectF(x, y + m_length / 2.0, m_length, m_length / 2.0), Qt::AlignCenter, QString("Zones"));
+  drawDetailedText(painter, QRectF(x, y + m_length / 2.0, m_length, m_length / 2.0), Qt::AlignCenter, QString("Zones"));
   x = x + m_length;
 }
 
@@ -437,7 +437,7 @@ void VRFSystemDropZoneView::paint(QPainter* painter, const QStyleOptionGraphicsI
   font.setPixelSize(24);
   painter->setFont(font);
   painter->setPen(QPen(QColor(109, 109, 109), 2, Qt::DashLine, Qt::RoundCap));
-  painter->drawText(boundingRect(), Qt::AlignCenter | Qt::TextWordWrap, "Drop VRF System");
+  drawDetailedText(painter, boundingRect(), Qt::AlignCenter | Qt::TextWordWrap, "Drop VRF System");
 }
 
 }  // namespace openstudio
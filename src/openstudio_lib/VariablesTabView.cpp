@@ -36,14 +36,17 @@
 
 #include "../model_editor/Utilities.hpp"
 
+#include <openstudio/utilities/core/Assert.hpp>
 #include <openstudio/utilities/sql/SqlFileEnums.hpp>
 
 #include <QHBoxLayout>
 #include <QVBoxLayout>
 #include <QLabel>
-#include <QScrollArea>
+#include <QListView>
 #include <QComboBox>
+#include <QPainter>
 #include <QPushButton>
+#include <QScrollBar>
 #include <QTimer>
 
 #include "../shared_gui_components/OSSwitch.hpp"
@@ -51,8 +54,40 @@
 
 #include <openstudio/utilities/idd/IddEnums.hxx>
 
+#include <algorithm>
+#include <tuple>
+
 namespace openstudio {
 
+namespace {
+
+// Height of a VariableListItem row, including its separator line
+constexpr int variableListItemHeight = 50;
+
+// Output variable names only depend on the type of the object, so they are computed once per type
+std::map<openstudio::IddObjectType, std::vector<std::string>>& outputVariableNamesByType() {
+  static std::map<openstudio::IddObjectType, std::vector<std::string>> namesByType;
+  return namesByType;
+}
+
+void cacheOutputVariableNames(const openstudio::model::ModelObject& t_modelObject) {
+  auto& namesByType = outputVariableNamesByType();
+  openstudio::IddObjectType type = t_modelObject.iddObject().type();
+  if (namesByType.find(type) == namesByType.end()) {
+    namesByType.emplace(type, t_modelObject.outputVariableNames());
+  }
+}
+
+openstudio::model::OutputVariable addOutputVariable(const std::string& t_name, const std::string& t_keyValue,
+                                                    openstudio::model::Model& t_model) {
+  openstudio::model::OutputVariable outputVariable(t_name, t_model);
+  outputVariable.setReportingFrequency("Hourly");
+  outputVariable.setKeyValue(t_keyValue);
+  return outputVariable;
+}
+
+}  // namespace
+
 VariableListItem::VariableListItem(const std::string& t_name, const std::string& t_keyValue,
                                    const boost::optional<openstudio::model::OutputVariable>& t_variable, const openstudio::model::Model& t_model)
   : m_name(t_name), m_keyValue(t_keyValue), m_variable(t_variable), m_model(t_model) {
@@ -88,17 +123,8 @@ VariableListItem::VariableListItem(const std::string& t_name, const std::string&
 }
 
 VariablesList::~VariablesList() {
-
-  for (auto itr = m_variables.begin(); itr != m_variables.end(); ++itr) {
-    //(*itr)->setParent(0);
-    //(*itr)->setStyleSheet("");
-    m_listLayout->removeWidget(*itr);
-    delete (*itr);
-  }
-
   delete m_allOnBtn;
   delete m_allOffBtn;
-  delete m_listLayout;
 }
 
 void VariableListItem::indexChanged(const QString& t_frequency) {
@@ -118,10 +144,7 @@ void VariableListItem::onOffClicked(bool t_on) {
 
   if (t_on) {
     if (!m_variable) {
-      openstudio::model::OutputVariable outputVariable(m_name, m_model);
-      outputVariable.setReportingFrequency("Hourly");
-      outputVariable.setKeyValue(m_keyValue);
-      m_variable = outputVariable;
+      m_variable = addOutputVariable(m_name, m_keyValue, m_model);
 
       m_combobox->bind<std::string>(
         *m_variable, static_cast<std::string (*)(const std::string&)>(&openstudio::toString),
@@ -129,17 +152,132 @@ void VariableListItem::onOffClicked(bool t_on) {
         std::bind(&model::OutputVariable::setReportingFrequency, m_variable.get_ptr(), std::placeholders::_1),
         boost::optional<NoFailAction>(std::bind(&model::OutputVariable::resetReportingFrequency, m_variable.get_ptr())),
         boost::optional<BasicQuery>(std::bind(&model::OutputVariable::isReportingFrequencyDefaulted, m_variable.get_ptr())));
+
+      emit variableChanged(m_variable);
     }
   } else {
     if (m_variable) {
       m_combobox->unbind();
       m_variable->remove();
       m_variable = boost::none;
+
+      emit variableChanged(m_variable);
     }
   }
 }
 
-VariablesList::VariablesList(openstudio::model::Model t_model) : m_model(t_model), m_dirty(true) {
+VariablesListModel::VariablesListModel(QObject* parent) : QAbstractListModel(parent) {}
+
+int VariablesListModel::rowCount(const QModelIndex& parent) const {
+  if (parent.isValid()) {
+    return 0;
+  }
+
+  return static_cast<int>(m_variables.size());
+}
+
+QVariant VariablesListModel::data(const QModelIndex& index, int role) const {
+  if (!index.isValid() || index.row() >= rowCount()) {
+    return {};
+  }
+
+  if (role == Qt::DisplayRole) {
+    const PotentialOutputVariable& pov = m_variables[index.row()];
+    return openstudio::toQString(pov.name + ", " + pov.keyValue);
+  }
+
+  return {};
+}
+
+void VariablesListModel::setVariables(std::vector<PotentialOutputVariable> t_variables) {
+  beginResetModel();
+  m_variables = std::move(t_variables);
+  endResetModel();
+}
+
+std::vector<PotentialOutputVariable>::const_iterator VariablesListModel::lowerBound(const std::string& t_name,
+                                                                                     const std::string& t_keyValue) const {
+  return std::lower_bound(m_variables.begin(), m_variables.end(), std::make_pair(t_name, t_keyValue),
+                          [](const PotentialOutputVariable& pov, const std::pair<std::string, std::string>& key) {
+                            return std::tie(pov.name, pov.keyValue) < std::tie(key.first, key.second);
+                          });
+}
+
+int VariablesListModel::insertVariable(const PotentialOutputVariable& t_variable) {
+  auto it = lowerBound(t_variable.name, t_variable.keyValue);
+  int row = static_cast<int>(std::distance(m_variables.cbegin(), it));
+
+  if (it != m_variables.end() && it->name == t_variable.name && it->keyValue == t_variable.keyValue) {
+    return row;
+  }
+
+  beginInsertRows(QModelIndex(), row, row);
+  m_variables.insert(m_variables.begin() + row, t_variable);
+  endInsertRows();
+
+  return row;
+}
+
+void VariablesListModel::removeVariable(int t_row) {
+  OS_ASSERT(t_row >= 0 && t_row < rowCount());
+
+  beginRemoveRows(QModelIndex(), t_row, t_row);
+  m_variables.erase(m_variables.begin() + t_row);
+  endRemoveRows();
+}
+
+int VariablesListModel::row(const std::string& t_name, const std::string& t_keyValue) const {
+  auto it = lowerBound(t_name, t_keyValue);
+
+  if (it != m_variables.end() && it->name == t_name && it->keyValue == t_keyValue) {
+    return static_cast<int>(std::distance(m_variables.cbegin(), it));
+  }
+
+  return -1;
+}
+
+const PotentialOutputVariable& VariablesListModel::variable(int t_row) const {
+  OS_ASSERT(t_row >= 0 && t_row < rowCount());
+
+  return m_variables[t_row];
+}
+
+void VariablesListModel::setOutputVariable(int t_row, const boost::optional<openstudio::model::OutputVariable>& t_variable) {
+  OS_ASSERT(t_row >= 0 && t_row < rowCount());
+
+  m_variables[t_row].variable = t_variable;
+
+  emit dataChanged(index(t_row), index(t_row));
+}
+
+VariableListItemDelegate::VariableListItemDelegate(QAbstractItemView* t_view) : QStyledItemDelegate(t_view), m_view(t_view) {}
+
+void VariableListItemDelegate::paint(QPainter* painter, const QStyleOptionViewItem& option, const QModelIndex& index) const {
+  painter->save();
+
+  // Stand in for the row until its VariableListItem is created
+  if (!m_view->indexWidget(index)) {
+    painter->setPen(option.palette.color(QPalette::WindowText));
+    painter->drawText(option.rect.adjusted(70, 0, -220, 0), Qt::AlignLeft | Qt::AlignVCenter, index.data().toString());
+  }
+
+  painter->setPen(option.palette.color(QPalette::Mid));
+  painter->drawLine(option.rect.left(), option.rect.bottom(), option.rect.right(), option.rect.bottom());
+
+  painter->restore();
+}
+
+QSize VariableListItemDelegate::sizeHint(const QStyleOptionViewItem& /*option*/, const QModelIndex& /*index*/) const {
+  return {0, variableListItemHeight};
+}
+
+VariablesList::VariablesList(openstudio::model::Model t_model)
+  : m_model(t_model),
+    m_variablesModel(new VariablesListModel(this)),
+    m_delegate(nullptr),
+    m_listView(new QListView()),
+    m_dirty(false),
+    m_visibleItemsDirty(false) {
   t_model.getImpl<openstudio::model::detail::Model_Impl>()->addWorkspaceObject.connect<VariablesList, &VariablesList::onAdded>(this);
 
   t_model.getImpl<openstudio::model::detail::Model_Impl>()->removeWorkspaceObject.connect<VariablesList, &VariablesList::onRemoved>(this);
@@ -168,10 +306,25 @@ VariablesList::VariablesList(openstudio::model::Model t_model) : m_model(t_model
 
   vbox->addLayout(outerbox);
 
-  m_listLayout = new QVBoxLayout();
-  vbox->addLayout(m_listLayout);
-
-  updateVariableList();
+  // Only the rows in view get a VariableListItem, the model can hold thousands of variables
+  m_delegate = new VariableListItemDelegate(m_listView);
+  m_listView->setModel(m_variablesModel);
+  m_listView->setItemDelegate(m_delegate);
+  m_listView->setFrameStyle(QFrame::NoFrame);
+  m_listView->setSelectionMode(QAbstractItemView::NoSelection);
+  m_listView->setVerticalScrollMode(QAbstractItemView::ScrollPerPixel);
+  m_listView->setHorizontalScrollBarPolicy(Qt::ScrollBarAlwaysOff);
+  m_listView->setUniformItemSizes(true);
+  m_listView->viewport()->setAutoFillBackground(false);
+  vbox->addWidget(m_listView, 10);
+
+  connect(m_listView->verticalScrollBar(), &QScrollBar::valueChanged, this, &VariablesList::scheduleVisibleItemsUpdate);
+  connect(m_listView->verticalScrollBar(), &QScrollBar::rangeChanged, this, &VariablesList::scheduleVisibleItemsUpdate);
+  connect(m_variablesModel, &VariablesListModel::rowsInserted, this, &VariablesList::scheduleVisibleItemsUpdate);
+  connect(m_variablesModel, &VariablesListModel::rowsRemoved, this, &VariablesList::scheduleVisibleItemsUpdate);
+  connect(m_variablesModel, &VariablesListModel::modelReset, this, &VariablesList::scheduleVisibleItemsUpdate);
+
+  buildVariableList();
 }
 
 void VariablesList::allOnClicked() {
@@ -183,19 +336,40 @@ void VariablesList::allOffClicked() {
 }
 
 void VariablesList::enableAll(bool t_enabled) {
-  for (auto itr = m_variables.begin(); itr != m_variables.end(); ++itr) {
-    (*itr)->setVariableEnabled(t_enabled);
+  for (int row = 0; row < m_variablesModel->rowCount(); ++row) {
+    if (auto* item = qobject_cast<VariableListItem*>(m_listView->indexWidget(m_variablesModel->index(row)))) {
+      item->setVariableEnabled(t_enabled);
+    } else {
+      const PotentialOutputVariable& pov = m_variablesModel->variable(row);
+
+      if (t_enabled && !pov.variable) {
+        m_variablesModel->setOutputVariable(row, addOutputVariable(pov.name, pov.keyValue, m_model));
+      } else if (!t_enabled && pov.variable) {
+        openstudio::model::OutputVariable outputVariable = pov.variable.get();
+        outputVariable.remove();
+        m_variablesModel->setOutputVariable(row, boost::none);
+      }
+    }
   }
 }
 
-void VariablesList::onAdded(const WorkspaceObject&, const openstudio::IddObjectType& type, const openstudio::UUID&) {
+void VariablesList::onAdded(const WorkspaceObject& t_object, const openstudio::IddObjectType& type, const openstudio::UUID&) {
   LOG(Debug, "onAdded: " << type.valueName());
 
   /// \todo if the user is able to add an output variable through some other means it will not show up here and now
   if (type != openstudio::IddObjectType::OS_Output_Variable) {
-    if (!m_dirty) {
-      m_dirty = true;
-      QTimer::singleShot(0, this, &VariablesList::updateVariableList);
+    // only the first object of a type can bring new variable names
+    if (m_typeCounts[type]++ == 0) {
+      if (boost::optional<openstudio::model::ModelObject> modelObject = t_object.optionalCast<openstudio::model::ModelObject>()) {
+        cacheOutputVariableNames(*modelObject);
+      }
+
+      m_changedTypes.insert(type);
+
+      if (!m_dirty) {
+        m_dirty = true;
+        QTimer::singleShot(0, this, &VariablesList::updateVariableList);
+      }
     }
   }
 }
@@ -205,41 +379,43 @@ void VariablesList::onRemoved(const WorkspaceObject&, const openstudio::IddObjec
 
   /// \todo if the user is remove to add an output variable through some other means it will not show up here and now
   if (type != openstudio::IddObjectType::OS_Output_Variable) {
-    if (!m_dirty) {
-      m_dirty = true;
-      QTimer::singleShot(0, this, &VariablesList::updateVariableList);
+    // only removing the last object of a type can drop variable names
+    auto it = m_typeCounts.find(type);
+    if (it != m_typeCounts.end() && it->second > 0 && --it->second == 0) {
+      m_changedTypes.insert(type);
+
+      if (!m_dirty) {
+        m_dirty = true;
+        QTimer::singleShot(0, this, &VariablesList::updateVariableList);
+      }
     }
   }
 }
 
-struct PotentialOutputVariable
-{
-  std::string name;
-  std::string keyValue;
-  boost::optional<openstudio::model::OutputVariable> variable;
-};
-
-void VariablesList::updateVariableList() {
-  m_variables.clear();
-  while (m_listLayout->count() > 0) {
-    QLayoutItem* qli = m_listLayout->takeAt(0);
-    delete qli->widget();
-    delete qli;
+void VariablesList::buildVariableList() {
+  // count the objects of each type, output variable names are only asked for once per type
+  for (const openstudio::model::ModelObject& modelObject : m_model.getModelObjects<openstudio::model::ModelObject>()) {
+    openstudio::IddObjectType type = modelObject.iddObject().type();
+    if (type != openstudio::IddObjectType::OS_Output_Variable) {
+      if (m_typeCounts[type]++ == 0) {
+        cacheOutputVariableNames(modelObject);
+      }
+    }
   }
 
-  // map of variable name + keyValue to PotentialOutputVariable
-  std::map<std::string, PotentialOutputVariable> potentialOutputVariableMap;
+  // map of variable name and keyValue to PotentialOutputVariable
+  std::map<std::pair<std::string, std::string>, PotentialOutputVariable> potentialOutputVariableMap;
 
   // make list of all potential variables
-  for (const openstudio::model::ModelObject& modelObject : m_model.getModelObjects<openstudio::model::ModelObject>()) {
-    for (const std::string& variableName : modelObject.outputVariableNames()) {
-      //LOG(Debug, "Found variableName: " << variableName);
-      std::string variableNameKeyValue = variableName + "*";
-      if (potentialOutputVariableMap.count(variableNameKeyValue) == 0) {
+  for (const auto& typeCount : m_typeCounts) {
+    m_activeTypes.insert(typeCount.first);
+
+    for (const std::string& variableName : outputVariableNamesByType()[typeCount.first]) {
+      if (m_nameRefCounts[variableName]++ == 0) {
         PotentialOutputVariable pov;
         pov.name = variableName;
         pov.keyValue = "*";
-        potentialOutputVariableMap.insert(std::pair<std::string, PotentialOutputVariable>(variableNameKeyValue, pov));
+        potentialOutputVariableMap.emplace(std::make_pair(variableName, pov.keyValue), pov);
       }
     }
   }
@@ -248,23 +424,24 @@ void VariablesList::updateVariableList() {
   for (openstudio::model::OutputVariable outputVariable : m_model.getConcreteModelObjects<openstudio::model::OutputVariable>()) {
     std::string variableName = outputVariable.variableName();
     std::string keyValue = outputVariable.keyValue();
-    std::string variableNameKeyValue = variableName + keyValue;
+    auto variableNameKeyValue = std::make_pair(variableName, keyValue);
 
-    if (potentialOutputVariableMap.count(variableNameKeyValue) == 0) {
+    auto it = potentialOutputVariableMap.find(variableNameKeyValue);
+    if (it == potentialOutputVariableMap.end()) {
       // DLM: this was causing too much trouble because it kept deleting variables added by users
       // there is no place for this outputvariable with the current objects, delete it.
       //outputVariable.remove();
 
       // user defined variable, add it to the list
       PotentialOutputVariable pov;
-      pov.name = outputVariable.variableName();
-      pov.keyValue = outputVariable.keyValue();
+      pov.name = variableName;
+      pov.keyValue = keyValue;
       pov.variable = outputVariable;
-      potentialOutputVariableMap.insert(std::pair<std::string, PotentialOutputVariable>(variableNameKeyValue, pov));
+      potentialOutputVariableMap.emplace(variableNameKeyValue, pov);
 
     } else {
 
-      if (potentialOutputVariableMap[variableNameKeyValue].variable) {
+      if (it->second.variable) {
         // already have output variable for this name + keyName, then remove this object
         outputVariable.remove();
       } else {
@@ -274,37 +451,150 @@ void VariablesList::updateVariableList() {
         // DLM: we know this is already '*' because all predefined variables are set to '*'
         //outputVariable.setKeyValue("*");
 
-        potentialOutputVariableMap[variableNameKeyValue].variable = outputVariable;
+        it->second.variable = outputVariable;
       }
     }
   }
 
-  for (auto itr = potentialOutputVariableMap.begin(); itr != potentialOutputVariableMap.end(); ++itr) {
-    auto* hline = new QFrame();
-    hline->setFrameShape(QFrame::HLine);
-    hline->setFrameShadow(QFrame::Sunken);
-    m_listLayout->addWidget(hline);
+  std::vector<PotentialOutputVariable> variables;
+  variables.reserve(potentialOutputVariableMap.size());
+  for (auto& entry : potentialOutputVariableMap) {
+    variables.push_back(std::move(entry.second));
+  }
 
-    PotentialOutputVariable pov = itr->second;
+  m_variablesModel->setVariables(std::move(variables));
+}
 
-    //LOG(Debug, "Creating VariableListItem for: " << pov.name << ", " << pov.keyValue);
-    auto* li = new VariableListItem(pov.name, pov.keyValue, pov.variable, m_model);
-    m_listLayout->addWidget(li);
-    m_variables.push_back(li);
+void VariablesList::updateVariableList() {
+  for (const openstudio::IddObjectType& type : m_changedTypes) {
+    bool isActive = m_activeTypes.count(type) != 0;
+    bool shouldBeActive = m_typeCounts[type] > 0;
+
+    if (shouldBeActive && !isActive) {
+      addPotentialVariables(type);
+    } else if (!shouldBeActive && isActive) {
+      removePotentialVariables(type);
+    }
   }
 
-  m_listLayout->addStretch();
+  m_changedTypes.clear();
 
   m_dirty = false;
 }
 
+void VariablesList::addPotentialVariables(const openstudio::IddObjectType& t_type) {
+  m_activeTypes.insert(t_type);
+
+  auto& namesByType = outputVariableNamesByType();
+  auto it = namesByType.find(t_type);
+  if (it == namesByType.end()) {
+    return;
+  }
+
+  for (const std::string& variableName : it->second) {
+    if (m_nameRefCounts[variableName]++ == 0) {
+      PotentialOutputVariable pov;
+      pov.name = variableName;
+      pov.keyValue = "*";
+      m_variablesModel->insertVariable(pov);
+    }
+  }
+}
+
+void VariablesList::removePotentialVariables(const openstudio::IddObjectType& t_type) {
+  m_activeTypes.erase(t_type);
+
+  auto& namesByType = outputVariableNamesByType();
+  auto it = namesByType.find(t_type);
+  if (it == namesByType.end()) {
+    return;
+  }
+
+  for (const std::string& variableName : it->second) {
+    auto refCount = m_nameRefCounts.find(variableName);
+    if (refCount == m_nameRefCounts.end() || --refCount->second > 0) {
+      continue;
+    }
+
+    m_nameRefCounts.erase(refCount);
+
+    // a variable the user turned on stays listed, as it did when the list was rebuilt
+    int row = m_variablesModel->row(variableName, "*");
+    if (row > -1 && !m_variablesModel->variable(row).variable) {
+      m_variablesModel->removeVariable(row);
+    }
+  }
+}
+
+VariableListItem* VariablesList::materializeItem(const QModelIndex& t_index) {
+  if (auto* item = qobject_cast<VariableListItem*>(m_listView->indexWidget(t_index))) {
+    return item;
+  }
+
+  const PotentialOutputVariable& pov = m_variablesModel->variable(t_index.row());
+
+  auto* item = new VariableListItem(pov.name, pov.keyValue, pov.variable, m_model);
+
+  QPersistentModelIndex persistentIndex(t_index);
+  connect(item, &VariableListItem::variableChanged, this,
+          [this, persistentIndex](const boost::optional<openstudio::model::OutputVariable>& variable) {
+            if (persistentIndex.isValid()) {
+              m_variablesModel->setOutputVariable(persistentIndex.row(), variable);
+            }
+          });
+
+  m_listView->setIndexWidget(t_index, item);
+  m_materializedIndexes.push_back(persistentIndex);
+
+  return item;
+}
+
+void VariablesList::scheduleVisibleItemsUpdate() {
+  if (!m_visibleItemsDirty) {
+    m_visibleItemsDirty = true;
+    QTimer::singleShot(0, this, &VariablesList::updateVisibleItems);
+  }
+}
+
+void VariablesList::updateVisibleItems() {
+  if (!m_visibleItemsDirty) {
+    return;
+  }
+
+  m_visibleItemsDirty = false;
+
+  // all rows have the same height, so the rows in view follow from the scroll position
+  const int top = m_listView->verticalScrollBar()->value();
+  const int firstRow = top / variableListItemHeight;
+  const int lastRow = std::min(m_variablesModel->rowCount() - 1, (top + m_listView->viewport()->height()) / variableListItemHeight);
+
+  // keep a viewport worth of rows on either side so small scrolls do not recreate widgets
+  const int margin = std::max(lastRow - firstRow + 1, 1);
+
+  std::vector<QPersistentModelIndex> keptIndexes;
+  for (const auto& index : m_materializedIndexes) {
+    if (!index.isValid()) {
+      continue;
+    }
+
+    if (index.row() >= firstRow - margin && index.row() <= lastRow + margin) {
+      keptIndexes.push_back(index);
+    } else {
+      m_listView->setIndexWidget(index, nullptr);
+    }
+  }
+  m_materializedIndexes = keptIndexes;
+
+  for (int row = firstRow; row <= lastRow; ++row) {
+    materializeItem(m_variablesModel->index(row));
+  }
+}
+
 VariablesTabView::VariablesTabView(openstudio::model::Model t_model, QWidget* parent)
   : MainTabView("Output Variables", MainTabView::MAIN_TAB, parent) {
-  auto* scrollarea = new QScrollArea();
+  // VariablesList scrolls its own rows
   auto* vl = new VariablesList(t_model);
-  scrollarea->setWidget(vl);
-  scrollarea->setWidgetResizable(true);
-  addTabWidget(scrollarea);
+  addTabWidget(vl);
   vl->setAutoFillBackground(false);
 }
 
@@ -37,9 +37,16 @@
 #include <openstudio/nano/nano_signal_slot.hpp>  // Signal-Slot replacement
 #include <boost/optional.hpp>
 
+#include <QAbstractListModel>
+#include <QPersistentModelIndex>
+#include <QStyledItemDelegate>
+
+#include <map>
+#include <set>
+
 class QComboBox;
+class QListView;
 class QPushButton;
-class QVBoxLayout;
 
 namespace openstudio {
 class OSSwitch2;
@@ -57,6 +64,10 @@ class VariableListItem
 
   virtual ~VariableListItem() {}
 
+ signals:
+  // Emitted when the item creates or removes its OutputVariable
+  void variableChanged(const boost::optional<openstudio::model::OutputVariable>& variable);
+
  public slots:
   void setVariableEnabled(bool);
 
@@ -76,6 +87,66 @@ class VariableListItem
   OSSwitch2* m_onOffButton;
 };
 
+struct PotentialOutputVariable
+{
+  std::string name;
+  std::string keyValue;
+  boost::optional<openstudio::model::OutputVariable> variable;
+};
+
+// One row per potential output variable, sorted by variable name then key value
+class VariablesListModel : public QAbstractListModel
+{
+  Q_OBJECT;
+
+ public:
+  explicit VariablesListModel(QObject* parent = nullptr);
+
+  virtual ~VariablesListModel() {}
+
+  int rowCount(const QModelIndex& parent = QModelIndex()) const override;
+
+  QVariant data(const QModelIndex& index, int role = Qt::DisplayRole) const override;
+
+  // t_variables must be sorted by name then key value
+  void setVariables(std::vector<PotentialOutputVariable> t_variables);
+
+  // Inserts the variable at its sorted position, returns its row
+  int insertVariable(const PotentialOutputVariable& t_variable);
+
+  void removeVariable(int t_row);
+
+  // Returns -1 if there is no such row
+  int row(const std::string& t_name, const std::string& t_keyValue) const;
+
+  const PotentialOutputVariable& variable(int t_row) const;
+
+  void setOutputVariable(int t_row, const boost::optional<openstudio::model::OutputVariable>& t_variable);
+
+ private:
+  std::vector<PotentialOutputVariable>::const_iterator lowerBound(const std::string& t_name, const std::string& t_keyValue) const;
+
+  std::vector<PotentialOutputVariable> m_variables;
+};
+
+// Paints the row separators, and a stand in label for rows without a VariableListItem yet
+class VariableListItemDelegate : public QStyledItemDelegate
+{
+  Q_OBJECT;
+
+ public:
+  explicit VariableListItemDelegate(QAbstractItemView* t_view);
+
+  virtual ~VariableListItemDelegate() {}
+
+  void paint(QPainter* painter, const QStyleOptionViewItem& option, const QModelIndex& index) const override;
+
+  QSize sizeHint(const QStyleOptionViewItem& option, const QModelIndex& index) const override;
+
+ private:
+  QAbstractItemView* m_view;
+};
+
 class VariablesList
   : public QWidget
   , public Nano::Observer
@@ -96,14 +167,37 @@ class VariablesList
   void enableAll(bool);
   void updateVariableList();
 
+  void scheduleVisibleItemsUpdate();
+  void updateVisibleItems();
+
  private:
   REGISTER_LOGGER("openstudio.VariablesList");
+
+  void buildVariableList();
+  void addPotentialVariables(const openstudio::IddObjectType& t_type);
+  void removePotentialVariables(const openstudio::IddObjectType& t_type);
+
+  // Creates the VariableListItem widget for a row if it does not exist yet
+  VariableListItem* materializeItem(const QModelIndex& t_index);
+
   openstudio::model::Model m_model;
   QPushButton* m_allOnBtn;
   QPushButton* m_allOffBtn;
-  QVBoxLayout* m_listLayout;
+  VariablesListModel* m_variablesModel;
+  VariableListItemDelegate* m_delegate;
+  QListView* m_listView;
+  // number of objects of each type in the model
+  std::map<openstudio::IddObjectType, unsigned> m_typeCounts;
+  // types whose output variable names are currently listed
+  std::set<openstudio::IddObjectType> m_activeTypes;
+  // types whose count went to or from zero since the last update
+  std::set<openstudio::IddObjectType> m_changedTypes;
+  // number of active types providing each output variable name
+  std::map<std::string, unsigned> m_nameRefCounts;
+  // rows which currently have a VariableListItem, only those in or near the viewport
+  std::vector<QPersistentModelIndex> m_materializedIndexes;
   bool m_dirty;
-  std::vector<VariableListItem*> m_variables;
+  bool m_visibleItemsDirty;
 };
 
 class VariablesTabView : public MainTabView
@@ -0,0 +1,125 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) 2020-2022, OpenStudio Coalition and other contributors. All rights reserved.
+*
+*  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the
+*  following conditions are met:
+*
+*  (1) Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+*  disclaimer.
+*
+*  (2) Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following
+*  disclaimer in the documentation and/or other materials provided with the distribution.
+*
+*  (3) Neither the name of the copyright holder nor the names of any contributors may be used to endorse or promote products
+*  derived from this software without specific prior written permission from the respective party.
+*
+*  (4) Other than as required in clauses (1) and (2), distributions in any form of modifications or other derivative works
+*  may not use the "OpenStudio" trademark, "OS", "os", or any other confusingly similar designation without specific prior
+*  written permission from Alliance for Sustainable Energy, LLC.
+*
+*  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDER(S) AND ANY CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+*  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+*  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER(S), ANY CONTRIBUTORS, THE UNITED STATES GOVERNMENT, OR THE UNITED
+*  STATES DEPARTMENT OF ENERGY, NOR ANY OF THEIR EMPLOYEES, BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+*  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF
+*  USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+*  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+*  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+***********************************************************************************************************************/
+
+#include <gtest/gtest.h>
+
+#include "OpenStudioLibFixture.hpp"
+
+#include "../ComponentLibraryCache.hpp"
+
+#include <openstudio/OpenStudio.hxx>
+
+#include <openstudio/model/Model.hpp>
+#include <openstudio/model/Space.hpp>
+#include <openstudio/model/ThermalZone.hpp>
+
+#include <openstudio/utilities/core/Filesystem.hpp>
+#include <openstudio/utilities/core/PathHelpers.hpp>
+
+#include <fstream>
+
+using namespace openstudio;
+
+static openstudio::path makeLibrary(const openstudio::path& dir) {
+  model::Model library;
+  model::ThermalZone(library).setName("Library Zone");
+  openstudio::path libPath = dir / toPath("library.osm");
+  EXPECT_TRUE(library.save(libPath, true));
+  return libPath;
+}
+
+static void touch(const openstudio::path& p) {
+  std::ofstream file(p.string());
+  file << "Version,0.0.0;";
+}
+
+TEST_F(OpenStudioLibFixture, ComponentLibraryCache_Load) {
+  openstudio::path dir = toPath("./ComponentLibraryCache_GTest_Load");
+  removeDirectory(dir);
+  openstudio::filesystem::create_directories(dir);
+
+  openstudio::path libPath = makeLibrary(dir);
+  ComponentLibraryCache cache(dir / toPath("Libraries"));
+
+  // keyed by the library contents and the OpenStudio version
+  openstudio::path cachePath = cache.cachePath(libPath);
+  ASSERT_FALSE(cachePath.empty());
+  EXPECT_EQ(dir / toPath("Libraries"), cachePath.parent_path());
+  EXPECT_EQ(0u, cachePath.filename().string().find("library_"));
+  EXPECT_NE(std::string::npos, cachePath.filename().string().find("_" + openStudioVersion() + ".osm"));
+  EXPECT_TRUE(cache.cachePath(dir / toPath("missing.osm")).empty());
+
+  // the first load translates the library and writes the copy
+  boost::optional<model::Model> library = ComponentLibraryCache::load(libPath, cachePath);
+  ASSERT_TRUE(library);
+  EXPECT_EQ(1u, library->getConcreteModelObjects<model::ThermalZone>().size());
+  ASSERT_TRUE(exists(cachePath));
+
+  // mark the copy to tell it apart from the library, the next load must return it
+  boost::optional<model::Model> cached = model::Model::load(cachePath);
+  ASSERT_TRUE(cached);
+  model::Space(*cached).setName("Cached Space");
+  ASSERT_TRUE(cached->save(cachePath, true));
+
+  library = ComponentLibraryCache::load(libPath, cachePath);
+  ASSERT_TRUE(library);
+  EXPECT_EQ(1u, library->getConcreteModelObjects<model::Space>().size());
+
+  // a changed library gets another key
+  model::ThermalZone(*library).setName("Another Zone");
+  ASSERT_TRUE(library->save(libPath, true));
+  EXPECT_NE(cachePath, cache.cachePath(libPath));
+}
+
+TEST_F(OpenStudioLibFixture, ComponentLibraryCache_Prune) {
+  openstudio::path dir = toPath("./ComponentLibraryCache_GTest_Prune");
+  removeDirectory(dir);
+  openstudio::path cacheDir = dir / toPath("Libraries");
+  openstudio::filesystem::create_directories(cacheDir);
+
+  const std::string version = openStudioVersion();
+  openstudio::path used = cacheDir / toPath("hvac_library_abc_" + version + ".osm");
+  openstudio::path unused = cacheDir / toPath("hvac_library_def_" + version + ".osm");
+  openstudio::path otherVersion = cacheDir / toPath("hvac_library_abc_0.0.1.osm");
+  openstudio::path otherVersionSuffix = cacheDir / toPath("hvac_library_abc_1" + version + ".osm");
+  openstudio::path inProgress = cacheDir / toPath("hvac_library_ghi_" + version + ".osm.tmp{1234}");
+  for (const auto& p : {used, unused, otherVersion, otherVersionSuffix, inProgress}) {
+    touch(p);
+  }
+
+  ComponentLibraryCache cache(cacheDir);
+  cache.prune({used});
+
+  EXPECT_TRUE(exists(used));
+  EXPECT_FALSE(exists(unused));
+  // another OpenStudio version sharing the cache directory keeps its copies
+  EXPECT_TRUE(exists(otherVersion));
+  EXPECT_TRUE(exists(otherVersionSuffix));
+  EXPECT_TRUE(exists(inProgress));
+}
@@ -157,4 +157,49 @@ TEST_F(OpenStudioLibFixture, DesignDayGridView) {
   checkExpected(objectSelector, gridView, 1, 2, 3, boost::none, designDay2, true, true, false, false, false, "0000");  // Month
   checkExpected(objectSelector, gridView, 1, 2, 4, boost::none, designDay2, true, true, false, false, false, "000");   // Day Type
   checkExpected(objectSelector, gridView, 1, 2, 5, boost::none, designDay2, true, true, false, false, false, "000");   // DST
-}
\ No newline at end of file
+}
+
+TEST_F(OpenStudioLibFixture, DesignDayGridView_RemoveRow) {
+
+  model::Model model = model::exampleModel();
+  auto designDays = model.getConcreteModelObjects<model::DesignDay>();
+  std::sort(designDays.begin(), designDays.end(), WorkspaceObjectNameLess());
+
+  ASSERT_EQ(2u, designDays.size());
+  auto designDay1 = designDays[0];
+  auto designDay2 = designDays[1];
+
+  auto ddGridView = std::make_shared<DesignDayGridView>(false, model);
+  auto* gridController = getGridController(ddGridView.get());
+  auto* gridView = getGridView(ddGridView.get());
+  auto* objectSelector = getObjectSelector(gridController);
+
+  processEvents();
+
+  // the grid is not shown, connect it to the model by hand
+  gridController->connectToModelSignals();
+
+  EXPECT_EQ(3, gridController->rowCount());
+  checkExpected(objectSelector, gridView, 1, 2, 0, boost::none, designDay2, true, true, false, false, false, "000");  // Name
+
+  designDay1.remove();
+
+  processEvents();
+
+  // the row is gone and the row below moved up without being recreated
+  EXPECT_EQ(2, gridController->rowCount());
+  auto modelObjects = gridController->modelObjects();
+  ASSERT_EQ(1u, modelObjects.size());
+  EXPECT_EQ(designDay2.handle(), modelObjects[0].handle());
+
+  checkExpected(objectSelector, gridView, 0, 1, 0, boost::none, designDay2, true, true, false, false, false, "000");   // Name
+  checkExpected(objectSelector, gridView, 0, 1, 1, boost::none, designDay2, true, true, false, true, false, "000");    // Selector
+  checkExpected(objectSelector, gridView, 0, 1, 2, boost::none, designDay2, true, true, false, false, false, "0000");  // Day of Month
+  checkExpected(objectSelector, gridView, 0, 1, 3, boost::none, designDay2, true, true, false, false, false, "0000");  // Month
+  checkExpected(objectSelector, gridView, 0, 1, 4, boost::none, designDay2, true, true, false, false, false, "000");   // Day Type
+  checkExpected(objectSelector, gridView, 0, 1, 5, boost::none, designDay2, true, true, false, false, false, "000");   // DST
+
+  EXPECT_FALSE(getGridCellLocationAt(objectSelector, 1, 2, 0, boost::none));
+
+  gridController->disconnectFromModelSignals();
+}
@@ -128,3 +128,58 @@ TEST_F(OpenStudioLibFixture, FacilityStoriesGridView) {
     }
   }
 }
+
+TEST_F(OpenStudioLibFixture, FacilityStoriesGridView_BatchedCellChanges) {
+
+  model::Model m;
+  model::BuildingStory s1(m);
+  s1.setNominalZCoordinate(0);
+  model::BuildingStory s2(m);
+  s2.setNominalZCoordinate(3);
+  model::BuildingStory s3(m);
+  s3.setNominalZCoordinate(6);
+
+  auto gridView = std::make_shared<FacilityStoriesGridView>(false, m);
+  auto* gridController = getGridController(gridView.get());
+  auto* objectSelector = getObjectSelector(gridController);
+
+  processEvents();
+
+  int numCellChanged = 0;
+  int numCellsChanged = 0;
+  size_t numChanges = 0;
+  QObject::connect(objectSelector, &OSObjectSelector::gridCellChanged, [&numCellChanged](const GridCellLocation&, const GridCellInfo&) {
+    ++numCellChanged;
+  });
+  QObject::connect(objectSelector, &OSObjectSelector::gridCellsChanged,
+                   [&numCellsChanged, &numChanges](const std::vector<std::pair<const GridCellLocation*, const GridCellInfo*>>& changes) {
+                     ++numCellsChanged;
+                     numChanges += changes.size();
+                   });
+
+  // hiding every story reports all the changed cells at once
+  gridController->setObjectFilter([](const model::ModelObject&) -> bool { return false; });
+  EXPECT_EQ(0, numCellChanged);
+  EXPECT_EQ(1, numCellsChanged);
+  EXPECT_LT(0u, numChanges);
+
+  // nothing changes, nothing is reported
+  gridController->setObjectFilter([](const model::ModelObject&) -> bool { return false; });
+  EXPECT_EQ(0, numCellChanged);
+  EXPECT_EQ(1, numCellsChanged);
+
+  gridController->setObjectFilter([](const model::ModelObject&) -> bool { return true; });
+  EXPECT_EQ(0, numCellChanged);
+  EXPECT_EQ(2, numCellsChanged);
+
+  objectSelector->selectAll();
+  EXPECT_EQ(0, numCellChanged);
+  EXPECT_EQ(3, numCellsChanged);
+  EXPECT_EQ(3u, objectSelector->selectedObjects().size());
+
+  // single selection changes are still reported cell by cell
+  objectSelector->setObjectSelected(s1, false);
+  EXPECT_LT(0, numCellChanged);
+  EXPECT_EQ(3, numCellsChanged);
+  EXPECT_EQ(2u, objectSelector->selectedObjects().size());
+}
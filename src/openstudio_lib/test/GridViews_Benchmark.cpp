@@ -0,0 +1,320 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) 2020-2022, OpenStudio Coalition and other contributors. All rights reserved.
+*
+*  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the
+*  following conditions are met:
+*
+*  (1) Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+*  disclaimer.
+*
+*  (2) Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following
+*  disclaimer in the documentation and/or other materials provided with the distribution.
+*
+*  (3) Neither the name of the copyright holder nor the names of any contributors may be used to endorse or promote products
+*  derived from this software without specific prior written permission from the respective party.
+*
+*  (4) Other than as required in clauses (1) and (2), distributions in any form of modifications or other derivative works
+*  may not use the "OpenStudio" trademark, "OS", "os", or any other confusingly similar designation without specific prior
+*  written permission from Alliance for Sustainable Energy, LLC.
+*
+*  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDER(S) AND ANY CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+*  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+*  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER(S), ANY CONTRIBUTORS, THE UNITED STATES GOVERNMENT, OR THE UNITED
+*  STATES DEPARTMENT OF ENERGY, NOR ANY OF THEIR EMPLOYEES, BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+*  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF
+*  USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+*  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+*  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+***********************************************************************************************************************/
+
+#include <benchmark/benchmark.h>
+
+#include "../../model_editor/Application.hpp"
+#include "../../shared_gui_components/OSCheckBox.hpp"
+#include "../../shared_gui_components/OSGridController.hpp"
+#include "../../shared_gui_components/OSGridView.hpp"
+#include "../../shared_gui_components/OSLineEdit.hpp"
+
+#include "../DesignDayGridView.hpp"
+#include "../FacilityExteriorEquipmentGridView.hpp"
+#include "../FacilityShadingGridView.hpp"
+#include "../FacilityStoriesGridView.hpp"
+#include "../RefrigerationGridView.hpp"
+#include "../SpaceTypesGridView.hpp"
+#include "../SpacesDaylightingGridView.hpp"
+#include "../SpacesInteriorPartitionsGridView.hpp"
+#include "../SpacesLoadsGridView.hpp"
+#include "../SpacesShadingGridView.hpp"
+#include "../SpacesSpacesGridView.hpp"
+#include "../SpacesSubsurfacesGridView.hpp"
+#include "../SpacesSurfacesGridView.hpp"
+#include "../ThermalZonesGridView.hpp"
+
+#include <openstudio/model/BuildingStory.hpp>
+#include <openstudio/model/DesignDay.hpp>
+#include <openstudio/model/ExteriorLights.hpp>
+#include <openstudio/model/ExteriorLightsDefinition.hpp>
+#include <openstudio/model/Lights.hpp>
+#include <openstudio/model/LightsDefinition.hpp>
+#include <openstudio/model/Model.hpp>
+#include <openstudio/model/People.hpp>
+#include <openstudio/model/PeopleDefinition.hpp>
+#include <openstudio/model/RefrigerationCase.hpp>
+#include <openstudio/model/ScheduleCompact.hpp>
+#include <openstudio/model/ShadingSurface.hpp>
+#include <openstudio/model/ShadingSurfaceGroup.hpp>
+#include <openstudio/model/Space.hpp>
+#include <openstudio/model/SpaceType.hpp>
+#include <openstudio/model/Surface.hpp>
+#include <openstudio/model/ThermalZone.hpp>
+#include <openstudio/utilities/core/Assert.hpp>
+#include <openstudio/utilities/geometry/Point3d.hpp>
+
+#include <QApplication>
+
+// Benchmarks for every grid view, run against parametric models of N spaces.
+// Each grid is measured for construction, first paint, category switch, select-all and a single cell edit.
+// To get a baseline, build the Release configuration on an otherwise idle machine and run the suite there, before the change
+// being measured:
+//   ./GridViews_Benchmark --benchmark_repetitions=5 --benchmark_out=baseline.json --benchmark_out_format=json
+// The context of the output records the CPU and load of that machine. Then compare a build with the change against it, on the
+// same machine, with google benchmark's tools/compare.py:
+//   compare.py benchmarks baseline.json ./GridViews_Benchmark
+
+using namespace openstudio;
+using namespace openstudio::model;
+
+// Builds a model with nSpaces spaces stacked on top of each other. Each space gets six surfaces, a window,
+// a thermal zone, lights and people; every ten spaces share a story and a space type. Site-level objects
+// (design days, shading, exterior lights, refrigeration cases) are created one per ten spaces.
+static model::Model makeParametricModel(int nSpaces) {
+
+  Model m;
+
+  constexpr double floorHeight = 3.0;
+
+  boost::optional<BuildingStory> story;
+  boost::optional<SpaceType> spaceType;
+  ScheduleCompact defrostSchedule(m);
+
+  double zOrigin = 0.0;
+  for (int i = 0; i < nSpaces; ++i) {
+
+    if (i % 10 == 0) {
+      story = BuildingStory(m);
+      spaceType = SpaceType(m);
+
+      DesignDay designDay(m);
+
+      ShadingSurfaceGroup shadingGroup(m);
+      shadingGroup.setShadingSurfaceType("Building");
+      ShadingSurface shadingSurface({{0, 0, zOrigin}, {0, 1, zOrigin}, {1, 1, zOrigin}, {1, 0, zOrigin}}, m);
+      shadingSurface.setShadingSurfaceGroup(shadingGroup);
+
+      ExteriorLights exteriorLights(ExteriorLightsDefinition(m));
+
+      RefrigerationCase refrigerationCase(m, defrostSchedule);
+    }
+
+    Point3dVector pts{{0, 0, zOrigin}, {0, 10, zOrigin}, {10, 10, zOrigin}, {10, 0, zOrigin}};
+    boost::optional<Space> space = Space::fromFloorPrint(pts, floorHeight, m);
+    OS_ASSERT(space);
+    space->setBuildingStory(*story);
+    space->setSpaceType(*spaceType);
+
+    ThermalZone zone(m);
+    space->setThermalZone(zone);
+
+    for (auto& surface : space->surfaces()) {
+      if (surface.surfaceType() == "Wall") {
+        surface.setWindowToWallRatio(0.4);
+        break;
+      }
+    }
+
+    Lights lights(LightsDefinition(m));
+    lights.setSpace(*space);
+    People people(PeopleDefinition(m));
+    people.setSpace(*space);
+
+    zOrigin += floorHeight;
+  }
+
+  return m;
+}
+
+static void processEvents() {
+  openstudio::Application::instance().application(true)->processEvents();
+}
+
+// The grid controllers are not exposed by the views, but they are parented (through the OSGridView) to the view
+template <typename T>
+static OSGridController* gridController(T& view) {
+  auto controllers = view.template findChildren<OSGridController*>();
+  OS_ASSERT(!controllers.empty());
+  return controllers.front();
+}
+
+template <typename T>
+static std::shared_ptr<T> makeGridView(const model::Model& model) {
+  auto view = std::make_shared<T>(false, model);
+  view->resize(1600, 1000);
+  processEvents();
+  return view;
+}
+
+template <typename T>
+static void BM_GridView_Construct(benchmark::State& state) {
+
+  openstudio::Application::instance().application(true);
+
+  model::Model model = makeParametricModel(state.range(0));
+
+  // Code inside this loop is measured repeatedly
+  for (auto _ : state) {
+    auto view = std::make_shared<T>(false, model);
+    processEvents();
+    benchmark::DoNotOptimize(view);
+  };
+
+  state.SetComplexityN(state.range(0));
+}
+
+template <typename T>
+static void BM_GridView_FirstPaint(benchmark::State& state) {
+
+  openstudio::Application::instance().application(true);
+
+  model::Model model = makeParametricModel(state.range(0));
+
+  for (auto _ : state) {
+    state.PauseTiming();
+    auto view = makeGridView<T>(model);
+    state.ResumeTiming();
+
+    // grab() forces the layout to be resolved and every visible widget to be painted
+    auto pixmap = view->grab();
+    benchmark::DoNotOptimize(pixmap);
+
+    state.PauseTiming();
+    view.reset();
+    processEvents();
+    state.ResumeTiming();
+  };
+
+  state.SetComplexityN(state.range(0));
+}
+
+template <typename T>
+static void BM_GridView_CategorySwitch(benchmark::State& state) {
+
+  openstudio::Application::instance().application(true);
+
+  model::Model model = makeParametricModel(state.range(0));
+  auto view = makeGridView<T>(model);
+  OSGridController* controller = gridController(*view);
+
+  const int nCategories = static_cast<int>(controller->categories().size());
+  int category = 0;
+
+  for (auto _ : state) {
+    category = (category + 1) % std::max(nCategories, 1);
+    controller->onCategorySelected(category);
+    processEvents();
+  };
+
+  state.SetComplexityN(state.range(0));
+}
+
+template <typename T>
+static void BM_GridView_SelectAll(benchmark::State& state) {
+
+  openstudio::Application::instance().application(true);
+
+  model::Model model = makeParametricModel(state.range(0));
+  auto view = makeGridView<T>(model);
+
+  auto checkboxes = view->template findChildren<OSSelectAllCheckBox*>();
+  if (checkboxes.empty()) {
+    state.SkipWithError("Grid has no select all check box");
+    return;
+  }
+  OSSelectAllCheckBox* checkbox = checkboxes.front();
+
+  for (auto _ : state) {
+    checkbox->setCheckState(Qt::Checked);
+    processEvents();
+
+    state.PauseTiming();
+    checkbox->setCheckState(Qt::Unchecked);
+    processEvents();
+    state.ResumeTiming();
+  };
+
+  state.SetComplexityN(state.range(0));
+}
+
+template <typename T>
+static void BM_GridView_CellEdit(benchmark::State& state) {
+
+  openstudio::Application::instance().application(true);
+
+  model::Model model = makeParametricModel(state.range(0));
+  auto view = makeGridView<T>(model);
+  OSGridController* controller = gridController(*view);
+  controller->connectToModelSignals();
+
+  std::vector<model::ModelObject> modelObjects = controller->modelObjects();
+  if (modelObjects.empty()) {
+    state.SkipWithError("Grid has no rows");
+    return;
+  }
+  model::ModelObject modelObject = modelObjects.front();
+
+  // Edit through the name cell of the first row, so the setter and the grid refresh it triggers are both measured
+  OSLineEdit2* nameEdit = nullptr;
+  for (auto* lineEdit : view->template findChildren<OSLineEdit2*>()) {
+    if (lineEdit->isEnabled() && lineEdit->text().toStdString() == modelObject.nameString()) {
+      nameEdit = lineEdit;
+      break;
+    }
+  }
+  if (!nameEdit) {
+    state.SkipWithError("Grid has no editable name cell");
+    return;
+  }
+
+  int i = 0;
+  for (auto _ : state) {
+    nameEdit->setText(QString::fromStdString("Edited " + std::to_string(++i)));
+    emit nameEdit->editingFinished();
+    processEvents();
+  };
+
+  state.SetComplexityN(state.range(0));
+}
+
+// Argument is the number of spaces, the row count of every grid scales linearly with it
+#define GRID_BENCHMARK_ARGS Arg(10)->Arg(20)->Arg(40)->Arg(80)->Arg(160)->Arg(320)->Arg(640)->Unit(benchmark::kMillisecond)->Complexity()
+
+#define GRID_BENCHMARKS(T)                                             \
+  BENCHMARK_TEMPLATE(BM_GridView_Construct, T)->GRID_BENCHMARK_ARGS;      \
+  BENCHMARK_TEMPLATE(BM_GridView_FirstPaint, T)->GRID_BENCHMARK_ARGS;     \
+  BENCHMARK_TEMPLATE(BM_GridView_CategorySwitch, T)->GRID_BENCHMARK_ARGS; \
+  BENCHMARK_TEMPLATE(BM_GridView_SelectAll, T)->GRID_BENCHMARK_ARGS;      \
+  BENCHMARK_TEMPLATE(BM_GridView_CellEdit, T)->GRID_BENCHMARK_ARGS;
+
+GRID_BENCHMARKS(DesignDayGridView)
+GRID_BENCHMARKS(FacilityExteriorEquipmentGridView)
+GRID_BENCHMARKS(FacilityShadingGridView)
+GRID_BENCHMARKS(FacilityStoriesGridView)
+GRID_BENCHMARKS(RefrigerationGridView)
+GRID_BENCHMARKS(SpaceTypesGridView)
+GRID_BENCHMARKS(SpacesDaylightingGridView)
+GRID_BENCHMARKS(SpacesInteriorPartitionsGridView)
+GRID_BENCHMARKS(SpacesLoadsGridView)
+GRID_BENCHMARKS(SpacesShadingGridView)
+GRID_BENCHMARKS(SpacesSpacesGridView)
+GRID_BENCHMARKS(SpacesSubsurfacesGridView)
+GRID_BENCHMARKS(SpacesSurfacesGridView)
+GRID_BENCHMARKS(ThermalZonesGridView)
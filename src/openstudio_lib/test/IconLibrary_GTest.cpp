@@ -227,3 +227,33 @@ TEST_F(OpenStudioLibFixture, IconLibrary_MiniIcon) {
     EXPECT_TRUE(pixmap) << "Could not find mini-icon for IddObjectType = '" << iddObjectType.valueName() << "'";
   }
 }
+
+TEST_F(OpenStudioLibFixture, IconLibrary_LazyLoad) {
+  const IconLibrary& iconLibrary = IconLibrary::Instance();
+
+  // Icons are decoded on first use, one at a time. No other test looks this one up
+  const size_t decodedBefore = iconLibrary.decodedCount();
+  const QPixmap* hybridVentilation = iconLibrary.findMiniIcon(IddObjectType(IddObjectType::OS_AvailabilityManager_HybridVentilation).value());
+  ASSERT_TRUE(hybridVentilation);
+  EXPECT_FALSE(hybridVentilation->isNull());
+  EXPECT_EQ(decodedBefore + 1, iconLibrary.decodedCount());
+
+  // and the same pixmap is returned afterwards, without decoding it again
+  EXPECT_EQ(hybridVentilation, iconLibrary.findMiniIcon(IddObjectType(IddObjectType::OS_AvailabilityManager_HybridVentilation).value()));
+  EXPECT_EQ(decodedBefore + 1, iconLibrary.decodedCount());
+
+  const QPixmap* boiler = iconLibrary.findIcon(IddObjectType(IddObjectType::OS_Boiler_HotWater).value());
+  ASSERT_TRUE(boiler);
+  EXPECT_FALSE(boiler->isNull());
+  EXPECT_EQ(boiler, iconLibrary.findIcon(IddObjectType(IddObjectType::OS_Boiler_HotWater).value()));
+
+  // Types without an icon fall back to the Catchall icon
+  const QPixmap* missing = iconLibrary.findIcon(IddObjectType(IddObjectType::Catchall).value());
+  ASSERT_TRUE(missing);
+  EXPECT_FALSE(missing->isNull());
+  EXPECT_EQ(missing, iconLibrary.findIcon(IddObjectType(IddObjectType::OS_Version).value()));
+
+  const QPixmap* missingMini = iconLibrary.findMiniIcon(IddObjectType(IddObjectType::Catchall).value());
+  ASSERT_TRUE(missingMini);
+  EXPECT_EQ(missingMini, iconLibrary.findMiniIcon(IddObjectType(IddObjectType::OS_Version).value()));
+}
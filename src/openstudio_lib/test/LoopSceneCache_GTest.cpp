@@ -0,0 +1,99 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) 2020-2022, OpenStudio Coalition and other contributors. All rights reserved.
+*
+*  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the
+*  following conditions are met:
+*
+*  (1) Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+*  disclaimer.
+*
+*  (2) Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following
+*  disclaimer in the documentation and/or other materials provided with the distribution.
+*
+*  (3) Neither the name of the copyright holder nor the names of any contributors may be used to endorse or promote products
+*  derived from this software without specific prior written permission from the respective party.
+*
+*  (4) Other than as required in clauses (1) and (2), distributions in any form of modifications or other derivative works
+*  may not use the "OpenStudio" trademark, "OS", "os", or any other confusingly similar designation without specific prior
+*  written permission from Alliance for Sustainable Energy, LLC.
+*
+*  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDER(S) AND ANY CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+*  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+*  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER(S), ANY CONTRIBUTORS, THE UNITED STATES GOVERNMENT, OR THE UNITED
+*  STATES DEPARTMENT OF ENERGY, NOR ANY OF THEIR EMPLOYEES, BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+*  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF
+*  USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+*  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+*  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+***********************************************************************************************************************/
+
+#include <gtest/gtest.h>
+
+#include "OpenStudioLibFixture.hpp"
+
+#include "../LoopScene.hpp"
+
+#include <openstudio/model/Model.hpp>
+#include <openstudio/model/PlantLoop.hpp>
+
+#include <QPointer>
+
+#include <vector>
+
+using namespace openstudio;
+
+TEST_F(OpenStudioLibFixture, LoopSceneCache) {
+
+  model::Model model;
+  model::PlantLoop loop(model);
+
+  LoopSceneCache cache;
+
+  // coming back to a loop returns the same scene
+  QPointer<LoopScene> scene = cache.scene(loop);
+  ASSERT_TRUE(scene);
+  EXPECT_TRUE(cache.contains(loop.handle()));
+  EXPECT_EQ(scene.data(), cache.scene(loop));
+
+  // a deleted loop drops its scene
+  cache.remove(loop.handle());
+  processEvents();
+  EXPECT_FALSE(cache.contains(loop.handle()));
+  EXPECT_TRUE(scene.isNull());
+}
+
+TEST_F(OpenStudioLibFixture, LoopSceneCache_Eviction) {
+
+  model::Model model;
+  std::vector<model::PlantLoop> loops;
+  for (unsigned i = 0; i < 9; ++i) {
+    loops.emplace_back(model);
+  }
+
+  LoopSceneCache cache;
+  ASSERT_EQ(8u, cache.capacity());
+
+  QPointer<LoopScene> first = cache.scene(loops[0]);
+  QPointer<LoopScene> second = cache.scene(loops[1]);
+  for (unsigned i = 2; i < 8; ++i) {
+    cache.scene(loops[i]);
+  }
+
+  // using the first loop again makes the second one the least recently used
+  EXPECT_EQ(first.data(), cache.scene(loops[0]));
+
+  cache.scene(loops[8]);
+  processEvents();
+
+  EXPECT_TRUE(cache.contains(loops[0].handle()));
+  EXPECT_FALSE(first.isNull());
+  EXPECT_FALSE(cache.contains(loops[1].handle()));
+  EXPECT_TRUE(second.isNull());
+  for (unsigned i = 2; i < 9; ++i) {
+    EXPECT_TRUE(cache.contains(loops[i].handle()));
+  }
+
+  cache.clear();
+  EXPECT_TRUE(first.isNull());
+  EXPECT_FALSE(cache.contains(loops[0].handle()));
+}
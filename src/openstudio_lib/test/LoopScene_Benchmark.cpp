@@ -0,0 +1,270 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) 2020-2022, OpenStudio Coalition and other contributors. All rights reserved.
+*
+*  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the
+*  following conditions are met:
+*
+*  (1) Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+*  disclaimer.
+*
+*  (2) Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following
+*  disclaimer in the documentation and/or other materials provided with the distribution.
+*
+*  (3) Neither the name of the copyright holder nor the names of any contributors may be used to endorse or promote products
+*  derived from this software without specific prior written permission from the respective party.
+*
+*  (4) Other than as required in clauses (1) and (2), distributions in any form of modifications or other derivative works
+*  may not use the "OpenStudio" trademark, "OS", "os", or any other confusingly similar designation without specific prior
+*  written permission from Alliance for Sustainable Energy, LLC.
+*
+*  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDER(S) AND ANY CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+*  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+*  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER(S), ANY CONTRIBUTORS, THE UNITED STATES GOVERNMENT, OR THE UNITED
+*  STATES DEPARTMENT OF ENERGY, NOR ANY OF THEIR EMPLOYEES, BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+*  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF
+*  USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+*  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+*  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+***********************************************************************************************************************/
+
+#include <benchmark/benchmark.h>
+
+#include "../../model_editor/Application.hpp"
+#include "../LoopScene.hpp"
+#include "../GridItem.hpp"
+#include "../HVACSystemsView.hpp"
+
+#include <openstudio/model/AirLoopHVAC.hpp>
+#include <openstudio/model/AirTerminalSingleDuctConstantVolumeNoReheat.hpp>
+#include <openstudio/model/CoilHeatingElectric.hpp>
+#include <openstudio/model/Model.hpp>
+#include <openstudio/model/Node.hpp>
+#include <openstudio/model/Schedule.hpp>
+#include <openstudio/model/ThermalZone.hpp>
+
+#include <QCoreApplication>
+#include <QImage>
+#include <QScrollBar>
+
+#include <algorithm>
+
+// Relayout time of a LoopScene against the number of terminals on an air loop.
+// BM_LoopScene_Build is the full rebuild every edit used to trigger, the other benchmarks time the layout that follows
+// an edit on the demand side, on the supply side, and on another loop. Model edits themselves are not timed.
+// BM_DemandBranches and BM_DemandSideItem_Build time the demand side topology pass alone and the demand side items built
+// from it, for 10 to 1000 zones.
+// BM_LoopScene_Pan repaints an HVACGraphicsView while panning across the scene, zoomed in (100) and zoomed out (20 percent),
+// and reports the view's own frame time.
+
+using namespace openstudio;
+using namespace openstudio::model;
+
+static AirLoopHVAC makeAirLoop(Model& model, int nTerminals) {
+  AirLoopHVAC airLoop(model);
+
+  Schedule schedule = model.alwaysOnDiscreteSchedule();
+  for (int i = 0; i < nTerminals; ++i) {
+    ThermalZone zone(model);
+    AirTerminalSingleDuctConstantVolumeNoReheat terminal(model, schedule);
+    airLoop.addBranchForZone(zone, terminal);
+  }
+
+  return airLoop;
+}
+
+template <typename T>
+static void notifyAdded(LoopScene& scene, const T& modelObject) {
+  // Stands in for the queued OSAppBase::workspaceObjectAddedPtr signal, which has no sender outside the application
+  scene.addedWorkspaceObject(modelObject.template getImpl<openstudio::detail::WorkspaceObject_Impl>(), modelObject.iddObjectType(),
+                             modelObject.handle());
+}
+
+static void BM_LoopScene_Build(benchmark::State& state) {
+
+  openstudio::Application::instance().application(true);
+
+  Model model;
+  AirLoopHVAC airLoop = makeAirLoop(model, state.range(0));
+
+  for (auto _ : state) {
+    LoopScene scene(airLoop);
+    benchmark::DoNotOptimize(scene.sceneRect());
+  }
+
+  state.SetComplexityN(state.range(0));
+}
+
+static void BM_LoopScene_DemandRelayout(benchmark::State& state) {
+
+  QCoreApplication* app = openstudio::Application::instance().application(true);
+
+  Model model;
+  AirLoopHVAC airLoop = makeAirLoop(model, state.range(0));
+  LoopScene scene(airLoop);
+
+  ThermalZone zone(model);
+  Schedule schedule = model.alwaysOnDiscreteSchedule();
+
+  for (auto _ : state) {
+    state.PauseTiming();
+    AirTerminalSingleDuctConstantVolumeNoReheat terminal(model, schedule);
+    airLoop.addBranchForZone(zone, terminal);
+    notifyAdded(scene, terminal);
+    state.ResumeTiming();
+
+    scene.layout();
+
+    state.PauseTiming();
+    airLoop.removeBranchForZone(zone);
+    state.ResumeTiming();
+
+    scene.layout();
+
+    state.PauseTiming();
+    app->processEvents();
+    state.ResumeTiming();
+  }
+
+  state.SetComplexityN(state.range(0));
+}
+
+static void BM_LoopScene_SupplyRelayout(benchmark::State& state) {
+
+  QCoreApplication* app = openstudio::Application::instance().application(true);
+
+  Model model;
+  AirLoopHVAC airLoop = makeAirLoop(model, state.range(0));
+  LoopScene scene(airLoop);
+
+  for (auto _ : state) {
+    state.PauseTiming();
+    CoilHeatingElectric coil(model);
+    Node supplyOutletNode = airLoop.supplyOutletNode();
+    coil.addToNode(supplyOutletNode);
+    notifyAdded(scene, coil);
+    state.ResumeTiming();
+
+    scene.layout();
+
+    state.PauseTiming();
+    coil.remove();
+    state.ResumeTiming();
+
+    scene.layout();
+
+    state.PauseTiming();
+    app->processEvents();
+    state.ResumeTiming();
+  }
+
+  state.SetComplexityN(state.range(0));
+}
+
+static void BM_LoopScene_OtherLoopEdit(benchmark::State& state) {
+
+  QCoreApplication* app = openstudio::Application::instance().application(true);
+
+  Model model;
+  AirLoopHVAC airLoop = makeAirLoop(model, state.range(0));
+  LoopScene scene(airLoop);
+
+  AirLoopHVAC otherLoop(model);
+  ThermalZone zone(model);
+  Schedule schedule = model.alwaysOnDiscreteSchedule();
+
+  for (auto _ : state) {
+    state.PauseTiming();
+    AirTerminalSingleDuctConstantVolumeNoReheat terminal(model, schedule);
+    otherLoop.addBranchForZone(zone, terminal);
+    state.ResumeTiming();
+
+    notifyAdded(scene, terminal);
+    scene.layout();
+
+    state.PauseTiming();
+    otherLoop.removeBranchForZone(zone);
+    state.ResumeTiming();
+
+    scene.layout();
+
+    state.PauseTiming();
+    app->processEvents();
+    state.ResumeTiming();
+  }
+
+  state.SetComplexityN(state.range(0));
+}
+
+static void BM_DemandBranches(benchmark::State& state) {
+
+  openstudio::Application::instance().application(true);
+
+  Model model;
+  AirLoopHVAC airLoop = makeAirLoop(model, state.range(0));
+  Splitter splitter = airLoop.demandSplitter();
+  Mixer mixer = airLoop.demandMixer();
+
+  for (auto _ : state) {
+    auto branches = demandBranches(splitter, mixer);
+    benchmark::DoNotOptimize(branches.data());
+  }
+
+  state.SetComplexityN(state.range(0));
+}
+
+static void BM_DemandSideItem_Build(benchmark::State& state) {
+
+  openstudio::Application::instance().application(true);
+
+  Model model;
+  AirLoopHVAC airLoop = makeAirLoop(model, state.range(0));
+  std::vector<Node> demandInletNodes = airLoop.demandInletNodes();
+  Node demandOutletNode = airLoop.demandOutletNode();
+
+  for (auto _ : state) {
+    DemandSideItem demandSideItem(nullptr, demandInletNodes, demandOutletNode);
+    benchmark::DoNotOptimize(demandSideItem.getVGridLength());
+  }
+
+  state.SetComplexityN(state.range(0));
+}
+
+static void BM_LoopScene_Pan(benchmark::State& state) {
+
+  openstudio::Application::instance().application(true);
+
+  Model model;
+  AirLoopHVAC airLoop = makeAirLoop(model, state.range(0));
+  LoopScene scene(airLoop);
+
+  HVACGraphicsView view;
+  view.setScene(&scene);
+  view.resize(1280, 800);
+  view.resetTransform();
+  view.scale(state.range(1) / 100.0, state.range(1) / 100.0);
+
+  QImage image(view.viewport()->size(), QImage::Format_ARGB32_Premultiplied);
+  QScrollBar* scrollBar = view.verticalScrollBar();
+  int step = std::max(1, (scrollBar->maximum() - scrollBar->minimum()) / 20);
+
+  for (auto _ : state) {
+    int value = scrollBar->value() + step;
+    scrollBar->setValue(value > scrollBar->maximum() ? scrollBar->minimum() : value);
+    view.viewport()->render(&image);
+  }
+
+  state.counters["frame_ms"] = view.averageFrameTime();
+  state.SetComplexityN(state.range(0));
+}
+
+#define TOPOLOGY_BENCHMARK_ARGS RangeMultiplier(10)->Range(10, 1000)->Unit(benchmark::kMillisecond)->Complexity()
+
+#define LOOPSCENE_BENCHMARK_ARGS RangeMultiplier(4)->Range(4, 256)->Unit(benchmark::kMillisecond)->Complexity()
+
+BENCHMARK(BM_LoopScene_Build)->LOOPSCENE_BENCHMARK_ARGS;
+BENCHMARK(BM_LoopScene_DemandRelayout)->LOOPSCENE_BENCHMARK_ARGS;
+BENCHMARK(BM_LoopScene_SupplyRelayout)->LOOPSCENE_BENCHMARK_ARGS;
+BENCHMARK(BM_LoopScene_OtherLoopEdit)->LOOPSCENE_BENCHMARK_ARGS;
+BENCHMARK(BM_DemandBranches)->TOPOLOGY_BENCHMARK_ARGS;
+BENCHMARK(BM_DemandSideItem_Build)->TOPOLOGY_BENCHMARK_ARGS;
+BENCHMARK(BM_LoopScene_Pan)->ArgsProduct({{10, 100, 1000}, {100, 20}})->Unit(benchmark::kMillisecond);
@@ -0,0 +1,182 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) 2020-2022, OpenStudio Coalition and other contributors. All rights reserved.
+*
+*  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the
+*  following conditions are met:
+*
+*  (1) Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+*  disclaimer.
+*
+*  (2) Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following
+*  disclaimer in the documentation and/or other materials provided with the distribution.
+*
+*  (3) Neither the name of the copyright holder nor the names of any contributors may be used to endorse or promote products
+*  derived from this software without specific prior written permission from the respective party.
+*
+*  (4) Other than as required in clauses (1) and (2), distributions in any form of modifications or other derivative works
+*  may not use the "OpenStudio" trademark, "OS", "os", or any other confusingly similar designation without specific prior
+*  written permission from Alliance for Sustainable Energy, LLC.
+*
+*  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDER(S) AND ANY CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+*  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+*  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER(S), ANY CONTRIBUTORS, THE UNITED STATES GOVERNMENT, OR THE UNITED
+*  STATES DEPARTMENT OF ENERGY, NOR ANY OF THEIR EMPLOYEES, BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+*  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF
+*  USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+*  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+*  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+***********************************************************************************************************************/
+
+#include <gtest/gtest.h>
+
+#include "OpenStudioLibFixture.hpp"
+
+#include "../../shared_gui_components/MeasureManager.hpp"
+
+#include <openstudio/utilities/bcl/BCLMeasure.hpp>
+#include <openstudio/utilities/core/PathHelpers.hpp>
+
+#include <QByteArray>
+#include <QDateTime>
+#include <QDir>
+#include <QFile>
+#include <QStandardPaths>
+
+using namespace openstudio;
+
+// reply of the measure manager server for a measure with a single model dependent argument
+static const QByteArray modelDependentReply(R"json({"arguments": [{"name": "space_name", "type": "String", "required": true, "model_dependent": true}]})json");
+
+static const QByteArray modelIndependentReply(R"json({"arguments": [{"name": "multiplier", "type": "Double", "required": true, "model_dependent": false}]})json");
+
+static BCLMeasure makeMeasure(const std::string& name) {
+  openstudio::path dir = toPath("./MeasureManager_GTest") / toPath(name);
+  removeDirectory(dir);
+  return BCLMeasure(name, name, dir, "Envelope.Form", MeasureType::ModelMeasure, "Description", "Modeler description");
+}
+
+static void setLastModified(const openstudio::path& p, const QDateTime& lastModified) {
+  QFile file(toQString(p));
+  ASSERT_TRUE(file.open(QFile::ReadWrite));
+  ASSERT_TRUE(file.setFileTime(lastModified, QFileDevice::FileModificationTime));
+}
+
+// Points the argument cache to an empty test location for the lifetime of the guard, the user's cache is left alone
+struct TestCacheLocation
+{
+  TestCacheLocation() {
+    QStandardPaths::setTestModeEnabled(true);
+    QDir(QStandardPaths::writableLocation(QStandardPaths::CacheLocation) + "/MeasureArguments").removeRecursively();
+  }
+
+  ~TestCacheLocation() {
+    QStandardPaths::setTestModeEnabled(false);
+  }
+};
+
+TEST_F(OpenStudioLibFixture, MeasureManager_ArgumentsCacheHitsAndMisses) {
+  TestCacheLocation cacheLocation;
+  BCLMeasure bclMeasure = makeMeasure("hits_and_misses");
+
+  {
+    MeasureManager measureManager(nullptr);
+    setTempModelChecksum(measureManager, "model_a");
+
+    EXPECT_FALSE(cachedArguments(measureManager, bclMeasure));
+    EXPECT_EQ(0, measureManager.argumentsCacheHits());
+    EXPECT_EQ(1, measureManager.argumentsCacheMisses());
+
+    std::vector<measure::OSArgument> arguments = storeArguments(measureManager, bclMeasure, modelIndependentReply);
+    ASSERT_EQ(1u, arguments.size());
+    EXPECT_TRUE(exists(argumentsCachePath(measureManager, bclMeasure, false)));
+
+    // served from memory, counted as well
+    auto cached = cachedArguments(measureManager, bclMeasure);
+    ASSERT_TRUE(cached);
+    EXPECT_EQ("multiplier", cached->front().name());
+    EXPECT_EQ(1, measureManager.argumentsCacheHits());
+    EXPECT_EQ(1, measureManager.argumentsCacheMisses());
+  }
+
+  // a new session reads the entry from disk, then from memory
+  MeasureManager measureManager(nullptr);
+  setTempModelChecksum(measureManager, "model_b");
+  EXPECT_TRUE(cachedArguments(measureManager, bclMeasure));
+  EXPECT_TRUE(cachedArguments(measureManager, bclMeasure));
+  EXPECT_EQ(2, measureManager.argumentsCacheHits());
+  EXPECT_EQ(0, measureManager.argumentsCacheMisses());
+}
+
+TEST_F(OpenStudioLibFixture, MeasureManager_ArgumentsCacheKey) {
+  TestCacheLocation cacheLocation;
+  BCLMeasure bclMeasure = makeMeasure("cache_key");
+
+  {
+    MeasureManager measureManager(nullptr);
+    setTempModelChecksum(measureManager, "model_a");
+    storeArguments(measureManager, bclMeasure, modelDependentReply);
+    EXPECT_TRUE(exists(argumentsCachePath(measureManager, bclMeasure, true)));
+    EXPECT_FALSE(exists(argumentsCachePath(measureManager, bclMeasure, false)));
+  }
+
+  {
+    // model dependent arguments are not valid for another model
+    MeasureManager measureManager(nullptr);
+    setTempModelChecksum(measureManager, "model_b");
+    EXPECT_FALSE(cachedArguments(measureManager, bclMeasure));
+    storeArguments(measureManager, bclMeasure, modelDependentReply);
+  }
+
+  {
+    // going back to the first model still finds its entry, the two models do not evict each other
+    MeasureManager measureManager(nullptr);
+    setTempModelChecksum(measureManager, "model_a");
+    EXPECT_TRUE(cachedArguments(measureManager, bclMeasure));
+  }
+
+  // editing the measure changes its version id
+  bclMeasure.incrementVersionId();
+  bclMeasure.save();
+
+  MeasureManager measureManager(nullptr);
+  setTempModelChecksum(measureManager, "model_a");
+  EXPECT_FALSE(cachedArguments(measureManager, bclMeasure));
+  EXPECT_EQ(0, measureManager.argumentsCacheHits());
+  EXPECT_EQ(1, measureManager.argumentsCacheMisses());
+}
+
+TEST_F(OpenStudioLibFixture, MeasureManager_PruneArgumentsCache) {
+  openstudio::path cacheDir = toPath("./MeasureManager_GTest/MeasureArguments");
+  removeDirectory(cacheDir);
+  QDir().mkpath(toQString(cacheDir));
+
+  const QDateTime now = QDateTime::currentDateTime();
+  for (int i = 0; i < 4; ++i) {
+    openstudio::path entry = cacheDir / toPath("entry_" + std::to_string(i) + ".json");
+    QFile file(toQString(entry));
+    ASSERT_TRUE(file.open(QFile::WriteOnly));
+    file.write(modelIndependentReply);
+    file.close();
+    // entry_0 is the most recently used
+    setLastModified(entry, now.addSecs(-60 * i));
+  }
+  openstudio::path stale = cacheDir / toPath("stale.json");
+  {
+    QFile file(toQString(stale));
+    ASSERT_TRUE(file.open(QFile::WriteOnly));
+    file.write(modelIndependentReply);
+  }
+  setLastModified(stale, now.addDays(-31));
+
+  // only entries unused for too long go when the cache is not full
+  pruneArgumentsCache(cacheDir, 10, 30);
+  EXPECT_FALSE(exists(stale));
+  EXPECT_EQ(4, QDir(toQString(cacheDir)).entryList({"*.json"}, QDir::Files).size());
+
+  // then the least recently used
+  pruneArgumentsCache(cacheDir, 2, 30);
+  EXPECT_TRUE(exists(cacheDir / toPath("entry_0.json")));
+  EXPECT_TRUE(exists(cacheDir / toPath("entry_1.json")));
+  EXPECT_FALSE(exists(cacheDir / toPath("entry_2.json")));
+  EXPECT_FALSE(exists(cacheDir / toPath("entry_3.json")));
+}
@@ -0,0 +1,155 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) 2020-2022, OpenStudio Coalition and other contributors. All rights reserved.
+*
+*  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the
+*  following conditions are met:
+*
+*  (1) Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+*  disclaimer.
+*
+*  (2) Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following
+*  disclaimer in the documentation and/or other materials provided with the distribution.
+*
+*  (3) Neither the name of the copyright holder nor the names of any contributors may be used to endorse or promote products
+*  derived from this software without specific prior written permission from the respective party.
+*
+*  (4) Other than as required in clauses (1) and (2), distributions in any form of modifications or other derivative works
+*  may not use the "OpenStudio" trademark, "OS", "os", or any other confusingly similar designation without specific prior
+*  written permission from Alliance for Sustainable Energy, LLC.
+*
+*  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDER(S) AND ANY CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+*  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+*  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER(S), ANY CONTRIBUTORS, THE UNITED STATES GOVERNMENT, OR THE UNITED
+*  STATES DEPARTMENT OF ENERGY, NOR ANY OF THEIR EMPLOYEES, BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+*  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF
+*  USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+*  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+*  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+***********************************************************************************************************************/
+
+#include <benchmark/benchmark.h>
+
+#include "../../model_editor/Application.hpp"
+#include "../ModelSaver.hpp"
+
+#include <openstudio/model/FileOperations.hpp>
+#include <openstudio/model/Lights.hpp>
+#include <openstudio/model/LightsDefinition.hpp>
+#include <openstudio/model/Model.hpp>
+#include <openstudio/model/Space.hpp>
+#include <openstudio/model/ThermalZone.hpp>
+#include <openstudio/utilities/core/Assert.hpp>
+#include <openstudio/utilities/geometry/Point3d.hpp>
+
+#include <QApplication>
+#include <QElapsedTimer>
+
+#include <fstream>
+
+// Compares model::saveModel with ModelSaver::saveAsync. The gui_stall_ms counter is the longest time the event loop
+// could not run during a save, which is the whole save for model::saveModel.
+// Arguments are the number of spaces and the number of files in the model's resources directory.
+
+using namespace openstudio;
+using namespace openstudio::model;
+
+static model::Model makeModel(int nSpaces) {
+  Model m;
+
+  constexpr double floorHeight = 3.0;
+  double zOrigin = 0.0;
+  for (int i = 0; i < nSpaces; ++i) {
+    Point3dVector pts{{0, 0, zOrigin}, {0, 10, zOrigin}, {10, 10, zOrigin}, {10, 0, zOrigin}};
+    boost::optional<Space> space = Space::fromFloorPrint(pts, floorHeight, m);
+    OS_ASSERT(space);
+
+    ThermalZone zone(m);
+    space->setThermalZone(zone);
+
+    Lights lights(LightsDefinition(m));
+    lights.setSpace(*space);
+
+    zOrigin += floorHeight;
+  }
+
+  return m;
+}
+
+static void addResourceFiles(const openstudio::path& modelTempDir, int nFiles) {
+  openstudio::path filesDir = modelTempDir / toPath("resources/files");
+  boost::filesystem::create_directories(filesDir);
+  for (int i = 0; i < nFiles; ++i) {
+    std::ofstream file(toString(filesDir / toPath("file_" + std::to_string(i) + ".csv")));
+    for (int j = 0; j < 8760; ++j) {
+      file << j << "," << (j % 24) << "\n";
+    }
+  }
+}
+
+static openstudio::path savePath() {
+  return boost::filesystem::temp_directory_path() / boost::filesystem::unique_path() / toPath("benchmark.osm");
+}
+
+static void BM_SaveModel_Sync(benchmark::State& state) {
+
+  openstudio::Application::instance().application(true);
+
+  model::Model model = makeModel(state.range(0));
+  openstudio::path modelTempDir = model::initializeModel(model);
+  addResourceFiles(modelTempDir, state.range(1));
+  openstudio::path osmPath = savePath();
+  boost::filesystem::create_directories(osmPath.parent_path());
+
+  double stall = 0.0;
+  for (auto _ : state) {
+    QElapsedTimer timer;
+    timer.start();
+    bool saved = model::saveModel(model, osmPath, modelTempDir);
+    stall = std::max(stall, static_cast<double>(timer.nsecsElapsed()) / 1.0e6);
+    benchmark::DoNotOptimize(saved);
+  };
+
+  state.counters["gui_stall_ms"] = stall;
+  state.SetComplexityN(state.range(0));
+
+  model::removeModelTempDir(modelTempDir);
+  boost::filesystem::remove_all(osmPath.parent_path());
+}
+
+static void BM_SaveModel_Async(benchmark::State& state) {
+
+  QCoreApplication* app = openstudio::Application::instance().application(true);
+
+  model::Model model = makeModel(state.range(0));
+  openstudio::path modelTempDir = model::initializeModel(model);
+  addResourceFiles(modelTempDir, state.range(1));
+  openstudio::path osmPath = savePath();
+  boost::filesystem::create_directories(osmPath.parent_path());
+
+  double stall = 0.0;
+  for (auto _ : state) {
+    // the snapshot taken by saveAsync blocks the event loop, then so does any work done by the event loop itself
+    QElapsedTimer timer;
+    timer.start();
+    QFuture<bool> future = ModelSaver::saveAsync(model, osmPath, modelTempDir);
+    stall = std::max(stall, static_cast<double>(timer.nsecsElapsed()) / 1.0e6);
+    while (!future.isFinished()) {
+      timer.restart();
+      app->processEvents();
+      stall = std::max(stall, static_cast<double>(timer.nsecsElapsed()) / 1.0e6);
+    }
+    benchmark::DoNotOptimize(future.result());
+  };
+
+  state.counters["gui_stall_ms"] = stall;
+  state.SetComplexityN(state.range(0));
+
+  model::removeModelTempDir(modelTempDir);
+  boost::filesystem::remove_all(osmPath.parent_path());
+}
+
+#define SAVE_BENCHMARK_ARGS \
+  ArgsProduct({{100, 400, 1600}, {0, 50}})->Unit(benchmark::kMillisecond)->Complexity()
+
+BENCHMARK(BM_SaveModel_Sync)->SAVE_BENCHMARK_ARGS;
+BENCHMARK(BM_SaveModel_Async)->SAVE_BENCHMARK_ARGS;
@@ -0,0 +1,274 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) 2020-2022, OpenStudio Coalition and other contributors. All rights reserved.
+*
+*  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the
+*  following conditions are met:
+*
+*  (1) Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+*  disclaimer.
+*
+*  (2) Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following
+*  disclaimer in the documentation and/or other materials provided with the distribution.
+*
+*  (3) Neither the name of the copyright holder nor the names of any contributors may be used to endorse or promote products
+*  derived from this software without specific prior written permission from the respective party.
+*
+*  (4) Other than as required in clauses (1) and (2), distributions in any form of modifications or other derivative works
+*  may not use the "OpenStudio" trademark, "OS", "os", or any other confusingly similar designation without specific prior
+*  written permission from Alliance for Sustainable Energy, LLC.
+*
+*  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDER(S) AND ANY CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+*  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+*  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER(S), ANY CONTRIBUTORS, THE UNITED STATES GOVERNMENT, OR THE UNITED
+*  STATES DEPARTMENT OF ENERGY, NOR ANY OF THEIR EMPLOYEES, BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+*  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF
+*  USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+*  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+*  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+***********************************************************************************************************************/
+
+#include <gtest/gtest.h>
+
+#include "OpenStudioLibFixture.hpp"
+
+#include "../../shared_gui_components/OSComboBox.hpp"
+#include "../../shared_gui_components/OSConcepts.hpp"
+
+#include <openstudio/model/Model.hpp>
+#include <openstudio/model/ScheduleCompact.hpp>
+#include <openstudio/model/ScheduleConstant.hpp>
+#include <openstudio/model/ScheduleRuleset.hpp>
+#include <openstudio/model/Space.hpp>
+
+#include <openstudio/utilities/idd/IddEnums.hxx>
+
+#include <QApplication>
+#include <QFocusEvent>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+using namespace openstudio;
+
+// The choices of one grid cell, recording what the combo box writes to its row
+class RowChoiceConcept : public ChoiceConcept
+{
+ public:
+  RowChoiceConcept(std::vector<std::string> choices, std::string value) : m_choices(std::move(choices)), m_value(std::move(value)) {}
+
+  virtual std::vector<std::string> choices() override {
+    return m_choices;
+  }
+
+  virtual std::string get() override {
+    return m_value;
+  }
+
+  virtual bool set(std::string value) override {
+    m_sets.push_back(value);
+    m_value = value;
+    return true;
+  }
+
+  virtual void clear() override {}
+
+  virtual bool isDefaulted() override {
+    return false;
+  }
+
+  std::vector<std::string> m_sets;
+
+ private:
+  std::vector<std::string> m_choices;
+
+  std::string m_value;
+};
+
+// Only used as the key of the shared choice model of a column
+class ColumnComboBoxConcept : public ComboBoxConcept
+{
+ public:
+  ColumnComboBoxConcept() : ComboBoxConcept(Heading("Column")) {}
+
+  virtual std::shared_ptr<ChoiceConcept> choiceConcept(const ConceptProxy& /*obj*/) override {
+    return nullptr;
+  }
+};
+
+TEST_F(OpenStudioLibFixture, OSObjectListCBDS_SharedRegistry) {
+
+  model::Model model;
+  model::ScheduleCompact compactA(model);
+  compactA.setName("Compact A");
+  model::ScheduleConstant constantA(model);
+  constantA.setName("Constant A");
+
+  OSObjectListCBDS compacts(IddObjectType::OS_Schedule_Compact, model);
+  OSObjectListCBDS schedules(std::vector<IddObjectType>{IddObjectType::OS_Schedule_Compact, IddObjectType::OS_Schedule_Constant}, model);
+
+  // both data sources are served by the one registry of the model
+  std::shared_ptr<OSObjectListRegistry> registry = OSObjectListRegistry::registry(model);
+  EXPECT_EQ(3, registry.use_count());
+
+  ASSERT_EQ(1, compacts.numberOfItems());
+  EXPECT_EQ("Compact A", compacts.valueAt(0).toStdString());
+
+  // a list of several types starts with the empty selection, then the objects grouped by type in the order the types were given
+  ASSERT_EQ(3, schedules.numberOfItems());
+  EXPECT_EQ("", schedules.valueAt(0).toStdString());
+  EXPECT_EQ("Compact A", schedules.valueAt(1).toStdString());
+  EXPECT_EQ("Constant A", schedules.valueAt(2).toStdString());
+
+  std::vector<int> compactsAdded;
+  std::vector<int> compactsRemoved;
+  std::vector<int> schedulesAdded;
+  std::vector<int> schedulesRemoved;
+  QObject::connect(&compacts, &OSComboBoxDataSource::itemAdded, [&compactsAdded](int i) { compactsAdded.push_back(i); });
+  QObject::connect(&compacts, &OSComboBoxDataSource::itemRemoved, [&compactsRemoved](int i) { compactsRemoved.push_back(i); });
+  QObject::connect(&schedules, &OSComboBoxDataSource::itemAdded, [&schedulesAdded](int i) { schedulesAdded.push_back(i); });
+  QObject::connect(&schedules, &OSComboBoxDataSource::itemRemoved, [&schedulesRemoved](int i) { schedulesRemoved.push_back(i); });
+
+  // an added object is appended to every list of its type
+  model::ScheduleCompact compactB(model);
+  compactB.setName("Compact B");
+  processEvents();
+
+  EXPECT_EQ(std::vector<int>{1}, compactsAdded);
+  EXPECT_EQ(std::vector<int>{3}, schedulesAdded);
+  ASSERT_EQ(2, compacts.numberOfItems());
+  EXPECT_EQ("Compact B", compacts.valueAt(1).toStdString());
+  ASSERT_EQ(4, schedules.numberOfItems());
+  EXPECT_EQ("Compact B", schedules.valueAt(3).toStdString());
+
+  // objects of other types are not listed
+  model::ScheduleRuleset ruleset(model);
+  processEvents();
+
+  EXPECT_EQ(1u, compactsAdded.size());
+  EXPECT_EQ(1u, schedulesAdded.size());
+
+  // names are read from the shared objects, a rename shows in both lists
+  compactA.setName("Compact Renamed");
+  processEvents();
+
+  EXPECT_EQ("Compact Renamed", compacts.valueAt(0).toStdString());
+  EXPECT_EQ("Compact Renamed", schedules.valueAt(1).toStdString());
+
+  // a removed object is taken out of every list
+  compactA.remove();
+  processEvents();
+
+  EXPECT_EQ(std::vector<int>{0}, compactsRemoved);
+  EXPECT_EQ(std::vector<int>{1}, schedulesRemoved);
+  ASSERT_EQ(1, compacts.numberOfItems());
+  EXPECT_EQ("Compact B", compacts.valueAt(0).toStdString());
+  ASSERT_EQ(3, schedules.numberOfItems());
+  EXPECT_EQ("Constant A", schedules.valueAt(1).toStdString());
+  EXPECT_EQ("Compact B", schedules.valueAt(2).toStdString());
+}
+
+TEST_F(OpenStudioLibFixture, OSComboBox2_SharedChoiceModelFocusChange) {
+
+  model::Model model;
+  model::Space spaceA(model);
+  model::Space spaceB(model);
+
+  ColumnComboBoxConcept column;
+  // the choices of a row can depend on the row, these two only share "Gamma"
+  auto rowA = std::make_shared<RowChoiceConcept>(std::vector<std::string>{"Alpha", "Beta", "Gamma"}, "Beta");
+  auto rowB = std::make_shared<RowChoiceConcept>(std::vector<std::string>{"Gamma", "Delta"}, "Delta");
+
+  OSComboBox2 comboA;
+  OSComboBox2 comboB;
+  comboA.bind(spaceA, rowA, &column);
+  comboB.bind(spaceB, rowB, &column);
+
+  std::shared_ptr<OSComboBoxChoiceModel> choiceModel = OSComboBoxChoiceModel::sharedModel(&column, model);
+
+  // until focused, a cell only holds its current value
+  EXPECT_EQ(1, comboA.count());
+  EXPECT_EQ("Beta", comboA.currentText().toStdString());
+  EXPECT_EQ(1, comboB.count());
+  EXPECT_EQ("Delta", comboB.currentText().toStdString());
+
+  QFocusEvent focusIn(QEvent::FocusIn);
+  QFocusEvent focusOut(QEvent::FocusOut);
+
+  QApplication::sendEvent(&comboA, &focusIn);
+  EXPECT_EQ(choiceModel.get(), comboA.model());
+  EXPECT_EQ(&comboA, choiceModel->attachedComboBox());
+  EXPECT_EQ(3, comboA.count());
+  EXPECT_EQ("Beta", comboA.currentText().toStdString());
+
+  // the release of A is only scheduled when focus leaves it, B reconciles the shared rows before that runs
+  QApplication::sendEvent(&comboA, &focusOut);
+  QApplication::sendEvent(&comboB, &focusIn);
+
+  EXPECT_EQ(choiceModel.get(), comboB.model());
+  EXPECT_NE(choiceModel.get(), comboA.model());
+  EXPECT_EQ(&comboB, choiceModel->attachedComboBox());
+  EXPECT_EQ((std::vector<std::string>{"Gamma", "Delta"}), choiceModel->choices());
+  EXPECT_EQ("Delta", comboB.currentText().toStdString());
+  EXPECT_EQ("Beta", comboA.currentText().toStdString());
+
+  processEvents();
+
+  // and back again
+  QApplication::sendEvent(&comboB, &focusOut);
+  QApplication::sendEvent(&comboA, &focusIn);
+
+  EXPECT_EQ(&comboA, choiceModel->attachedComboBox());
+  EXPECT_EQ((std::vector<std::string>{"Alpha", "Beta", "Gamma"}), choiceModel->choices());
+  EXPECT_EQ("Beta", comboA.currentText().toStdString());
+  EXPECT_EQ("Delta", comboB.currentText().toStdString());
+
+  processEvents();
+
+  // moving the focus did not write to either row
+  EXPECT_TRUE(rowA->m_sets.empty());
+  EXPECT_TRUE(rowB->m_sets.empty());
+  EXPECT_EQ("Beta", rowA->get());
+  EXPECT_EQ("Delta", rowB->get());
+}
+
+TEST_F(OpenStudioLibFixture, OSComboBoxChoiceModel_SetChoices) {
+
+  model::Model model;
+  ColumnComboBoxConcept column;
+  std::shared_ptr<OSComboBoxChoiceModel> choiceModel = OSComboBoxChoiceModel::sharedModel(&column, model);
+  EXPECT_EQ(choiceModel, OSComboBoxChoiceModel::sharedModel(&column, model));
+
+  int numInserted = 0;
+  int numRemoved = 0;
+  int numMoved = 0;
+  int numReset = 0;
+  QObject::connect(choiceModel.get(), &QAbstractItemModel::rowsInserted, [&numInserted](const QModelIndex&, int first, int last) {
+    numInserted += last - first + 1;
+  });
+  QObject::connect(choiceModel.get(), &QAbstractItemModel::rowsRemoved, [&numRemoved](const QModelIndex&, int first, int last) {
+    numRemoved += last - first + 1;
+  });
+  QObject::connect(choiceModel.get(), &QAbstractItemModel::rowsMoved, [&numMoved]() { ++numMoved; });
+  QObject::connect(choiceModel.get(), &QAbstractItemModel::modelReset, [&numReset]() { ++numReset; });
+
+  choiceModel->setChoices({"A", "B", "C", "D"});
+  EXPECT_EQ(4, numInserted);
+  ASSERT_EQ(4, choiceModel->rowCount());
+
+  // the same choices are a no-op
+  choiceModel->setChoices({"A", "B", "C", "D"});
+  EXPECT_EQ(4, numInserted);
+
+  // only the rows that differ are touched
+  numInserted = 0;
+  choiceModel->setChoices({"A", "C", "B", "E"});
+  EXPECT_EQ(1, numRemoved);
+  EXPECT_EQ(1, numInserted);
+  EXPECT_EQ(1, numMoved);
+  EXPECT_EQ(0, numReset);
+  EXPECT_EQ((std::vector<std::string>{"A", "C", "B", "E"}), choiceModel->choices());
+  for (int row = 0; row < choiceModel->rowCount(); ++row) {
+    EXPECT_EQ(choiceModel->choices()[row], choiceModel->data(choiceModel->index(row)).toString().toStdString());
+  }
+}
@@ -0,0 +1,181 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) 2020-2022, OpenStudio Coalition and other contributors. All rights reserved.
+*
+*  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the
+*  following conditions are met:
+*
+*  (1) Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+*  disclaimer.
+*
+*  (2) Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following
+*  disclaimer in the documentation and/or other materials provided with the distribution.
+*
+*  (3) Neither the name of the copyright holder nor the names of any contributors may be used to endorse or promote products
+*  derived from this software without specific prior written permission from the respective party.
+*
+*  (4) Other than as required in clauses (1) and (2), distributions in any form of modifications or other derivative works
+*  may not use the "OpenStudio" trademark, "OS", "os", or any other confusingly similar designation without specific prior
+*  written permission from Alliance for Sustainable Energy, LLC.
+*
+*  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDER(S) AND ANY CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+*  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+*  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER(S), ANY CONTRIBUTORS, THE UNITED STATES GOVERNMENT, OR THE UNITED
+*  STATES DEPARTMENT OF ENERGY, NOR ANY OF THEIR EMPLOYEES, BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+*  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF
+*  USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+*  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+*  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+***********************************************************************************************************************/
+
+#include <gtest/gtest.h>
+
+#include "OpenStudioLibFixture.hpp"
+
+#include "../OSItemList.hpp"
+#include "../OSVectorController.hpp"
+#include "../ScriptItem.hpp"
+
+#include <QWidget>
+
+#include <vector>
+
+using namespace openstudio;
+
+class CountingVectorController : public OSVectorController
+{
+ public:
+  explicit CountingVectorController(int& numReports) : m_numReports(numReports) {}
+
+ protected:
+  virtual std::vector<OSItemId> makeVector() override {
+    ++m_numReports;
+    return {};
+  }
+
+ private:
+  int& m_numReports;
+};
+
+// Reports an empty vector, items are then inserted and removed as deltas
+class DeltaVectorController : public OSVectorController
+{
+ public:
+  void reportRemoved(const OSItemId& itemId) {
+    emit itemIdRemoved(itemId);
+  }
+
+ protected:
+  virtual std::vector<OSItemId> makeVector() override {
+    return {};
+  }
+};
+
+static std::vector<QString> itemTexts(OSItemList* itemList) {
+  std::vector<QString> result;
+  for (OSItem* item : itemList->items()) {
+    result.push_back(item->text());
+  }
+  return result;
+}
+
+TEST_F(OpenStudioLibFixture, OSItemList_HiddenListReportsItemsWhenShown) {
+
+  int numReports = 0;
+
+  QWidget panel;
+  // the item list owns its vector controller
+  auto* itemList = new OSItemList(new CountingVectorController(numReports), false, &panel);
+
+  // like the list of a collapsed OSCollapsibleItem, which is hidden until its category is expanded
+  itemList->hide();
+  panel.show();
+  processEvents();
+  EXPECT_EQ(0, numReports);
+
+  itemList->show();
+  processEvents();
+  EXPECT_EQ(1, numReports);
+
+  // collapsing and expanding again does not rebuild the items
+  itemList->hide();
+  itemList->show();
+  processEvents();
+  EXPECT_EQ(1, numReports);
+}
+
+TEST_F(OpenStudioLibFixture, OSItemList_VisibleListReportsItems) {
+
+  int numReports = 0;
+
+  QWidget panel;
+  new OSItemList(new CountingVectorController(numReports), false, &panel);
+
+  panel.show();
+  processEvents();
+  EXPECT_EQ(1, numReports);
+}
+
+TEST_F(OpenStudioLibFixture, OSItemList_InsertItemId) {
+
+  QWidget panel;
+  auto* itemList = new OSItemList(new DeltaVectorController(), false, &panel);
+
+  // the layout shows the vector in reverse order
+  insertItemAtIndex(itemList, 0, new ScriptItem(toPath("a.rb"), OSItemType::ListItem));
+  EXPECT_EQ(std::vector<QString>({"a.rb"}), itemTexts(itemList));
+
+  // vector is a, b
+  insertItemAtIndex(itemList, 1, new ScriptItem(toPath("b.rb"), OSItemType::ListItem));
+  EXPECT_EQ(std::vector<QString>({"b.rb", "a.rb"}), itemTexts(itemList));
+
+  // vector is a, c, b
+  insertItemAtIndex(itemList, 1, new ScriptItem(toPath("c.rb"), OSItemType::ListItem));
+  EXPECT_EQ(std::vector<QString>({"b.rb", "c.rb", "a.rb"}), itemTexts(itemList));
+
+  // vector is d, a, c, b
+  insertItemAtIndex(itemList, 0, new ScriptItem(toPath("d.rb"), OSItemType::ListItem));
+  EXPECT_EQ(std::vector<QString>({"b.rb", "c.rb", "a.rb", "d.rb"}), itemTexts(itemList));
+
+  // vector is d, a, c, b, e
+  insertItemAtIndex(itemList, 4, new ScriptItem(toPath("e.rb"), OSItemType::ListItem));
+  EXPECT_EQ(std::vector<QString>({"e.rb", "b.rb", "c.rb", "a.rb", "d.rb"}), itemTexts(itemList));
+
+  // inserting does not change the selection
+  EXPECT_FALSE(itemList->selectedItem());
+}
+
+TEST_F(OpenStudioLibFixture, OSItemList_RemoveItemId) {
+
+  QWidget panel;
+  auto* controller = new DeltaVectorController();
+  auto* itemList = new OSItemList(controller, false, &panel);
+
+  auto* a = new ScriptItem(toPath("a.rb"), OSItemType::ListItem);
+  auto* b = new ScriptItem(toPath("b.rb"), OSItemType::ListItem);
+  auto* c = new ScriptItem(toPath("c.rb"), OSItemType::ListItem);
+  OSItemId aId = a->itemId();
+  OSItemId cId = c->itemId();
+  itemList->addItem(a, false);
+  itemList->addItem(b, false);
+  itemList->addItem(c, false);
+  EXPECT_EQ(std::vector<QString>({"c.rb", "b.rb", "a.rb"}), itemTexts(itemList));
+
+  itemList->selectItem(b);
+  ASSERT_EQ(b, itemList->selectedItem());
+
+  // removing another item keeps the selection
+  controller->reportRemoved(aId);
+  EXPECT_EQ(std::vector<QString>({"c.rb", "b.rb"}), itemTexts(itemList));
+  EXPECT_EQ(b, itemList->selectedItem());
+
+  // removing the selected item selects the first one left
+  controller->reportRemoved(b->itemId());
+  EXPECT_EQ(std::vector<QString>({"c.rb"}), itemTexts(itemList));
+  ASSERT_TRUE(itemList->selectedItem());
+  EXPECT_EQ(cId, itemList->selectedItem()->itemId());
+
+  // and nothing once the list is empty
+  controller->reportRemoved(cId);
+  EXPECT_TRUE(itemTexts(itemList).empty());
+  EXPECT_FALSE(itemList->selectedItem());
+}
@@ -34,6 +34,8 @@
 #include "../DesignDayGridView.hpp"
 #include "../GridViewSubTab.hpp"
 #include "../OSDropZone.hpp"
+#include "../OSItemList.hpp"
+#include "../../shared_gui_components/MeasureManager.hpp"
 #include "../../shared_gui_components/OSCellWrapper.hpp"
 #include "../../shared_gui_components/OSGridController.hpp"
 #include "../../shared_gui_components/OSGridView.hpp"
@@ -93,11 +95,11 @@ std::map<GridCellLocation*, GridCellInfo*> OpenStudioLibFixture::getGridCellLoca
 }
 
 std::vector<GridCellLocation*> OpenStudioLibFixture::getSelectorCellLocations(openstudio::OSObjectSelector* os) {
-  return os->m_selectorCellLocations;
+  return os->selectorCellLocations();
 }
 
 std::vector<GridCellLocation*> OpenStudioLibFixture::getParentCellLocations(openstudio::OSObjectSelector* os) {
-  return os->m_parentCellLocations;
+  return os->parentCellLocations();
 }
 
 boost::optional<openstudio::model::ModelObject> OpenStudioLibFixture::getModelObject(openstudio::OSDropZone2* dropZone) {
@@ -249,4 +251,29 @@ void OpenStudioLibFixture::checkExpected(OSObjectSelector* os, OSGridView* gv, i
 
   var = widget->property("style");
   EXPECT_EQ(var.toString().toStdString(), style) << gridRow << ", " << column << ", " << subrow;
-}
\ No newline at end of file
+}
+
+void OpenStudioLibFixture::insertItemAtIndex(OSItemList* itemList, int index, OSItem* item) {
+  itemList->insertItemAtIndex(index, item);
+}
+
+void OpenStudioLibFixture::setTempModelChecksum(MeasureManager& measureManager, const std::string& tempModelChecksum) {
+  measureManager.m_tempModelChecksum = tempModelChecksum;
+}
+
+boost::optional<std::vector<measure::OSArgument>> OpenStudioLibFixture::cachedArguments(MeasureManager& measureManager, const BCLMeasure& measure) {
+  return measureManager.cachedArguments(measure);
+}
+
+std::vector<measure::OSArgument> OpenStudioLibFixture::storeArguments(MeasureManager& measureManager, const BCLMeasure& measure,
+                                                                      const QByteArray& reply) {
+  return measureManager.storeArguments(measure, reply);
+}
+
+openstudio::path OpenStudioLibFixture::argumentsCachePath(const MeasureManager& measureManager, const BCLMeasure& measure, bool modelDependent) {
+  return measureManager.argumentsCachePath(measure, modelDependent);
+}
+
+void OpenStudioLibFixture::pruneArgumentsCache(const openstudio::path& cacheDir, int maxEntries, int maxAgeDays) {
+  MeasureManager::pruneArgumentsCache(cacheDir, maxEntries, maxAgeDays);
+}
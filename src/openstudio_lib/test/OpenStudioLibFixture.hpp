@@ -35,6 +35,8 @@
 #include <openstudio/utilities/core/Logger.hpp>
 #include <openstudio/utilities/core/FileLogSink.hpp>
 #include <openstudio/model/ModelObject.hpp>
+#include <openstudio/measure/OSArgument.hpp>
+#include <openstudio/utilities/core/Path.hpp>
 
 #include <map>
 #include <vector>
@@ -44,6 +46,10 @@ class DesignDayGridView;
 class GridCellLocation;
 class GridCellInfo;
 class GridViewSubTab;
+class OSItem;
+class OSItemList;
+class BCLMeasure;
+class MeasureManager;
 class OSCellWrapper;
 class OSObjectSelector;
 class OSGridController;
@@ -53,6 +59,7 @@ class OSLineEdit2;
 class OSWidgetHolder;
 }  // namespace openstudio
 
+class QByteArray;
 class QWidget;
 class QString;
 
@@ -107,6 +114,18 @@ class OpenStudioLibFixture : public ::testing::Test
                      boost::optional<openstudio::model::ModelObject> mo, bool visible, bool selectable, bool selected, bool selector, bool locked,
                      const std::string& style);
 
+  void insertItemAtIndex(openstudio::OSItemList* itemList, int index, openstudio::OSItem* item);
+
+  // MeasureManager argument cache
+  void setTempModelChecksum(openstudio::MeasureManager& measureManager, const std::string& tempModelChecksum);
+  boost::optional<std::vector<openstudio::measure::OSArgument>> cachedArguments(openstudio::MeasureManager& measureManager,
+                                                                                const openstudio::BCLMeasure& measure);
+  std::vector<openstudio::measure::OSArgument> storeArguments(openstudio::MeasureManager& measureManager, const openstudio::BCLMeasure& measure,
+                                                              const QByteArray& reply);
+  openstudio::path argumentsCachePath(const openstudio::MeasureManager& measureManager, const openstudio::BCLMeasure& measure,
+                                      bool modelDependent);
+  void pruneArgumentsCache(const openstudio::path& cacheDir, int maxEntries, int maxAgeDays);
+
   // static variables
   static boost::optional<openstudio::FileLogSink> logFile;
 };
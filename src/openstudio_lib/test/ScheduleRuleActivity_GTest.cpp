@@ -0,0 +1,128 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) 2020-2022, OpenStudio Coalition and other contributors. All rights reserved.
+*
+*  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the
+*  following conditions are met:
+*
+*  (1) Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+*  disclaimer.
+*
+*  (2) Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following
+*  disclaimer in the documentation and/or other materials provided with the distribution.
+*
+*  (3) Neither the name of the copyright holder nor the names of any contributors may be used to endorse or promote products
+*  derived from this software without specific prior written permission from the respective party.
+*
+*  (4) Other than as required in clauses (1) and (2), distributions in any form of modifications or other derivative works
+*  may not use the "OpenStudio" trademark, "OS", "os", or any other confusingly similar designation without specific prior
+*  written permission from Alliance for Sustainable Energy, LLC.
+*
+*  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDER(S) AND ANY CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+*  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+*  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER(S), ANY CONTRIBUTORS, THE UNITED STATES GOVERNMENT, OR THE UNITED
+*  STATES DEPARTMENT OF ENERGY, NOR ANY OF THEIR EMPLOYEES, BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+*  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF
+*  USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+*  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+*  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+***********************************************************************************************************************/
+
+#include <gtest/gtest.h>
+
+#include "OpenStudioLibFixture.hpp"
+
+#include "../SchedulesView.hpp"
+
+#include <openstudio/model/Model.hpp>
+#include <openstudio/model/ScheduleRule.hpp>
+#include <openstudio/model/ScheduleRuleset.hpp>
+#include <openstudio/model/YearDescription.hpp>
+
+#include <openstudio/utilities/time/Date.hpp>
+
+using namespace openstudio;
+
+static void setApplyAllDays(model::ScheduleRule& scheduleRule, bool apply) {
+  scheduleRule.setApplySunday(apply);
+  scheduleRule.setApplyMonday(apply);
+  scheduleRule.setApplyTuesday(apply);
+  scheduleRule.setApplyWednesday(apply);
+  scheduleRule.setApplyThursday(apply);
+  scheduleRule.setApplyFriday(apply);
+  scheduleRule.setApplySaturday(apply);
+}
+
+// Refreshes the cached activity and compares it with the activity computed from scratch over the whole assumed year
+static void expectActivity(ScheduleRuleActivity& activity, const model::ScheduleRuleset& schedule, const std::string& step) {
+  activity.refresh();
+
+  int year = schedule.model().getUniqueModelObject<model::YearDescription>().assumedYear();
+  std::vector<int> expected = schedule.getActiveRuleIndices(Date(MonthOfYear::Jan, 1, year), Date(MonthOfYear::Dec, 31, year));
+  ASSERT_EQ(expected.size(), activity.activeRuleIndices().size()) << step;
+  for (size_t i = 0; i < expected.size(); ++i) {
+    ASSERT_EQ(expected[i], activity.activeRuleIndices()[i]) << step << ", day " << i + 1;
+  }
+}
+
+TEST_F(OpenStudioLibFixture, ScheduleRuleActivity_Refresh) {
+  model::Model model;
+  model::ScheduleRuleset schedule(model);
+  int year = model.getUniqueModelObject<model::YearDescription>().assumedYear();
+
+  ScheduleRuleActivity activity(schedule);
+  expectActivity(activity, schedule, "no rule");
+
+  // add rules
+  model::ScheduleRule weekdays(schedule);
+  weekdays.setApplyMonday(true);
+  weekdays.setApplyTuesday(true);
+  weekdays.setApplyWednesday(true);
+  weekdays.setApplyThursday(true);
+  weekdays.setApplyFriday(true);
+  expectActivity(activity, schedule, "add weekdays");
+
+  model::ScheduleRule summer(schedule);
+  setApplyAllDays(summer, true);
+  summer.setStartDate(Date(MonthOfYear::Jun, 1, year));
+  summer.setEndDate(Date(MonthOfYear::Aug, 31, year));
+  expectActivity(activity, schedule, "add summer");
+
+  model::ScheduleRule holidays(schedule);
+  setApplyAllDays(holidays, true);
+  holidays.setStartDate(Date(MonthOfYear::Dec, 20, year));
+  holidays.setEndDate(Date(MonthOfYear::Dec, 31, year));
+  expectActivity(activity, schedule, "add holidays");
+
+  // date range edits, only the old and new ranges of the rule are recomputed
+  summer.setEndDate(Date(MonthOfYear::Sep, 30, year));
+  expectActivity(activity, schedule, "extend summer");
+
+  summer.setStartDate(Date(MonthOfYear::Jul, 1, year));
+  expectActivity(activity, schedule, "shrink summer");
+
+  weekdays.setStartDate(Date(MonthOfYear::Mar, 1, year));
+  weekdays.setEndDate(Date(MonthOfYear::Oct, 31, year));
+  expectActivity(activity, schedule, "restrict weekdays");
+
+  summer.setApplySaturday(false);
+  summer.setApplySunday(false);
+  expectActivity(activity, schedule, "summer on weekdays only");
+
+  // reorder, the priority of overlapping rules changes
+  EXPECT_TRUE(schedule.setScheduleRuleIndex(weekdays, 0));
+  expectActivity(activity, schedule, "weekdays first");
+
+  EXPECT_TRUE(schedule.setScheduleRuleIndex(holidays, 0));
+  expectActivity(activity, schedule, "holidays first");
+
+  // remove rules
+  summer.remove();
+  expectActivity(activity, schedule, "remove summer");
+
+  weekdays.remove();
+  expectActivity(activity, schedule, "remove weekdays");
+
+  // another assumed year moves every day
+  model.getUniqueModelObject<model::YearDescription>().setCalendarYear(year + 1);
+  expectActivity(activity, schedule, "next year");
+}
@@ -90,6 +90,7 @@ BENCHMARK(BM_SpacesSurfaces)
   ->Arg(192)
   ->Arg(384)
   ->Arg(768)
-  //->Arg(1536) // 1536 takes 89 secodns AFTER dan's improvements
+  ->Arg(1536)  // 1536 took 89 seconds before the grid was virtualized
+  ->Arg(3072)
   ->Unit(benchmark::kMillisecond)
   ->Complexity();
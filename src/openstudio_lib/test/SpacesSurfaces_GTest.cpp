@@ -31,10 +31,14 @@
 
 #include "OpenStudioLibFixture.hpp"
 
+#include "../SpacesFilterIndex.hpp"
 #include "../SpacesSurfacesGridView.hpp"
 #include "../../shared_gui_components/OSGridController.hpp"
+#include "../../shared_gui_components/OSGridView.hpp"
 #include "../../shared_gui_components/OSObjectSelector.hpp"
+#include "../../model_editor/Utilities.hpp"
 
+#include <openstudio/model/BuildingStory.hpp>
 #include <openstudio/model/Model.hpp>
 #include <openstudio/model/Space.hpp>
 #include <openstudio/model/Space_Impl.hpp>
@@ -42,9 +46,12 @@
 #include <openstudio/model/SpaceType_Impl.hpp>
 #include <openstudio/model/Surface.hpp>
 #include <openstudio/model/Surface_Impl.hpp>
+#include <openstudio/utilities/core/Compare.hpp>
+#include <openstudio/utilities/geometry/Point3d.hpp>
 
 #include <QComboBox>
 
+#include <algorithm>
 #include <memory>
 
 using namespace openstudio;
@@ -183,3 +190,108 @@ TEST_F(OpenStudioLibFixture, SpacesSurfacesGridView) {
     i += 1;
   }
 }
+
+TEST_F(OpenStudioLibFixture, SpacesSurfacesGridView_Virtualized) {
+
+  model::Model model;
+  constexpr int nSpaces = 120;
+  double zOrigin = 0.0;
+  for (int i = 0; i < nSpaces; ++i) {
+    Point3dVector pts{{0, 0, zOrigin}, {0, 1, zOrigin}, {1, 1, zOrigin}, {1, 0, zOrigin}};
+    model::Space::fromFloorPrint(pts, 2.0, model);
+    zOrigin += 2.0;
+  }
+  auto surfaces = model.getConcreteModelObjects<model::Surface>();
+  EXPECT_EQ(6u * nSpaces, surfaces.size());
+
+  // the grid is never shown, so only the first block of rows is materialized
+  auto gridView = std::make_shared<SpacesSurfacesGridView>(false, model);
+  auto* gridController = getGridController(gridView.get());
+  auto* objectSelector = getObjectSelector(gridController);
+  auto* osGridView = getGridView(gridView.get());
+
+  processEvents();
+
+  EXPECT_TRUE(osGridView->isVirtualized());
+
+  // Row = 1, Col = 0 is the first Space
+  EXPECT_TRUE(objectSelector->getObject(0, 1, 0, boost::none));
+  EXPECT_TRUE(osGridView->itemAtPosition(1, 0));
+
+  // Row = 101 is in the second block, which is not materialized
+  EXPECT_FALSE(objectSelector->getObject(100, 101, 0, boost::none));
+  EXPECT_FALSE(osGridView->itemAtPosition(101, 0));
+  EXPECT_GT(surfaces.size(), objectSelector->selectableObjects().size());
+
+  // selecting all rows materializes all of them
+  osGridView->onMaterializeAll();
+  objectSelector->selectAll();
+
+  processEvents();
+
+  EXPECT_TRUE(objectSelector->getObject(100, 101, 0, boost::none));
+  EXPECT_TRUE(osGridView->itemAtPosition(101, 0));
+  EXPECT_EQ(surfaces.size(), objectSelector->selectableObjects().size());
+  EXPECT_EQ(surfaces.size(), objectSelector->selectedObjects().size());
+}
+
+TEST_F(OpenStudioLibFixture, SpacesFilterIndex) {
+
+  model::Model model = model::exampleModel();
+  auto spaces = model.getConcreteModelObjects<model::Space>();
+  auto surfaces = model.getConcreteModelObjects<model::Surface>();
+  ASSERT_EQ(4u, spaces.size());
+
+  SpacesFilterIndex filterIndex(model);
+
+  auto numAccepted = [&filterIndex](const auto& objects) {
+    return static_cast<size_t>(std::count_if(objects.begin(), objects.end(), [&filterIndex](const auto& obj) { return filterIndex.accepts(obj); }));
+  };
+
+  EXPECT_EQ(spaces.size(), numAccepted(spaces));
+  EXPECT_EQ(surfaces.size(), numAccepted(surfaces));
+  EXPECT_EQ(spaces.size() + surfaces.size(), filterIndex.numEntries());
+
+  // surface filters are case insensitive and never hide spaces
+  auto numWalls = static_cast<size_t>(
+    std::count_if(surfaces.begin(), surfaces.end(), [](const auto& s) { return istringEqual("Wall", s.surfaceType()); }));
+  filterIndex.setFilter(SpacesFilterIndex::SurfaceType, "wall");
+  EXPECT_EQ(numWalls, numAccepted(surfaces));
+  EXPECT_EQ(spaces.size(), numAccepted(spaces));
+
+  // combined filters
+  auto numOutdoorWalls = static_cast<size_t>(std::count_if(surfaces.begin(), surfaces.end(), [](const auto& s) {
+    return istringEqual("Wall", s.surfaceType()) && istringEqual("Outdoors", s.outsideBoundaryCondition());
+  }));
+  filterIndex.setFilter(SpacesFilterIndex::OutsideBoundaryCondition, "Outdoors");
+  EXPECT_EQ(numOutdoorWalls, numAccepted(surfaces));
+
+  filterIndex.clearFilter(SpacesFilterIndex::SurfaceType);
+  filterIndex.clearFilter(SpacesFilterIndex::OutsideBoundaryCondition);
+  EXPECT_EQ(surfaces.size(), numAccepted(surfaces));
+
+  // space filters
+  model::BuildingStory story(model);
+  story.setName("Filtered Story");
+  spaces[0].setBuildingStory(story);
+
+  filterIndex.setFilter(SpacesFilterIndex::Story, "Filtered Story");
+  EXPECT_TRUE(filterIndex.isActive(SpacesFilterIndex::Story));
+  EXPECT_EQ(1u, numAccepted(spaces));
+  EXPECT_TRUE(filterIndex.accepts(spaces[0]));
+  EXPECT_EQ(surfaces.size(), numAccepted(surfaces));
+
+  // entries follow model changes without resetting the filter
+  spaces[1].setBuildingStory(story);
+  EXPECT_TRUE(filterIndex.accepts(spaces[1]));
+  EXPECT_EQ(2u, numAccepted(spaces));
+
+  filterIndex.setFilter(SpacesFilterIndex::SpaceName, toString(toQString(spaces[1].nameString()).toLower()));
+  EXPECT_EQ(1u, numAccepted(spaces));
+  EXPECT_TRUE(filterIndex.accepts(spaces[1]));
+
+  filterIndex.clearFilter(SpacesFilterIndex::Story);
+  filterIndex.clearFilter(SpacesFilterIndex::SpaceName);
+  EXPECT_FALSE(filterIndex.isActive(SpacesFilterIndex::Story));
+  EXPECT_EQ(spaces.size(), numAccepted(spaces));
+}
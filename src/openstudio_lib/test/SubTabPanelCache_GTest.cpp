@@ -0,0 +1,113 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) 2020-2022, OpenStudio Coalition and other contributors. All rights reserved.
+*
+*  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the
+*  following conditions are met:
+*
+*  (1) Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+*  disclaimer.
+*
+*  (2) Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following
+*  disclaimer in the documentation and/or other materials provided with the distribution.
+*
+*  (3) Neither the name of the copyright holder nor the names of any contributors may be used to endorse or promote products
+*  derived from this software without specific prior written permission from the respective party.
+*
+*  (4) Other than as required in clauses (1) and (2), distributions in any form of modifications or other derivative works
+*  may not use the "OpenStudio" trademark, "OS", "os", or any other confusingly similar designation without specific prior
+*  written permission from Alliance for Sustainable Energy, LLC.
+*
+*  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDER(S) AND ANY CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+*  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+*  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER(S), ANY CONTRIBUTORS, THE UNITED STATES GOVERNMENT, OR THE UNITED
+*  STATES DEPARTMENT OF ENERGY, NOR ANY OF THEIR EMPLOYEES, BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+*  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF
+*  USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+*  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+*  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+***********************************************************************************************************************/
+
+#include <gtest/gtest.h>
+
+#include "OpenStudioLibFixture.hpp"
+
+#include "../SubTabPanelCache.hpp"
+
+#include <openstudio/model/Model.hpp>
+
+#include <QPointer>
+#include <QStackedWidget>
+
+using namespace openstudio;
+
+TEST_F(OpenStudioLibFixture, SubTabPanelCache) {
+
+  QStackedWidget stack;
+  SubTabPanelCache cache;
+
+  EXPECT_FALSE(cache.find("Schedules/ScheduleSets"));
+
+  // the panel of the first subtab is built once and shown
+  auto* scheduleSets = new QWidget();
+  cache.insert("Schedules/ScheduleSets", scheduleSets);
+  stack.addWidget(scheduleSets);
+  EXPECT_TRUE(cache.contains(scheduleSets));
+
+  // switching to another subtab only takes it out of the stack
+  auto* schedules = new QWidget();
+  cache.insert("Schedules/Schedules", schedules);
+  stack.removeWidget(scheduleSets);
+  stack.addWidget(schedules);
+  processEvents();
+
+  // revisiting the first subtab returns the same panel
+  EXPECT_EQ(scheduleSets, cache.find("Schedules/ScheduleSets"));
+  EXPECT_EQ(schedules, cache.find("Schedules/Schedules"));
+
+  QWidget other;
+  EXPECT_FALSE(cache.contains(&other));
+
+  // a panel deleted behind the cache's back has to be built again
+  delete schedules;
+  EXPECT_FALSE(cache.find("Schedules/Schedules"));
+
+  cache.reset();
+  EXPECT_FALSE(cache.find("Schedules/ScheduleSets"));
+  EXPECT_EQ(0, stack.count());
+}
+
+TEST_F(OpenStudioLibFixture, SubTabPanelCache_ComponentLibraryChange) {
+
+  QStackedWidget stack;
+  SubTabPanelCache cache;
+
+  model::Model library;
+  model::Model otherLibrary;
+
+  // the first library seen starts the cache
+  EXPECT_TRUE(cache.resetForLibrary(library));
+
+  QPointer<QWidget> constructions = new QWidget();
+  cache.insert("Constructions/Constructions", constructions);
+  stack.addWidget(constructions);
+  QPointer<QWidget> defaultConstructions = new QWidget();
+  cache.insert("Constructions/DefaultConstructions", defaultConstructions);
+  stack.removeWidget(constructions);
+  stack.addWidget(defaultConstructions);
+
+  // the same library, even through another handle to it, keeps the panels
+  model::Model sameLibrary = library;
+  EXPECT_FALSE(cache.resetForLibrary(sameLibrary));
+  EXPECT_EQ(constructions.data(), cache.find("Constructions/Constructions"));
+
+  // replacing the component library drops every library panel, shown or not
+  EXPECT_TRUE(cache.resetForLibrary(otherLibrary));
+  processEvents();
+  EXPECT_TRUE(constructions.isNull());
+  EXPECT_TRUE(defaultConstructions.isNull());
+  EXPECT_FALSE(cache.find("Constructions/Constructions"));
+  EXPECT_FALSE(cache.find("Constructions/DefaultConstructions"));
+  EXPECT_EQ(0, stack.count());
+
+  EXPECT_FALSE(cache.resetForLibrary(otherLibrary));
+}
@@ -0,0 +1,111 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) 2020-2022, OpenStudio Coalition and other contributors. All rights reserved.
+*
+*  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the
+*  following conditions are met:
+*
+*  (1) Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+*  disclaimer.
+*
+*  (2) Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following
+*  disclaimer in the documentation and/or other materials provided with the distribution.
+*
+*  (3) Neither the name of the copyright holder nor the names of any contributors may be used to endorse or promote products
+*  derived from this software without specific prior written permission from the respective party.
+*
+*  (4) Other than as required in clauses (1) and (2), distributions in any form of modifications or other derivative works
+*  may not use the "OpenStudio" trademark, "OS", "os", or any other confusingly similar designation without specific prior
+*  written permission from Alliance for Sustainable Energy, LLC.
+*
+*  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDER(S) AND ANY CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+*  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+*  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER(S), ANY CONTRIBUTORS, THE UNITED STATES GOVERNMENT, OR THE UNITED
+*  STATES DEPARTMENT OF ENERGY, NOR ANY OF THEIR EMPLOYEES, BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+*  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF
+*  USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+*  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+*  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+***********************************************************************************************************************/
+
+#include <gtest/gtest.h>
+
+#include "OpenStudioLibFixture.hpp"
+
+#include "../MainTabController.hpp"
+#include "../MainTabView.hpp"
+#include "../TabControllerCache.hpp"
+
+#include <memory>
+
+using namespace openstudio;
+
+static std::shared_ptr<MainTabController> makeTabController(const QString& label) {
+  return std::make_shared<MainTabController>(new MainTabView(label, MainTabView::MAIN_TAB));
+}
+
+TEST_F(OpenStudioLibFixture, TabControllerCache) {
+
+  TabControllerCache cache(4, 100000);
+
+  auto loads = makeTabController("Loads");
+  std::weak_ptr<MainTabController> weakLoads = loads;
+  cache.put(3, std::move(loads));
+  EXPECT_EQ(1, cache.size());
+
+  // coming back to the tab returns the same controller
+  EXPECT_FALSE(cache.take(5));
+  auto taken = cache.take(3);
+  EXPECT_EQ(weakLoads.lock(), taken);
+  EXPECT_EQ(0, cache.size());
+
+  // an object added or removed while the tab was detached makes it rebuilt
+  cache.put(3, std::move(taken));
+  cache.markAllDirty();
+  EXPECT_FALSE(cache.take(3));
+  EXPECT_TRUE(weakLoads.expired());
+  EXPECT_EQ(0, cache.size());
+}
+
+TEST_F(OpenStudioLibFixture, TabControllerCache_ComponentLibraryChange) {
+
+  TabControllerCache cache(4, 100000);
+
+  auto constructions = makeTabController("Constructions");
+  auto loads = makeTabController("Loads");
+  std::weak_ptr<MainTabController> weakConstructions = constructions;
+  std::weak_ptr<MainTabController> weakLoads = loads;
+  cache.put(2, std::move(constructions));
+  cache.put(3, std::move(loads));
+
+  // OSDocument::setComponentLibrary and on_closeBclDlg clear the cache before reselecting the tab,
+  // so neither the current tab nor the ones visited before it keep showing the previous library
+  cache.clear();
+  processEvents();
+
+  EXPECT_TRUE(weakConstructions.expired());
+  EXPECT_TRUE(weakLoads.expired());
+  EXPECT_FALSE(cache.take(2));
+  EXPECT_FALSE(cache.take(3));
+}
+
+TEST_F(OpenStudioLibFixture, TabControllerCache_Eviction) {
+
+  TabControllerCache cache(2, 100000);
+
+  auto site = makeTabController("Site");
+  std::weak_ptr<MainTabController> weakSite = site;
+  cache.put(0, std::move(site));
+  cache.put(1, makeTabController("Schedules"));
+  cache.put(2, makeTabController("Constructions"));
+
+  // the least recently used controller is dropped first
+  EXPECT_EQ(2, cache.size());
+  EXPECT_TRUE(weakSite.expired());
+  EXPECT_TRUE(cache.take(1));
+  EXPECT_TRUE(cache.take(2));
+
+  // a size of 0 disables the cache
+  TabControllerCache disabled(0, 100000);
+  disabled.put(0, makeTabController("Site"));
+  EXPECT_EQ(0, disabled.size());
+}
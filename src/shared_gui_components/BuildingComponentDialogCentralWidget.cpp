@@ -317,10 +317,8 @@ void BuildingComponentDialogCentralWidget::measureDownloadComplete(const std::st
   auto* app = dynamic_cast<BaseApp*>(Application::instance().application());
   if (app) {
     if (measure) {
-      try {
-        app->measureManager().getArguments(*measure);
-      } catch (const std::exception&) {
-      }
+      // warm the argument cache without blocking the dialog, errors are reported when the measure is added to the workflow
+      app->measureManager().computeArgumentsAsync(*measure);
     }
     // DLM: handled in OSDocument::on_closeMeasuresBclDlg
     // app->measureManager().updateMeasuresLists();
@@ -63,7 +63,10 @@ EditController::~EditController() {
 }
 
 void EditController::setMeasureStepItem(measuretab::MeasureStepItem* measureStepItem, BaseApp* t_app) {
+  disconnect(m_argumentsComputedConnection);
+
   m_measureStepItem = measureStepItem;
+  m_app = t_app;
 
   editRubyMeasureView->clear();
 
@@ -85,12 +88,23 @@ void EditController::setMeasureStepItem(measuretab::MeasureStepItem* measureStep
 
   editRubyMeasureView->modelerDescriptionTextEdit->setText(m_measureStepItem->modelerDescription());
 
-  // Inputs
+  // Inputs, arguments may still be computing in which case they are added once available
+
+  m_argumentsComputedConnection =
+    connect(m_measureStepItem.data(), &measuretab::MeasureStepItem::argumentsComputed, this, &EditController::updateInputs);
+
+  updateInputs();
+}
+
+void EditController::updateInputs() {
+  editRubyMeasureView->clear();
+
+  m_inputControllers.clear();
 
   std::vector<measure::OSArgument> arguments = m_measureStepItem->arguments();
 
   for (const auto& arg : arguments) {
-    QSharedPointer<InputController> inputController = QSharedPointer<InputController>(new InputController(this, arg, t_app));
+    QSharedPointer<InputController> inputController = QSharedPointer<InputController>(new InputController(this, arg, m_app));
 
     m_inputControllers.push_back(inputController);
 
@@ -108,6 +122,8 @@ void EditController::updateDescription() {
 
 void EditController::reset() {
 
+  disconnect(m_argumentsComputedConnection);
+
   editView->setView(m_editNullView);
 
   m_inputControllers.clear();
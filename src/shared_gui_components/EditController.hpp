@@ -78,6 +78,9 @@ class EditController : public QObject
 
   void updateDescription();
 
+  // Rebuilds the input views from the arguments of the current measure step
+  void updateInputs();
+
  private:
   REGISTER_LOGGER("openstudio.pat.EditController");
 
@@ -86,6 +89,10 @@ class EditController : public QObject
   std::vector<QSharedPointer<InputController>> m_inputControllers;
 
   QPointer<measuretab::MeasureStepItem> m_measureStepItem;
+
+  BaseApp* m_app = nullptr;
+
+  QMetaObject::Connection m_argumentsComputedConnection;
 };
 
 class InputController : public QObject
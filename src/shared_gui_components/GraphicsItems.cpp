@@ -34,9 +34,34 @@
 #include <QPainter>
 #include <QApplication>
 #include <QGraphicsScene>
+#include <QStyleOptionGraphicsItem>
+#include <QPixmap>
+#include <algorithm>
 
 namespace openstudio {
 
+static double levelOfDetail(const QPainter* painter) {
+  return QStyleOptionGraphicsItem::levelOfDetailFromTransform(painter->worldTransform());
+}
+
+void drawDetailedPixmap(QPainter* painter, const QRectF& target, const QPixmap& pixmap) {
+  double lod = levelOfDetail(painter);
+
+  if (std::min(target.width(), target.height()) * lod < minimumIconPixels) {
+    painter->fillRect(target, QColor(96, 96, 96));
+  } else {
+    painter->drawPixmap(target, pixmap, QRectF(pixmap.rect()));
+  }
+}
+
+void drawDetailedText(QPainter* painter, const QRectF& rect, int flags, const QString& text) {
+  double lod = levelOfDetail(painter);
+
+  if (painter->fontInfo().pixelSize() * lod >= minimumTextPixels) {
+    painter->drawText(rect, flags, text);
+  }
+}
+
 AbstractButtonItem::AbstractButtonItem(QGraphicsItem* parent) : QGraphicsObject(parent), m_checked(false), m_mouseDown(false) {}
 
 void AbstractButtonItem::setChecked(bool checked) {
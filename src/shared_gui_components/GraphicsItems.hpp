@@ -34,8 +34,22 @@
 #include <QGraphicsObject>
 #include <QSizeF>
 
+class QPainter;
+
 namespace openstudio {
 
+// Level of detail for items in zoomable scenes such as the HVAC and refrigeration views.
+// When zoomed out far enough, icons smaller than minimumIconPixels are drawn as flat glyphs and text smaller than
+// minimumTextPixels is skipped: both are unreadable at that size and they dominate repainting large scenes.
+constexpr double minimumIconPixels = 12.0;
+constexpr double minimumTextPixels = 5.0;
+
+// Draws pixmap scaled into target, or a flat glyph with the same footprint if target is smaller than minimumIconPixels on screen
+void drawDetailedPixmap(QPainter* painter, const QRectF& target, const QPixmap& pixmap);
+
+// Draws text like QPainter::drawText, unless the painter's font is smaller than minimumTextPixels on screen
+void drawDetailedText(QPainter* painter, const QRectF& rect, int flags, const QString& text);
+
 class OSListItem;
 class OSListController;
 class OSGraphicsItemDelegate;
@@ -45,7 +45,10 @@
 
 #include <openstudio/model/Model.hpp>
 
+#include <openstudio/OpenStudio.hxx>
+
 #include <openstudio/utilities/core/Assert.hpp>
+#include <openstudio/utilities/core/Checksum.hpp>
 #include <openstudio/utilities/core/PathHelpers.hpp>
 #include <openstudio/utilities/core/RubyException.hpp>
 #include <openstudio/utilities/core/System.hpp>
@@ -58,8 +61,11 @@
 
 #include <json/json.h>
 
+#include <algorithm>
+
 #include <QAbstractButton>
 #include <QBoxLayout>
+#include <QDateTime>
 #include <QDesktopServices>
 #include <QDir>
 #include <QFile>
@@ -71,18 +77,45 @@
 #include <QPushButton>
 #include <QUrl>
 #include <QRadioButton>
+#include <QSaveFile>
+#include <QStandardPaths>
 #include <QProgressDialog>
 #include <QNetworkAccessManager>
 #include <QNetworkRequest>
 #include <QNetworkReply>
 #include <QThread>
+#include <QTimer>
 // Debug only
 //#include <QSslError>
 //#include <QDateTime>
 
 namespace openstudio {
 
-MeasureManager::MeasureManager(BaseApp* t_app) : m_app(t_app), m_started(false) {}
+namespace {
+
+// A request to the measure manager server failed, the message is the reply body when there is one
+class RequestError : public std::runtime_error
+{
+ public:
+  explicit RequestError(const std::string& message) : std::runtime_error(message) {}
+};
+
+}  // namespace
+
+MeasureManager::MeasureManager(BaseApp* t_app) : m_app(t_app), m_started(false) {
+  // replies are received on their own thread, so a blocking call on the GUI thread does not need a local event loop to complete
+  m_networkThread = new QThread(this);
+  m_networkThread->setObjectName("MeasureManagerNetwork");
+  m_networkContext = new QObject();
+  m_networkContext->moveToThread(m_networkThread);
+  connect(m_networkThread, &QThread::finished, m_networkContext, &QObject::deleteLater);
+  m_networkThread->start();
+}
+
+MeasureManager::~MeasureManager() {
+  m_networkThread->quit();
+  m_networkThread->wait();
+}
 
 QUrl MeasureManager::url() const {
   return m_url;
@@ -92,64 +125,106 @@ void MeasureManager::setUrl(const QUrl& url) {
   m_url = url;
 }
 
-bool MeasureManager::waitForStarted(int msec) {
+QFuture<bool> MeasureManager::waitForStartedAsync(int msec) {
   if (m_started) {
-    return true;
+    return QtFuture::makeReadyFuture(true);
   }
 
-  // ping server until get a started response
-  bool success = false;
+  // the startup state is owned by the thread MeasureManager lives in, relay its future without waiting on that thread
+  if (QThread::currentThread() != thread()) {
+    auto relay = std::make_shared<QPromise<bool>>();
+    QFuture<bool> result = relay->future();
+    relay->start();
+    QMetaObject::invokeMethod(
+      this,
+      [this, msec, relay]() {
+        waitForStartedAsync(msec).then([relay](bool started) {
+          relay->addResult(started);
+          relay->finish();
+        });
+      },
+      Qt::QueuedConnection);
+    return result;
+  }
 
-  QUrl thisUrl(m_url);
-  thisUrl.setPath("/");
+  // a previous call is already pinging the server
+  if (!m_startedPromise) {
+    m_startedPromise = std::make_shared<QPromise<bool>>();
+    m_startedPromise->start();
+    m_startedDeadline = QDeadlineTimer(msec);
+    pingServer();
+  }
 
-  int msecPerLoop = 20;
-  int numTries = msec / msecPerLoop;
-  int current = 0;
-  while (!success && current < numTries) {
-    QNetworkRequest request(thisUrl);
-    request.setHeader(QNetworkRequest::ContentTypeHeader, "json");
+  return m_startedPromise->future();
+}
 
-    QNetworkAccessManager manager;
+void MeasureManager::pingServer() {
+  sendRequest("/", QString())
+    .then(this,
+          [this](const QByteArray& /*reply*/) {
+            m_started = true;
+            finishStarted(true);
+          })
+    .onFailed(this, [this]() {
+      if (m_startedDeadline.hasExpired()) {
+        QUrl thisUrl(m_url);
+        thisUrl.setPath("/");
+        LOG(Error, "Measure manager server failed to start. Was looking at URL=" << toString(thisUrl.toString()));
+        finishStarted(false);
+      } else {
+        // connection refused comes back immediately while the server is starting, do not hammer it
+        QTimer::singleShot(STARTUP_RETRY_MSEC, this, &MeasureManager::pingServer);
+      }
+    });
+}
 
-    QNetworkReply* reply = manager.get(request);
+void MeasureManager::finishStarted(bool started) {
+  OS_ASSERT(m_startedPromise);
+  m_startedPromise->addResult(started);
+  m_startedPromise->finish();
+  m_startedPromise.reset();
+}
 
-    // If trying to debug a potential SSL error
-    // connect(reply, SIGNAL(sslErrors(QList<QSslError>)), this, SLOT(sslErrors(QList<QSslError>)));
-    // connect(reply, SIGNAL(sslErrors(QList<QSslError>)), reply, SLOT(ignoreSslErrors()));
+QFuture<QByteArray> MeasureManager::sendRequest(const QString& endpoint, const QString& data) {
+  auto promise = std::make_shared<QPromise<QByteArray>>();
+  QFuture<QByteArray> future = promise->future();
+  promise->start();
 
-    while (reply->isRunning()) {
-      Application::instance().processEvents();
-    }
+  QUrl thisUrl(m_url);
+  thisUrl.setPath(endpoint);
 
-    auto error = reply->error();
-    delete reply;
+  auto send = [this, promise, thisUrl, data]() {
+    if (!m_networkAccessManager) {
+      // one manager for the lifetime of the application, it keeps the connections to the server alive between requests
+      m_networkAccessManager = new QNetworkAccessManager(m_networkContext);
+    }
 
-    if (error == QNetworkReply::NoError) {
-      success = true;
-    } else {
-      // We actually want to pause for msecPerLoop, processEvents will only put an upper limit the event processing that needs doing
-      // > processEvents: Processes pending events for the calling thread for maxTime_ms milliseconds or
-      // > ** until there are no more events to process,whichever is shorter**.
-      // Application::instance().processEvents(msecPerLoop);
+    QNetworkRequest request(thisUrl);
+    request.setHeader(QNetworkRequest::ContentTypeHeader, "json");
 
-      // So we use QThread::msleep instead, which is not 100% accurate but we do not care. I am getting about 20ms delay in between tries
-      // Debug
-      // LOG(Debug, "[" << current << ", " << QDateTime::currentDateTime().toMSecsSinceEpoch() << " ms]: QNetworkReply is " << error);
+    QNetworkReply* reply = data.isNull() ? m_networkAccessManager->get(request) : m_networkAccessManager->post(request, data.toUtf8());
 
-      QThread::msleep(msecPerLoop);
-    }
+    // If trying to debug a potential SSL error
+    // connect(reply, SIGNAL(sslErrors(QList<QSslError>)), this, SLOT(sslErrors(QList<QSslError>)));
+    // connect(reply, SIGNAL(sslErrors(QList<QSslError>)), reply, SLOT(ignoreSslErrors()));
 
-    ++current;
-  }
+    connect(reply, &QNetworkReply::finished, m_networkContext, [reply, promise]() {
+      QByteArray body = reply->readAll();
+      if (reply->error() == QNetworkReply::NoError) {
+        promise->addResult(body);
+      } else {
+        std::string message = body.isEmpty() ? toString(reply->errorString()) : body.toStdString();
+        promise->setException(std::make_exception_ptr(RequestError(message)));
+      }
+      promise->finish();
+      reply->deleteLater();
+    });
+  };
 
-  if (success) {
-    m_started = true;
-  } else {
-    LOG(Error, "Measure manager server failed to start. Was looking at URL=" << toString(thisUrl.toString()));
-  }
+  // QNetworkAccessManager must be used from the thread it lives in
+  QMetaObject::invokeMethod(m_networkContext, send, Qt::QueuedConnection);
 
-  return m_started;
+  return future;
 }
 
 bool MeasureManager::isStarted() const {
@@ -172,8 +247,6 @@ openstudio::path MeasureManager::tempModelPath() const {
 }
 
 void MeasureManager::saveTempModel(const path& tempDir) {
-  waitForStarted();
-
   boost::optional<model::Model> model = m_app->currentModel();
 
   // DLM: don't get tempDir from app because this requires OSDocument and we may call saveTempModel from OSDocument ctor
@@ -190,7 +263,20 @@ void MeasureManager::saveTempModel(const path& tempDir) {
 
   model->save(m_tempModelPath, true);
 
-  m_measureArguments.clear();
+  std::string tempModelChecksum = checksum(m_tempModelPath);
+  if (tempModelChecksum == m_tempModelChecksum) {
+    return;
+  }
+  m_tempModelChecksum = tempModelChecksum;
+
+  // arguments which do not depend on the model are still valid
+  for (auto it = m_measureArguments.begin(); it != m_measureArguments.end();) {
+    if (hasModelDependentArguments(it->second)) {
+      it = m_measureArguments.erase(it);
+    } else {
+      ++it;
+    }
+  }
 }
 
 std::vector<BCLMeasure> MeasureManager::bclMeasures() const {
@@ -449,39 +535,155 @@ void MeasureManager::updateMeasures(const std::vector<BCLMeasure>& newMeasures,
 }
 
 std::vector<measure::OSArgument> MeasureManager::getArguments(const BCLMeasure& t_measure) {
+  if (boost::optional<std::vector<measure::OSArgument>> cached = cachedArguments(t_measure)) {
+    return *cached;
+  }
+
+  // the reply is received on the network thread, blocking here does not process any GUI event
+  QFuture<QByteArray> reply = sendRequest("/compute_arguments", argumentsRequest(t_measure));
+  try {
+    return storeArguments(t_measure, reply.result());
+  } catch (const RequestError& e) {
+    LOG_AND_THROW("Error computing arguments: " << e.what());
+  }
+}
+
+QFuture<std::vector<measure::OSArgument>> MeasureManager::computeArgumentsAsync(const BCLMeasure& t_measure) {
+  if (boost::optional<std::vector<measure::OSArgument>> cached = cachedArguments(t_measure)) {
+    return QtFuture::makeReadyFuture(*cached);
+  }
+
+  return sendRequest("/compute_arguments", argumentsRequest(t_measure))
+    .then(this, [this, t_measure](const QByteArray& reply) { return storeArguments(t_measure, reply); })
+    .onFailed(this, [](const RequestError& e) -> std::vector<measure::OSArgument> { LOG_AND_THROW("Error computing arguments: " << e.what()) });
+}
+
+boost::optional<std::vector<measure::OSArgument>> MeasureManager::cachedArguments(const BCLMeasure& t_measure) {
+  openstudio::path measureDir = t_measure.directory();
+
+  boost::optional<std::vector<measure::OSArgument>> result;
 
-  auto it = m_measureArguments.find(t_measure.directory());
+  auto it = m_measureArguments.find(measureDir);
   if (it != m_measureArguments.end()) {
-    return it->second;
+    result = it->second;
+  } else {
+    result = loadCachedArguments(t_measure);
+    if (result) {
+      m_measureArguments.insert(std::make_pair(measureDir, *result));
+    }
   }
 
-  QUrl thisUrl(m_url);
-  thisUrl.setPath("/compute_arguments");
+  if (result) {
+    ++m_argumentsCacheHits;
+  } else {
+    ++m_argumentsCacheMisses;
+  }
+  LOG(Debug, "Arguments for " << t_measure.directory() << (result ? " found" : " not found") << " in cache, " << m_argumentsCacheHits
+                              << " hits, " << m_argumentsCacheMisses << " misses");
+
+  return result;
+}
+
+QString MeasureManager::argumentsRequest(const BCLMeasure& t_measure) const {
+  return QString(R"json({"measure_dir": "%1", "osm_path": "%2"})json").arg(toQString(t_measure.directory()), toQString(m_tempModelPath));
+}
+
+std::vector<measure::OSArgument> MeasureManager::storeArguments(const BCLMeasure& t_measure, const QByteArray& reply) {
+  std::vector<measure::OSArgument> result = parseArguments(reply.toStdString());
+  m_measureArguments.insert(std::make_pair(t_measure.directory(), result));
+  saveCachedArguments(t_measure, reply, result);
+  return result;
+}
 
-  // std::string url_s = m_url.toString().toStdString();
+openstudio::path MeasureManager::argumentsCachePath(const BCLMeasure& t_measure, bool modelDependent) const {
+  if (modelDependent && m_tempModelChecksum.empty()) {
+    return {};
+  }
 
-  QString data = QString(R"json({"measure_dir": "%1", "osm_path": "%2"})json").arg(toQString(t_measure.directory()), toQString(m_tempModelPath));
+  QString cacheDir = QStandardPaths::writableLocation(QStandardPaths::CacheLocation);
+  if (cacheDir.isEmpty()) {
+    return {};
+  }
 
-  QNetworkRequest request(thisUrl);
-  request.setHeader(QNetworkRequest::ContentTypeHeader, "json");
+  std::string fileName = checksum(toString(t_measure.directory())) + "_" + t_measure.versionId() + "_" + openStudioVersion();
+  if (modelDependent) {
+    fileName += "_" + m_tempModelChecksum;
+  }
+  return toPath(cacheDir) / toPath("MeasureArguments") / toPath(fileName + ".json");
+}
 
-  QNetworkAccessManager manager;
+boost::optional<std::vector<measure::OSArgument>> MeasureManager::loadCachedArguments(const BCLMeasure& t_measure) {
+  // a measure is cached under one of the two keys, depending on whether its arguments are model dependent
+  for (bool modelDependent : {false, true}) {
+    openstudio::path cachePath = argumentsCachePath(t_measure, modelDependent);
+    if (cachePath.empty() || !exists(cachePath)) {
+      continue;
+    }
 
-  QNetworkReply* reply = manager.post(request, data.toUtf8());
+    QFile file(toQString(cachePath));
+    if (file.open(QFile::ReadOnly)) {
+      try {
+        std::vector<measure::OSArgument> result = parseArguments(file.readAll().toStdString());
+        // entries are pruned least recently used first
+        file.setFileTime(QDateTime::currentDateTime(), QFileDevice::FileModificationTime);
+        return result;
+      } catch (const std::exception&) {
+      }
+      file.close();
+    }
 
-  while (reply->isRunning()) {
-    Application::instance().processEvents();
+    LOG(Warn, "Removing unreadable argument cache " << cachePath);
+    QFile::remove(toQString(cachePath));
   }
 
-  QString replyString = reply->readAll();
-  std::string s = replyString.toStdString();
-  auto error = reply->error();
-  delete reply;
+  return boost::none;
+}
 
-  if (error != QNetworkReply::NoError) {
-    LOG_AND_THROW("Error computing arguments: " << s)
+void MeasureManager::saveCachedArguments(const BCLMeasure& t_measure, const QByteArray& reply,
+                                         const std::vector<measure::OSArgument>& arguments) {
+  openstudio::path cachePath = argumentsCachePath(t_measure, hasModelDependentArguments(arguments));
+  if (cachePath.empty()) {
+    return;
   }
 
+  QDir().mkpath(toQString(cachePath.parent_path()));
+
+  // QSaveFile only replaces the entry once fully written
+  QSaveFile file(toQString(cachePath));
+  if (!file.open(QFile::WriteOnly) || (file.write(reply) != reply.size()) || !file.commit()) {
+    LOG(Warn, "Failed to write argument cache " << cachePath);
+    return;
+  }
+
+  // every model edit adds one entry for each model dependent measure
+  pruneArgumentsCache(cachePath.parent_path(), ARGUMENTS_CACHE_MAX_ENTRIES, ARGUMENTS_CACHE_MAX_AGE_DAYS);
+}
+
+void MeasureManager::pruneArgumentsCache(const openstudio::path& cacheDir, int maxEntries, int maxAgeDays) {
+  QDir dir(toQString(cacheDir));
+  // most recently used first
+  const QFileInfoList entries = dir.entryInfoList({"*.json"}, QDir::Files, QDir::Time);
+  const QDateTime oldest = QDateTime::currentDateTime().addDays(-maxAgeDays);
+  for (qsizetype i = 0; i < entries.size(); ++i) {
+    if ((i >= maxEntries) || (entries[i].lastModified() < oldest)) {
+      dir.remove(entries[i].fileName());
+    }
+  }
+}
+
+bool MeasureManager::hasModelDependentArguments(const std::vector<measure::OSArgument>& arguments) {
+  return std::any_of(arguments.begin(), arguments.end(), [](const measure::OSArgument& argument) { return argument.modelDependent(); });
+}
+
+int MeasureManager::argumentsCacheHits() const {
+  return m_argumentsCacheHits;
+}
+
+int MeasureManager::argumentsCacheMisses() const {
+  return m_argumentsCacheMisses;
+}
+
+std::vector<measure::OSArgument> MeasureManager::parseArguments(const std::string& s) {
   std::vector<measure::OSArgument> result;
 
   Json::CharReaderBuilder rbuilder;
@@ -522,8 +724,6 @@ std::vector<measure::OSArgument> MeasureManager::getArguments(const BCLMeasure&
     LOG_AND_THROW(errorString);
   }
 
-  m_measureArguments.insert(std::make_pair(t_measure.directory(), result));
-
   return result;
 }
 
@@ -822,121 +1022,49 @@ void MeasureManager::updateMeasuresLists(bool updateUserMeasures) {
 //}
 
 bool MeasureManager::reset() {
-  waitForStarted();
-
-  if (!m_mutex.tryLock()) {
-    return false;
-  }
-
-  QUrl thisUrl(m_url);
-  thisUrl.setPath("/reset");
-
-  // std::string url_s = m_url.toString().toStdString();
-
-  QString data = QString("{}");
-
-  QNetworkRequest request(thisUrl);
-  request.setHeader(QNetworkRequest::ContentTypeHeader, "json");
-
-  QNetworkAccessManager manager;
-
-  QNetworkReply* reply = manager.post(request, data.toUtf8());
-
-  while (reply->isRunning()) {
-    Application::instance().processEvents();
-  }
-
-  // QString replyString = reply->readAll();
-  // std::string s = replyString.toStdString();
-
-  bool result = true;
-  if (reply->error() != QNetworkReply::NoError) {
-    result = false;
-  }
-
-  delete reply;
-
-  m_mutex.unlock();
+  return sendBlockingRequest("/reset", QString("{}"));
+}
 
-  return result;
+QFuture<bool> MeasureManager::resetAsync() {
+  return sendRequest("/reset", QString("{}")).then([](const QByteArray& /*reply*/) { return true; }).onFailed([]() { return false; });
 }
 
 bool MeasureManager::checkForLocalBCLUpdates() {
-  waitForStarted();
-
-  if (!m_mutex.tryLock()) {
-    return false;
-  }
-
-  QUrl thisUrl(m_url);
-  thisUrl.setPath("/bcl_measures");
-
-  // std::string url_s = m_url.toString().toStdString();
-
-  QString data = QString("{}");
-
-  QNetworkRequest request(thisUrl);
-  request.setHeader(QNetworkRequest::ContentTypeHeader, "json");
-
-  QNetworkAccessManager manager;
-
-  QNetworkReply* reply = manager.post(request, data.toUtf8());
-
-  while (reply->isRunning()) {
-    Application::instance().processEvents();
-  }
-
-  // QString replyString = reply->readAll();
-  // std::string s = replyString.toStdString();
-
-  bool result = true;
-  if (reply->error() != QNetworkReply::NoError) {
-    result = false;
-  }
-
-  delete reply;
+  return sendBlockingRequest("/bcl_measures", QString("{}"));
+}
 
-  m_mutex.unlock();
+bool MeasureManager::checkForUpdates(const openstudio::path& measureDir, bool force) {
+  return sendBlockingRequest("/update_measures", updateMeasuresRequest(measureDir, force));
+}
 
-  return result;
+QFuture<bool> MeasureManager::updateMeasuresAsync(const openstudio::path& measureDir, bool force) {
+  return sendRequest("/update_measures", updateMeasuresRequest(measureDir, force))
+    .then([](const QByteArray& /*reply*/) { return true; })
+    .onFailed([]() { return false; });
 }
 
-bool MeasureManager::checkForUpdates(const openstudio::path& measureDir, bool force) {
-  waitForStarted();
+QString MeasureManager::updateMeasuresRequest(const openstudio::path& measureDir, bool force) {
+  return QString(R"json({"measure_dir": "%1", "force_reload": "%2"})json").arg(toQString(measureDir), force ? QString("true") : QString("false"));
+}
 
-  if (!m_mutex.tryLock()) {
+bool MeasureManager::sendBlockingRequest(const QString& endpoint, const QString& data) {
+  if (!m_started) {
+    LOG(Warn, "Measure manager server is not started, cannot send " << toString(endpoint));
     return false;
   }
 
-  QUrl thisUrl(m_url);
-  thisUrl.setPath("/update_measures");
-
-  // std::string url_s = m_url.toString().toStdString();
-
-  QString data =
-    QString(R"json({"measure_dir": "%1", "force_reload": "%2"})json").arg(toQString(measureDir), force ? QString("true") : QString("false"));
-
-  QNetworkRequest request(thisUrl);
-  request.setHeader(QNetworkRequest::ContentTypeHeader, "json");
-
-  QNetworkAccessManager manager;
-
-  QNetworkReply* reply = manager.post(request, data.toUtf8());
-
-  while (reply->isRunning()) {
-    Application::instance().processEvents();
+  if (!m_mutex.tryLock()) {
+    return false;
   }
 
-  // QString replyString = reply->readAll();
-  // std::string s = replyString.toStdString();
-
+  QFuture<QByteArray> reply = sendRequest(endpoint, data);
   bool result = true;
-  if (reply->error() != QNetworkReply::NoError) {
+  try {
+    reply.result();
+  } catch (const RequestError&) {
     result = false;
   }
 
-  delete reply;
-
   m_mutex.unlock();
 
   return result;
@@ -42,11 +42,19 @@
 #include <QApplication>
 #include <QUrl>
 #include <QMutex>
+#include <QDeadlineTimer>
+#include <QFuture>
+#include <QPromise>
+
+#include <memory>
 
 class QEvent;
 class QNetworkAccessManager;
+class QThread;
 // class QSslError; // If trying to debug a potential SSL error
 
+class OpenStudioLibFixture;
+
 namespace Json {
 class Value;
 }
@@ -98,13 +106,15 @@ class MeasureManager : public QObject
  public:
   explicit MeasureManager(BaseApp* t_app);
 
-  virtual ~MeasureManager() {}
+  virtual ~MeasureManager();
 
   QUrl url() const;
 
   void setUrl(const QUrl& url);
 
-  bool waitForStarted(int msec = 10000);
+  // Finishes with true once the measure manager server answers, or false after msec.
+  // Calls made while the server is still starting share the same future
+  QFuture<bool> waitForStartedAsync(int msec = 10000);
 
   void setLibraryController(const QSharedPointer<LocalLibraryController>& t_libraryController);
 
@@ -140,18 +150,33 @@ class MeasureManager : public QObject
   //// when this method is called.
   void updateMeasures(const std::vector<BCLMeasure>& newMeasures, bool t_showMessage = true);
 
-  //// Get arguments for given measure using current model
+  //// Get arguments for given measure using current model, blocks until the server answers unless the arguments are cached.
   //// Will throw if arguments cannot be computed.
   std::vector<measure::OSArgument> getArguments(const BCLMeasure& t_measure);
 
+  //// Asynchronous version of getArguments, the future holds the exception if arguments cannot be computed.
+  //// Several measures can be computed concurrently, results are cached like getArguments
+  QFuture<std::vector<measure::OSArgument>> computeArgumentsAsync(const BCLMeasure& t_measure);
+
+  //// Asks the server to reload a measure directory, the future holds false if the request failed
+  QFuture<bool> updateMeasuresAsync(const openstudio::path& measureDir, bool force = false);
+
   std::string suggestMeasureName(const BCLMeasure& t_measure);
 
   bool isMeasureSelected();
 
+  //// Blocks until the server answers, returns false if the server is not started or the request failed
   bool reset();
 
+  //// Asynchronous version of reset, the server must be started
+  QFuture<bool> resetAsync();
+
   bool isStarted() const;
 
+  //// Number of argument lookups served from memory or from the on-disk cache, and left to the server, since startup
+  int argumentsCacheHits() const;
+  int argumentsCacheMisses() const;
+
  public slots:
 
   /// Update the UI display for all measures. Does recompute the measure's XML.
@@ -196,16 +221,65 @@ class MeasureManager : public QObject
  private:
   REGISTER_LOGGER("openstudio.MeasureManager");
 
+  friend class ::OpenStudioLibFixture;
+
   void updateMeasuresLists(bool updateUserMeasures);
 
   bool checkForLocalBCLUpdates();
 
   bool checkForUpdates(const openstudio::path& measureDir, bool force = false);
 
+  static QString updateMeasuresRequest(const openstudio::path& measureDir, bool force);
+
+  // Arguments from memory, then from the on-disk cache
+  boost::optional<std::vector<measure::OSArgument>> cachedArguments(const BCLMeasure& t_measure);
+
+  QString argumentsRequest(const BCLMeasure& t_measure) const;
+
+  // Parses a compute_arguments reply and caches the result in memory and on disk
+  std::vector<measure::OSArgument> storeArguments(const BCLMeasure& t_measure, const QByteArray& reply);
+
   boost::optional<measure::OSArgument> getArgument(const measure::OSArgumentType& type, const Json::Value& argument);
 
+  std::vector<measure::OSArgument> parseArguments(const std::string& s);
+
+  // On-disk argument cache, entries are keyed by measure directory, measure version id and OpenStudio version.
+  // Measures with model dependent arguments also key on the checksum of the temp model, so any change to the
+  // measure files or (for those measures) to the model invalidates the entry.
+  openstudio::path argumentsCachePath(const BCLMeasure& t_measure, bool modelDependent) const;
+
+  boost::optional<std::vector<measure::OSArgument>> loadCachedArguments(const BCLMeasure& t_measure);
+
+  // Writes the entry then prunes the cache, entries for other models or measure versions are kept until they age out
+  void saveCachedArguments(const BCLMeasure& t_measure, const QByteArray& reply, const std::vector<measure::OSArgument>& arguments);
+
+  // Removes the entries not used for maxAgeDays, then the least recently used ones beyond maxEntries
+  static void pruneArgumentsCache(const openstudio::path& cacheDir, int maxEntries, int maxAgeDays);
+
+  static bool hasModelDependentArguments(const std::vector<measure::OSArgument>& arguments);
+
+  // Sends a GET (data is null) or POST request to the server through the shared QNetworkAccessManager, may be called from any thread.
+  // The future holds the reply body, or a RequestError if the request failed. It is fulfilled on the network thread,
+  // so it can be waited on from the GUI thread
+  QFuture<QByteArray> sendRequest(const QString& endpoint, const QString& data);
+
+  // Waits for the reply of a request, returns false if the server is not started or the request failed
+  bool sendBlockingRequest(const QString& endpoint, const QString& data);
+
+  // Ping the server until it answers or m_startedDeadline expires
+  void pingServer();
+
+  void finishStarted(bool started);
+
+  static constexpr int STARTUP_RETRY_MSEC = 20;
+
+  static constexpr int ARGUMENTS_CACHE_MAX_ENTRIES = 500;
+
+  static constexpr int ARGUMENTS_CACHE_MAX_AGE_DAYS = 30;
+
   BaseApp* m_app;
   openstudio::path m_tempModelPath;
+  std::string m_tempModelChecksum;
   std::map<UUID, BCLMeasure> m_myMeasures;
   std::map<UUID, BCLMeasure> m_bclMeasures;
   std::map<openstudio::path, std::vector<measure::OSArgument>> m_measureArguments;
@@ -213,6 +287,14 @@ class MeasureManager : public QObject
   QSharedPointer<LocalLibraryController> m_libraryController;
   bool m_started;
   QMutex m_mutex;
+  QThread* m_networkThread = nullptr;
+  // lives in m_networkThread, owns m_networkAccessManager and receives the replies
+  QObject* m_networkContext = nullptr;
+  QNetworkAccessManager* m_networkAccessManager = nullptr;
+  std::shared_ptr<QPromise<bool>> m_startedPromise;
+  QDeadlineTimer m_startedDeadline;
+  int m_argumentsCacheHits = 0;
+  int m_argumentsCacheMisses = 0;
 };
 
 }  // namespace openstudio
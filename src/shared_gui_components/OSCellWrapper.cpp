@@ -202,6 +202,16 @@ void OSCellWrapper::setCellProperties(const GridCellLocation& location, const Gr
   }
 }
 
+void OSCellWrapper::setGridRow(int modelRow, int gridRow) {
+  m_modelRow = modelRow;
+  m_gridRow = gridRow;
+
+  bool isEven = ((m_gridRow % 2) == 0);
+  for (auto* holder : m_holders) {
+    holder->setEven(isEven);
+  }
+}
+
 QWidget* OSCellWrapper::createOSWidget(model::ModelObject t_mo, const QSharedPointer<BaseConcept>& t_baseConcept) {
   QWidget* widget = nullptr;
 
@@ -246,7 +256,7 @@ QWidget* OSCellWrapper::createOSWidget(model::ModelObject t_mo, const QSharedPoi
       comboBox->enableClickFocus();
     }
 
-    comboBox->bind(t_mo, choiceConcept);
+    comboBox->bind(t_mo, choiceConcept, comboBoxConcept.data());
 
     widget = comboBox;
 
@@ -76,6 +76,9 @@ class OSCellWrapper : public QWidget
 
   void setCellProperties(const GridCellLocation& location, const GridCellInfo& info);
 
+  // Update the location of this cell after a row above it was removed
+  void setGridRow(int modelRow, int gridRow);
+
  private slots:
 
   void onRemoveWorkspaceObject(const WorkspaceObject& object, const openstudio::IddObjectType& iddObjectType, const openstudio::UUID& handle);
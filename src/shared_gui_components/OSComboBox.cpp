@@ -38,10 +38,16 @@
 #include <openstudio/utilities/idf/WorkspaceObject_Impl.hpp>
 #include <openstudio/utilities/core/Assert.hpp>
 
+#include <QAbstractItemView>
 #include <QCompleter>
 #include <QEvent>
+#include <QStandardItemModel>
+#include <QTimer>
 
+#include <algorithm>
 #include <bitset>
+#include <map>
+#include <unordered_set>
 
 namespace openstudio {
 
@@ -58,19 +64,19 @@ OSObjectListCBDS::OSObjectListCBDS(const std::vector<IddObjectType>& types, cons
 }
 
 void OSObjectListCBDS::initialize() {
-  std::vector<model::ModelObject> modelObjects = m_model.getModelObjects<model::ModelObject>();
+  m_registry = OSObjectListRegistry::registry(m_model);
 
-  for (const auto& modelObject : modelObjects) {
-    if (std::find(m_types.begin(), m_types.end(), modelObject.iddObjectType()) != m_types.end()) {
-      m_workspaceObjects << modelObject;
-
-      modelObject.getImpl<model::detail::ModelObject_Impl>()->onChange.connect<OSObjectListCBDS, &OSObjectListCBDS::onObjectChanged>(this);
+  // The objects are grouped by type, in the order of m_types, and objects added later go at the end.
+  // Before the registry they came in the order of a scan over every model object
+  for (const auto& type : m_types) {
+    for (const auto& workspaceObject : m_registry->objects(type)) {
+      m_workspaceObjects << workspaceObject;
     }
   }
 
-  m_model.getImpl<model::detail::Model_Impl>()->addWorkspaceObject.connect<OSObjectListCBDS, &OSObjectListCBDS::onObjectAdded>(this);
+  connect(m_registry.get(), &OSObjectListRegistry::objectAdded, this, &OSObjectListCBDS::onObjectAdded);
 
-  m_model.getImpl<model::detail::Model_Impl>()->removeWorkspaceObject.connect<OSObjectListCBDS, &OSObjectListCBDS::onObjectWillBeRemoved>(this);
+  connect(m_registry.get(), &OSObjectListRegistry::objectWillBeRemoved, this, &OSObjectListCBDS::onObjectWillBeRemoved);
 }
 
 int OSObjectListCBDS::numberOfItems() {
@@ -93,11 +99,10 @@ QString OSObjectListCBDS::valueAt(int i) {
   }
 }
 
-void OSObjectListCBDS::onObjectAdded(const WorkspaceObject& workspaceObject, const openstudio::IddObjectType& type, const openstudio::UUID& uuid) {
-  if (std::find(m_types.begin(), m_types.end(), workspaceObject.cast<model::ModelObject>().iddObjectType()) != m_types.end()) {
+void OSObjectListCBDS::onObjectAdded(const WorkspaceObject& workspaceObject, const openstudio::IddObjectType& type) {
+  if (std::find(m_types.begin(), m_types.end(), type) != m_types.end()) {
     m_workspaceObjects << workspaceObject;
 
-    workspaceObject.getImpl<model::detail::ModelObject_Impl>()->onChange.connect<OSObjectListCBDS, &OSObjectListCBDS::onObjectChanged>(this);
     if (m_allowEmptySelection) {
       emit itemAdded(m_workspaceObjects.size());
     } else {
@@ -106,9 +111,8 @@ void OSObjectListCBDS::onObjectAdded(const WorkspaceObject& workspaceObject, con
   }
 }
 
-void OSObjectListCBDS::onObjectWillBeRemoved(const WorkspaceObject& workspaceObject, const openstudio::IddObjectType& type,
-                                             const openstudio::UUID& uuid) {
-  if (std::find(m_types.begin(), m_types.end(), workspaceObject.cast<model::ModelObject>().iddObjectType()) != m_types.end()) {
+void OSObjectListCBDS::onObjectWillBeRemoved(const WorkspaceObject& workspaceObject, const openstudio::IddObjectType& type) {
+  if (std::find(m_types.begin(), m_types.end(), type) != m_types.end()) {
     int i = m_workspaceObjects.indexOf(workspaceObject);
 
     m_workspaceObjects.removeAt(i);
@@ -121,23 +125,180 @@ void OSObjectListCBDS::onObjectWillBeRemoved(const WorkspaceObject& workspaceObj
   }
 }
 
-void OSObjectListCBDS::onObjectChanged() {
-  // WorkspaceObject workspaceObject = qobject_cast<detail::WorkspaceObject_Impl *>(sender())->getObject<WorkspaceObject>();
+std::shared_ptr<OSObjectListRegistry> OSObjectListRegistry::registry(const model::Model& model) {
+  static std::map<const model::detail::Model_Impl*, std::weak_ptr<OSObjectListRegistry>> registries;
+
+  const model::detail::Model_Impl* key = model.getImpl<model::detail::Model_Impl>().get();
+  auto it = registries.find(key);
+  if (it != registries.end()) {
+    if (std::shared_ptr<OSObjectListRegistry> result = it->second.lock()) {
+      return result;
+    }
+  }
+
+  // Forget the registries of models nobody lists objects from anymore
+  for (auto jt = registries.begin(); jt != registries.end();) {
+    if (jt->second.expired()) {
+      jt = registries.erase(jt);
+    } else {
+      ++jt;
+    }
+  }
+
+  std::shared_ptr<OSObjectListRegistry> result(new OSObjectListRegistry(model));
+  registries[key] = result;
+  return result;
+}
+
+OSObjectListRegistry::OSObjectListRegistry(const model::Model& model) : QObject(), m_model(model) {
+  m_model.getImpl<model::detail::Model_Impl>()->addWorkspaceObject.connect<OSObjectListRegistry, &OSObjectListRegistry::onObjectAdded>(this);
+
+  m_model.getImpl<model::detail::Model_Impl>()->removeWorkspaceObject.connect<OSObjectListRegistry, &OSObjectListRegistry::onObjectWillBeRemoved>(
+    this);
+}
+
+const std::vector<WorkspaceObject>& OSObjectListRegistry::objects(const IddObjectType& type) {
+  auto it = m_objectsByType.find(type);
+  if (it == m_objectsByType.end()) {
+    it = m_objectsByType.emplace(type, m_model.getObjectsByType(type)).first;
+  }
+  return it->second;
+}
+
+void OSObjectListRegistry::onObjectAdded(const WorkspaceObject& workspaceObject, const openstudio::IddObjectType& type,
+                                         const openstudio::UUID& uuid) {
+  auto it = m_objectsByType.find(type);
+  if (it != m_objectsByType.end()) {
+    it->second.push_back(workspaceObject);
+
+    emit objectAdded(workspaceObject, type);
+  }
+}
+
+void OSObjectListRegistry::onObjectWillBeRemoved(const WorkspaceObject& workspaceObject, const openstudio::IddObjectType& type,
+                                                 const openstudio::UUID& uuid) {
+  auto it = m_objectsByType.find(type);
+  if (it != m_objectsByType.end()) {
+    auto jt = std::find(it->second.begin(), it->second.end(), workspaceObject);
+    if (jt != it->second.end()) {
+      it->second.erase(jt);
+
+      emit objectWillBeRemoved(workspaceObject, type);
+    }
+  }
+}
+
+std::shared_ptr<OSComboBoxChoiceModel> OSComboBoxChoiceModel::sharedModel(const ComboBoxConcept* comboBoxConcept, const model::Model& model) {
+  using Key = std::pair<const ComboBoxConcept*, const model::detail::Model_Impl*>;
+  static std::map<Key, std::weak_ptr<OSComboBoxChoiceModel>> sharedModels;
+
+  Key key(comboBoxConcept, model.getImpl<model::detail::Model_Impl>().get());
+  auto it = sharedModels.find(key);
+  if (it != sharedModels.end()) {
+    if (std::shared_ptr<OSComboBoxChoiceModel> result = it->second.lock()) {
+      return result;
+    }
+  }
+
+  // Forget the models whose cells have all been destroyed
+  for (auto jt = sharedModels.begin(); jt != sharedModels.end();) {
+    if (jt->second.expired()) {
+      jt = sharedModels.erase(jt);
+    } else {
+      ++jt;
+    }
+  }
+
+  std::shared_ptr<OSComboBoxChoiceModel> result(new OSComboBoxChoiceModel());
+  sharedModels[key] = result;
+  return result;
+}
+
+int OSComboBoxChoiceModel::rowCount(const QModelIndex& parent) const {
+  return parent.isValid() ? 0 : static_cast<int>(m_choices.size());
+}
+
+QVariant OSComboBoxChoiceModel::data(const QModelIndex& index, int role) const {
+  if (!index.isValid() || index.row() >= static_cast<int>(m_choices.size())) {
+    return QVariant();
+  }
+
+  if (role == Qt::DisplayRole || role == Qt::EditRole || role == Qt::ToolTipRole) {
+    return QString::fromStdString(m_choices[index.row()]);
+  }
+
+  return QVariant();
+}
+
+const std::vector<std::string>& OSComboBoxChoiceModel::choices() const {
+  return m_choices;
+}
+
+void OSComboBoxChoiceModel::setChoices(const std::vector<std::string>& choices) {
+  if (choices == m_choices) {
+    return;
+  }
 
-  // if(std::find(m_types.begin(),m_types.end(),workspaceObject.cast<model::ModelObject>().iddObjectType()) != m_types.end())
-  // {
+  // Remove the rows that are no longer a choice, one contiguous run at a time
+  std::unordered_set<std::string> newChoices(choices.begin(), choices.end());
+  int row = 0;
+  while (row < static_cast<int>(m_choices.size())) {
+    if (newChoices.count(m_choices[row])) {
+      ++row;
+      continue;
+    }
+    int last = row;
+    while (last + 1 < static_cast<int>(m_choices.size()) && !newChoices.count(m_choices[last + 1])) {
+      ++last;
+    }
+    beginRemoveRows(QModelIndex(), row, last);
+    m_choices.erase(m_choices.begin() + row, m_choices.begin() + last + 1);
+    endRemoveRows();
+  }
 
-  //   int i = m_workspaceObjects.indexOf(workspaceObject);
+  // Then put the remaining rows in order, moving the ones that were renamed and inserting the new ones
+  for (int i = 0; i < static_cast<int>(choices.size()); ++i) {
+    if (i < static_cast<int>(m_choices.size()) && m_choices[i] == choices[i]) {
+      continue;
+    }
+    auto it = std::find(m_choices.begin() + std::min(i, static_cast<int>(m_choices.size())), m_choices.end(), choices[i]);
+    if (it != m_choices.end()) {
+      int from = static_cast<int>(it - m_choices.begin());
+      beginMoveRows(QModelIndex(), from, from, QModelIndex(), i);
+      std::rotate(m_choices.begin() + i, it, it + 1);
+      endMoveRows();
+    } else {
+      beginInsertRows(QModelIndex(), i, i);
+      m_choices.insert(m_choices.begin() + i, choices[i]);
+      endInsertRows();
+    }
+  }
 
-  //   if( m_allowEmptySelection )
-  //   {
-  //     emit itemChanged(i + 1);
-  //   }
-  //   else
-  //   {
-  //     emit itemChanged(i);
-  //   }
-  // }
+  // Only duplicated choices can be left over at the end
+  if (m_choices.size() > choices.size()) {
+    beginRemoveRows(QModelIndex(), static_cast<int>(choices.size()), static_cast<int>(m_choices.size()) - 1);
+    m_choices.resize(choices.size());
+    endRemoveRows();
+  }
+}
+
+void OSComboBoxChoiceModel::attach(OSComboBox2* comboBox) {
+  if (m_attachedComboBox && m_attachedComboBox != comboBox) {
+    // Its release is only scheduled when it loses focus, until then changing the rows would change its current text
+    // and write that to the object of its own row
+    m_attachedComboBox->dropChoices();
+  }
+  m_attachedComboBox = comboBox;
+}
+
+void OSComboBoxChoiceModel::detach(OSComboBox2* comboBox) {
+  if (m_attachedComboBox == comboBox) {
+    m_attachedComboBox = nullptr;
+  }
+}
+
+OSComboBox2* OSComboBoxChoiceModel::attachedComboBox() const {
+  return m_attachedComboBox;
 }
 
 OSComboBox2::OSComboBox2(QWidget* parent, bool editable) : QComboBox(parent), m_editable(editable) {
@@ -171,23 +332,34 @@ OSComboBox2::OSComboBox2(QWidget* parent, bool editable) : QComboBox(parent), m_
   setSizePolicy(QSizePolicy::MinimumExpanding, QSizePolicy::Fixed);
 }
 
-OSComboBox2::~OSComboBox2() = default;
+OSComboBox2::~OSComboBox2() {
+  detachChoiceModel();
+}
 
 bool OSComboBox2::event(QEvent* e) {
   if (e->type() == QEvent::Wheel) {
     return false;
-  } else if (e->type() == QEvent::FocusIn && m_hasClickFocus) {
-    m_focused = true;
-    updateStyle();
+  } else if (e->type() == QEvent::FocusIn) {
+    populateChoices();
+
+    if (m_hasClickFocus) {
+      m_focused = true;
+      updateStyle();
 
-    emit inFocus(m_focused, hasData());
+      emit inFocus(m_focused, hasData());
+    }
 
     return QComboBox::event(e);
-  } else if (e->type() == QEvent::FocusOut && m_hasClickFocus) {
-    m_focused = false;
-    updateStyle();
+  } else if (e->type() == QEvent::FocusOut) {
+    // Focus also leaves while the popup is open, so only drop the choices once things have settled
+    QTimer::singleShot(0, this, &OSComboBox2::releaseChoices);
 
-    emit inFocus(m_focused, false);
+    if (m_hasClickFocus) {
+      m_focused = false;
+      updateStyle();
+
+      emit inFocus(m_focused, false);
+    }
 
     return QComboBox::event(e);
   } else {
@@ -195,6 +367,17 @@ bool OSComboBox2::event(QEvent* e) {
   }
 }
 
+void OSComboBox2::showPopup() {
+  populateChoices();
+  QComboBox::showPopup();
+}
+
+void OSComboBox2::hidePopup() {
+  QComboBox::hidePopup();
+  // The selected item is applied after the popup hides, the model has to stay attached until then
+  QTimer::singleShot(0, this, &OSComboBox2::releaseChoices);
+}
+
 void OSComboBox2::enableClickFocus() {
   m_hasClickFocus = true;
   this->setFocusPolicy(Qt::ClickFocus);
@@ -230,6 +413,8 @@ void OSComboBox2::bind(std::shared_ptr<OSComboBoxDataSource> dataSource) {
 }
 
 void OSComboBox2::unbind() {
+  detachChoiceModel();
+
   if (m_modelObject) {
     // disconnect( m_modelObject->getImpl<openstudio::model::detail::ModelObject_Impl>().get() );
 
@@ -260,11 +445,15 @@ void OSComboBox2::onModelObjectChanged() {
   if (m_choiceConcept) {
     std::string value = m_choiceConcept->get();
 
-    auto it = std::find(m_values.begin(), m_values.end(), value);
-
-    int i = int(it - m_values.begin());
     this->blockSignals(true);
-    setCurrentIndex(i);
+    if (m_choicesPopulated) {
+      auto it = std::find(m_values.begin(), m_values.end(), value);
+
+      int i = int(it - m_values.begin());
+      setCurrentIndex(i);
+    } else {
+      showCurrentValue(value);
+    }
     updateStyle();
     this->blockSignals(false);
   }
@@ -307,22 +496,99 @@ void OSComboBox2::onEditTextChanged(const QString& text) {
 
 void OSComboBox2::onChoicesRefreshTrigger() {
   if (m_choiceConcept) {
-    m_values = m_choiceConcept->choices();
-    this->blockSignals(true);
+    if (m_choicesPopulated) {
+      m_choicesPopulated = false;
+      populateChoices();
+    } else {
+      // Keeps the concept's lookup of choices current, the items themselves wait for focus
+      m_choiceConcept->choices();
+      onModelObjectChanged();
+    }
 
+    setLocked(false);
+  }
+}
+
+void OSComboBox2::populateChoices() {
+  if (m_choicesPopulated || !m_choiceConcept) {
+    return;
+  }
+
+  m_values = m_choiceConcept->choices();
+  bool wasBlocked = this->blockSignals(true);
+
+  if (m_choiceModel) {
+    // Every cell reads its own choices since they may depend on the row, but they usually match
+    // what the previous cell left in the shared model and reconciling it is then a no-op
+    m_choiceModel->attach(this);
+    m_choiceModel->setChoices(m_values);
+    if (model() != m_choiceModel.get()) {
+      setModel(m_choiceModel.get());
+    }
+  } else {
     clear();
     for (const auto& value : m_values) {
       QString qvalue = QString::fromStdString(value);
       addItem(qvalue);
       setItemData(count() - 1, qvalue, Qt::ToolTipRole);
     }
+  }
+  m_choicesPopulated = true;
+
+  // re-initialize
+  onModelObjectChanged();
+
+  this->blockSignals(wasBlocked);
+}
+
+void OSComboBox2::releaseChoices() {
+  if (!m_choicesPopulated || hasFocus() || (view() && view()->isVisible())) {
+    return;
+  }
 
-    // re-initialize
+  dropChoices();
+}
+
+void OSComboBox2::dropChoices() {
+  if (!m_choicesPopulated) {
+    return;
+  }
+
+  bool wasBlocked = this->blockSignals(true);
+  if (m_choiceModel && model() == m_choiceModel.get()) {
+    setModel(new QStandardItemModel(0, 1, this));
+    m_choiceModel->detach(this);
+  }
+  m_choicesPopulated = false;
+  m_values.clear();
+  this->blockSignals(wasBlocked);
+
+  if (m_modelObject && m_choiceConcept) {
     onModelObjectChanged();
+  }
+}
 
-    this->blockSignals(false);
-    setLocked(false);
+void OSComboBox2::showCurrentValue(const std::string& value) {
+  QString qvalue = QString::fromStdString(value);
+  if (count() != 1 || itemText(0) != qvalue) {
+    clear();
+    addItem(qvalue);
+    setItemData(0, qvalue, Qt::ToolTipRole);
+  }
+  setCurrentIndex(0);
+}
+
+void OSComboBox2::detachChoiceModel() {
+  if (m_choiceModel) {
+    if (model() == m_choiceModel.get()) {
+      bool wasBlocked = this->blockSignals(true);
+      setModel(new QStandardItemModel(0, 1, this));
+      this->blockSignals(wasBlocked);
+    }
+    m_choiceModel->detach(this);
   }
+  m_choiceModel.reset();
+  m_choicesPopulated = false;
 }
 
 void OSComboBox2::onDataSourceChange(int i) {
@@ -397,17 +663,17 @@ void OSComboBox2::completeBind() {
     // ETH@20140228 - With extension of this class to choices of ModelObjects, and beyond,
     // do we need to figure out some way to signal when the choices have changed? Or maybe
     // controllers will be able to sense that and trigger an unbind(), (re-)bind?
-    m_values = m_choiceConcept->choices();
+    // Until the combo box gains focus it only holds its current value, a grid column of thousands
+    // of cells would otherwise build every choice item (and tooltip) in each of them.
     this->blockSignals(true);
-
-    for (const auto& value : m_values) {
-      QString qvalue = QString::fromStdString(value);
-      addItem(qvalue);
-      setItemData(count() - 1, qvalue, Qt::ToolTipRole);
-    }
+    m_choicesPopulated = false;
+    m_values.clear();
 
     // initialize
     onModelObjectChanged();
+    if (hasFocus()) {
+      populateChoices();
+    }
   } else if (m_dataSource) {
 
     // connections
@@ -41,9 +41,13 @@
 
 #include <openstudio/utilities/idf/WorkspaceObject.hpp>
 
+#include <QAbstractListModel>
 #include <QComboBox>
 #include <QList>
+#include <QPointer>
 
+#include <map>
+#include <memory>
 #include <vector>
 
 namespace openstudio {
@@ -70,6 +74,46 @@ class OSComboBoxDataSource
   void itemRemoved(int);
 };
 
+/**
+ * OSObjectListRegistry keeps the lists of objects of given IddObjectTypes for one model.
+ *
+ * A list is read from the model's type index the first time it is asked for and then maintained
+ * from a single subscription to the model's add and remove signals, which is fanned out to the
+ * data sources through objectAdded and objectWillBeRemoved. Every cell of a grid column shares it.
+ **/
+class OSObjectListRegistry
+  : public QObject
+  , public Nano::Observer
+{
+  Q_OBJECT
+
+ public:
+  virtual ~OSObjectListRegistry() {}
+
+  // Returns the registry of model, shared by every caller while any of them holds on to it
+  static std::shared_ptr<OSObjectListRegistry> registry(const model::Model& model);
+
+  const std::vector<WorkspaceObject>& objects(const IddObjectType& type);
+
+ signals:
+
+  void objectAdded(const WorkspaceObject& workspaceObject, const openstudio::IddObjectType& type);
+
+  void objectWillBeRemoved(const WorkspaceObject& workspaceObject, const openstudio::IddObjectType& type);
+
+ private:
+  explicit OSObjectListRegistry(const model::Model& model);
+
+  void onObjectAdded(const WorkspaceObject& workspaceObject, const openstudio::IddObjectType& type, const openstudio::UUID& uuid);
+
+  void onObjectWillBeRemoved(const WorkspaceObject& workspaceObject, const openstudio::IddObjectType& type, const openstudio::UUID& uuid);
+
+  model::Model m_model;
+
+  // Only the types somebody asked for are kept up to date
+  std::map<IddObjectType, std::vector<WorkspaceObject>> m_objectsByType;
+};
+
 class OSObjectListCBDS : public OSComboBoxDataSource
 {
   Q_OBJECT
@@ -90,11 +134,9 @@ class OSObjectListCBDS : public OSComboBoxDataSource
 
  private slots:
 
-  void onObjectAdded(const WorkspaceObject&, const openstudio::IddObjectType& type, const openstudio::UUID& uuid);
-
-  void onObjectWillBeRemoved(const WorkspaceObject&, const openstudio::IddObjectType& type, const openstudio::UUID& uuid);
+  void onObjectAdded(const WorkspaceObject&, const openstudio::IddObjectType& type);
 
-  void onObjectChanged();
+  void onObjectWillBeRemoved(const WorkspaceObject&, const openstudio::IddObjectType& type);
 
  private:
   void initialize();
@@ -103,9 +145,54 @@ class OSObjectListCBDS : public OSComboBoxDataSource
 
   model::Model m_model;
 
+  std::shared_ptr<OSObjectListRegistry> m_registry;
+
   QList<WorkspaceObject> m_workspaceObjects;
 };
 
+class OSComboBox2;
+
+/**
+ * OSComboBoxChoiceModel is the item model shown in the popup of focused OSComboBox2 grid cells.
+ *
+ * One reference-counted instance is shared by every cell of a ComboBoxConcept column for a given model.
+ * When a cell gains focus it reconciles the model with its own choices, inserting, moving and removing
+ * only the rows that differ, so cells of the same column reuse the rows built for the previous cell.
+ * Only one cell shows the model at a time, the previous one is given back its own model before the rows change.
+ **/
+class OSComboBoxChoiceModel : public QAbstractListModel
+{
+  Q_OBJECT
+
+ public:
+  virtual ~OSComboBoxChoiceModel() {}
+
+  // Returns the model shared by all cells of comboBoxConcept bound to objects of model
+  static std::shared_ptr<OSComboBoxChoiceModel> sharedModel(const ComboBoxConcept* comboBoxConcept, const model::Model& model);
+
+  int rowCount(const QModelIndex& parent = QModelIndex()) const override;
+
+  QVariant data(const QModelIndex& index, int role = Qt::DisplayRole) const override;
+
+  const std::vector<std::string>& choices() const;
+
+  void setChoices(const std::vector<std::string>& choices);
+
+  // Makes comboBox the cell showing this model, the cell that showed it so far drops its choices first
+  void attach(OSComboBox2* comboBox);
+
+  void detach(OSComboBox2* comboBox);
+
+  OSComboBox2* attachedComboBox() const;
+
+ private:
+  OSComboBoxChoiceModel() = default;
+
+  std::vector<std::string> m_choices;
+
+  QPointer<OSComboBox2> m_attachedComboBox;
+};
+
 class OSComboBox2
   : public QComboBox
   , public Nano::Observer
@@ -132,6 +219,7 @@ class OSComboBox2
             std::function<ChoiceType()> getter, std::function<bool(ChoiceType)> setter, boost::optional<NoFailAction> reset = boost::none,
             boost::optional<BasicQuery> isDefaulted = boost::none) {
     m_modelObject = modelObject;
+    detachChoiceModel();
     m_choiceConcept =
       std::shared_ptr<ChoiceConcept>(new RequiredChoiceConceptImpl<ChoiceType>(toString, choices, getter, setter, reset, isDefaulted));
     clear();
@@ -144,6 +232,7 @@ class OSComboBox2
             std::function<boost::optional<ChoiceType>()> getter, std::function<bool(ChoiceType)> setter,
             boost::optional<NoFailAction> reset = boost::none) {
     m_modelObject = modelObject;
+    detachChoiceModel();
     m_choiceConcept = std::shared_ptr<ChoiceConcept>(new OptionalChoiceConceptImpl<ChoiceType>(toString, choices, getter, setter, reset));
     clear();
     completeBind();
@@ -169,15 +258,19 @@ class OSComboBox2
     m_choiceConcept = std::make_shared<OptionalChoiceSaveDataSourceConceptImpl<ChoiceType, DataSourceType>>(
       dataSource, toString, std::bind(choices, dataSource.get()), std::bind(getter, dataSource.get()),
       std::bind(setter, dataSource.get(), std::placeholders::_1), resetAction, editable);
+    detachChoiceModel();
 
     clear();
     completeBind();
   }
 
-  // interface for OSGridController bind
-  void bind(const model::ModelObject& modelObject, std::shared_ptr<ChoiceConcept> choiceConcept) {
+  // interface for OSGridController bind, cells of the same comboBoxConcept share their popup item model
+  void bind(const model::ModelObject& modelObject, std::shared_ptr<ChoiceConcept> choiceConcept,
+            const ComboBoxConcept* comboBoxConcept = nullptr) {
     m_modelObject = modelObject;
     m_choiceConcept = choiceConcept;
+    detachChoiceModel();
+    m_choiceModel = comboBoxConcept ? OSComboBoxChoiceModel::sharedModel(comboBoxConcept, modelObject.model()) : nullptr;
     clear();
     completeBind();
   }
@@ -187,6 +280,10 @@ class OSComboBox2
 
   void unbind();
 
+  void showPopup() override;
+
+  void hidePopup() override;
+
  protected:
   bool event(QEvent* e) override;
 
@@ -217,11 +314,27 @@ class OSComboBox2
  private:
   void updateStyle();
 
+  // Fills the combo box with every choice, until then it only holds the current value
+  void populateChoices();
+
+  // Drops the choices again once neither the combo box nor its popup has focus
+  void releaseChoices();
+
+  // Drops the choices right away and gives the combo box back its own item model
+  void dropChoices();
+
+  void showCurrentValue(const std::string& value);
+
+  // Gives the combo box back its own item model if the shared one is attached, and forgets the shared one
+  void detachChoiceModel();
+
   std::shared_ptr<OSComboBoxDataSource> m_dataSource;
 
   boost::optional<model::ModelObject> m_modelObject;
   std::shared_ptr<ChoiceConcept> m_choiceConcept;
+  std::shared_ptr<OSComboBoxChoiceModel> m_choiceModel;
   std::vector<std::string> m_values;
+  bool m_choicesPopulated = false;
 
   bool m_hasClickFocus = false;
   bool m_focused = false;
@@ -229,6 +342,8 @@ class OSComboBox2
   bool m_editable = false;
 
   void completeBind();
+
+  friend class OSComboBoxChoiceModel;
 };
 
 /**
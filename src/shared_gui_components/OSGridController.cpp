@@ -101,6 +101,7 @@ OSGridController::OSGridController(bool isIP, const QString& settingsKey, IddObj
   connect(m_objectSelector, &OSObjectSelector::inFocus, this, &OSGridController::onInFocus);
   connect(m_objectSelector, &OSObjectSelector::gridRowSelectionChanged, this, &OSGridController::gridRowSelectionChanged);
   connect(m_objectSelector, &OSObjectSelector::gridCellChanged, this, &OSGridController::gridCellChanged);
+  connect(m_objectSelector, &OSObjectSelector::gridCellsChanged, this, &OSGridController::gridCellsChanged);
 }
 
 OSGridController::~OSGridController() {
@@ -687,6 +688,20 @@ void OSGridController::onSelectionCleared() {
 void OSGridController::onRemoveWorkspaceObject(const WorkspaceObject& object, const openstudio::IddObjectType& iddObjectType,
                                                const openstudio::UUID& handle) {
   m_objectSelector->setObjectRemoved(handle);
+
+  if (iddObjectType == m_iddObjectType) {
+    // object was added and removed before we got to it
+    for (auto it = m_newModelObjects.begin(); it != m_newModelObjects.end(); ++it) {
+      if (it->handle() == handle) {
+        m_newModelObjects.erase(it);
+        break;
+      }
+    }
+
+    // the row is hidden and locked now, remove it once the object is gone
+    m_removedHandles.insert(handle);
+    QTimer::singleShot(0, this, &OSGridController::processRemovedModelObjects);
+  }
 }
 
 void OSGridController::onAddWorkspaceObject(const WorkspaceObject& object, const openstudio::IddObjectType& iddObjectType,
@@ -706,12 +721,39 @@ void OSGridController::processNewModelObjects() {
   m_newModelObjects.clear();
 }
 
-void OSGridController::onSelectAllStateChanged(const int newState) const {
+void OSGridController::processRemovedModelObjects() {
+  for (const Handle& removedHandle : m_removedHandles) {
+    auto it = std::find_if(m_modelObjects.begin(), m_modelObjects.end(),
+                           [&removedHandle](const model::ModelObject& modelObject) { return modelObject.handle() == removedHandle; });
+    if (it == m_modelObjects.end()) {
+      continue;
+    }
+
+    const int modelRow = static_cast<int>(std::distance(m_modelObjects.begin(), it));
+    const int gridRow = gridRowFromModelRow(modelRow);
+    m_modelObjects.erase(it);
+
+    auto focusedGridRow = std::get<0>(m_focusedCellLocation);
+    if (focusedGridRow == gridRow) {
+      m_focusedCellLocation = std::make_tuple(-1, -1, -1);
+    } else if (focusedGridRow > gridRow) {
+      std::get<0>(m_focusedCellLocation) = focusedGridRow - 1;
+    }
+
+    m_objectSelector->removeRow(gridRow);
+    emit removeRow(gridRow);
+  }
+  m_removedHandles.clear();
+}
+
+void OSGridController::onSelectAllStateChanged(const int newState) {
   LOG(Debug, "Select all state changed: " << newState);
 
   if (newState == 0) {
     m_objectSelector->clearSelection();
   } else {
+    // only rows that have widgets can be selected
+    emit materializeAllRequested();
     m_objectSelector->selectAll();
   }
 }
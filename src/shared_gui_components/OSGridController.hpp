@@ -589,17 +589,28 @@ class OSGridController : public QObject
   // temp variable
   std::set<model::ModelObject> m_newModelObjects;
 
+  // temp variable
+  std::set<Handle> m_removedHandles;
+
  signals:
 
   // signal to add a row
   void addRow(int row);
 
+  // signal to remove a row
+  void removeRow(int row);
+
   // signal to parent to recreate all widgets
   void recreateAll();
 
   // signal to update a widget
   void gridCellChanged(const GridCellLocation& location, const GridCellInfo& info);
 
+  void gridCellsChanged(const std::vector<std::pair<const GridCellLocation*, const GridCellInfo*>>& changes);
+
+  // signal to a virtualized view to create the widgets for all rows, e.g. before selecting all
+  void materializeAllRequested();
+
   // signal to any created quantity edits to update
   void toggleUnitsClicked(bool displayIP);
 
@@ -622,7 +633,7 @@ class OSGridController : public QObject
 
  protected slots:
 
-  void onSelectAllStateChanged(const int newState) const;
+  void onSelectAllStateChanged(const int newState);
 
  private slots:
 
@@ -634,6 +645,8 @@ class OSGridController : public QObject
 
   void processNewModelObjects();
 
+  void processRemovedModelObjects();
+
   void onSetApplyButtonState();
 };
 
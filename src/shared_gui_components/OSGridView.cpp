@@ -63,11 +63,15 @@
 #include <QHideEvent>
 #include <QLabel>
 #include <QPushButton>
-//#include <QScrollArea>
+#include <QScrollArea>
+#include <QScrollBar>
 #include <QShowEvent>
 #include <QStackedWidget>
 #include <QStyle>
 
+#include <algorithm>
+#include <numeric>
+
 #ifdef Q_OS_DARWIN
 #  define WIDTH 110
 #  define HEIGHT 60
@@ -80,6 +84,12 @@
 
 constexpr int NUM_ROWS_PER_GRIDLAYOUT = 51;
 
+// OSWidgetHolder minimum height plus the cell wrapper bottom border, used until a block has been laid out
+constexpr int DEFAULT_ROW_HEIGHT = 41;
+
+// delay used to coalesce scroll and resize events in virtualized mode
+constexpr int VIEWPORT_UPDATE_DELAY_MS = 20;
+
 namespace openstudio {
 
 QGridLayout* OSGridView::makeGridLayout() {
@@ -99,8 +109,15 @@ OSGridView::OSGridView(OSGridController* gridController, const QString& headerTe
   m_gridController->setParent(this);
   connect(m_gridController, &OSGridController::recreateAll, this, &OSGridView::onRecreateAll);
   connect(m_gridController, &OSGridController::addRow, this, &OSGridView::onAddRow);
+  connect(m_gridController, &OSGridController::removeRow, this, &OSGridView::onRemoveRow);
   connect(m_gridController, &OSGridController::gridCellChanged, this, &OSGridView::onGridCellChanged);
+  connect(m_gridController, &OSGridController::gridCellsChanged, this, &OSGridView::onGridCellsChanged);
   connect(m_gridController, &OSGridController::gridRowSelectionChanged, this, &OSGridView::gridRowSelectionChanged);
+  connect(m_gridController, &OSGridController::materializeAllRequested, this, &OSGridView::onMaterializeAll);
+
+  m_viewportTimer.setSingleShot(true);
+  m_viewportTimer.setInterval(VIEWPORT_UPDATE_DELAY_MS);
+  connect(&m_viewportTimer, &QTimer::timeout, this, &OSGridView::onViewportChanged);
 
   /** Set up buttons for Categories: eg: SpaceTypes tab: that's the dropzone "Drop Space Type", "General", "Loads", "Measure Tags", "Custom"
    * QHBoxLayout manages the visual representation: they are placed side by side
@@ -189,29 +206,6 @@ OSGridView::OSGridView(OSGridController* gridController, const QString& headerTe
 OSGridView::~OSGridView() = default;
 ;
 
-/*
-void OSGridView::requestAddRow(int row) {
-  // std::cout << "REQUEST ADDROW CALLED " << std::endl;
-  setEnabled(false);
-
-  m_timer.start();
-
-  m_rowToAdd = row;
-
-  m_queueRequests.emplace_back(AddRow);
-}
-
-void OSGridView::requestRemoveRow(int row) {
-  // std::cout << "REQUEST REMOVEROW CALLED " << std::endl;
-  setEnabled(false);
-
-  m_timer.start();
-
-  m_rowToRemove = row;
-
-  m_queueRequests.emplace_back(RemoveRow);
-}
-*/
 //void OSGridView::refreshRow(int row)
 //{
 //  for( int j = 0; j < m_gridController->columnCount(); j++ )
@@ -221,9 +215,14 @@ void OSGridView::requestRemoveRow(int row) {
 //}
 
 QLayoutItem* OSGridView::itemAtPosition(int row, int column) {
-  int li = layoutIndex(row);
-  int ri = rowInLayout(row);
+  OS_ASSERT(row < static_cast<int>(m_rowSlots.size()));
+  int li = layoutIndex(m_rowSlots[row]);
+  int ri = rowInLayout(m_rowSlots[row]);
   OS_ASSERT(li < m_gridLayouts.size());
+  if (!m_gridLayouts[li]) {
+    // not materialized
+    return nullptr;
+  }
   return m_gridLayouts[li]->itemAtPosition(ri, column);
 }
 
@@ -239,6 +238,24 @@ void OSGridView::addSpacingToContentLayout(int spacing) {
   m_contentLayout->addSpacing(spacing);
 }
 
+bool OSGridView::isVirtualized() const {
+  return m_virtualized;
+}
+
+void OSGridView::setVirtualized(bool virtualized) {
+  if (m_virtualized == virtualized) {
+    return;
+  }
+
+  m_virtualized = virtualized;
+
+  if (m_virtualized) {
+    m_viewportTimer.start();
+  } else {
+    onMaterializeAll();
+  }
+}
+
 //void OSGridView::removeWidget(int row, int column)
 //{
 //  // Currently this is cruft code
@@ -283,6 +300,12 @@ void OSGridView::onAddRow(int row) {
   setEnabled(true);
 }
 
+void OSGridView::onRemoveRow(int row) {
+  setEnabled(false);
+  removeRow(row);
+  setEnabled(true);
+}
+
 void OSGridView::onRecreateAll() {
   setEnabled(false);
   recreateAll();
@@ -290,9 +313,14 @@ void OSGridView::onRecreateAll() {
 }
 
 void OSGridView::onGridCellChanged(const GridCellLocation& location, const GridCellInfo& info) {
-  int li = layoutIndex(location.gridRow);
-  int ri = rowInLayout(location.gridRow);
+  OS_ASSERT(location.gridRow < static_cast<int>(m_rowSlots.size()));
+  int li = layoutIndex(m_rowSlots[location.gridRow]);
+  int ri = rowInLayout(m_rowSlots[location.gridRow]);
   OS_ASSERT(li < m_gridLayouts.size());
+  if (!m_gridLayouts[li]) {
+    // not materialized, the row will be styled when it is
+    return;
+  }
   QLayoutItem* item = m_gridLayouts[li]->itemAtPosition(ri, location.column);
   if (item) {
     auto* wrapper = qobject_cast<OSCellWrapper*>(item->widget());
@@ -303,9 +331,24 @@ void OSGridView::onGridCellChanged(const GridCellLocation& location, const GridC
   }
 }
 
+void OSGridView::onGridCellsChanged(const std::vector<std::pair<const GridCellLocation*, const GridCellInfo*>>& changes) {
+  const bool updatesEnabled = this->updatesEnabled();
+  setUpdatesEnabled(false);
+
+  for (const auto& [location, info] : changes) {
+    onGridCellChanged(*location, *info);
+  }
+
+  // re-enabling updates schedules a single repaint of the whole grid
+  setUpdatesEnabled(updatesEnabled);
+}
+
 void OSGridView::deleteAll() {
   QLayoutItem* child;
   for (auto* gridLayout : m_gridLayouts) {
+    if (!gridLayout) {
+      continue;
+    }
     m_contentLayout->removeItem(gridLayout);
     while ((child = gridLayout->takeAt(0)) != nullptr) {
       QWidget* widget = child->widget();
@@ -323,24 +366,88 @@ void OSGridView::deleteAll() {
     delete gridLayout;
   }
   m_gridLayouts.clear();
+
+  for (auto* placeholder : m_placeholders) {
+    if (placeholder) {
+      m_contentLayout->removeWidget(placeholder);
+      delete placeholder;
+    }
+  }
+  m_placeholders.clear();
+
+  m_rowSlots.clear();
   m_columnWidths.clear();
 }
 
 void OSGridView::addRow(int row) {
   setUpdatesEnabled(false);
 
-  int li = layoutIndex(row);
-  while (li >= m_gridLayouts.size()) {
-    auto* gridLayout = makeGridLayout();
-    m_gridLayouts.push_back(gridLayout);
-    m_contentLayout->addLayout(gridLayout);
+  // rows are only ever appended, in the slot after the last one
+  OS_ASSERT(row == static_cast<int>(m_rowSlots.size()));
+  m_rowSlots.push_back(m_rowSlots.empty() ? 0 : m_rowSlots.back() + 1);
+
+  int li = layoutIndex(m_rowSlots.back());
+  while (li >= blockCount()) {
+    // a new block at the end is materialized if the one before it is
+    appendBlock(!m_virtualized || blockCount() == 0 || isBlockMaterialized(blockCount() - 1));
   }
 
   const auto numRows = m_gridController->rowCount();
   OS_ASSERT(row < numRows);
+
+  if (isBlockMaterialized(li)) {
+    const auto numColumns = m_gridController->columnCount();
+    for (int j = 0; j < numColumns; j++) {
+      createCellWrapper(row, j);
+    }
+  } else {
+    m_placeholders[li]->setFixedHeight(rowCountInBlock(li) * estimatedRowHeight());
+  }
+
+  setUpdatesEnabled(true);
+}
+
+void OSGridView::removeRow(int row) {
+  OS_ASSERT(row < static_cast<int>(m_rowSlots.size()));
+
+  setUpdatesEnabled(false);
+
+  // the slot is left empty, an empty row in a QGridLayout has no height
+  const int li = layoutIndex(m_rowSlots[row]);
+  const int ri = rowInLayout(m_rowSlots[row]);
+  if (isBlockMaterialized(li)) {
+    const int numColumns = m_gridLayouts[li]->columnCount();
+    for (int j = 0; j < numColumns; j++) {
+      if (QLayoutItem* item = m_gridLayouts[li]->itemAtPosition(ri, j)) {
+        QWidget* widget = item->widget();
+        m_gridLayouts[li]->removeWidget(widget);
+        delete widget;
+      }
+    }
+  }
+
+  m_rowSlots.erase(m_rowSlots.begin() + row);
+
+  if (!isBlockMaterialized(li)) {
+    m_placeholders[li]->setFixedHeight(rowCountInBlock(li) * estimatedRowHeight());
+  }
+
+  // the rows below move up by one, renumber their cell wrappers in place
+  const auto numRows = static_cast<int>(m_rowSlots.size());
   const auto numColumns = m_gridController->columnCount();
-  for (int j = 0; j < numColumns; j++) {
-    createCellWrapper(row, j);
+  for (int i = row; i < numRows; i++) {
+    int rli = layoutIndex(m_rowSlots[i]);
+    int rri = rowInLayout(m_rowSlots[i]);
+    if (!m_gridLayouts[rli]) {
+      continue;
+    }
+    for (int j = 0; j < numColumns; j++) {
+      if (QLayoutItem* item = m_gridLayouts[rli]->itemAtPosition(rri, j)) {
+        auto* wrapper = qobject_cast<OSCellWrapper*>(item->widget());
+        OS_ASSERT(wrapper);
+        wrapper->setGridRow(m_gridController->modelRowFromGridRow(i), i);
+      }
+    }
   }
 
   setUpdatesEnabled(true);
@@ -359,9 +466,18 @@ void OSGridView::recreateAll() {
 
     const auto numRows = m_gridController->rowCount();
     const auto numColumns = m_gridController->columnCount();
-    for (int i = 0; i < numRows; i++) {
-      for (int j = 0; j < numColumns; j++) {
-        createCellWrapper(i, j);
+    m_rowSlots.resize(numRows);
+    std::iota(m_rowSlots.begin(), m_rowSlots.end(), 0);
+    const int numBlocks = (numRows > 0) ? layoutIndex(numRows - 1) + 1 : 0;
+    for (int block = 0; block < numBlocks; ++block) {
+      // the first block holds the header and sets the column widths, it is always materialized
+      appendBlock(!m_virtualized || block == 0);
+      if (isBlockMaterialized(block)) {
+        for (int i = firstRowInBlock(block); i <= lastRowInBlock(block); i++) {
+          for (int j = 0; j < numColumns; j++) {
+            createCellWrapper(i, j);
+          }
+        }
       }
     }
 
@@ -370,26 +486,31 @@ void OSGridView::recreateAll() {
 
     setUpdatesEnabled(true);
 
+    if (m_virtualized) {
+      m_viewportTimer.start();
+    }
+
     //QTimer::singleShot(0, this, SLOT(selectRowDeterminedByModelSubTabView()));
   }
 }
 
-constexpr int OSGridView::layoutIndex(int row) const {
-  return row / NUM_ROWS_PER_GRIDLAYOUT;
+constexpr int OSGridView::layoutIndex(int slot) const {
+  return slot / NUM_ROWS_PER_GRIDLAYOUT;
 }
 
-constexpr int OSGridView::rowInLayout(int row) const {
-  return row % NUM_ROWS_PER_GRIDLAYOUT;
+constexpr int OSGridView::rowInLayout(int slot) const {
+  return slot % NUM_ROWS_PER_GRIDLAYOUT;
 }
 
 void OSGridView::updateColumnWidths() {
   m_columnWidths.clear();
 
-  if (m_gridLayouts.size() > 0) {
-    if (m_gridLayouts[0]->rowCount() > 0) {
+  // the first block is always materialized
+  if (m_gridLayouts.size() > 0 && m_gridLayouts[0]) {
+    if (m_gridLayouts[0]->rowCount() > 0 && !m_rowSlots.empty() && layoutIndex(m_rowSlots[0]) == 0) {
       int numColumns = m_gridLayouts[0]->columnCount();
       for (int column = 0; column < numColumns; ++column) {
-        QLayoutItem* item = m_gridLayouts[0]->itemAtPosition(0, column);
+        QLayoutItem* item = m_gridLayouts[0]->itemAtPosition(rowInLayout(m_rowSlots[0]), column);
         OS_ASSERT(item);
         auto* wrapper = qobject_cast<OSCellWrapper*>(item->widget());
         OS_ASSERT(wrapper);
@@ -446,13 +567,13 @@ void OSGridView::createCellWrapper(int row, int column) {
 
 void OSGridView::addCellWrapper(OSCellWrapper* w, int row, int column) {
 
-  int li = layoutIndex(row);
-  int ri = rowInLayout(row);
-  while (li >= m_gridLayouts.size()) {
-    auto* gridLayout = makeGridLayout();
-    m_gridLayouts.push_back(gridLayout);
-    m_contentLayout->addLayout(gridLayout);
+  OS_ASSERT(row < static_cast<int>(m_rowSlots.size()));
+  int li = layoutIndex(m_rowSlots[row]);
+  int ri = rowInLayout(m_rowSlots[row]);
+  while (li >= blockCount()) {
+    appendBlock(true);
   }
+  OS_ASSERT(isBlockMaterialized(li));
 
   if (li > 0) {
     if (m_columnWidths.empty()) {
@@ -464,6 +585,193 @@ void OSGridView::addCellWrapper(OSCellWrapper* w, int row, int column) {
   m_gridLayouts[li]->addWidget(w, ri, column);
 }
 
+int OSGridView::blockCount() const {
+  return static_cast<int>(m_gridLayouts.size());
+}
+
+int OSGridView::firstRowInBlock(int block) const {
+  // slots are increasing with rows
+  auto it = std::lower_bound(m_rowSlots.begin(), m_rowSlots.end(), block * NUM_ROWS_PER_GRIDLAYOUT);
+  return static_cast<int>(std::distance(m_rowSlots.begin(), it));
+}
+
+int OSGridView::lastRowInBlock(int block) const {
+  return firstRowInBlock(block + 1) - 1;
+}
+
+int OSGridView::rowCountInBlock(int block) const {
+  return lastRowInBlock(block) - firstRowInBlock(block) + 1;
+}
+
+bool OSGridView::isBlockMaterialized(int block) const {
+  OS_ASSERT(block < blockCount());
+  return m_gridLayouts[block] != nullptr;
+}
+
+void OSGridView::appendBlock(bool materialized) {
+  if (materialized) {
+    auto* gridLayout = makeGridLayout();
+    m_gridLayouts.push_back(gridLayout);
+    m_placeholders.push_back(nullptr);
+    m_contentLayout->addLayout(gridLayout);
+  } else {
+    auto* placeholder = new QWidget();
+    m_gridLayouts.push_back(nullptr);
+    m_placeholders.push_back(placeholder);
+    m_contentLayout->addWidget(placeholder);
+    const int block = blockCount() - 1;
+    placeholder->setFixedHeight(rowCountInBlock(block) * estimatedRowHeight());
+  }
+}
+
+void OSGridView::materializeBlock(int block) {
+  if (isBlockMaterialized(block)) {
+    return;
+  }
+
+  QWidget* placeholder = m_placeholders[block];
+  const int index = m_contentLayout->indexOf(placeholder);
+  OS_ASSERT(index >= 0);
+  m_contentLayout->removeWidget(placeholder);
+  delete placeholder;
+  m_placeholders[block] = nullptr;
+
+  auto* gridLayout = makeGridLayout();
+  m_gridLayouts[block] = gridLayout;
+  m_contentLayout->insertLayout(index, gridLayout);
+
+  LOG_FREE(Debug, "OSGridView", "Materializing rows " << firstRowInBlock(block) << " to " << lastRowInBlock(block));
+
+  const auto numColumns = m_gridController->columnCount();
+  for (int i = firstRowInBlock(block); i <= lastRowInBlock(block); i++) {
+    for (int j = 0; j < numColumns; j++) {
+      createCellWrapper(i, j);
+    }
+    // new cells are visible and unlocked, apply the current filter and locks
+    m_gridController->m_objectSelector->onRowNeedsStyle(m_gridController->modelRowFromGridRow(i), i);
+  }
+}
+
+void OSGridView::dematerializeBlock(int block) {
+  if (!isBlockMaterialized(block)) {
+    return;
+  }
+
+  QGridLayout* gridLayout = m_gridLayouts[block];
+  const int height = gridLayout->geometry().height();
+  const int index = m_contentLayout->indexOf(gridLayout);
+  OS_ASSERT(index >= 0);
+  m_contentLayout->removeItem(gridLayout);
+
+  LOG_FREE(Debug, "OSGridView", "Dematerializing rows " << firstRowInBlock(block) << " to " << lastRowInBlock(block));
+
+  const auto numColumns = m_gridController->columnCount();
+  for (int i = firstRowInBlock(block); i <= lastRowInBlock(block); i++) {
+    for (int j = 0; j < numColumns; j++) {
+      m_gridController->m_objectSelector->clearCell(m_gridController->modelRowFromGridRow(i), i, j);
+    }
+  }
+
+  QLayoutItem* child;
+  while ((child = gridLayout->takeAt(0)) != nullptr) {
+    delete child->widget();
+    delete child;
+  }
+  delete gridLayout;
+  m_gridLayouts[block] = nullptr;
+
+  auto* placeholder = new QWidget();
+  placeholder->setFixedHeight(height > 0 ? height : rowCountInBlock(block) * estimatedRowHeight());
+  m_placeholders[block] = placeholder;
+  m_contentLayout->insertWidget(index, placeholder);
+}
+
+int OSGridView::estimatedRowHeight() const {
+  // average over the blocks that have been laid out, skipping the header block
+  int height = 0;
+  int numRows = 0;
+  for (int block = 1; block < blockCount(); ++block) {
+    if (m_gridLayouts[block] && m_gridLayouts[block]->geometry().height() > 0) {
+      height += m_gridLayouts[block]->geometry().height();
+      numRows += rowCountInBlock(block);
+    }
+  }
+
+  if (numRows == 0 && blockCount() > 0 && m_gridLayouts[0] && m_gridLayouts[0]->geometry().height() > 0) {
+    height = m_gridLayouts[0]->geometry().height();
+    numRows = rowCountInBlock(0);
+  }
+
+  if (numRows == 0) {
+    return DEFAULT_ROW_HEIGHT;
+  }
+  return std::max(1, height / numRows);
+}
+
+QScrollArea* OSGridView::findScrollArea() const {
+  for (QWidget* parent = parentWidget(); parent != nullptr; parent = parent->parentWidget()) {
+    if (auto* scrollArea = qobject_cast<QScrollArea*>(parent)) {
+      return scrollArea;
+    }
+  }
+  return nullptr;
+}
+
+void OSGridView::onMaterializeAll() {
+  setUpdatesEnabled(false);
+  for (int block = 0; block < blockCount(); ++block) {
+    materializeBlock(block);
+  }
+  setUpdatesEnabled(true);
+}
+
+void OSGridView::onViewportChanged() {
+  if (!m_virtualized || !isVisible() || blockCount() == 0) {
+    return;
+  }
+
+  QWidget* contentWidget = m_contentLayout->parentWidget();
+  OS_ASSERT(contentWidget);
+  const QRect visibleRect = contentWidget->visibleRegion().boundingRect();
+  if (visibleRect.isEmpty()) {
+    return;
+  }
+
+  // materialize one viewport worth of rows above and below what is visible,
+  // only delete blocks beyond three viewports so scrolling back and forth around a block boundary does not thrash
+  const int overscan = m_scrollArea ? m_scrollArea->viewport()->height() : visibleRect.height();
+  const int top = visibleRect.top() - overscan;
+  const int bottom = visibleRect.bottom() + overscan;
+  const int keepTop = visibleRect.top() - 3 * overscan;
+  const int keepBottom = visibleRect.bottom() + 3 * overscan;
+
+  const int focusedGridRow = std::get<0>(m_gridController->m_focusedCellLocation);
+
+  setUpdatesEnabled(false);
+
+  // the first block holds the header, never touch it
+  for (int block = 1; block < blockCount(); ++block) {
+    const bool materialized = isBlockMaterialized(block);
+    const QRect geometry = materialized ? m_gridLayouts[block]->geometry() : m_placeholders[block]->geometry();
+
+    if (!materialized) {
+      if (geometry.bottom() >= top && geometry.top() <= bottom) {
+        materializeBlock(block);
+      }
+    } else if (geometry.bottom() < keepTop || geometry.top() > keepBottom) {
+      const int firstRow = firstRowInBlock(block);
+      const int lastRow = lastRowInBlock(block);
+      // selected rows and the focused cell must stay alive, they are used by 'Apply to Selected'
+      const bool hasFocus = (focusedGridRow >= firstRow && focusedGridRow <= lastRow);
+      if (!hasFocus && !m_gridController->m_objectSelector->hasSelectedCells(firstRow, lastRow)) {
+        dematerializeBlock(block);
+      }
+    }
+  }
+
+  setUpdatesEnabled(true);
+}
+
 void OSGridView::hideEvent(QHideEvent* event) {
   m_gridController->disconnectFromModelSignals();
 
@@ -473,7 +781,22 @@ void OSGridView::hideEvent(QHideEvent* event) {
 void OSGridView::showEvent(QShowEvent* event) {
   m_gridController->connectToModelSignals();
 
+  if (!m_scrollArea) {
+    m_scrollArea = findScrollArea();
+    if (m_scrollArea) {
+      connect(m_scrollArea->verticalScrollBar(), &QScrollBar::valueChanged, this, [this](int) {
+        if (m_virtualized) {
+          m_viewportTimer.start();
+        }
+      });
+    }
+  }
+
   QWidget::showEvent(event);
+
+  if (m_virtualized) {
+    m_viewportTimer.start();
+  }
 }
 
 void OSGridView::resizeEvent(QResizeEvent* event) {
@@ -482,14 +805,18 @@ void OSGridView::resizeEvent(QResizeEvent* event) {
   updateColumnWidths();
 
   if (m_gridLayouts.size() > 0) {
-    const auto numRows = m_gridController->rowCount();
+    const auto numRows = static_cast<int>(m_rowSlots.size());
     const auto numColumns = m_gridController->columnCount();
-    for (int i = NUM_ROWS_PER_GRIDLAYOUT; i < numRows; i++) {
-      int li = layoutIndex(i);
-      int ri = rowInLayout(i);
+    // the first block sets the column widths
+    for (int i = firstRowInBlock(1); i < numRows; i++) {
+      int li = layoutIndex(m_rowSlots[i]);
+      int ri = rowInLayout(m_rowSlots[i]);
       if (li >= m_gridLayouts.size()) {
         break;
       }
+      if (!m_gridLayouts[li]) {
+        continue;
+      }
       for (int j = 0; j < numColumns; j++) {
         QLayoutItem* item = m_gridLayouts[li]->itemAtPosition(ri, j);
         if (item) {
@@ -501,6 +828,10 @@ void OSGridView::resizeEvent(QResizeEvent* event) {
       }
     }
   }
+
+  if (m_virtualized) {
+    m_viewportTimer.start();
+  }
 }
 
 }  // namespace openstudio
@@ -30,6 +30,7 @@
 #ifndef SHAREDGUICOMPONENTS_OSGRIDVIEW_HPP
 #define SHAREDGUICOMPONENTS_OSGRIDVIEW_HPP
 
+#include <QPointer>
 #include <QTimer>
 #include <QWidget>
 
@@ -44,6 +45,7 @@ class QLabel;
 class QShowEvent;
 class QString;
 class QLayoutItem;
+class QScrollArea;
 class OpenStudioLibFixture;
 
 namespace openstudio {
@@ -74,6 +76,12 @@ class OSGridView : public QWidget
 
   void addSpacingToContentLayout(int spacing);
 
+  // In virtualized mode, cell wrappers are only created for the blocks of rows that intersect the viewport
+  // of the enclosing QScrollArea (plus some overscan). Blocks that scroll far out of view are deleted
+  // and replaced by a placeholder of the same height, so opening a grid no longer depends on the model size
+  bool isVirtualized() const;
+  void setVirtualized(bool virtualized);
+
  protected:
   virtual void hideEvent(QHideEvent* event) override;
 
@@ -89,14 +97,24 @@ class OSGridView : public QWidget
 
  public slots:
 
-  //void requestRemoveRow(int row);
-
   void onAddRow(int row);
 
+  void onRemoveRow(int row);
+
   void onRecreateAll();
 
   void onGridCellChanged(const GridCellLocation& location, const GridCellInfo& info);
 
+  // style all the changed cells in a single pass with updates disabled, then repaint once
+  void onGridCellsChanged(const std::vector<std::pair<const GridCellLocation*, const GridCellInfo*>>& changes);
+
+  // create the cell wrappers for every row, e.g. before selecting all rows
+  void onMaterializeAll();
+
+ private slots:
+
+  void onViewportChanged();
+
  private:
   // For testing
   friend class OpenStudioLibFixture;
@@ -110,14 +128,17 @@ class OSGridView : public QWidget
   // add a row
   void addRow(int row);
 
+  // remove a row, moving the rows below it up without recreating them
+  void removeRow(int row);
+
   // recreate all widgets
   void recreateAll();
 
-  // convert row to layout index
-  constexpr int layoutIndex(int row) const;
+  // convert slot to layout index
+  constexpr int layoutIndex(int slot) const;
 
-  // get row in layout
-  constexpr int rowInLayout(int row) const;
+  // get row in layout for a slot
+  constexpr int rowInLayout(int slot) const;
 
   // update column widths
   void updateColumnWidths();
@@ -131,12 +152,53 @@ class OSGridView : public QWidget
   // Add a widget, adding a new layout if necessary
   void addCellWrapper(OSCellWrapper* w, int row, int column);
 
+  // number of blocks of NUM_ROWS_PER_GRIDLAYOUT rows
+  int blockCount() const;
+
+  // rows in the block [firstRow, lastRow]
+  int firstRowInBlock(int block) const;
+  int lastRowInBlock(int block) const;
+  int rowCountInBlock(int block) const;
+
+  // true if the block has a grid layout with cell wrappers, false if it is a placeholder
+  bool isBlockMaterialized(int block) const;
+
+  // append a new block at the end of the content layout, as a placeholder if virtualized
+  void appendBlock(bool materialized);
+
+  // replace the placeholder of a block by a grid layout and create its cell wrappers
+  void materializeBlock(int block);
+
+  // delete the cell wrappers of a block and replace it by a placeholder
+  void dematerializeBlock(int block);
+
+  // placeholder height for the rows of a block that are not materialized
+  int estimatedRowHeight() const;
+
+  // find the QScrollArea we are placed in, if any
+  QScrollArea* findScrollArea() const;
+
   OSDropZone* m_dropZone;
 
   QVBoxLayout* m_contentLayout;
 
+  // one entry per block of rows, nullptr if the block is a placeholder
   std::vector<QGridLayout*> m_gridLayouts;
 
+  // physical slot of each grid row, the block is slot / NUM_ROWS_PER_GRIDLAYOUT.
+  // Removing a row leaves its slot empty so the rows below do not have to move between layouts
+  std::vector<int> m_rowSlots;
+
+  // one entry per block of rows, nullptr if the block is materialized
+  std::vector<QWidget*> m_placeholders;
+
+  bool m_virtualized = false;
+
+  QPointer<QScrollArea> m_scrollArea;
+
+  // coalesces scroll and resize events before checking which blocks are in view
+  QTimer m_viewportTimer;
+
   std::vector<int> m_columnWidths;
 
   OSCollapsibleView* m_collapsibleView;
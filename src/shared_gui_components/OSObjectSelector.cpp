@@ -186,6 +186,33 @@ bool GridCellInfo::setLocked(bool locked) {
   return false;
 }
 
+namespace {
+
+using RowIndex = std::map<int, std::vector<GridCellLocation*>>;
+
+void eraseFromRowIndex(RowIndex& index, GridCellLocation* location) {
+  auto it = index.find(location->gridRow);
+  if (it != index.end()) {
+    it->second.erase(std::remove(it->second.begin(), it->second.end(), location), it->second.end());
+    if (it->second.empty()) {
+      index.erase(it);
+    }
+  }
+}
+
+// Moves every row below t_gridRow up by one, t_gridRow must already have been removed from the index
+void shiftRowsUp(RowIndex& index, int t_gridRow) {
+  OS_ASSERT(index.find(t_gridRow) == index.end());
+  auto it = index.upper_bound(t_gridRow);
+  while (it != index.end()) {
+    auto node = index.extract(it++);
+    --node.key();
+    index.insert(std::move(node));
+  }
+}
+
+}  // namespace
+
 OSObjectSelector::OSObjectSelector(QObject* parent) : QObject(parent), m_objectFilter(getDefaultFilter()), m_isLocked(getDefaultIsLocked()) {}
 
 OSObjectSelector::~OSObjectSelector() = default;
@@ -199,67 +226,46 @@ void OSObjectSelector::clear() {
     it = m_gridCellLocationToInfoMap.erase(it);
   }
 
-  m_selectorCellLocations.clear();
-  m_parentCellLocations.clear();
-  m_selectorOrParentCellLocations.clear();
+  m_gridRowToCellLocations.clear();
+  m_gridRowToSelectorCellLocations.clear();
+  m_gridRowToParentCellLocations.clear();
+  m_handleToSelectorCellLocations.clear();
+  m_batchedCellLocations.clear();
 
   m_objectFilter = getDefaultFilter();
   m_isLocked = getDefaultIsLocked();
 }
 
 void OSObjectSelector::clearCell(int t_modelRow, int t_gridRow, int t_column) {
-
-  auto sameCellLambda = [t_modelRow, t_gridRow, t_column](GridCellLocation* tmp) {
-    return t_modelRow == tmp->modelRow && t_gridRow == tmp->gridRow && t_column == tmp->column;
-  };
-
-  m_selectorCellLocations.erase(std::remove_if(m_selectorCellLocations.begin(), m_selectorCellLocations.end(), sameCellLambda),
-                                m_selectorCellLocations.end());
-
-  m_parentCellLocations.erase(std::remove_if(m_parentCellLocations.begin(), m_parentCellLocations.end(), sameCellLambda),
-                              m_parentCellLocations.end());
-
-  m_selectorOrParentCellLocations.erase(
-    std::remove_if(m_selectorOrParentCellLocations.begin(), m_selectorOrParentCellLocations.end(), sameCellLambda),
-    m_selectorOrParentCellLocations.end());
-
-  auto it = m_gridCellLocationToInfoMap.begin();
-  while (it != m_gridCellLocationToInfoMap.end()) {
-    if (it->first->modelRow == t_modelRow && it->first->gridRow == t_gridRow && it->first->column == t_column) {
-      delete it->first;
-      delete it->second;
-      it = m_gridCellLocationToInfoMap.erase(it);
-    } else {
-      ++it;
+  for (auto* location : cellLocations(t_gridRow)) {
+    if (location->modelRow == t_modelRow && location->column == t_column) {
+      removeCell(location);
     }
   }
 }
 
-void OSObjectSelector::clearSubCell(int t_modelRow, int t_gridRow, int t_column, int t_subrow) {
-
-  auto sameSubCellLambda = [t_modelRow, t_gridRow, t_column, t_subrow](GridCellLocation* tmp) {
-    return t_modelRow == tmp->modelRow && t_gridRow == tmp->gridRow && t_column == tmp->column && tmp->subrow && t_subrow == tmp->subrow.get();
-  };
+void OSObjectSelector::removeRow(int t_gridRow) {
 
-  m_selectorCellLocations.erase(std::remove_if(m_selectorCellLocations.begin(), m_selectorCellLocations.end(), sameSubCellLambda),
-                                m_selectorCellLocations.end());
+  for (auto* location : cellLocations(t_gridRow)) {
+    removeCell(location);
+  }
 
-  m_parentCellLocations.erase(std::remove_if(m_parentCellLocations.begin(), m_parentCellLocations.end(), sameSubCellLambda),
-                              m_parentCellLocations.end());
+  for (auto it = m_gridRowToCellLocations.upper_bound(t_gridRow); it != m_gridRowToCellLocations.end(); ++it) {
+    for (auto* location : it->second) {
+      --(location->modelRow);
+      --(location->gridRow);
+    }
+  }
 
-  m_selectorOrParentCellLocations.erase(
-    std::remove_if(m_selectorOrParentCellLocations.begin(), m_selectorOrParentCellLocations.end(), sameSubCellLambda),
-    m_selectorOrParentCellLocations.end());
+  shiftRowsUp(m_gridRowToCellLocations, t_gridRow);
+  shiftRowsUp(m_gridRowToSelectorCellLocations, t_gridRow);
+  shiftRowsUp(m_gridRowToParentCellLocations, t_gridRow);
+}
 
-  auto it = m_gridCellLocationToInfoMap.begin();
-  while (it != m_gridCellLocationToInfoMap.end()) {
-    if (it->first->modelRow == t_modelRow && it->first->gridRow == t_gridRow && it->first->column == t_column && it->first->subrow
-        && it->first->subrow.get() == t_subrow) {
-      delete it->first;
-      delete it->second;
-      it = m_gridCellLocationToInfoMap.erase(it);
-    } else {
-      ++it;
+void OSObjectSelector::clearSubCell(int t_modelRow, int t_gridRow, int t_column, int t_subrow) {
+  for (auto* location : cellLocations(t_gridRow)) {
+    if (location->modelRow == t_modelRow && location->column == t_column && location->subrow && location->subrow.get() == t_subrow) {
+      removeCell(location);
     }
   }
 }
@@ -284,16 +290,17 @@ void OSObjectSelector::addObject(const boost::optional<model::ModelObject>& t_ob
   connect(t_holder, &OSWidgetHolder::inFocus, location, &GridCellLocation::onInFocus);
   connect(location, &GridCellLocation::inFocus, this, &OSObjectSelector::inFocus);
 
+  m_gridRowToCellLocations[t_gridRow].push_back(location);
+
   if (t_isSelector) {
-    m_selectorCellLocations.push_back(location);
+    m_gridRowToSelectorCellLocations[t_gridRow].push_back(location);
+    if (t_obj) {
+      m_handleToSelectorCellLocations[t_obj->handle()].push_back(location);
+    }
   }
 
   if (t_isParent) {
-    m_parentCellLocations.push_back(location);
-  }
-
-  if (t_isSelector || t_isParent) {
-    m_selectorOrParentCellLocations.push_back(location);
+    m_gridRowToParentCellLocations[t_gridRow].push_back(location);
   }
 
   m_gridCellLocationToInfoMap.insert(std::make_pair(location, info));
@@ -303,14 +310,11 @@ void OSObjectSelector::setObjectRemoved(const openstudio::Handle& handle) {
   const PropertyChange visible = ChangeToFalse;
   const PropertyChange selected = ChangeToFalse;
   const PropertyChange locked = ChangeToTrue;
-  for (auto* const location : m_selectorCellLocations) {
-    GridCellInfo* info = getGridCellInfo(location);
-    if ((info != nullptr) && info->modelObject && info->modelObject->handle() == handle) {
-      if (location->subrow) {
-        setSubrowProperties(location->gridRow, location->subrow.get(), visible, selected, locked);
-      } else {
-        setRowProperties(location->gridRow, visible, selected, locked);
-      }
+  for (auto* const location : selectorCellLocations(handle)) {
+    if (location->subrow) {
+      setSubrowProperties(location->gridRow, location->subrow.get(), visible, selected, locked);
+    } else {
+      setRowProperties(location->gridRow, visible, selected, locked);
     }
   }
 }
@@ -326,9 +330,12 @@ void OSObjectSelector::setObjectRemoved(const openstudio::Handle& handle) {
 
 boost::optional<model::ModelObject> OSObjectSelector::getObject(const int t_modelRow, const int t_gridRow, const int t_column,
                                                                 const boost::optional<int>& t_subrow) const {
-  for (const auto& locationInfoPair : m_gridCellLocationToInfoMap) {
-    if (locationInfoPair.first->equal(t_modelRow, t_gridRow, t_column, t_subrow)) {
-      return locationInfoPair.second->modelObject;
+  auto it = m_gridRowToCellLocations.find(t_gridRow);
+  if (it != m_gridRowToCellLocations.end()) {
+    for (auto* location : it->second) {
+      if (location->equal(t_modelRow, t_gridRow, t_column, t_subrow)) {
+        return getGridCellInfo(location)->modelObject;
+      }
     }
   }
   return boost::none;
@@ -338,8 +345,9 @@ void OSObjectSelector::selectAll() {
   const PropertyChange visible = NoChange;
   const PropertyChange selected = ChangeToTrue;
   const PropertyChange locked = NoChange;
+  beginBatch();
   int numSelected = 0;
-  for (auto& location : m_selectorCellLocations) {
+  for (auto& location : selectorCellLocations()) {
     GridCellInfo* info = getGridCellInfo(location);
     if (info) {
       if (info->isSelectable()) {
@@ -355,6 +363,8 @@ void OSObjectSelector::selectAll() {
     }
   }
 
+  endBatch();
+
   emit gridRowSelectionChanged(numSelected, numSelected);
 }
 
@@ -362,8 +372,9 @@ void OSObjectSelector::clearSelection() {
   const PropertyChange visible = NoChange;
   const PropertyChange selected = ChangeToFalse;
   const PropertyChange locked = NoChange;
+  beginBatch();
   int numSelectable = 0;
-  for (auto& location : m_selectorCellLocations) {
+  for (auto& location : selectorCellLocations()) {
     GridCellInfo* info = getGridCellInfo(location);
     if (info) {
       if (info->isSelectable()) {
@@ -379,6 +390,8 @@ void OSObjectSelector::clearSelection() {
     }
   }
 
+  endBatch();
+
   emit gridRowSelectionChanged(0, numSelectable);
 }
 
@@ -387,66 +400,84 @@ void OSObjectSelector::onRowNeedsStyle(int modelRow, int gridRow) {
   std::vector<std::pair<GridCellLocation*, PropertyChange>> visibleChanges;
   std::vector<std::pair<GridCellLocation*, PropertyChange>> lockedChanges;
 
+  appendRowChanges(modelRow, gridRow, true, true, visibleChanges, lockedChanges);
+
+  // apply the changes in reverse order
+  std::reverse(visibleChanges.begin(), visibleChanges.end());
+  std::reverse(lockedChanges.begin(), lockedChanges.end());
+
+  updateRowsAndSubrows(visibleChanges, lockedChanges);
+}
+
+void OSObjectSelector::appendRowChanges(const boost::optional<int>& t_modelRow, int t_gridRow, bool t_visible, bool t_locked,
+                                        std::vector<std::pair<GridCellLocation*, PropertyChange>>& visibleChanges,
+                                        std::vector<std::pair<GridCellLocation*, PropertyChange>>& lockedChanges) const {
+
+  // changes for this row are appended at the end, parents only need to override changes from this point
+  const auto firstVisibleChange = static_cast<std::ptrdiff_t>(visibleChanges.size());
+  const auto firstLockedChange = static_cast<std::ptrdiff_t>(lockedChanges.size());
+
   // loop over selector cells first
-  for (auto& location : m_selectorCellLocations) {
-    if (location->modelRow == modelRow && location->gridRow == gridRow) {
+  auto selectorIt = m_gridRowToSelectorCellLocations.find(t_gridRow);
+  if (selectorIt != m_gridRowToSelectorCellLocations.end()) {
+    for (auto* location : selectorIt->second) {
+      if (t_modelRow && location->modelRow != *t_modelRow) {
+        continue;
+      }
       GridCellInfo* info = getGridCellInfo(location);
       if (info && info->modelObject) {
-        PropertyChange lockedChange = PropertyChange::NoChange;
-
-        if (m_isLocked(info->modelObject.get())) {
-          lockedChange = PropertyChange::ChangeToTrue;
+        if (t_locked) {
+          PropertyChange lockedChange = PropertyChange::NoChange;
+          if (m_isLocked(info->modelObject.get())) {
+            lockedChange = PropertyChange::ChangeToTrue;
+          }
+          lockedChanges.emplace_back(location, lockedChange);
         }
-        lockedChanges.emplace_back(location, lockedChange);
 
-        PropertyChange visibleChange = PropertyChange::ChangeToFalse;
-        if (m_objectFilter(info->modelObject.get())) {
-          visibleChange = PropertyChange::ChangeToTrue;
+        if (t_visible) {
+          PropertyChange visibleChange = PropertyChange::ChangeToFalse;
+          if (m_objectFilter(info->modelObject.get())) {
+            visibleChange = PropertyChange::ChangeToTrue;
+          }
+          visibleChanges.emplace_back(location, visibleChange);
         }
-        visibleChanges.emplace_back(location, visibleChange);
       }
     }
   }
 
   // loop over parent cells second
-  for (auto& location : m_parentCellLocations) {
-    if (location->modelRow == modelRow && location->gridRow == gridRow) {
+  auto parentIt = m_gridRowToParentCellLocations.find(t_gridRow);
+  if (parentIt != m_gridRowToParentCellLocations.end()) {
+    for (auto* location : parentIt->second) {
+      if (t_modelRow && location->modelRow != *t_modelRow) {
+        continue;
+      }
       GridCellInfo* info = getGridCellInfo(location);
       if (info && info->modelObject) {
-        PropertyChange lockedChange = PropertyChange::NoChange;
-        if (m_isLocked(info->modelObject.get())) {
-          lockedChange = PropertyChange::ChangeToTrue;
-
-          // parent locked, selector always locked
-          lockedChanges.erase(
-            std::remove_if(lockedChanges.begin(), lockedChanges.end(),
-                           [location](std::pair<GridCellLocation*, PropertyChange> tmp) { return location->gridRow == tmp.first->gridRow; }),
-            lockedChanges.end());
+        if (t_locked) {
+          PropertyChange lockedChange = PropertyChange::NoChange;
+          if (m_isLocked(info->modelObject.get())) {
+            lockedChange = PropertyChange::ChangeToTrue;
+
+            // parent locked, selector always locked
+            lockedChanges.erase(lockedChanges.begin() + firstLockedChange, lockedChanges.end());
+          }
+          lockedChanges.emplace_back(location, lockedChange);
         }
-        lockedChanges.emplace_back(location, lockedChange);
 
-        PropertyChange visibleChange = PropertyChange::ChangeToFalse;
-        if (m_objectFilter(info->modelObject.get())) {
-          visibleChange = PropertyChange::ChangeToTrue;
-        } else {
-          visibleChange = PropertyChange::ChangeToFalse;
+        if (t_visible) {
+          PropertyChange visibleChange = PropertyChange::ChangeToTrue;
+          if (!m_objectFilter(info->modelObject.get())) {
+            visibleChange = PropertyChange::ChangeToFalse;
 
-          // parent hidden, selector always hidden
-          visibleChanges.erase(
-            std::remove_if(visibleChanges.begin(), visibleChanges.end(),
-                           [location](std::pair<GridCellLocation*, PropertyChange> tmp) { return location->gridRow == tmp.first->gridRow; }),
-            visibleChanges.end());
+            // parent hidden, selector always hidden
+            visibleChanges.erase(visibleChanges.begin() + firstVisibleChange, visibleChanges.end());
+          }
+          visibleChanges.emplace_back(location, visibleChange);
         }
-        visibleChanges.emplace_back(location, visibleChange);
       }
     }
   }
-
-  // apply the changes in reverse order
-  std::reverse(visibleChanges.begin(), visibleChanges.end());
-  std::reverse(lockedChanges.begin(), lockedChanges.end());
-
-  updateRowsAndSubrows(visibleChanges, lockedChanges);
 }
 
 void OSObjectSelector::updateRowsAndSubrows(const std::vector<std::pair<GridCellLocation*, PropertyChange>>& visibleChanges,
@@ -476,83 +507,76 @@ void OSObjectSelector::updateRowsAndSubrows(const std::vector<std::pair<GridCell
 }
 
 void OSObjectSelector::setRowProperties(const int t_gridRow, PropertyChange t_visible, PropertyChange t_selected, PropertyChange t_locked) {
-  for (auto& locationInfoPair : m_gridCellLocationToInfoMap) {
-    if (locationInfoPair.first->gridRow == t_gridRow) {
-      bool changed = false;
-
-      if (t_visible == ChangeToFalse) {
-        changed = locationInfoPair.second->setVisible(false) || changed;
-      } else if (t_visible == ChangeToTrue) {
-        changed = locationInfoPair.second->setVisible(true) || changed;
-      } else if (t_visible == ToggleChange) {
-        changed = locationInfoPair.second->setVisible(!locationInfoPair.second->isVisible()) || changed;
-      }
-
-      if (t_selected == ChangeToFalse) {
-        changed = locationInfoPair.second->setSelected(false) || changed;
-      } else if (t_selected == ChangeToTrue) {
-        changed = locationInfoPair.second->setSelected(true) || changed;
-      } else if (t_selected == ToggleChange) {
-        changed = locationInfoPair.second->setSelected(!locationInfoPair.second->isSelected()) || changed;
-      }
-
-      if (t_locked == ChangeToFalse) {
-        changed = locationInfoPair.second->setLocked(false) || changed;
-      } else if (t_locked == ChangeToTrue) {
-        changed = locationInfoPair.second->setLocked(true) || changed;
-      } else if (t_locked == ToggleChange) {
-        changed = locationInfoPair.second->setLocked(!locationInfoPair.second->isLocked()) || changed;
-      }
-
-      if (changed) {
-        emit gridCellChanged(*locationInfoPair.first, *locationInfoPair.second);
-      }
-    }
+  for (auto* location : cellLocations(t_gridRow)) {
+    setCellProperties(location, t_visible, t_selected, t_locked);
   }
 }
 
 void OSObjectSelector::setSubrowProperties(const int t_gridRow, const int t_subrow, PropertyChange t_visible, PropertyChange t_selected,
                                            PropertyChange t_locked) {
-  for (auto& locationInfoPair : m_gridCellLocationToInfoMap) {
-    if (locationInfoPair.first->gridRow == t_gridRow && locationInfoPair.first->subrow == t_subrow) {
-      bool changed = false;
-
-      if (t_visible == ChangeToFalse) {
-        changed = locationInfoPair.second->setVisible(false) || changed;
-      } else if (t_visible == ChangeToTrue) {
-        changed = locationInfoPair.second->setVisible(true) || changed;
-      } else if (t_visible == ToggleChange) {
-        changed = locationInfoPair.second->setVisible(!locationInfoPair.second->isVisible()) || changed;
-      }
+  for (auto* location : cellLocations(t_gridRow)) {
+    if (location->subrow == t_subrow) {
+      setCellProperties(location, t_visible, t_selected, t_locked);
+    }
+  }
+}
 
-      if (t_selected == ChangeToFalse) {
-        changed = locationInfoPair.second->setSelected(false) || changed;
-      } else if (t_selected == ChangeToTrue) {
-        changed = locationInfoPair.second->setSelected(true) || changed;
-      } else if (t_selected == ToggleChange) {
-        changed = locationInfoPair.second->setSelected(!locationInfoPair.second->isSelected()) || changed;
-      }
+void OSObjectSelector::setCellProperties(GridCellLocation* location, PropertyChange t_visible, PropertyChange t_selected, PropertyChange t_locked) {
+  GridCellInfo* info = getGridCellInfo(location);
+  OS_ASSERT(info);
 
-      if (t_locked == ChangeToFalse) {
-        changed = locationInfoPair.second->setLocked(false) || changed;
-      } else if (t_locked == ChangeToTrue) {
-        changed = locationInfoPair.second->setLocked(true) || changed;
-      } else if (t_locked == ToggleChange) {
-        changed = locationInfoPair.second->setLocked(!locationInfoPair.second->isLocked()) || changed;
-      }
+  bool changed = false;
 
-      if (changed) {
-        emit gridCellChanged(*locationInfoPair.first, *locationInfoPair.second);
-      }
+  if (t_visible == ChangeToFalse) {
+    changed = info->setVisible(false) || changed;
+  } else if (t_visible == ChangeToTrue) {
+    changed = info->setVisible(true) || changed;
+  } else if (t_visible == ToggleChange) {
+    changed = info->setVisible(!info->isVisible()) || changed;
+  }
+
+  if (t_selected == ChangeToFalse) {
+    changed = info->setSelected(false) || changed;
+  } else if (t_selected == ChangeToTrue) {
+    changed = info->setSelected(true) || changed;
+  } else if (t_selected == ToggleChange) {
+    changed = info->setSelected(!info->isSelected()) || changed;
+  }
+
+  if (t_locked == ChangeToFalse) {
+    changed = info->setLocked(false) || changed;
+  } else if (t_locked == ChangeToTrue) {
+    changed = info->setLocked(true) || changed;
+  } else if (t_locked == ToggleChange) {
+    changed = info->setLocked(!info->isLocked()) || changed;
+  }
+
+  if (changed) {
+    if (m_batchDepth > 0) {
+      m_batchedCellLocations.insert(location);
+    } else {
+      emit gridCellChanged(*location, *info);
     }
   }
 }
 
 bool OSObjectSelector::getObjectSelected(const model::ModelObject& t_obj) const {
-  for (const auto& location : m_selectorCellLocations) {
+  for (const auto& location : selectorCellLocations(t_obj.handle())) {
     GridCellInfo* info = getGridCellInfo(location);
-    if (info && info->modelObject && info->modelObject.get() == t_obj) {
-      if (info->isSelected()) {
+    if (info && info->isSelected()) {
+      return true;
+    }
+  }
+  return false;
+}
+
+bool OSObjectSelector::hasSelectedCells(int t_firstGridRow, int t_lastGridRow) const {
+  auto it = m_gridRowToSelectorCellLocations.lower_bound(t_firstGridRow);
+  auto end = m_gridRowToSelectorCellLocations.upper_bound(t_lastGridRow);
+  for (; it != end; ++it) {
+    for (const auto& location : it->second) {
+      GridCellInfo* info = getGridCellInfo(location);
+      if (info && info->isSelected()) {
         return true;
       }
     }
@@ -564,22 +588,27 @@ void OSObjectSelector::setObjectSelected(const model::ModelObject& t_obj, bool t
   const PropertyChange visible = NoChange;
   const PropertyChange selected = (t_selected ? ChangeToTrue : ChangeToFalse);
   const PropertyChange locked = NoChange;
-  int numSelected = 0;
-  int numSelectable = 0;
-  for (auto& location : m_selectorCellLocations) {
+  for (auto& location : selectorCellLocations(t_obj.handle())) {
     GridCellInfo* info = getGridCellInfo(location);
-    if (info && info->isSelectable() && info->modelObject && info->modelObject.get() == t_obj) {
+    if (info && info->isSelectable()) {
       if (location->subrow) {
         setSubrowProperties(location->gridRow, location->subrow.get(), visible, selected, locked);
       } else {
         setRowProperties(location->gridRow, visible, selected, locked);
       }
     }
+  }
 
-    if (info && info->isSelectable()) {
-      numSelectable += 1;
-      if (info->isSelected()) {
-        numSelected += 1;
+  int numSelected = 0;
+  int numSelectable = 0;
+  for (const auto& rowLocations : m_gridRowToSelectorCellLocations) {
+    for (const auto& location : rowLocations.second) {
+      GridCellInfo* info = getGridCellInfo(location);
+      if (info && info->isSelectable()) {
+        numSelectable += 1;
+        if (info->isSelected()) {
+          numSelected += 1;
+        }
       }
     }
   }
@@ -589,7 +618,7 @@ void OSObjectSelector::setObjectSelected(const model::ModelObject& t_obj, bool t
 
 std::set<model::ModelObject> OSObjectSelector::selectorObjects() const {
   std::set<model::ModelObject> result;
-  for (const auto& location : m_selectorCellLocations) {
+  for (const auto& location : selectorCellLocations()) {
     GridCellInfo* info = getGridCellInfo(location);
     if (info && info->isSelector && info->modelObject) {
       result.insert(info->modelObject.get());
@@ -600,7 +629,7 @@ std::set<model::ModelObject> OSObjectSelector::selectorObjects() const {
 
 std::set<model::ModelObject> OSObjectSelector::selectableObjects() const {
   std::set<model::ModelObject> result;
-  for (const auto& location : m_selectorCellLocations) {
+  for (const auto& location : selectorCellLocations()) {
     GridCellInfo* info = getGridCellInfo(location);
     if (info && info->isSelectable() && info->modelObject) {
       result.insert(info->modelObject.get());
@@ -611,7 +640,7 @@ std::set<model::ModelObject> OSObjectSelector::selectableObjects() const {
 
 std::set<model::ModelObject> OSObjectSelector::selectedObjects() const {
   std::set<model::ModelObject> result;
-  for (const auto& location : m_selectorCellLocations) {
+  for (const auto& location : selectorCellLocations()) {
     GridCellInfo* info = getGridCellInfo(location);
     if (info && info->isSelected() && info->modelObject) {
       result.insert(info->modelObject.get());
@@ -639,40 +668,16 @@ void OSObjectSelector::setObjectFilter(const std::function<bool(const model::Mod
   std::vector<std::pair<GridCellLocation*, PropertyChange>> visibleChanges;
   std::vector<std::pair<GridCellLocation*, PropertyChange>> lockedChanges;
 
-  // loop over selector cells first
-  for (auto& location : m_selectorCellLocations) {
-    GridCellInfo* info = getGridCellInfo(location);
-    if (info && info->modelObject) {
-      PropertyChange visibleChange = PropertyChange::ChangeToFalse;
-      if (m_objectFilter(info->modelObject.get())) {
-        visibleChange = PropertyChange::ChangeToTrue;
-      }
-      visibleChanges.emplace_back(location, visibleChange);
-    }
-  }
-
-  // loop over parent cells second
-  for (auto& location : m_parentCellLocations) {
-    GridCellInfo* info = getGridCellInfo(location);
-    if (info && info->modelObject) {
-      PropertyChange visibleChange = PropertyChange::ChangeToTrue;
-      if (!m_objectFilter(info->modelObject.get())) {
-        visibleChange = PropertyChange::ChangeToFalse;
-
-        // parent hidden, selector always hidden
-        visibleChanges.erase(
-          std::remove_if(visibleChanges.begin(), visibleChanges.end(),
-                         [location](std::pair<GridCellLocation*, PropertyChange> tmp) { return location->gridRow == tmp.first->gridRow; }),
-          visibleChanges.end());
-      }
-      visibleChanges.emplace_back(location, visibleChange);
-    }
+  for (const auto& rowLocations : m_gridRowToCellLocations) {
+    appendRowChanges(boost::none, rowLocations.first, true, false, visibleChanges, lockedChanges);
   }
 
   // apply the changes in reverse order
   std::reverse(visibleChanges.begin(), visibleChanges.end());
 
+  beginBatch();
   updateRowsAndSubrows(visibleChanges, lockedChanges);
+  endBatch();
 }
 
 void OSObjectSelector::resetObjectFilter() {
@@ -698,46 +703,42 @@ void OSObjectSelector::setObjectIsLocked(const std::function<bool(const model::M
   std::vector<std::pair<GridCellLocation*, PropertyChange>> visibleChanges;
   std::vector<std::pair<GridCellLocation*, PropertyChange>> lockedChanges;
 
-  // loop over selector cells first
-  for (auto& location : m_selectorCellLocations) {
-    GridCellInfo* info = getGridCellInfo(location);
-    if (info && info->modelObject) {
-      PropertyChange lockedChange = PropertyChange::NoChange;
-      if (m_isLocked(info->modelObject.get())) {
-        lockedChange = PropertyChange::ChangeToTrue;
-      }
-      lockedChanges.emplace_back(location, lockedChange);
-    }
-  }
-
-  // loop over parent cells second
-  for (auto& location : m_parentCellLocations) {
-    GridCellInfo* info = getGridCellInfo(location);
-    if (info && info->modelObject) {
-      PropertyChange lockedChange = PropertyChange::NoChange;
-      if (m_isLocked(info->modelObject.get())) {
-        lockedChange = PropertyChange::ChangeToTrue;
-
-        // parent locked, selector always locked
-        lockedChanges.erase(
-          std::remove_if(lockedChanges.begin(), lockedChanges.end(),
-                         [location](std::pair<GridCellLocation*, PropertyChange> tmp) { return location->gridRow == tmp.first->gridRow; }),
-          lockedChanges.end());
-      }
-      lockedChanges.emplace_back(location, lockedChange);
-    }
+  for (const auto& rowLocations : m_gridRowToCellLocations) {
+    appendRowChanges(boost::none, rowLocations.first, false, true, visibleChanges, lockedChanges);
   }
 
   // apply the changes in reverse order
   std::reverse(lockedChanges.begin(), lockedChanges.end());
 
+  beginBatch();
   updateRowsAndSubrows(visibleChanges, lockedChanges);
+  endBatch();
 }
 
 void OSObjectSelector::resetObjectIsLocked() {
   setObjectIsLocked(getDefaultIsLocked());
 }
 
+void OSObjectSelector::beginBatch() {
+  ++m_batchDepth;
+}
+
+void OSObjectSelector::endBatch() {
+  OS_ASSERT(m_batchDepth > 0);
+  if (--m_batchDepth > 0 || m_batchedCellLocations.empty()) {
+    return;
+  }
+
+  std::vector<std::pair<const GridCellLocation*, const GridCellInfo*>> changes;
+  changes.reserve(m_batchedCellLocations.size());
+  for (auto* location : m_batchedCellLocations) {
+    changes.emplace_back(location, getGridCellInfo(location));
+  }
+  m_batchedCellLocations.clear();
+
+  emit gridCellsChanged(changes);
+}
+
 /*
 void OSObjectSelector::applyLocks() {
   std::set<int> gridRowsToLock;
@@ -793,6 +794,64 @@ GridCellInfo* OSObjectSelector::getGridCellInfo(GridCellLocation* location) cons
   return result;
 }
 
+std::vector<GridCellLocation*> OSObjectSelector::cellLocations(int t_gridRow) const {
+  auto it = m_gridRowToCellLocations.find(t_gridRow);
+  if (it != m_gridRowToCellLocations.end()) {
+    return it->second;
+  }
+  return {};
+}
+
+std::vector<GridCellLocation*> OSObjectSelector::selectorCellLocations() const {
+  std::vector<GridCellLocation*> result;
+  for (const auto& rowLocations : m_gridRowToSelectorCellLocations) {
+    result.insert(result.end(), rowLocations.second.begin(), rowLocations.second.end());
+  }
+  return result;
+}
+
+std::vector<GridCellLocation*> OSObjectSelector::selectorCellLocations(const openstudio::Handle& handle) const {
+  auto it = m_handleToSelectorCellLocations.find(handle);
+  if (it != m_handleToSelectorCellLocations.end()) {
+    return it->second;
+  }
+  return {};
+}
+
+std::vector<GridCellLocation*> OSObjectSelector::parentCellLocations() const {
+  std::vector<GridCellLocation*> result;
+  for (const auto& rowLocations : m_gridRowToParentCellLocations) {
+    result.insert(result.end(), rowLocations.second.begin(), rowLocations.second.end());
+  }
+  return result;
+}
+
+void OSObjectSelector::removeCell(GridCellLocation* location) {
+  auto it = m_gridCellLocationToInfoMap.find(location);
+  OS_ASSERT(it != m_gridCellLocationToInfoMap.end());
+  GridCellInfo* info = it->second;
+
+  eraseFromRowIndex(m_gridRowToCellLocations, location);
+  eraseFromRowIndex(m_gridRowToSelectorCellLocations, location);
+  eraseFromRowIndex(m_gridRowToParentCellLocations, location);
+
+  if (info->isSelector && info->modelObject) {
+    auto handleIt = m_handleToSelectorCellLocations.find(info->modelObject->handle());
+    if (handleIt != m_handleToSelectorCellLocations.end()) {
+      handleIt->second.erase(std::remove(handleIt->second.begin(), handleIt->second.end(), location), handleIt->second.end());
+      if (handleIt->second.empty()) {
+        m_handleToSelectorCellLocations.erase(handleIt);
+      }
+    }
+  }
+
+  m_batchedCellLocations.erase(location);
+
+  m_gridCellLocationToInfoMap.erase(it);
+  delete location;
+  delete info;
+}
+
 std::function<bool(const model::ModelObject&)> OSObjectSelector::getDefaultFilter() {
   return [](const model::ModelObject&) { return true; };
 }
@@ -37,6 +37,8 @@
 
 #include <string>
 #include <functional>
+#include <map>
+#include <set>
 #include <vector>
 
 #include <QObject>
@@ -56,8 +58,9 @@ class GridCellLocation : public QObject
 
   virtual ~GridCellLocation();
 
-  const int modelRow;
-  const int gridRow;
+  // rows are updated by OSObjectSelector::removeRow when a row above is removed
+  int modelRow;
+  int gridRow;
   const int column;
   const boost::optional<int> subrow;
 
@@ -137,6 +140,9 @@ class OSObjectSelector : public QObject
 
   // Reset all state in a cell
   void clearCell(int t_modelRow, int t_gridRow, int t_column);
+
+  // Reset all state in a row and move the rows below it up by one
+  void removeRow(int t_gridRow);
   void clearSubCell(int t_modelRow, int t_gridRow, int t_column, int t_subrow);
 
   // Adds object to the internal maps
@@ -165,6 +171,9 @@ class OSObjectSelector : public QObject
   // Check if an object is selected
   bool getObjectSelected(const model::ModelObject& t_obj) const;
 
+  // Check if any cell between the two grid rows (inclusive) is selected
+  bool hasSelectedCells(int t_firstGridRow, int t_lastGridRow) const;
+
   // Set a selectable object as selected
   void setObjectSelected(const model::ModelObject& t_obj, bool t_selected);
 
@@ -198,12 +207,18 @@ class OSObjectSelector : public QObject
   // Applies locks to entire rows and subrows
   //void applyLocks();
 
+  // Hold back gridCellChanged until the matching endBatch, each changed cell is then reported once through gridCellsChanged
+  void beginBatch();
+  void endBatch();
+
  signals:
 
   void inFocus(bool inFocus, bool hasData, int modelRow, int gridRow, int column, boost::optional<int> subrow);
 
   void gridCellChanged(const GridCellLocation& location, const GridCellInfo& info);
 
+  void gridCellsChanged(const std::vector<std::pair<const GridCellLocation*, const GridCellInfo*>>& changes);
+
   void gridRowSelectionChanged(int numSelected, int numSelectable);
 
  public slots:
@@ -219,13 +234,41 @@ class OSObjectSelector : public QObject
 
   std::map<GridCellLocation*, GridCellInfo*> m_gridCellLocationToInfoMap;
 
+  // all cells indexed by grid row, in the order they were added, performance optimization
+  std::map<int, std::vector<GridCellLocation*>> m_gridRowToCellLocations;
+
   // selector cells are the ones with checkboxes, performance optimization
-  std::vector<GridCellLocation*> m_selectorCellLocations;
+  std::map<int, std::vector<GridCellLocation*>> m_gridRowToSelectorCellLocations;
 
   // parent cells are the first column in a row that has sub rows, performance optimization
-  std::vector<GridCellLocation*> m_parentCellLocations;
+  std::map<int, std::vector<GridCellLocation*>> m_gridRowToParentCellLocations;
+
+  // selector cells indexed by the handle of their object, performance optimization
+  std::map<openstudio::Handle, std::vector<GridCellLocation*>> m_handleToSelectorCellLocations;
+
+  // cells changed since beginBatch
+  int m_batchDepth = 0;
+  std::set<GridCellLocation*> m_batchedCellLocations;
 
-  std::vector<GridCellLocation*> m_selectorOrParentCellLocations;
+  // Cells in a grid row
+  std::vector<GridCellLocation*> cellLocations(int t_gridRow) const;
+
+  // Selector cells in grid row order
+  std::vector<GridCellLocation*> selectorCellLocations() const;
+
+  // Selector cells referencing an object
+  std::vector<GridCellLocation*> selectorCellLocations(const openstudio::Handle& handle) const;
+
+  // Parent cells in grid row order
+  std::vector<GridCellLocation*> parentCellLocations() const;
+
+  // Remove a cell from all the indexes and delete it
+  void removeCell(GridCellLocation* location);
+
+  // Compute the visible and locked changes for the selector and parent cells of a row, optionally restricted to a model row
+  void appendRowChanges(const boost::optional<int>& t_modelRow, int t_gridRow, bool t_visible, bool t_locked,
+                        std::vector<std::pair<GridCellLocation*, PropertyChange>>& visibleChanges,
+                        std::vector<std::pair<GridCellLocation*, PropertyChange>>& lockedChanges) const;
 
   // Apply locked and not visible properties to rows and subrows
   void updateRowsAndSubrows(const std::vector<std::pair<GridCellLocation*, PropertyChange>>& visibleChanges,
@@ -237,6 +280,9 @@ class OSObjectSelector : public QObject
   // Set a subrow as selected
   void setSubrowProperties(const int t_gridRow, const int t_subrow, PropertyChange t_visible, PropertyChange t_selected, PropertyChange t_locked);
 
+  // Set a single cell as selected
+  void setCellProperties(GridCellLocation* location, PropertyChange t_visible, PropertyChange t_selected, PropertyChange t_locked);
+
   GridCellInfo* getGridCellInfo(GridCellLocation* location) const;
 
   // returns true if object is visible
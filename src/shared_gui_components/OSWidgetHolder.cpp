@@ -139,6 +139,15 @@ void OSWidgetHolder::setCellProperties(const GridCellLocation& location, const G
   }
 }
 
+void OSWidgetHolder::setEven(bool isEven) {
+  if (m_isEven != isEven) {
+    m_isEven = isEven;
+    this->setProperty("even", m_isEven);
+    this->style()->unpolish(this);
+    this->style()->polish(this);
+  }
+}
+
 void OSWidgetHolder::paintEvent(QPaintEvent*) {
   QStyleOption opt;
   opt.initFrom(this);
@@ -52,6 +52,8 @@ class OSWidgetHolder : public QWidget
 
   void setCellProperties(const GridCellLocation& location, const GridCellInfo& info);
 
+  void setEven(bool isEven);
+
  protected:
   void paintEvent(QPaintEvent* event) override;
 
@@ -44,7 +44,6 @@
 #include <openstudio/utilities/core/Assert.hpp>
 #include <openstudio/utilities/core/Compare.hpp>
 #include <openstudio/utilities/core/Containers.hpp>
-#include <openstudio/utilities/core/RubyException.hpp>
 #include <openstudio/utilities/core/PathHelpers.hpp>
 #include <openstudio/utilities/bcl/BCLMeasure.hpp>
 #include <openstudio/utilities/filetypes/WorkflowStep_Impl.hpp>
@@ -252,24 +251,35 @@ void MeasureStepController::addItemForDroppedMeasure(QDropEvent* event) {
     return;
   }
 
+  // the step is added once arguments are computed, the document stays disabled in the meantime
+  std::weak_ptr<OSDocument> weakDocument = document;
+  m_app->measureManager()
+    .computeArgumentsAsync(*projectMeasure)
+    .then(this,
+          [this, weakDocument, bclMeasure = *projectMeasure](const std::vector<measure::OSArgument>& /*arguments*/) {
+            addItemForMeasure(bclMeasure);
+            if (std::shared_ptr<OSDocument> document = weakDocument.lock()) {
+              document->enable();
+            }
+          })
+    .onFailed(this, [this, weakDocument](const std::exception& e) {
+      QString errorMessage("Failed to compute arguments for measure: \n\n");
+      errorMessage += QString::fromStdString(e.what());
+      QMessageBox::information(m_app->mainWidget(), QString("Failed to add measure"), errorMessage);
+
+      if (std::shared_ptr<OSDocument> document = weakDocument.lock()) {
+        document->enable();
+      }
+    });
+}
+
+void MeasureStepController::addItemForMeasure(const BCLMeasure& projectMeasure) {
   // Since we set the measure_paths, we only neeed to reference the name of the directory (=last level directory name)
   // eg: /path/to/measure_folder => measure_folder
-  MeasureStep measureStep(toString(getLastLevelDirectoryName(projectMeasure->directory())));
-  try {
-    /* std::vector<measure::OSArgument> arguments = */ m_app->measureManager().getArguments(*projectMeasure);
-  } catch (const RubyException& e) {
-    QString errorMessage("Failed to compute arguments for measure: \n\n");
-    errorMessage += QString::fromStdString(e.what());
-    QMessageBox::information(m_app->mainWidget(), QString("Failed to add measure"), errorMessage);
-
-    if (document) {
-      document->enable();
-    }
-    return;
-  }
+  MeasureStep measureStep(toString(getLastLevelDirectoryName(projectMeasure.directory())));
 
   // the new measure
-  std::string name = m_app->measureManager().suggestMeasureName(*projectMeasure);
+  std::string name = m_app->measureManager().suggestMeasureName(projectMeasure);
   // DLM: moved to WorkflowStepResult
   //measureStep.setMeasureId(projectMeasure->uid());
   //measureStep.setVersionId(projectMeasure->versionId());
@@ -279,8 +289,8 @@ void MeasureStepController::addItemForDroppedMeasure(QDropEvent* event) {
   //}
   measureStep.setName(name);
   //measureStep.setDisplayName(name); // DLM: TODO
-  measureStep.setDescription(projectMeasure->description());
-  measureStep.setModelerDescription(projectMeasure->modelerDescription());
+  measureStep.setDescription(projectMeasure.description());
+  measureStep.setModelerDescription(projectMeasure.modelerDescription());
 
   WorkflowJSON workflowJSON = m_app->currentModel()->workflowJSON();
 
@@ -291,10 +301,6 @@ void MeasureStepController::addItemForDroppedMeasure(QDropEvent* event) {
 
   //workflowJSON.save();
 
-  if (document) {
-    document->enable();
-  }
-
   emit modelReset();
 }
 
@@ -418,9 +424,18 @@ OptionalBCLMeasure MeasureStepItem::bclMeasure() const {
 std::vector<measure::OSArgument> MeasureStepItem::arguments() const {
   std::vector<measure::OSArgument> result;
 
-  // get arguments from the BCL Measure (computed using the current model)
+  if (isComputingArguments()) {
+    return result;
+  }
+
+  // get arguments from the BCL Measure (computed using the current model), cached arguments are ready right away
   if (auto bclMeasure_ = this->bclMeasure()) {
-    result = m_app->measureManager().getArguments(bclMeasure_.get());
+    QFuture<std::vector<measure::OSArgument>> computed = m_app->measureManager().computeArgumentsAsync(bclMeasure_.get());
+    if (!computed.isFinished()) {
+      const_cast<MeasureStepItem*>(this)->watchArguments(computed);
+      return result;
+    }
+    result = computed.result();
   }
 
   // fill in with any arguments in this WorkflowJSON
@@ -444,6 +459,26 @@ std::vector<measure::OSArgument> MeasureStepItem::arguments() const {
   return result;
 }
 
+bool MeasureStepItem::isComputingArguments() const {
+  return m_pendingArguments.isValid() && !m_pendingArguments.isFinished();
+}
+
+void MeasureStepItem::watchArguments(QFuture<std::vector<measure::OSArgument>> arguments) {
+  m_pendingArguments = arguments;
+  arguments
+    .then(this,
+          [this](const std::vector<measure::OSArgument>& /*arguments*/) {
+            m_pendingArguments = {};
+            emit argumentsComputed();
+            emit argumentsChanged(hasIncompleteArguments());
+          })
+    .onFailed(this, [this]() {
+      // the error is logged by the measure manager, the step cannot be run until its arguments are computed
+      m_pendingArguments = {};
+      emit argumentsChanged(true);
+    });
+}
+
 bool MeasureStepItem::hasIncompleteArguments() const {
   return (!incompleteArguments().empty());
 }
@@ -36,6 +36,7 @@
 #include <openstudio/utilities/bcl/BCLMeasure.hpp>
 #include <openstudio/utilities/core/Logger.hpp>
 #include <openstudio/utilities/filetypes/WorkflowStep.hpp>
+#include <QFuture>
 #include <QObject>
 #include <QSharedPointer>
 #include <map>
@@ -153,6 +154,9 @@ class MeasureStepController : public WorkflowStepController
  private:
   void addItem(QSharedPointer<OSListItem> item);
 
+  // Appends a step for a measure already in the project, its arguments must have been computed
+  void addItemForMeasure(const BCLMeasure& projectMeasure);
+
   MeasureType m_measureType;
   BaseApp* m_app;
 
@@ -196,9 +200,12 @@ class MeasureStepItem : public OSListItem
 
   OptionalBCLMeasure bclMeasure() const;
 
-  // arguments includes the full list of arguments calculated for the given model along with any values specified in the OSW
+  // arguments includes the full list of arguments calculated for the given model along with any values specified in the OSW.
+  // Empty while the measure manager computes them, argumentsComputed is emitted once they are available
   std::vector<measure::OSArgument> arguments() const;
 
+  bool isComputingArguments() const;
+
   bool hasIncompleteArguments() const;
 
   std::vector<measure::OSArgument> incompleteArguments() const;
@@ -231,10 +238,15 @@ class MeasureStepItem : public OSListItem
 
   void argumentsChanged(bool isIncomplete);
 
+  void argumentsComputed();
+
  private:
+  void watchArguments(QFuture<std::vector<measure::OSArgument>> arguments);
+
   MeasureType m_measureType;
   MeasureStep m_step;
   BaseApp* m_app;
+  QFuture<std::vector<measure::OSArgument>> m_pendingArguments;
 };
 
 }  // namespace measuretab